@@ -162,7 +162,10 @@ bool LifeCycleImpl::StartComponents() {
 // Adapters
 #ifdef TELEMETRY_MONITOR
   telemetry_monitor_ = new telemetry_monitor::TelemetryMonitor(
-      profile_.server_address(), profile_.time_testing_port());
+      profile_.server_address(),
+      profile_.time_testing_port(),
+      profile_.telemetry_statistics_socket(),
+      profile_.telemetry_statistics_period());
   telemetry_monitor_->Start();
   telemetry_monitor_->Init(protocol_handler_, app_manager_, transport_manager_);
 #endif  // TELEMETRY_MONITOR
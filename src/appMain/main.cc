@@ -52,6 +52,7 @@
 #include "utils/logger/boostlogger.h"
 #endif  // LOG4CXX_LOGGER
 
+#include "utils/logger/binary_log.h"
 #include "utils/logger/logger_impl.h"
 #endif  // ENABLE_LOG
 
@@ -162,6 +163,22 @@ int32_t main(int32_t argc, char** argv) {
 #endif  // LOG4CXX_LOGGER
 
     logger_impl->Init(std::move(logger));
+
+    const std::string& binary_log_file_name =
+        profile_instance.binary_log_file_name();
+    if (!binary_log_file_name.empty()) {
+      auto binary_log = std::unique_ptr<logger::BinaryLog>(
+          new logger::BinaryLog(binary_log_file_name,
+                                64 * 1024,
+                                100,
+                                profile_instance.binary_log_max_file_size()));
+      if (binary_log->Init()) {
+        logger_impl->InitBinaryLog(std::move(binary_log));
+      } else {
+        SDL_LOG_ERROR("Failed to create binary log " << binary_log_file_name
+                                                     << ", text log is used");
+      }
+    }
   }
 #endif
 
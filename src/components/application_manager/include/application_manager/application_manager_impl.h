@@ -1307,7 +1307,7 @@ class ApplicationManagerImpl
    * @param connection_key connection key of app, which provided app list to
    * be created
    */
-  void CreateApplications(smart_objects::SmartArray& obj_array,
+  void CreateApplications(const smart_objects::SmartArray& obj_array,
                           const uint32_t connection_key);
 
   /*
@@ -33,13 +33,9 @@
 #ifndef SRC_COMPONENTS_APPLICATION_MANAGER_INCLUDE_APPLICATION_MANAGER_EVENT_ENGINE_EVENT_DISPATCHER_IMPL_H_
 #define SRC_COMPONENTS_APPLICATION_MANAGER_INCLUDE_APPLICATION_MANAGER_EVENT_ENGINE_EVENT_DISPATCHER_IMPL_H_
 
-#include <map>
-#include <vector>
-
-#include "utils/lock.h"
-
 #include "application_manager/event_engine/event.h"
 #include "application_manager/event_engine/event_dispatcher.h"
+#include "application_manager/event_engine/observer_registry.h"
 
 namespace application_manager {
 namespace event_engine {
@@ -48,12 +44,6 @@ class EventObserver;
 
 class EventDispatcherImpl : public EventDispatcher {
  public:
-  // Data types section
-  typedef std::vector<EventObserver*> ObserverVector;
-  typedef std::map<int32_t, ObserverVector> ObserversMap;
-  typedef std::map<Event::EventID, ObserversMap> EventObserverMap;
-  typedef std::map<MobileEvent::MobileEventID, ObserversMap>
-      MobileEventObserverMap;
   /*
    * @brief Destructor
    */
@@ -65,15 +55,12 @@ class EventDispatcherImpl : public EventDispatcher {
   EventDispatcherImpl();
 
 #ifdef BUILD_TESTS
-  EventObserverMap get_observers() const {
-    return observers_event_;
-  }
-  MobileEventObserverMap get_mobile_observers() const {
-    return mobile_observers_event_;
-  }
-  ObserverVector get_observers_list() const {
+  const ObserverRegistry& get_observers() const {
     return observers_;
   }
+  const ObserverRegistry& get_mobile_observers() const {
+    return mobile_observers_;
+  }
 #endif  // BUILD_TESTS
 
   /*
@@ -83,6 +70,12 @@ class EventDispatcherImpl : public EventDispatcher {
    */
   void raise_event(const Event& event) OVERRIDE;
 
+  /*
+   * @brief Unsubscribes all observers from event with specific correlation ID
+   *
+   * @param event_id    The event ID to unsubscribe from
+   * @param hmi_correlation_id  The event HMI correlation ID
+   */
   void remove_observer(const Event::EventID& event_id,
                        const int32_t hmi_correlation_id) OVERRIDE;
 
@@ -149,32 +142,12 @@ class EventDispatcherImpl : public EventDispatcher {
   void remove_mobile_observer(EventObserver& observer) OVERRIDE;
 
  private:
-  /*
-   * @brief removes observer
-   * when occurs unsubscribe from event
-   * @param observer to be removed
-   */
-  void remove_observer_from_vector(EventObserver& observer);
-
-  /*
-   * @brief removes observer
-   * when occurs unsubscribe from event
-   * @param observer to be removed
-   */
-  void remove_mobile_observer_from_vector(EventObserver& observer);
-
   DISALLOW_COPY_AND_ASSIGN(EventDispatcherImpl);
 
  private:
   // Members section
-  sync_primitives::Lock state_lock_;
-  sync_primitives::Lock mobile_state_lock_;
-  sync_primitives::RecursiveLock observer_lock_;
-  sync_primitives::RecursiveLock mobile_observer_lock_;
-  EventObserverMap observers_event_;
-  MobileEventObserverMap mobile_observers_event_;
-  ObserverVector observers_;
-  ObserverVector mobile_observers_;
+  ObserverRegistry observers_;
+  ObserverRegistry mobile_observers_;
 };
 
 }  // namespace event_engine
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_COMPONENTS_APPLICATION_MANAGER_INCLUDE_APPLICATION_MANAGER_EVENT_ENGINE_OBSERVER_REGISTRY_H_
+#define SRC_COMPONENTS_APPLICATION_MANAGER_INCLUDE_APPLICATION_MANAGER_EVENT_ENGINE_OBSERVER_REGISTRY_H_
+
+#include <stdint.h>
+#include <unordered_map>
+
+#include "utils/lock.h"
+#include "utils/macro.h"
+
+namespace application_manager {
+namespace event_engine {
+
+class EventObserver;
+
+/*
+ * @brief Index of observers subscribed by event ID and correlation ID.
+ * Observers of the same key are kept in subscription order, each
+ * subscription is also linked into the list of its observer, so
+ * unsubscribing never scans other keys. Keys without observers are erased.
+ * Thread-safe class
+ */
+class ObserverRegistry {
+ public:
+  ObserverRegistry();
+  ~ObserverRegistry();
+
+  /*
+   * @brief Subscribes the observer to key
+   *
+   * @param event_id        The event ID to subscribe for
+   * @param correlation_id  The event correlation ID
+   * @param observer        The observer to subscribe for event
+   */
+  void Add(const int32_t event_id,
+           const int32_t correlation_id,
+           EventObserver& observer);
+
+  /*
+   * @brief Unsubscribes all observers from key
+   *
+   * @param event_id        The event ID to unsubscribe from
+   * @param correlation_id  The event correlation ID
+   */
+  void Remove(const int32_t event_id, const int32_t correlation_id);
+
+  /*
+   * @brief Unsubscribes the observer from event with any correlation ID
+   *
+   * @param event_id  The event ID to unsubscribe from
+   * @param observer  The observer to be unsubscribed
+   */
+  void Remove(const int32_t event_id, EventObserver& observer);
+
+  /*
+   * @brief Unsubscribes the observer from all events
+   *
+   * @param observer  The observer to be unsubscribed
+   */
+  void Remove(EventObserver& observer);
+
+  /*
+   * @brief Calls handler for each observer subscribed to key at the moment
+   * of call. Lock is released while handler runs, so handler may subscribe
+   * and unsubscribe freely. Observers subscribed meanwhile are not called,
+   * unsubscribed ones are not called anymore
+   *
+   * @param event_id        The event ID
+   * @param correlation_id  The event correlation ID
+   * @param handler         Functor accepting EventObserver&
+   */
+  template <typename Handler>
+  void ForEach(const int32_t event_id,
+               const int32_t correlation_id,
+               Handler handler);
+
+  /*
+   * @brief Gets amount of keys having at least one subscription
+   */
+  size_t keys_count() const;
+
+  /*
+   * @brief Gets amount of observers having at least one subscription
+   */
+  size_t observers_count() const;
+
+ private:
+  struct Key {
+    Key(const int32_t event_id, const int32_t correlation_id);
+    bool operator==(const Key& other) const;
+
+    int32_t event_id;
+    int32_t correlation_id;
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  struct Subscription;
+
+  struct Bucket {
+    explicit Bucket(const Key& key);
+
+    Key key;
+    Subscription* head;
+    Subscription* tail;
+  };
+
+  typedef std::unordered_map<Key, Bucket, KeyHash> Buckets;
+  typedef std::unordered_map<const EventObserver*, Subscription*> Observers;
+
+  /*
+   * @brief Unlinks subscription from its observer and releases it unless
+   * some ForEach call is currently standing on it.
+   * Not thread-safe
+   */
+  void RemoveSubscription(Subscription* subscription);
+
+  /*
+   * @brief Unlinks subscription from its key and deletes it.
+   * Not thread-safe
+   */
+  void ReleaseSubscription(Subscription* subscription);
+
+  /*
+   * @brief Finds first subscription of key to be called and pins it.
+   * Not thread-safe
+   * @param last_sequence Sequence number of last subscription to be called
+   */
+  Subscription* PinFirst(const Key& key, const uint64_t last_sequence);
+
+  /*
+   * @brief Unpins subscription and pins the next one to be called.
+   * Not thread-safe
+   * @param last_sequence Sequence number of last subscription to be called
+   */
+  Subscription* PinNext(Subscription* subscription,
+                        const uint64_t last_sequence);
+
+  /*
+   * @brief Skips subscriptions which are removed or were added after the
+   * ForEach call has started, pins the found one.
+   * Not thread-safe
+   */
+  Subscription* PinLive(Subscription* subscription,
+                        const uint64_t last_sequence);
+
+  static EventObserver& observer_of(const Subscription* subscription);
+
+  mutable sync_primitives::Lock lock_;
+  Buckets buckets_;
+  Observers observers_;
+  uint64_t sequence_;
+
+  DISALLOW_COPY_AND_ASSIGN(ObserverRegistry);
+};
+
+template <typename Handler>
+void ObserverRegistry::ForEach(const int32_t event_id,
+                               const int32_t correlation_id,
+                               Handler handler) {
+  sync_primitives::AutoLock auto_lock(lock_);
+  const uint64_t last_sequence = sequence_;
+  for (Subscription* subscription =
+           PinFirst(Key(event_id, correlation_id), last_sequence);
+       subscription;
+       subscription = PinNext(subscription, last_sequence)) {
+    EventObserver& observer = observer_of(subscription);
+    sync_primitives::AutoUnlock auto_unlock(auto_lock);
+    handler(observer);
+  }
+}
+
+}  // namespace event_engine
+}  // namespace application_manager
+
+#endif  // SRC_COMPONENTS_APPLICATION_MANAGER_INCLUDE_APPLICATION_MANAGER_EVENT_ENGINE_OBSERVER_REGISTRY_H_
@@ -33,17 +33,17 @@
 #ifndef SRC_COMPONENTS_APPLICATION_MANAGER_INCLUDE_APPLICATION_MANAGER_REQUEST_CONTROLLER_IMPL_H_
 #define SRC_COMPONENTS_APPLICATION_MANAGER_INCLUDE_APPLICATION_MANAGER_REQUEST_CONTROLLER_IMPL_H_
 
+#include <atomic>
 #include <climits>
 #include <list>
-#include <vector>
+#include <memory>
+#include <unordered_map>
 
+#include "utils/date_time.h"
 #include "utils/lock.h"
-
-#include "utils/conditional_variable.h"
-#include "utils/threads/async_runner.h"
-#include "utils/threads/thread.h"
-#include "utils/threads/thread_delegate.h"
+#include "utils/threads/work_stealing_executor.h"
 #include "utils/timer.h"
+#include "utils/timer_wheel.h"
 
 #include "interfaces/HMI_API.h"
 #include "interfaces/MOBILE_API.h"
@@ -58,7 +58,7 @@ namespace application_manager {
 
 namespace request_controller {
 
-class RequestControllerImpl : public RequestController, threads::AsyncRunner {
+class RequestControllerImpl : public RequestController {
  public:
   /**
    * @brief Class constructor
@@ -133,24 +133,49 @@ class RequestControllerImpl : public RequestController, threads::AsyncRunner {
 
   bool IsLowVoltage() OVERRIDE;
 
+  /**
+   * @brief Gets queue depth and latency metrics of request processing
+   */
+  threads::WorkStealingExecutor::Statistics GetExecutorStatistics() const;
+
  protected:
   /**
-   * @brief Timer callback which handles all request timeouts
+   * @brief Initializes and runs mobile request, called on executor worker.
+   * Requests of the same application are processed one by one
+   * @param request Request to process
+   */
+  void ProcessMobileRequest(const RequestPtr request);
+
+  /**
+   * @brief Arms timeout timer of request to its current end time,
+   * re-arms it if request already has one
+   * @param request_info Request waiting for response
    */
-  void TimeoutThread();
+  void ScheduleTimeout(const RequestInfoPtr request_info);
 
   /**
-   * @brief Signal timer condition variable
+   * @brief Stops and deletes timeout timer of finished request
+   * @param request_info Request not waiting for response anymore
    */
-  void NotifyTimer();
+  void CancelTimeout(const RequestInfoPtr request_info);
+
+  /**
+   * @brief Stops and deletes timeout timers of requests
+   * @param mobile_only Keep timers of HMI requests
+   */
+  void CancelTimeouts(const bool mobile_only);
+
+  /**
+   * @brief Handles request timeout unless request has already been finished
+   * @param request_info Request waiting for response
+   */
+  void OnRequestTimeout(const std::weak_ptr<RequestInfo> request_info);
 
   void TerminateWaitingForExecutionAppRequests(const uint32_t app_id);
   void TerminateWaitingForResponseAppRequests(const uint32_t app_id);
 
   /**
-   * @brief Starts a new async task for cleaning up the provided requests
-   * references
-   * and perform the rest of cleanup actions for each request
+   * @brief Releases the provided requests references after a short delay
    * @param requests list of requests to cleanup
    */
   typedef std::list<RequestInfoPtr> RequestInfoPtrs;
@@ -176,40 +201,14 @@ class RequestControllerImpl : public RequestController, threads::AsyncRunner {
   bool CheckPendingRequestsAmount(const uint32_t pending_requests_amount);
 
  private:
-  class Worker : public threads::ThreadDelegate {
-   public:
-    explicit Worker(RequestControllerImpl* request_controller);
-    virtual ~Worker();
-    virtual void threadMain();
-    virtual void exitThreadMain();
-
-   protected:
-   private:
-    RequestControllerImpl* request_controller_;
-    sync_primitives::Lock thread_lock_;
-    volatile bool stop_flag_;
-  };
+  class TimeoutTask;
 
-  class RequestCleanerDelegate : public threads::ThreadDelegate {
-   public:
-    explicit RequestCleanerDelegate(const RequestInfoPtrs& requests);
-    ~RequestCleanerDelegate();
-    void threadMain() OVERRIDE;
-    void exitThreadMain() OVERRIDE;
-
-   private:
-    sync_primitives::Lock state_lock_;
-    sync_primitives::ConditionalVariable state_cond_;
-    RequestInfoPtrs requests_;
+  struct RequestTimeout {
+    std::weak_ptr<RequestInfo> request_info;
+    std::unique_ptr<timer::Timer> timer;
   };
 
-  std::vector<threads::Thread*> pool_;
   volatile TPoolState pool_state_;
-  uint32_t pool_size_;
-  sync_primitives::ConditionalVariable cond_var_;
-
-  std::list<RequestPtr> mobile_request_list_;
-  sync_primitives::Lock mobile_request_list_lock_;
 
   /**
    * @brief Requests, that are waiting for responses
@@ -242,23 +241,31 @@ class RequestControllerImpl : public RequestController, threads::AsyncRunner {
   std::map<uint32_t, uint32_t> duplicate_message_count_;
   sync_primitives::Lock duplicate_message_count_lock_;
 
-  /*
-   * timer for checking requests timeout
-   */
-  timer::Timer timer_;
-
-  /*
-   * Timer for lock
-   */
-  bool timer_stop_flag_;
-  sync_primitives::Lock timer_lock;
-  sync_primitives::ConditionalVariable timer_condition_;
-
   bool is_low_voltage_;
   const RequestControlerSettings& settings_;
 
   RequestTimeoutHandler& request_timeout_handler_;
   event_engine::EventDispatcher& event_dispatcher_;
+
+  /**
+   * @brief Runs request timeouts one by one on a thread of its own, so
+   * they are neither delayed by nor counted as pending requests
+   */
+  timer::TimerWheel timeout_wheel_;
+  std::unordered_map<const RequestInfo*, RequestTimeout> timeouts_;
+  sync_primitives::Lock timeouts_lock_;
+
+  /**
+   * @brief Amount of mobile requests posted to executor_ and not started
+   */
+  std::atomic<size_t> pending_requests_count_;
+
+  /**
+   * @brief Runs mobile requests and cleanups with per application
+   * ordering. Declared last to be destroyed first as its pending tasks
+   * refer to other members
+   */
+  threads::WorkStealingExecutor executor_;
   DISALLOW_COPY_AND_ASSIGN(RequestControllerImpl);
 };
 
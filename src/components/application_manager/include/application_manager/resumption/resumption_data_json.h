@@ -176,55 +176,33 @@ class ResumptionDataJson : public ResumptionData {
   void Persist() OVERRIDE;
 
  private:
-  /**
-   * @brief GetFromSavedOrAppend allows to get existed record about application
-   * or adds the new one.
-   * @param policy_app_id application id.
-   * @param device_id unique id of device.
-   * @param dictionary - data dictionary where all necessary info stored
-   * @return the reference to the record in applications array.
-   */
-  Json::Value& GetFromSavedOrAppend(const std::string& policy_app_id,
-                                    const std::string& device_id,
-                                    Json::Value& dictionary) const;
-
   /**
    * @brief Get applications for resumption of LastState
    * @param dictionary - data dictionary where all necessary info stored
-   * @return applications for resumption of LastState
+   * @return applications for resumption of LastState or null value if
+   * section is missed
    */
-  Json::Value& GetSavedApplications(Json::Value& dictionary) const;
+  const Json::Value& GetSavedApplications(const Json::Value& dictionary) const;
 
   /**
    * @brief Get Resumption section of LastState
    * @param dictionary - data dictionary where all necessary info stored
-   * @return Resumption section of LastState in Json
+   * @return Resumption section of LastState in Json or null value if section
+   * is missed
    */
-  Json::Value& GetResumptionData(Json::Value& dictionary) const;
+  const Json::Value& GetResumptionData(const Json::Value& dictionary) const;
 
   /**
    * @brief GetObjectIndex allows to obtain specified object index from
    * applications arrays.
    * @param policy_app_id application id that should be found.
    * @param device_id unique id of device.
+   * @param dictionary - data dictionary where all necessary info stored
    * @return application's index of or -1 if it doesn't exists
    */
   ssize_t GetObjectIndex(const std::string& policy_app_id,
-                         const std::string& device_id) const;
-
-  /**
-   * @brief Set applications for resumption to LastState
-   * @param dictionary - data dictionary where all necessary info stored
-   * @parems apps_json applications to write in LastState
-   */
-  void SetSavedApplication(Json::Value& apps_json, Json::Value& dictionary);
-
-  /**
-   * @brief Setup IgnOff time to LastState
-   * @param dictionary - data dictionary where all necessary info stored
-   * @param ign_off_time - igition off time
-   */
-  void SetLastIgnOffTime(time_t ign_off_time, Json::Value& dictionary);
+                         const std::string& device_id,
+                         const Json::Value& dictionary) const;
 
   /*
    * @brief Return true if application resumption data is valid,
@@ -56,6 +56,7 @@
 #include "interfaces/v4_protocol_v1_2_no_extra.h"
 #include "interfaces/v4_protocol_v1_2_no_extra_schema.h"
 
+#include "utils/bucket_prioritized_queue.h"
 #include "utils/semantic_version.h"
 #include "utils/threads/message_loop_thread.h"
 
@@ -83,9 +84,11 @@ struct MessageFromHmi : public std::shared_ptr<Message> {
 };
 
 // Short type names for prioritized message queues
-typedef threads::MessageLoopThread<utils::PrioritizedQueue<MessageFromMobile> >
+typedef threads::MessageLoopThread<
+    utils::BucketPrioritizedQueue<MessageFromMobile> >
     FromMobileQueue;
-typedef threads::MessageLoopThread<utils::PrioritizedQueue<MessageFromHmi> >
+typedef threads::MessageLoopThread<
+    utils::BucketPrioritizedQueue<MessageFromHmi> >
     FromHmiQueue;
 }  // namespace impl
 
@@ -171,6 +174,17 @@ class RPCHandlerImpl : public RPCHandler,
   bool HandleWrongMessageType(smart_objects::SmartObject& output,
                               rpc::ValidationReport report) const;
 
+  /**
+   * @brief Attaches HMI schema to message parsed from HMI and validates it
+   * @param message - message the smart object was parsed from
+   * @param output - parsed message
+   * @returns false if message has to be dropped
+   */
+  bool ValidateHMIMessageSO(const Message& message,
+                            smart_objects::SmartObject& output,
+                            const bool allow_unknown_parameters,
+                            const bool validate_params);
+
   void ProcessMessageFromMobile(const std::shared_ptr<Message> message);
   void ProcessMessageFromHMI(const std::shared_ptr<Message> message);
 
@@ -51,6 +51,7 @@
 #include "interfaces/v4_protocol_v1_2_no_extra.h"
 #include "interfaces/v4_protocol_v1_2_no_extra_schema.h"
 
+#include "utils/bucket_prioritized_queue.h"
 #include "utils/logger.h"
 #include "utils/threads/message_loop_thread.h"
 
@@ -82,9 +83,10 @@ struct MessageToHmi : public std::shared_ptr<Message> {
   }
 };
 
-typedef threads::MessageLoopThread<utils::PrioritizedQueue<MessageToMobile> >
+typedef threads::MessageLoopThread<
+    utils::BucketPrioritizedQueue<MessageToMobile> >
     ToMobileQueue;
-typedef threads::MessageLoopThread<utils::PrioritizedQueue<MessageToHmi> >
+typedef threads::MessageLoopThread<utils::BucketPrioritizedQueue<MessageToHmi> >
     ToHmiQueue;
 }  // namespace impl
 
@@ -158,6 +160,15 @@ class RPCServiceImpl : public RPCService,
       const hmi_apis::messageType::eType& message_type,
       const std::map<std::string, SMember>& members) OVERRIDE;
 
+#ifdef TELEMETRY_MONITOR
+  /**
+   * @brief Setup observer for time metric.
+   *
+   * @param observer - pointer to observer
+   */
+  void SetTelemetryObserver(AMTelemetryObserver* observer) OVERRIDE;
+#endif  // TELEMETRY_MONITOR
+
  private:
   bool ConvertSOtoMessage(const smart_objects::SmartObject& message,
                           Message& output,
@@ -186,6 +197,9 @@ class RPCServiceImpl : public RPCService,
 
   hmi_apis::HMI_API& hmi_so_factory_;
   mobile_apis::MOBILE_API& mobile_so_factory_;
+#ifdef TELEMETRY_MONITOR
+  AMTelemetryObserver* metric_observer_;
+#endif  // TELEMETRY_MONITOR
 };
 }  // namespace rpc_service
 }  // namespace application_manager
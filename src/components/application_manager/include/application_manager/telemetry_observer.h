@@ -36,12 +36,13 @@
 #include "application_manager/smart_object_keys.h"
 #include "json/json.h"
 #include "smart_objects/smart_object.h"
+#include "telemetry_monitor/telemetry_stage.h"
 
 #include "utils/date_time.h"
 
 namespace application_manager {
 
-class AMTelemetryObserver {
+class AMTelemetryObserver : public telemetry_monitor::StageTelemetryObserver {
  public:
   struct MessageMetric {
     date_time::TimeDuration begin;
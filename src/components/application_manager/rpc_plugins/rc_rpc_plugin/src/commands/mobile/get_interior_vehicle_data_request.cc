@@ -78,9 +78,9 @@ void GetInteriorVehicleDataRequest::FilterDisabledModuleData(
   // message.
   if (module_data.keyExists(message_params::kRadioEnable) &&
       module_data[message_params::kRadioEnable].asBool() == false) {
-    for (auto data = module_data.map_begin(); data != module_data.map_end();) {
-      auto key = data->first;
-      ++data;
+    // Erase invalidates map iterators, so keys are copied first
+    const std::set<std::string> keys = module_data.enumerate();
+    for (const auto& key : keys) {
       if (key != message_params::kRadioEnable) {
         module_data.erase(key);
       }
@@ -314,7 +314,7 @@ smart_objects::SmartObject RCHelpers::MergeModuleData(
 
   for (auto it = data2.map_begin(); it != data2.map_end(); ++it) {
     const std::string& key = it->first;
-    smart_objects::SmartObject& value = it->second;
+    const smart_objects::SmartObject& value = it->second;
     if (!result.keyExists(key) || value.getType() != result[key].getType()) {
       result[key] = value;
       continue;
@@ -322,11 +322,12 @@ smart_objects::SmartObject RCHelpers::MergeModuleData(
 
     // Merge maps and arrays with `id` param included, replace other types
     if (smart_objects::SmartType::SmartType_Map == value.getType()) {
-      value = MergeModuleData(result[key], value);
+      result[key] = MergeModuleData(result[key], value);
     } else if (smart_objects::SmartType::SmartType_Array == value.getType()) {
-      value = MergeArray(result[key], value);
+      result[key] = MergeArray(result[key], value);
+    } else {
+      result[key] = value;
     }
-    result[key] = value;
   }
   return result;
 }
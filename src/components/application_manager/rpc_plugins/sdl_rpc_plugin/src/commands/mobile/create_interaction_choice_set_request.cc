@@ -208,12 +208,12 @@ bool CreateInteractionChoiceSetRequest::compareSynonyms(
         choice2.keyExists(strings::vr_commands))) {
     return false;  // clearly there isn't a duplicate if one of them is null
   }
-  smart_objects::SmartArray* vr_cmds_1 =
+  const smart_objects::SmartArray* vr_cmds_1 =
       choice1[strings::vr_commands].asArray();
-  smart_objects::SmartArray* vr_cmds_2 =
+  const smart_objects::SmartArray* vr_cmds_2 =
       choice2[strings::vr_commands].asArray();
 
-  smart_objects::SmartArray::iterator it;
+  smart_objects::SmartArray::const_iterator it;
   it = std::find_first_of(vr_cmds_1->begin(),
                           vr_cmds_1->end(),
                           vr_cmds_2->begin(),
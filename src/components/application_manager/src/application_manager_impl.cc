@@ -2728,6 +2728,16 @@ bool ApplicationManagerImpl::ConvertSOtoMessage(
       }
       output.set_protocol_version(
           protocol_handler::MajorProtocolVersion::PROTOCOL_VERSION_HMI);
+      // Method name lets HMI adapter route the message without parsing it
+      std::string function_name;
+      if (smart_objects::EnumConversionHelper<hmi_apis::FunctionID::eType>::
+              EnumToString(static_cast<hmi_apis::FunctionID::eType>(
+                               message.getElement(jhs::S_PARAMS)
+                                   .getElement(jhs::S_FUNCTION_ID)
+                                   .asInt()),
+                           &function_name)) {
+        output.set_function_name(function_name);
+      }
       break;
     }
     default:
@@ -2862,7 +2872,7 @@ void ApplicationManagerImpl::PullLanguagesInfo(const SmartObject& app_data,
   }
 }
 
-void ApplicationManagerImpl::CreateApplications(SmartArray& obj_array,
+void ApplicationManagerImpl::CreateApplications(const SmartArray& obj_array,
                                                 const uint32_t connection_key) {
   SDL_LOG_AUTO_TRACE();
   using namespace policy;
@@ -2973,7 +2983,7 @@ void ApplicationManagerImpl::ProcessQueryApp(
     return;
   }
 
-  SmartArray* obj_array = sm_object[json::response].asArray();
+  const SmartArray* obj_array = sm_object[json::response].asArray();
   if (NULL != obj_array) {
     CreateApplications(*obj_array, connection_key);
     SendUpdateAppList();
@@ -2999,6 +3009,7 @@ bool ApplicationManagerImpl::is_attenuated_supported() const {
 void ApplicationManagerImpl::SetTelemetryObserver(
     AMTelemetryObserver* observer) {
   rpc_handler_->SetTelemetryObserver(observer);
+  rpc_service_->SetTelemetryObserver(observer);
 }
 #endif  // TELEMETRY_MONITOR
 
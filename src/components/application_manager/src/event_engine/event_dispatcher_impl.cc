@@ -31,185 +31,100 @@
  */
 
 #include "application_manager/event_engine/event_dispatcher_impl.h"
-#include <algorithm>
 #include "application_manager/event_engine/event_observer.h"
 #include "interfaces/HMI_API.h"
 
 namespace application_manager {
 namespace event_engine {
-using namespace sync_primitives;
 
-EventDispatcherImpl::EventDispatcherImpl() : observers_event_() {}
+namespace {
+template <typename EventType>
+class HandleEvent {
+ public:
+  explicit HandleEvent(const EventType& event) : event_(event) {}
 
-EventDispatcherImpl::~EventDispatcherImpl() {}
-
-void EventDispatcherImpl::raise_event(const Event& event) {
-  ObserverVector observers;
-  AutoLock observer_lock(observer_lock_);
-  {
-    AutoLock state_lock(state_lock_);
-
-    // check if event is notification
-    if (hmi_apis::messageType::notification == event.smart_object_type()) {
-      const uint32_t notification_correlation_id = 0;
-      observers = observers_event_[event.id()][notification_correlation_id];
-    }
-
-    if (hmi_apis::messageType::response == event.smart_object_type() ||
-        hmi_apis::messageType::error_response == event.smart_object_type()) {
-      observers =
-          observers_event_[event.id()][event.smart_object_correlation_id()];
+  void operator()(EventObserver& observer) const {
+    if (observer.IncrementReferenceCount()) {
+      observer.HandleOnEvent(event_);
+      observer.DecrementReferenceCount();
     }
   }
 
-  while (!observers.empty()) {
-    EventObserver* temp = *observers.begin();
-    observers.erase(observers.begin());
-    AutoUnlock unlock_observer(observer_lock);
+ private:
+  const EventType& event_;
+};
+}  // namespace
 
-    if (temp->IncrementReferenceCount()) {
-      temp->HandleOnEvent(event);
-      temp->DecrementReferenceCount();
-    }
+EventDispatcherImpl::EventDispatcherImpl() {}
+
+EventDispatcherImpl::~EventDispatcherImpl() {}
+
+void EventDispatcherImpl::raise_event(const Event& event) {
+  int32_t correlation_id = 0;
+  switch (event.smart_object_type()) {
+    case hmi_apis::messageType::notification:
+      break;
+    case hmi_apis::messageType::response:
+    case hmi_apis::messageType::error_response:
+      correlation_id = event.smart_object_correlation_id();
+      break;
+    default:
+      return;
   }
+  observers_.ForEach(event.id(), correlation_id, HandleEvent<Event>(event));
 }
 
 void EventDispatcherImpl::add_observer(const Event::EventID& event_id,
                                        int32_t hmi_correlation_id,
                                        EventObserver& observer) {
-  AutoLock auto_lock(state_lock_);
-  observers_event_[event_id][hmi_correlation_id].push_back(&observer);
+  observers_.Add(event_id, hmi_correlation_id, observer);
 }
 
-struct IdCheckFunctor {
-  explicit IdCheckFunctor(const unsigned long id) : target_id(id) {}
-
-  bool operator()(const EventObserver* obs) const {
-    return (obs->id() == target_id);
-  }
-
- private:
-  const unsigned long target_id;
-};
-
 void EventDispatcherImpl::remove_observer(const Event::EventID& event_id,
                                           const int32_t hmi_correlation_id) {
-  AutoLock auto_lock(state_lock_);
-  auto& observers = observers_event_[event_id][hmi_correlation_id];
-  for (auto observer : observers) {
-    remove_observer_from_vector(*observer);
-  }
+  observers_.Remove(event_id, hmi_correlation_id);
 }
 
 void EventDispatcherImpl::remove_observer(const Event::EventID& event_id,
                                           EventObserver& observer) {
-  remove_observer_from_vector(observer);
-  AutoLock auto_lock(state_lock_);
-  ObserversMap::iterator it = observers_event_[event_id].begin();
-
-  for (; observers_event_[event_id].end() != it; ++it) {
-    ObserverVector& obs_vec = it->second;
-    const ObserverVector::iterator obs_vec_it = obs_vec.end();
-    obs_vec.erase(
-        std::remove_if(
-            obs_vec.begin(), obs_vec_it, IdCheckFunctor(observer.id())),
-        obs_vec_it);
-  }
+  observers_.Remove(event_id, observer);
 }
 
 void EventDispatcherImpl::remove_observer(EventObserver& observer) {
-  remove_observer_from_vector(observer);
-  EventObserverMap::iterator event_map = observers_event_.begin();
-
-  for (; observers_event_.end() != event_map; ++event_map) {
-    remove_observer(event_map->first, observer);
-  }
-}
-
-void EventDispatcherImpl::remove_observer_from_vector(EventObserver& observer) {
-  AutoLock auto_lock(observer_lock_);
-
-  observers_.erase(
-      std::remove_if(
-          observers_.begin(), observers_.end(), IdCheckFunctor(observer.id())),
-      observers_.end());
+  observers_.Remove(observer);
 }
 
 // Mobile Events
 
 void EventDispatcherImpl::raise_mobile_event(const MobileEvent& event) {
-  AutoLock observer_lock(mobile_observer_lock_);
-  {
-    AutoLock state_lock(mobile_state_lock_);
-
-    // check if event is notification
-    if (mobile_apis::messageType::notification == event.smart_object_type()) {
-      const uint32_t notification_correlation_id = 0;
-      mobile_observers_ =
-          mobile_observers_event_[event.id()][notification_correlation_id];
-    }
-
-    if (mobile_apis::messageType::response == event.smart_object_type()) {
-      mobile_observers_ =
-          mobile_observers_event_[event.id()]
-                                 [event.smart_object_correlation_id()];
-    }
-  }
-
-  // Call observers
-  while (!mobile_observers_.empty()) {
-    EventObserver* temp = *mobile_observers_.begin();
-    mobile_observers_.erase(mobile_observers_.begin());
-    AutoUnlock unlock_observer(observer_lock);
-
-    if (temp->IncrementReferenceCount()) {
-      temp->HandleOnEvent(event);
-      temp->DecrementReferenceCount();
-    }
+  int32_t correlation_id = 0;
+  switch (event.smart_object_type()) {
+    case mobile_apis::messageType::notification:
+      break;
+    case mobile_apis::messageType::response:
+      correlation_id = event.smart_object_correlation_id();
+      break;
+    default:
+      return;
   }
+  mobile_observers_.ForEach(
+      event.id(), correlation_id, HandleEvent<MobileEvent>(event));
 }
 
 void EventDispatcherImpl::add_mobile_observer(
     const MobileEvent::MobileEventID& event_id,
     int32_t mobile_correlation_id,
     EventObserver& observer) {
-  AutoLock auto_lock(mobile_state_lock_);
-  mobile_observers_event_[event_id][mobile_correlation_id].push_back(&observer);
+  mobile_observers_.Add(event_id, mobile_correlation_id, observer);
 }
 
 void EventDispatcherImpl::remove_mobile_observer(
     const MobileEvent::MobileEventID& event_id, EventObserver& observer) {
-  remove_mobile_observer_from_vector(observer);
-  AutoLock auto_lock(mobile_state_lock_);
-  ObserversMap::iterator it = mobile_observers_event_[event_id].begin();
-
-  for (; mobile_observers_event_[event_id].end() != it; ++it) {
-    ObserverVector& obs_vec = it->second;
-    const ObserverVector::iterator obs_vec_it = obs_vec.end();
-    obs_vec.erase(
-        std::remove_if(
-            obs_vec.begin(), obs_vec_it, IdCheckFunctor(observer.id())),
-        obs_vec_it);
-  }
+  mobile_observers_.Remove(event_id, observer);
 }
 
 void EventDispatcherImpl::remove_mobile_observer(EventObserver& observer) {
-  remove_mobile_observer_from_vector(observer);
-  MobileEventObserverMap::iterator event_map = mobile_observers_event_.begin();
-
-  for (; mobile_observers_event_.end() != event_map; ++event_map) {
-    remove_mobile_observer(event_map->first, observer);
-  }
-}
-
-void EventDispatcherImpl::remove_mobile_observer_from_vector(
-    EventObserver& observer) {
-  AutoLock auto_lock(mobile_observer_lock_);
-
-  mobile_observers_.erase(
-      std::remove_if(
-          observers_.begin(), observers_.end(), IdCheckFunctor(observer.id())),
-      observers_.end());
+  mobile_observers_.Remove(observer);
 }
 
 }  // namespace event_engine
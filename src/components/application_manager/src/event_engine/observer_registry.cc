@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "application_manager/event_engine/observer_registry.h"
+
+#include <functional>
+
+#include "utils/macro.h"
+
+namespace application_manager {
+namespace event_engine {
+
+struct ObserverRegistry::Subscription {
+  Subscription(EventObserver* observer,
+               Bucket* bucket,
+               const uint64_t sequence)
+      : observer(observer)
+      , bucket(bucket)
+      , sequence(sequence)
+      , bucket_prev(nullptr)
+      , bucket_next(nullptr)
+      , observer_prev(nullptr)
+      , observer_next(nullptr)
+      , pins(0)
+      , removed(false) {}
+
+  EventObserver* observer;
+  Bucket* bucket;
+  const uint64_t sequence;
+  Subscription* bucket_prev;
+  Subscription* bucket_next;
+  Subscription* observer_prev;
+  Subscription* observer_next;
+  /**
+   * @brief Amount of ForEach calls standing on the subscription.
+   * Removed subscription stays linked into its bucket until unpinned
+   */
+  uint32_t pins;
+  bool removed;
+};
+
+ObserverRegistry::Key::Key(const int32_t event_id,
+                           const int32_t correlation_id)
+    : event_id(event_id), correlation_id(correlation_id) {}
+
+bool ObserverRegistry::Key::operator==(const Key& other) const {
+  return event_id == other.event_id && correlation_id == other.correlation_id;
+}
+
+size_t ObserverRegistry::KeyHash::operator()(const Key& key) const {
+  const uint64_t value =
+      (static_cast<uint64_t>(static_cast<uint32_t>(key.event_id)) << 32) |
+      static_cast<uint32_t>(key.correlation_id);
+  return std::hash<uint64_t>()(value);
+}
+
+ObserverRegistry::Bucket::Bucket(const Key& key)
+    : key(key), head(nullptr), tail(nullptr) {}
+
+ObserverRegistry::ObserverRegistry() : sequence_(0) {}
+
+ObserverRegistry::~ObserverRegistry() {
+  for (Buckets::iterator it = buckets_.begin(); buckets_.end() != it; ++it) {
+    Subscription* subscription = it->second.head;
+    while (subscription) {
+      Subscription* next = subscription->bucket_next;
+      delete subscription;
+      subscription = next;
+    }
+  }
+}
+
+void ObserverRegistry::Add(const int32_t event_id,
+                           const int32_t correlation_id,
+                           EventObserver& observer) {
+  sync_primitives::AutoLock auto_lock(lock_);
+  const Key key(event_id, correlation_id);
+  Buckets::iterator bucket_it = buckets_.find(key);
+  if (buckets_.end() == bucket_it) {
+    bucket_it = buckets_.insert(std::make_pair(key, Bucket(key))).first;
+  }
+  Bucket& bucket = bucket_it->second;
+  Subscription* subscription =
+      new Subscription(&observer, &bucket, ++sequence_);
+
+  subscription->bucket_prev = bucket.tail;
+  if (bucket.tail) {
+    bucket.tail->bucket_next = subscription;
+  } else {
+    bucket.head = subscription;
+  }
+  bucket.tail = subscription;
+
+  Subscription*& observer_head = observers_[&observer];
+  subscription->observer_next = observer_head;
+  if (observer_head) {
+    observer_head->observer_prev = subscription;
+  }
+  observer_head = subscription;
+}
+
+void ObserverRegistry::Remove(const int32_t event_id,
+                              const int32_t correlation_id) {
+  sync_primitives::AutoLock auto_lock(lock_);
+  Buckets::iterator bucket_it = buckets_.find(Key(event_id, correlation_id));
+  if (buckets_.end() == bucket_it) {
+    return;
+  }
+  Subscription* subscription = bucket_it->second.head;
+  while (subscription) {
+    Subscription* next = subscription->bucket_next;
+    if (!subscription->removed) {
+      RemoveSubscription(subscription);
+    }
+    subscription = next;
+  }
+}
+
+void ObserverRegistry::Remove(const int32_t event_id,
+                              EventObserver& observer) {
+  sync_primitives::AutoLock auto_lock(lock_);
+  Observers::iterator observer_it = observers_.find(&observer);
+  if (observers_.end() == observer_it) {
+    return;
+  }
+  Subscription* subscription = observer_it->second;
+  while (subscription) {
+    Subscription* next = subscription->observer_next;
+    if (event_id == subscription->bucket->key.event_id) {
+      RemoveSubscription(subscription);
+    }
+    subscription = next;
+  }
+}
+
+void ObserverRegistry::Remove(EventObserver& observer) {
+  sync_primitives::AutoLock auto_lock(lock_);
+  Observers::iterator observer_it = observers_.find(&observer);
+  if (observers_.end() == observer_it) {
+    return;
+  }
+  Subscription* subscription = observer_it->second;
+  while (subscription) {
+    Subscription* next = subscription->observer_next;
+    RemoveSubscription(subscription);
+    subscription = next;
+  }
+}
+
+size_t ObserverRegistry::keys_count() const {
+  sync_primitives::AutoLock auto_lock(lock_);
+  return buckets_.size();
+}
+
+size_t ObserverRegistry::observers_count() const {
+  sync_primitives::AutoLock auto_lock(lock_);
+  return observers_.size();
+}
+
+void ObserverRegistry::RemoveSubscription(Subscription* subscription) {
+  DCHECK_OR_RETURN_VOID(!subscription->removed);
+  if (subscription->observer_prev) {
+    subscription->observer_prev->observer_next = subscription->observer_next;
+  } else if (subscription->observer_next) {
+    observers_[subscription->observer] = subscription->observer_next;
+  } else {
+    observers_.erase(subscription->observer);
+  }
+  if (subscription->observer_next) {
+    subscription->observer_next->observer_prev = subscription->observer_prev;
+  }
+  subscription->observer_prev = nullptr;
+  subscription->observer_next = nullptr;
+  subscription->removed = true;
+
+  if (0 == subscription->pins) {
+    ReleaseSubscription(subscription);
+  }
+}
+
+void ObserverRegistry::ReleaseSubscription(Subscription* subscription) {
+  Bucket* bucket = subscription->bucket;
+  if (subscription->bucket_prev) {
+    subscription->bucket_prev->bucket_next = subscription->bucket_next;
+  } else {
+    bucket->head = subscription->bucket_next;
+  }
+  if (subscription->bucket_next) {
+    subscription->bucket_next->bucket_prev = subscription->bucket_prev;
+  } else {
+    bucket->tail = subscription->bucket_prev;
+  }
+  delete subscription;
+
+  if (!bucket->head) {
+    buckets_.erase(bucket->key);
+  }
+}
+
+ObserverRegistry::Subscription* ObserverRegistry::PinFirst(
+    const Key& key, const uint64_t last_sequence) {
+  Buckets::iterator bucket_it = buckets_.find(key);
+  if (buckets_.end() == bucket_it) {
+    return nullptr;
+  }
+  return PinLive(bucket_it->second.head, last_sequence);
+}
+
+ObserverRegistry::Subscription* ObserverRegistry::PinNext(
+    Subscription* subscription, const uint64_t last_sequence) {
+  Subscription* next = subscription->bucket_next;
+  --subscription->pins;
+  if (subscription->removed && 0 == subscription->pins) {
+    ReleaseSubscription(subscription);
+  }
+  return PinLive(next, last_sequence);
+}
+
+ObserverRegistry::Subscription* ObserverRegistry::PinLive(
+    Subscription* subscription, const uint64_t last_sequence) {
+  // Subscriptions are appended to bucket tail, so sequence grows along it
+  while (subscription && subscription->sequence <= last_sequence) {
+    if (!subscription->removed) {
+      ++subscription->pins;
+      return subscription;
+    }
+    subscription = subscription->bucket_next;
+  }
+  return nullptr;
+}
+
+EventObserver& ObserverRegistry::observer_of(
+    const Subscription* subscription) {
+  return *subscription->observer;
+}
+
+}  // namespace event_engine
+}  // namespace application_manager
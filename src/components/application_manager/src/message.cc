@@ -83,6 +83,7 @@ Message::Message(const Message& message)
 
 Message& Message::operator=(const Message& message) {
   set_function_id(message.function_id_);
+  set_function_name(message.function_name_);
   set_correlation_id(message.correlation_id_);
   set_connection_key(message.connection_key_);
   set_message_type(message.type_);
@@ -2930,7 +2930,7 @@ void PolicyHandler::SetDefaultHmiTypes(
   POLICY_LIB_CHECK_VOID(policy_manager);
   std::vector<int> hmi_types;
   if (app_types && app_types->asArray()) {
-    smart_objects::SmartArray* hmi_list = app_types->asArray();
+    const smart_objects::SmartArray* hmi_list = app_types->asArray();
     std::transform(hmi_list->begin(),
                    hmi_list->end(),
                    std::back_inserter(hmi_types),
@@ -2950,7 +2950,7 @@ bool PolicyHandler::CheckHMIType(const std::string& application_id,
 
   std::vector<int> additional_hmi_types;
   if (app_types && app_types->asArray()) {
-    smart_objects::SmartArray* hmi_list = app_types->asArray();
+    const smart_objects::SmartArray* hmi_list = app_types->asArray();
     std::transform(hmi_list->begin(),
                    hmi_list->end(),
                    std::back_inserter(additional_hmi_types),
@@ -32,12 +32,13 @@
 
 #include "application_manager/request_controller.h"
 
+#include <vector>
+
 #include "application_manager/commands/command_request_impl.h"
 #include "application_manager/commands/request_from_mobile_impl.h"
 #include "application_manager/commands/request_to_hmi.h"
 #include "application_manager/request_controller_impl.h"
 #include "utils/logger.h"
-#include "utils/timer_task_impl.h"
 
 namespace application_manager {
 
@@ -47,82 +48,87 @@ using namespace sync_primitives;
 
 SDL_CREATE_LOG_VARIABLE("RequestController")
 
+namespace {
+/**
+ * @brief Delay before releasing references of terminated requests, gives
+ * event dispatcher time to figure out that request was finalized
+ */
+const uint32_t kRequestsCleanupDelayMs = 50u;
+
+const char* kTimeoutTimerName = "AM RequestTimeout";
+}  // namespace
+
+/**
+ * @brief Passes expiration of request timeout timer to the controller
+ */
+class RequestControllerImpl::TimeoutTask : public timer::TimerTask {
+ public:
+  TimeoutTask(RequestControllerImpl& controller,
+              const std::weak_ptr<RequestInfo>& request_info)
+      : controller_(controller), request_info_(request_info) {}
+
+  void run() const OVERRIDE {
+    controller_.OnRequestTimeout(request_info_);
+  }
+
+ private:
+  RequestControllerImpl& controller_;
+  const std::weak_ptr<RequestInfo> request_info_;
+};
+
 RequestControllerImpl::RequestControllerImpl(
     const RequestControlerSettings& settings,
     RequestTimeoutHandler& request_timeout_handler,
     event_engine::EventDispatcher& event_dispatcher)
-    : threads::AsyncRunner("RequestController async runner")
-    , pool_state_(TPoolState::UNDEFINED)
-    , pool_size_(settings.thread_pool_size())
+    : pool_state_(TPoolState::UNDEFINED)
     , request_tracker_(settings)
     , duplicate_message_count_()
-    , timer_("AM RequestCtrlTimer",
-             new timer::TimerTaskImpl<RequestControllerImpl>(
-                 this, &RequestControllerImpl::TimeoutThread))
-    , timer_stop_flag_(false)
     , is_low_voltage_(false)
     , settings_(settings)
     , request_timeout_handler_(request_timeout_handler)
-    , event_dispatcher_(event_dispatcher) {
+    , event_dispatcher_(event_dispatcher)
+    , timeout_wheel_(1u)
+    , pending_requests_count_(0)
+    , executor_("AM Pool", settings.thread_pool_size()) {
   SDL_LOG_AUTO_TRACE();
   InitializeThreadpool();
-  timer_.Start(0, timer::kSingleShot);
 }
 
 RequestControllerImpl::~RequestControllerImpl() {
   SDL_LOG_AUTO_TRACE();
   Stop();
+  CancelTimeouts(false);
 }
 
 void RequestControllerImpl::Stop() {
   SDL_LOG_AUTO_TRACE();
 
-  {
-    sync_primitives::AutoLock auto_lock(timer_lock);
-    timer_stop_flag_ = true;
-    timer_condition_.Broadcast();
-  }
-
   if (pool_state_ != TPoolState::STOPPED) {
     DestroyThreadpool();
   }
-
-  SDL_LOG_DEBUG("Stopping async runner");
-  AsyncRunner::Stop();
-
-  SDL_LOG_DEBUG("Stopping timeout tracker");
-  timer_.Stop();
 }
 
 void RequestControllerImpl::InitializeThreadpool() {
   SDL_LOG_AUTO_TRACE();
 
-  // TODO(DK): Consider lazy loading threads instead of creating all at once
   pool_state_ = TPoolState::STARTED;
-  char name[50];
-  for (uint32_t i = 0; i < pool_size_; ++i) {
-    snprintf(name, sizeof(name) / sizeof(name[0]), "AM Pool %u", i);
-    pool_.push_back(threads::CreateThread(name, new Worker(this)));
-    pool_[i]->Start();
-    SDL_LOG_DEBUG("Request thread initialized: " << name);
-  }
+  executor_.Start();
+  SDL_LOG_DEBUG("Request threads initialized: " << executor_.workers_count());
 }
 
 void RequestControllerImpl::DestroyThreadpool() {
   SDL_LOG_AUTO_TRACE();
-  {
-    AutoLock auto_lock(mobile_request_list_lock_);
-    pool_state_ = TPoolState::STOPPED;
-    SDL_LOG_DEBUG("Broadcasting STOP signal to all threads...");
-    cond_var_.Broadcast();  // notify all threads we are shutting down
-  }
-  for (size_t i = 0; i < pool_.size(); ++i) {
-    threads::Thread* thread = pool_[i];
-    thread->Stop(threads::Thread::kThreadSoftStop);
-    delete thread->GetDelegate();
-    threads::DeleteThread(thread);
-  }
-  pool_.clear();
+  pool_state_ = TPoolState::STOPPED;
+  executor_.Stop();
+
+  const threads::WorkStealingExecutor::Statistics statistics =
+      executor_.GetStatistics();
+  SDL_LOG_DEBUG("Executed tasks: "
+                << statistics.executed_count
+                << " stolen: " << statistics.stolen_count
+                << " pending: " << statistics.queue_depth
+                << " average latency (us): " << statistics.average_latency_us
+                << " max latency (us): " << statistics.max_latency_us);
 }
 
 RequestControllerImpl::TResult RequestControllerImpl::CheckPosibilitytoAdd(
@@ -159,7 +165,7 @@ bool RequestControllerImpl::CheckPendingRequestsAmount(
   SDL_LOG_AUTO_TRACE();
 
   if (pending_requests_amount > 0) {
-    const size_t pending_requests_size = mobile_request_list_.size();
+    const size_t pending_requests_size = pending_requests_count_.load();
     const bool available_to_add =
         pending_requests_amount > pending_requests_size;
     if (!available_to_add) {
@@ -178,7 +184,6 @@ RequestController::TResult RequestControllerImpl::AddMobileRequest(
   SDL_LOG_AUTO_TRACE();
   if (!request) {
     SDL_LOG_ERROR("Null Pointer request");
-    cond_var_.NotifyOne();
     return TResult::INVALID_DATA;
   }
   SDL_LOG_DEBUG("correlation_id : " << request->correlation_id()
@@ -186,12 +191,14 @@ RequestController::TResult RequestControllerImpl::AddMobileRequest(
                                     << request->connection_key());
   RequestController::TResult result = CheckPosibilitytoAdd(request, hmi_level);
   if (TResult::SUCCESS == result) {
-    AutoLock auto_lock_list(mobile_request_list_lock_);
-    mobile_request_list_.push_back(request);
-    SDL_LOG_DEBUG("Waiting for execution: " << mobile_request_list_.size());
-    // wake up one thread that is waiting for a task to be available
+    // Requests of one application are run one by one in order of adding
+    ++pending_requests_count_;
+    executor_.Post(request->connection_key(),
+                   std::bind(&RequestControllerImpl::ProcessMobileRequest,
+                             this,
+                             request));
+    SDL_LOG_DEBUG("Waiting for execution: " << pending_requests_count_);
   }
-  cond_var_.NotifyOne();
   return result;
 }
 
@@ -224,7 +231,7 @@ RequestController::TResult RequestControllerImpl::AddHMIRequest(
   waiting_for_response_.Add(request_info_ptr);
   SDL_LOG_DEBUG("Waiting for response count:" << waiting_for_response_.Size());
 
-  NotifyTimer();
+  ScheduleTimeout(request_info_ptr);
   return RequestController::TResult::SUCCESS;
 }
 
@@ -335,10 +342,13 @@ void RequestControllerImpl::TerminateRequest(const uint32_t correlation_id,
     return;
   }
   if (force_terminate || request->request()->AllowedToTerminate()) {
-    event_dispatcher_.remove_observer(
-        static_cast<hmi_apis::FunctionID::eType>(function_id), correlation_id);
     waiting_for_response_.RemoveRequest(request);
+    CancelTimeout(request);
     if (RequestInfo::HMIRequest == request->request_type()) {
+      // Mobile IDs are not HMI event keys, they may match another request
+      event_dispatcher_.remove_observer(
+          static_cast<hmi_apis::FunctionID::eType>(function_id),
+          correlation_id);
       request_timeout_handler_.RemoveRequest(request->requestId());
     }
 
@@ -347,7 +357,6 @@ void RequestControllerImpl::TerminateRequest(const uint32_t correlation_id,
                  << "correlation_id = " << correlation_id
                  << " function_id = " << function_id);
   }
-  NotifyTimer();
 }
 
 void RequestControllerImpl::OnMobileResponse(
@@ -367,25 +376,23 @@ void RequestControllerImpl::OnHMIResponse(const uint32_t correlation_id,
 void RequestControllerImpl::TerminateWaitingForExecutionAppRequests(
     const uint32_t app_id) {
   SDL_LOG_AUTO_TRACE();
-  SDL_LOG_DEBUG("app_id: " << app_id << "Waiting for execution"
-                           << mobile_request_list_.size());
-  AutoLock auto_lock(mobile_request_list_lock_);
-  std::list<RequestPtr>::iterator request_it = mobile_request_list_.begin();
-  while (mobile_request_list_.end() != request_it) {
-    RequestPtr request = (*request_it);
-    if ((request.use_count() != 0) && (request->connection_key() == app_id)) {
-      mobile_request_list_.erase(request_it++);
-    } else {
-      ++request_it;
-    }
-  }
-  SDL_LOG_DEBUG("Waiting for execution " << mobile_request_list_.size());
+  const size_t removed_count = executor_.Remove(app_id);
+  pending_requests_count_ -= removed_count;
+  SDL_LOG_DEBUG("app_id: " << app_id << " removed " << removed_count
+                           << " requests waiting for execution");
 }
 
 void RequestControllerImpl::scheduleRequestsCleanup(
     const RequestInfoPtrs& requests) {
   SDL_LOG_AUTO_TRACE();
-  AsyncRun(new RequestCleanerDelegate(requests));
+  SDL_LOG_DEBUG("Prepare to cleanup of " << requests.size() << " requests");
+  // The task keeps the references until it runs, no thread is blocked
+  // meanwhile
+  executor_.PostDelayed(
+      RequestInfo::kHmiConnectionKey, kRequestsCleanupDelayMs, [requests]() {
+        SDL_LOG_DEBUG("Releasing references of " << requests.size()
+                                                 << " requests");
+      });
 }
 
 void RequestControllerImpl::TerminateWaitingForResponseAppRequests(
@@ -411,6 +418,7 @@ void RequestControllerImpl::TerminateWaitingForResponseAppRequests(
         "Removing request with corr_id: " << request_ptr->correlation_id());
     requests_to_terminate.push_back(*it);
     waiting_for_response_.RemoveRequest(*it);
+    CancelTimeout(*it);
   }
 
   SDL_LOG_DEBUG("Waiting for response count after cleanup: "
@@ -433,13 +441,12 @@ void RequestControllerImpl::TerminateAppRequests(const uint32_t app_id) {
   SDL_LOG_AUTO_TRACE();
   SDL_LOG_DEBUG("app_id : " << app_id
                             << "Requests waiting for execution count : "
-                            << mobile_request_list_.size()
+                            << pending_requests_count_
                             << "Requests waiting for response count : "
                             << waiting_for_response_.Size());
 
   TerminateWaitingForExecutionAppRequests(app_id);
   TerminateWaitingForResponseAppRequests(app_id);
-  NotifyTimer();
 }
 
 void RequestControllerImpl::TerminateAllHMIRequests() {
@@ -451,11 +458,10 @@ void RequestControllerImpl::TerminateAllMobileRequests() {
   SDL_LOG_AUTO_TRACE();
 
   waiting_for_response_.RemoveMobileRequests();
+  CancelTimeouts(true);
   SDL_LOG_DEBUG("Mobile Requests waiting for response cleared");
-  AutoLock waiting_execution_auto_lock(mobile_request_list_lock_);
-  mobile_request_list_.clear();
+  pending_requests_count_ -= executor_.Clear();
   SDL_LOG_DEBUG("Mobile Requests waiting for execution cleared");
-  NotifyTimer();
 }
 
 void RequestControllerImpl::UpdateRequestTimeout(const uint32_t app_id,
@@ -485,7 +491,7 @@ void RequestControllerImpl::UpdateRequestTimeout(const uint32_t app_id,
     waiting_for_response_.RemoveRequest(request_info);
     request_info->updateTimeOut(new_timeout);
     waiting_for_response_.Add(request_info);
-    NotifyTimer();
+    ScheduleTimeout(request_info);
     SDL_LOG_INFO("Timeout updated for "
                  << " app_id: " << app_id << " correlation_id: "
                  << correlation_id << " new_timeout (ms): " << new_timeout);
@@ -514,193 +520,150 @@ bool RequestControllerImpl::IsLowVoltage() {
   return is_low_voltage_;
 }
 
-void RequestControllerImpl::TimeoutThread() {
-  SDL_LOG_AUTO_TRACE();
+threads::WorkStealingExecutor::Statistics
+RequestControllerImpl::GetExecutorStatistics() const {
+  return executor_.GetStatistics();
+}
 
-  if (TPoolState::STOPPED == pool_state_) {
-    SDL_LOG_DEBUG("Thread pool has been stopped. Skipping timer restart");
+void RequestControllerImpl::ScheduleTimeout(
+    const RequestInfoPtr request_info) {
+  if (0 == request_info->timeout_msec()) {
+    // Timeout may have been reset to zero by UpdateRequestTimeout
+    CancelTimeout(request_info);
     return;
   }
+  const int64_t delay_ms = date_time::getmSecs(request_info->end_time() -
+                                               date_time::getCurrentTime());
 
-  SDL_LOG_DEBUG(
-      "ENTER Waiting fore response count: " << waiting_for_response_.Size());
-  sync_primitives::AutoLock auto_lock(timer_lock);
-  while (!timer_stop_flag_) {
-    RequestInfoPtr probably_expired =
-        waiting_for_response_.FrontWithNotNullTimeout();
-    if (!probably_expired) {
-      timer_condition_.Wait(auto_lock);
-      continue;
-    }
-    if (!probably_expired->isExpired()) {
-      SDL_LOG_DEBUG("Timeout for "
-                    << (RequestInfo::HMIRequest ==
-                                probably_expired->request_type()
-                            ? "HMI"
-                            : "Mobile")
-                    << " request id: " << probably_expired->requestId()
-                    << " connection_key: " << probably_expired->app_id()
-                    << " NOT expired");
-      const date_time::TimeDuration current_time = date_time::getCurrentTime();
-      const date_time::TimeDuration end_time = probably_expired->end_time();
-      if (current_time < end_time) {
-        const uint32_t msecs =
-            static_cast<uint32_t>(date_time::getmSecs(end_time - current_time));
-        SDL_LOG_DEBUG("Sleep for " << msecs << " millisecs");
-        timer_condition_.WaitFor(auto_lock, msecs);
-      }
-      continue;
-    }
-    SDL_LOG_INFO("Timeout for "
-                 << (RequestInfo::HMIRequest == probably_expired->request_type()
-                         ? "HMI"
-                         : "Mobile")
-                 << " request id: " << probably_expired->requestId()
-                 << " connection_key: " << probably_expired->app_id()
-                 << " is expired");
-    const uint32_t expired_request_id = probably_expired->requestId();
-    const uint32_t expired_app_id = probably_expired->app_id();
-
-    probably_expired->request()->HandleTimeOut();
-
-    if (RequestInfo::kHmiConnectionKey == probably_expired->app_id()) {
-      SDL_LOG_DEBUG("Erase HMI request: " << probably_expired->requestId());
-      waiting_for_response_.RemoveRequest(probably_expired);
-      if (RequestInfo::HMIRequest == probably_expired->request_type()) {
-        request_timeout_handler_.RemoveRequest(expired_request_id);
-      }
-    }
-    probably_expired = waiting_for_response_.FrontWithNotNullTimeout();
-    if (probably_expired) {
-      if (expired_request_id == probably_expired->requestId() &&
-          expired_app_id == probably_expired->app_id()) {
-        SDL_LOG_DEBUG("Expired request wasn't removed");
-        break;
-      }
-    }
+  // Timer of a deleted request is deleted after the lock is released
+  std::unique_ptr<timer::Timer> stale_timer;
+  AutoLock auto_lock(timeouts_lock_);
+  RequestTimeout& timeout = timeouts_[request_info.get()];
+  if (timeout.request_info.lock() != request_info) {
+    stale_timer = std::move(timeout.timer);
+    timeout.request_info = request_info;
+    timeout.timer.reset(new timer::Timer(kTimeoutTimerName,
+                                         new TimeoutTask(*this, request_info),
+                                         timeout_wheel_));
   }
-  SDL_LOG_DEBUG(
-      "EXIT Waiting for response count : " << waiting_for_response_.Size());
+  timeout.timer->Start(delay_ms > 0 ? static_cast<uint32_t>(delay_ms) : 0u,
+                       timer::kSingleShot);
 }
 
-RequestControllerImpl::Worker::Worker(RequestControllerImpl* request_controller)
-    : request_controller_(request_controller), stop_flag_(false) {}
-
-RequestControllerImpl::Worker::~Worker() {}
-
-void RequestControllerImpl::Worker::threadMain() {
-  SDL_LOG_AUTO_TRACE();
-  AutoLock auto_lock(thread_lock_);
-  while (!stop_flag_) {
-    // Try to pick a request
-    AutoLock auto_lock(request_controller_->mobile_request_list_lock_);
-
-    while ((request_controller_->pool_state_ != TPoolState::STOPPED) &&
-           (request_controller_->mobile_request_list_.empty())) {
-      // Wait until there is a task in the queue
-      // Unlock mutex while wait, then lock it back when signaled
-      SDL_LOG_INFO("Unlocking and waiting");
-      request_controller_->cond_var_.Wait(auto_lock);
-      SDL_LOG_INFO("Signaled and locking");
-    }
-
-    // If the thread was shutdown, return from here
-    if (request_controller_->pool_state_ == TPoolState::STOPPED) {
-      break;
-    }
-
-    if (request_controller_->mobile_request_list_.empty()) {
-      SDL_LOG_WARN("Mobile request list is empty");
-      break;
+void RequestControllerImpl::CancelTimeout(const RequestInfoPtr request_info) {
+  std::unique_ptr<timer::Timer> timer;
+  {
+    AutoLock auto_lock(timeouts_lock_);
+    auto it = timeouts_.find(request_info.get());
+    if (timeouts_.end() == it) {
+      return;
     }
+    timer = std::move(it->second.timer);
+    timeouts_.erase(it);
+  }
+  // Timer waits for its running task, so it is deleted unlocked
+  timer.reset();
+}
 
-    RequestPtr request_ptr(request_controller_->mobile_request_list_.front());
-    request_controller_->mobile_request_list_.pop_front();
-
-    bool init_res = request_ptr->Init();  // to setup specific
-                                          // default timeout
-
-    const uint32_t timeout_in_mseconds = request_ptr->default_timeout();
-    RequestInfoPtr request_info_ptr =
-        std::make_shared<MobileRequestInfo>(request_ptr, timeout_in_mseconds);
-
-    if (!request_controller_->waiting_for_response_.Add(request_info_ptr)) {
-      commands::RequestFromMobileImpl* cmd_request =
-          dynamic_cast<commands::RequestFromMobileImpl*>(request_ptr.get());
-      if (cmd_request != NULL) {
-        uint32_t corr_id = cmd_request->correlation_id();
-        request_controller_->duplicate_message_count_lock_.Acquire();
-        auto dup_it =
-            request_controller_->duplicate_message_count_.find(corr_id);
-        if (request_controller_->duplicate_message_count_.end() == dup_it) {
-          request_controller_->duplicate_message_count_[corr_id] = 0;
-        }
-        request_controller_->duplicate_message_count_[corr_id]++;
-        request_controller_->duplicate_message_count_lock_.Release();
-        cmd_request->SendResponse(
-            false, mobile_apis::Result::INVALID_ID, "Duplicate correlation_id");
+void RequestControllerImpl::CancelTimeouts(const bool mobile_only) {
+  std::vector<std::unique_ptr<timer::Timer> > timers;
+  {
+    AutoLock auto_lock(timeouts_lock_);
+    for (auto it = timeouts_.begin(); it != timeouts_.end();) {
+      const RequestInfoPtr request_info = it->second.request_info.lock();
+      if (mobile_only && request_info &&
+          RequestInfo::HMIRequest == request_info->request_type()) {
+        ++it;
+        continue;
       }
-      continue;
-    }
-    SDL_LOG_DEBUG("timeout_in_mseconds " << timeout_in_mseconds);
-
-    if (0 != timeout_in_mseconds) {
-      request_controller_->NotifyTimer();
-    } else {
-      SDL_LOG_DEBUG(
-          "Default timeout was set to 0. "
-          "RequestController will not track timeout "
-          "of this request.");
-    }
-
-    AutoUnlock unlock(auto_lock);
-
-    // execute
-    if ((false == request_controller_->IsLowVoltage()) &&
-        request_ptr->CheckPermissions() && init_res) {
-      SDL_LOG_DEBUG("Execute MobileRequest corr_id = "
-                    << request_info_ptr->requestId()
-                    << " with timeout: " << timeout_in_mseconds);
-      request_ptr->Run();
+      timers.push_back(std::move(it->second.timer));
+      it = timeouts_.erase(it);
     }
   }
+  SDL_LOG_DEBUG("Cancelled " << timers.size() << " request timeouts");
 }
 
-void RequestControllerImpl::Worker::exitThreadMain() {
-  stop_flag_ = true;
-  // setup stop flag and whit while threadMain will be finished correctly
-  // FIXME (dchmerev@luxoft.com): There is no waiting
-}
+void RequestControllerImpl::OnRequestTimeout(
+    const std::weak_ptr<RequestInfo> request_info) {
+  SDL_LOG_AUTO_TRACE();
+  RequestInfoPtr expired = request_info.lock();
+  if (!expired) {
+    SDL_LOG_DEBUG("Request was finished");
+    return;
+  }
+  if (expired != waiting_for_response_.Find(expired->app_id(),
+                                            expired->requestId())) {
+    SDL_LOG_DEBUG("Request is not waiting for response anymore");
+    return;
+  }
 
-RequestControllerImpl::RequestCleanerDelegate::RequestCleanerDelegate(
-    const RequestInfoPtrs& requests)
-    : requests_(requests) {}
+  SDL_LOG_INFO("Timeout for "
+               << (RequestInfo::HMIRequest == expired->request_type()
+                       ? "HMI"
+                       : "Mobile")
+               << " request id: " << expired->requestId()
+               << " connection_key: " << expired->app_id() << " is expired");
+  const uint32_t expired_request_id = expired->requestId();
 
-RequestControllerImpl::RequestCleanerDelegate::~RequestCleanerDelegate() {
-  SDL_LOG_AUTO_TRACE();
-}
+  expired->request()->HandleTimeOut();
 
-void RequestControllerImpl::RequestCleanerDelegate::exitThreadMain() {
-  sync_primitives::AutoLock lock(state_lock_);
-  state_cond_.NotifyOne();
+  if (RequestInfo::kHmiConnectionKey == expired->app_id()) {
+    SDL_LOG_DEBUG("Erase HMI request: " << expired_request_id);
+    waiting_for_response_.RemoveRequest(expired);
+    CancelTimeout(expired);
+    if (RequestInfo::HMIRequest == expired->request_type()) {
+      request_timeout_handler_.RemoveRequest(expired_request_id);
+    }
+  }
 }
 
-void RequestControllerImpl::RequestCleanerDelegate::threadMain() {
-  SDL_LOG_DEBUG("Prepare to cleanup of " << requests_.size() << " requests");
+void RequestControllerImpl::ProcessMobileRequest(const RequestPtr request_ptr) {
+  SDL_LOG_AUTO_TRACE();
+  --pending_requests_count_;
+  const bool init_res = request_ptr->Init();  // to setup specific
+                                              // default timeout
 
-  {
-    SDL_LOG_DEBUG("Waiting...");
-    sync_primitives::AutoLock lock(state_lock_);
-    state_cond_.WaitFor(lock, 50);
+  const uint32_t timeout_in_mseconds = request_ptr->default_timeout();
+  RequestInfoPtr request_info_ptr =
+      std::make_shared<MobileRequestInfo>(request_ptr, timeout_in_mseconds);
+
+  if (!waiting_for_response_.Add(request_info_ptr)) {
+    commands::RequestFromMobileImpl* cmd_request =
+        dynamic_cast<commands::RequestFromMobileImpl*>(request_ptr.get());
+    if (cmd_request != NULL) {
+      uint32_t corr_id = cmd_request->correlation_id();
+      {
+        AutoLock auto_lock(duplicate_message_count_lock_);
+        auto dup_it = duplicate_message_count_.find(corr_id);
+        if (duplicate_message_count_.end() == dup_it) {
+          duplicate_message_count_[corr_id] = 0;
+        }
+        duplicate_message_count_[corr_id]++;
+      }
+      cmd_request->SendResponse(
+          false, mobile_apis::Result::INVALID_ID, "Duplicate correlation_id");
+    }
+    return;
   }
+  SDL_LOG_DEBUG("timeout_in_mseconds " << timeout_in_mseconds);
 
-  SDL_LOG_DEBUG("Releasing references");
-  requests_.clear();
-}
+  if (0 != timeout_in_mseconds) {
+    ScheduleTimeout(request_info_ptr);
+  } else {
+    SDL_LOG_DEBUG(
+        "Default timeout was set to 0. "
+        "RequestController will not track timeout "
+        "of this request.");
+  }
 
-void RequestControllerImpl::NotifyTimer() {
-  SDL_LOG_AUTO_TRACE();
-  timer_condition_.NotifyOne();
+  // execute
+  if ((false == IsLowVoltage()) && request_ptr->CheckPermissions() &&
+      init_res) {
+    SDL_LOG_DEBUG("Execute MobileRequest corr_id = "
+                  << request_info_ptr->requestId()
+                  << " with timeout: " << timeout_in_mseconds);
+    request_ptr->Run();
+  }
 }
 
 }  //  namespace request_controller
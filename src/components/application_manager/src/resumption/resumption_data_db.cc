@@ -2396,8 +2396,8 @@ bool ResumptionDataDB::InsertGlobalPropertiesData(
   SDL_LOG_AUTO_TRACE();
   using namespace app_mngr;
   using namespace smart_objects;
-  SmartMap::iterator it_begin = global_properties.map_begin();
-  SmartMap::iterator it_end = global_properties.map_end();
+  SmartMap::const_iterator it_begin = global_properties.map_begin();
+  SmartMap::const_iterator it_end = global_properties.map_end();
   bool data_exists = false;
   while (it_begin != it_end) {
     if (SmartType::SmartType_Null != ((it_begin->second).getType())) {
@@ -45,6 +45,27 @@ namespace formatters = ns_smart_device_link::ns_json_handler::formatters;
 
 SDL_CREATE_LOG_VARIABLE("Resumption")
 
+namespace {
+Json::Value ResumptionPath(const char* key) {
+  Json::Value path(Json::arrayValue);
+  path.append(app_mngr::strings::resumption);
+  path.append(key);
+  return path;
+}
+
+Json::Value AppPath(const Json::ArrayIndex index) {
+  Json::Value path = ResumptionPath(app_mngr::strings::resume_app_list);
+  path.append(index);
+  return path;
+}
+
+Json::Value AppPath(const Json::ArrayIndex index, const char* key) {
+  Json::Value path = AppPath(index);
+  path.append(key);
+  return path;
+}
+}  // namespace
+
 ResumptionDataJson::ResumptionDataJson(
     resumption::LastStateWrapperPtr last_state_wrapper,
     const application_manager::ApplicationManager& application_manager)
@@ -71,9 +92,12 @@ void ResumptionDataJson::SaveApplication(
 
   Json::Value tmp;
   resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  Json::Value dictionary = accessor.GetData().dictionary();
-  Json::Value& json_app =
-      GetFromSavedOrAppend(policy_app_id, device_mac, dictionary);
+  const Json::Value& dictionary = accessor.GetData().dictionary_ref();
+  const Json::Value& saved_apps = GetSavedApplications(dictionary);
+  const int idx = GetObjectIndex(policy_app_id, device_mac, dictionary);
+  const Json::ArrayIndex app_index =
+      -1 == idx ? saved_apps.size() : static_cast<Json::ArrayIndex>(idx);
+  Json::Value json_app = -1 == idx ? Json::Value() : saved_apps[app_index];
 
   json_app[strings::device_id] = device_mac;
   json_app[strings::app_id] = policy_app_id;
@@ -105,13 +129,24 @@ void ResumptionDataJson::SaveApplication(
   formatters::CFormatterJsonBase::objToJsonValue(
       GetApplicationWidgetsInfo(application), tmp);
   json_app[strings::windows_info] = tmp;
-  json_app[strings::time_stamp] = time_stamp;
   json_app[strings::subscribed_for_way_points] = is_subscribed_for_way_points;
   formatters::CFormatterJsonBase::objToJsonValue(
       application->get_user_location(), tmp);
   json_app[strings::user_location] = tmp;
 
-  accessor.GetMutableData().set_dictionary(dictionary);
+  // Application is saved on every timer tick, but its data rarely changes
+  // between ticks, so only the time stamp is updated in such case
+  if (-1 != idx) {
+    json_app[strings::time_stamp] = saved_apps[app_index][strings::time_stamp];
+    if (json_app == saved_apps[app_index]) {
+      accessor.GetMutableData().set_value(
+          AppPath(app_index, strings::time_stamp), time_stamp);
+      SDL_LOG_DEBUG("SaveApplication : only time stamp is updated");
+      return;
+    }
+  }
+  json_app[strings::time_stamp] = time_stamp;
+  accessor.GetMutableData().set_value(AppPath(app_index), json_app);
   SDL_LOG_DEBUG("SaveApplication : " << json_app.toStyledString());
 }
 
@@ -120,8 +155,8 @@ bool ResumptionDataJson::IsHMIApplicationIdExist(uint32_t hmi_app_id) const {
   SDL_LOG_AUTO_TRACE();
 
   resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  Json::Value dictionary = accessor.GetData().dictionary();
-  const Json::Value& saved_apps = GetSavedApplications(dictionary);
+  const Json::Value& saved_apps =
+      GetSavedApplications(accessor.GetData().dictionary_ref());
 
   for (const auto& saved_app : saved_apps) {
     if (saved_app.isMember(strings::hmi_app_id)) {
@@ -140,13 +175,13 @@ uint32_t ResumptionDataJson::GetHMIApplicationID(
 
   uint32_t hmi_app_id = 0;
 
-  const int idx = GetObjectIndex(policy_app_id, device_id);
+  resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
+  const Json::Value& dictionary = accessor.GetData().dictionary_ref();
+  const int idx = GetObjectIndex(policy_app_id, device_id, dictionary);
   if (-1 == idx) {
     SDL_LOG_WARN("Application not saved");
     return hmi_app_id;
   }
-  resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  Json::Value dictionary = accessor.GetData().dictionary();
   const Json::Value& json_app = GetSavedApplications(dictionary)[idx];
   if (json_app.isMember(strings::app_id) &&
       json_app.isMember(strings::device_id)) {
@@ -160,27 +195,27 @@ void ResumptionDataJson::IncrementIgnOffCount() {
   using namespace app_mngr;
   SDL_LOG_AUTO_TRACE();
 
-  Json::Value to_save = Json::arrayValue;
-  Json::Value dictionary;
   resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  dictionary = accessor.GetData().dictionary();
-  Json::Value& saved_apps = GetSavedApplications(dictionary);
-  for (auto& json_app : saved_apps) {
+  resumption::LastState& last_state = accessor.GetMutableData();
+  const Json::ArrayIndex apps_count =
+      GetSavedApplications(last_state.dictionary_ref()).size();
+  for (Json::ArrayIndex i = 0; i < apps_count; ++i) {
+    const Json::Value& json_app =
+        GetSavedApplications(last_state.dictionary_ref())[i];
+    uint32_t ign_off_count = 1;
     if (json_app.isMember(strings::ign_off_count)) {
-      Json::Value& ign_off_count = json_app[strings::ign_off_count];
-      const uint32_t counter_value = ign_off_count.asUInt();
-      ign_off_count = counter_value + 1;
+      ign_off_count = json_app[strings::ign_off_count].asUInt() + 1;
     } else {
       SDL_LOG_WARN("Unknown key among saved applications");
-      Json::Value& ign_off_count = json_app[strings::ign_off_count];
-      ign_off_count = 1;
     }
-    to_save.append(json_app);
+    last_state.set_value(AppPath(i, strings::ign_off_count), ign_off_count);
   }
-  SetSavedApplication(to_save, dictionary);
-  SetLastIgnOffTime(time(nullptr), dictionary);
-  accessor.GetMutableData().set_dictionary(dictionary);
-  SDL_LOG_DEBUG(GetResumptionData(dictionary).toStyledString());
+  const time_t ign_off_time = time(nullptr);
+  SDL_LOG_WARN("ign_off_time = " << ign_off_time);
+  last_state.set_value(ResumptionPath(strings::last_ign_off_time),
+                       static_cast<uint32_t>(ign_off_time));
+  SDL_LOG_DEBUG(
+      GetResumptionData(last_state.dictionary_ref()).toStyledString());
 }
 
 void ResumptionDataJson::DecrementIgnOffCount() {
@@ -188,22 +223,25 @@ void ResumptionDataJson::DecrementIgnOffCount() {
   SDL_LOG_AUTO_TRACE();
 
   resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  Json::Value dictionary = accessor.GetData().dictionary();
-  Json::Value& saved_apps = GetSavedApplications(dictionary);
-  for (auto& saved_app : saved_apps) {
+  resumption::LastState& last_state = accessor.GetMutableData();
+  const Json::ArrayIndex apps_count =
+      GetSavedApplications(last_state.dictionary_ref()).size();
+  for (Json::ArrayIndex i = 0; i < apps_count; ++i) {
+    const Json::Value& saved_app =
+        GetSavedApplications(last_state.dictionary_ref())[i];
     if (saved_app.isMember(strings::ign_off_count)) {
       const uint32_t ign_off_count = saved_app[strings::ign_off_count].asUInt();
       if (0 == ign_off_count) {
         SDL_LOG_WARN("Application has not been suspended");
       } else {
-        saved_app[strings::ign_off_count] = ign_off_count - 1;
+        last_state.set_value(AppPath(i, strings::ign_off_count),
+                             ign_off_count - 1);
       }
     } else {
       SDL_LOG_WARN("Unknown key among saved applications");
-      saved_app[strings::ign_off_count] = 0;
+      last_state.set_value(AppPath(i, strings::ign_off_count), 0);
     }
   }
-  accessor.GetMutableData().set_dictionary(dictionary);
 }
 
 bool ResumptionDataJson::GetHashId(const std::string& policy_app_id,
@@ -212,14 +250,14 @@ bool ResumptionDataJson::GetHashId(const std::string& policy_app_id,
   using namespace app_mngr;
   SDL_LOG_AUTO_TRACE();
 
-  const int idx = GetObjectIndex(policy_app_id, device_id);
+  resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
+  const Json::Value& dictionary = accessor.GetData().dictionary_ref();
+  const int idx = GetObjectIndex(policy_app_id, device_id, dictionary);
   if (-1 == idx) {
     SDL_LOG_WARN("Application not saved");
     return false;
   }
 
-  resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  Json::Value dictionary = accessor.GetData().dictionary();
   const Json::Value& json_app = GetSavedApplications(dictionary)[idx];
   SDL_LOG_DEBUG("Saved_application_data: " << json_app.toStyledString());
   if (json_app.isMember(strings::hash_id) &&
@@ -238,12 +276,12 @@ bool ResumptionDataJson::GetSavedApplication(
   using namespace app_mngr;
   SDL_LOG_AUTO_TRACE();
 
-  const int idx = GetObjectIndex(policy_app_id, device_id);
+  resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
+  const Json::Value& dictionary = accessor.GetData().dictionary_ref();
+  const int idx = GetObjectIndex(policy_app_id, device_id, dictionary);
   if (-1 == idx) {
     return false;
   }
-  resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  Json::Value dictionary = accessor.GetData().dictionary();
   const Json::Value& json_saved_app = GetSavedApplications(dictionary)[idx];
   formatters::CFormatterJsonBase::jsonValueToObj(json_saved_app, saved_app);
 
@@ -255,36 +293,14 @@ bool ResumptionDataJson::RemoveApplicationFromSaved(
   using namespace app_mngr;
   SDL_LOG_AUTO_TRACE();
 
-  bool result = false;
-  std::vector<Json::Value> temp;
   resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  Json::Value dictionary = accessor.GetData().dictionary();
-  Json::Value& saved_apps = GetSavedApplications(dictionary);
-  for (auto& app : saved_apps) {
-    if (app.isMember(strings::app_id) && app.isMember(strings::device_id)) {
-      const std::string& saved_policy_app_id = app[strings::app_id].asString();
-      const std::string& saved_device_id = app[strings::device_id].asString();
-      if (saved_policy_app_id == policy_app_id &&
-          saved_device_id == device_id) {
-        result = true;
-      } else {
-        temp.push_back(app);
-      }
-    }
-  }
-
-  if (false == result) {
-    SDL_LOG_TRACE("EXIT result: " << (result ? "true" : "false"));
-    accessor.GetMutableData().set_dictionary(dictionary);
-    return result;
-  }
-
-  GetSavedApplications(dictionary).clear();
-  for (auto& app : temp) {
-    GetSavedApplications(dictionary).append(app);
+  const int idx = GetObjectIndex(
+      policy_app_id, device_id, accessor.GetData().dictionary_ref());
+  const bool result = -1 != idx;
+  if (result) {
+    accessor.GetMutableData().remove_value(AppPath(idx));
   }
   SDL_LOG_TRACE("EXIT result: " << (result ? "true" : "false"));
-  accessor.GetMutableData().set_dictionary(dictionary);
   return result;
 }
 
@@ -293,12 +309,13 @@ uint32_t ResumptionDataJson::GetIgnOffTime() const {
   SDL_LOG_AUTO_TRACE();
 
   resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  Json::Value dictionary = accessor.GetData().dictionary();
-  Json::Value& resumption = GetResumptionData(dictionary);
+  const Json::Value& resumption =
+      GetResumptionData(accessor.GetData().dictionary_ref());
   if (!resumption.isMember(strings::last_ign_off_time)) {
-    resumption[strings::last_ign_off_time] = 0;
-    accessor.GetMutableData().set_dictionary(dictionary);
+    accessor.GetMutableData().set_value(
+        ResumptionPath(strings::last_ign_off_time), 0);
     SDL_LOG_WARN("last_save_time section is missed");
+    return 0;
   }
   return resumption[strings::last_ign_off_time].asUInt();
 }
@@ -308,8 +325,8 @@ uint32_t ResumptionDataJson::GetGlobalIgnOnCounter() const {
   SDL_LOG_AUTO_TRACE();
 
   resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  Json::Value dictionary = accessor.GetData().dictionary();
-  Json::Value& resumption = GetResumptionData(dictionary);
+  const Json::Value& resumption =
+      GetResumptionData(accessor.GetData().dictionary_ref());
   if (resumption.isMember(strings::global_ign_on_counter)) {
     const uint32_t global_ign_on_counter =
         resumption[strings::global_ign_on_counter].asUInt();
@@ -324,20 +341,18 @@ void ResumptionDataJson::IncrementGlobalIgnOnCounter() {
   SDL_LOG_AUTO_TRACE();
 
   resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  Json::Value dictionary = accessor.GetData().dictionary();
-  Json::Value& resumption = GetResumptionData(dictionary);
+  const Json::Value& resumption =
+      GetResumptionData(accessor.GetData().dictionary_ref());
+  uint32_t global_ign_on_counter = 1;
   if (resumption.isMember(strings::global_ign_on_counter)) {
-    const uint32_t global_ign_on_counter =
-        resumption[strings::global_ign_on_counter].asUInt();
-    SDL_LOG_DEBUG(
-        "Global IGN ON counter in resumption data: " << global_ign_on_counter);
-    resumption[strings::global_ign_on_counter] = global_ign_on_counter + 1;
-    SDL_LOG_DEBUG("Global IGN ON counter new value: "
+    SDL_LOG_DEBUG("Global IGN ON counter in resumption data: "
                   << resumption[strings::global_ign_on_counter].asUInt());
-  } else {
-    resumption[strings::global_ign_on_counter] = 1;
+    global_ign_on_counter =
+        resumption[strings::global_ign_on_counter].asUInt() + 1;
+    SDL_LOG_DEBUG("Global IGN ON counter new value: " << global_ign_on_counter);
   }
-  accessor.GetMutableData().set_dictionary(dictionary);
+  accessor.GetMutableData().set_value(
+      ResumptionPath(strings::global_ign_on_counter), global_ign_on_counter);
   accessor.GetMutableData().SaveToFileSystem();
 }
 
@@ -346,11 +361,8 @@ void ResumptionDataJson::ResetGlobalIgnOnCount() {
   SDL_LOG_AUTO_TRACE();
 
   resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  Json::Value dictionary = accessor.GetData().dictionary();
-  Json::Value& resumption = GetResumptionData(dictionary);
-
-  resumption[strings::global_ign_on_counter] = 0;
-  accessor.GetMutableData().set_dictionary(dictionary);
+  accessor.GetMutableData().set_value(
+      ResumptionPath(strings::global_ign_on_counter), 0);
   SDL_LOG_DEBUG("Global IGN ON counter resetting");
 }
 
@@ -358,25 +370,9 @@ ssize_t ResumptionDataJson::IsApplicationSaved(
     const std::string& policy_app_id, const std::string& device_id) const {
   SDL_LOG_AUTO_TRACE();
 
-  return GetObjectIndex(policy_app_id, device_id);
-}
-
-Json::Value& ResumptionDataJson::GetFromSavedOrAppend(
-    const std::string& policy_app_id,
-    const std::string& device_id,
-    Json::Value& dictionary) const {
-  using namespace app_mngr;
-  SDL_LOG_AUTO_TRACE();
-
-  Json::Value& saved_apps = GetSavedApplications(dictionary);
-  for (auto& saved_app : saved_apps) {
-    if (device_id == saved_app[strings::device_id].asString() &&
-        policy_app_id == saved_app[strings::app_id].asString()) {
-      return saved_app;
-    }
-  }
-
-  return GetSavedApplications(dictionary).append(Json::Value());
+  resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
+  return GetObjectIndex(
+      policy_app_id, device_id, accessor.GetData().dictionary_ref());
 }
 
 void ResumptionDataJson::GetDataForLoadResumeData(
@@ -387,10 +383,10 @@ void ResumptionDataJson::GetDataForLoadResumeData(
   smart_objects::SmartObject so_array_data(smart_objects::SmartType_Array);
   int i = 0;
   resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  Json::Value dictionary = accessor.GetData().dictionary();
-  Json::Value& saved_apps = GetSavedApplications(dictionary);
+  const Json::Value& saved_apps =
+      GetSavedApplications(accessor.GetData().dictionary_ref());
 
-  for (auto& saved_app : saved_apps) {
+  for (const auto& saved_app : saved_apps) {
     if ((saved_app.isMember(strings::hmi_level)) &&
         (saved_app.isMember(strings::ign_off_count)) &&
         (saved_app.isMember(strings::time_stamp)) &&
@@ -419,60 +415,60 @@ void ResumptionDataJson::UpdateHmiLevel(
   SDL_LOG_AUTO_TRACE();
   using namespace app_mngr;
 
-  int idx = GetObjectIndex(policy_app_id, device_id);
+  resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
+  const int idx = GetObjectIndex(
+      policy_app_id, device_id, accessor.GetData().dictionary_ref());
   if (-1 == idx) {
     SDL_LOG_WARN("Application isn't saved with mobile_app_id = "
                  << policy_app_id << " device_id = " << device_id);
     return;
   }
-  resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  Json::Value dictionary = accessor.GetData().dictionary();
-  GetSavedApplications(dictionary)[idx][strings::hmi_level] = hmi_level;
-  accessor.GetMutableData().set_dictionary(dictionary);
+  accessor.GetMutableData().set_value(AppPath(idx, strings::hmi_level),
+                                      static_cast<int32_t>(hmi_level));
 }
 
-Json::Value& ResumptionDataJson::GetSavedApplications(
-    Json::Value& dictionary) const {
+const Json::Value& ResumptionDataJson::GetSavedApplications(
+    const Json::Value& dictionary) const {
   using namespace app_mngr;
   SDL_LOG_AUTO_TRACE();
 
-  Json::Value& resumption = GetResumptionData(dictionary);
+  const Json::Value& resumption = GetResumptionData(dictionary);
   if (!resumption.isMember(strings::resume_app_list)) {
-    resumption[strings::resume_app_list] = Json::Value(Json::arrayValue);
     SDL_LOG_WARN("app_list section is missed");
+    return Json::Value::nullSingleton();
   }
-  Json::Value& resume_app_list = resumption[strings::resume_app_list];
+  const Json::Value& resume_app_list = resumption[strings::resume_app_list];
   if (!resume_app_list.isArray()) {
-    SDL_LOG_ERROR("resume_app_list type INVALID rewrite");
-    resume_app_list = Json::Value(Json::arrayValue);
+    SDL_LOG_ERROR("resume_app_list type INVALID");
+    return Json::Value::nullSingleton();
   }
   return resume_app_list;
 }
 
-Json::Value& ResumptionDataJson::GetResumptionData(
-    Json::Value& dictionary) const {
+const Json::Value& ResumptionDataJson::GetResumptionData(
+    const Json::Value& dictionary) const {
   using namespace app_mngr;
   SDL_LOG_AUTO_TRACE();
 
-  if (!dictionary.isMember(strings::resumption)) {
-    dictionary[strings::resumption] = Json::Value(Json::objectValue);
+  if (!dictionary.isObject() || !dictionary.isMember(strings::resumption)) {
     SDL_LOG_WARN("resumption section is missed");
+    return Json::Value::nullSingleton();
   }
-  Json::Value& resumption = dictionary[strings::resumption];
+  const Json::Value& resumption = dictionary[strings::resumption];
   if (!resumption.isObject()) {
-    SDL_LOG_ERROR("resumption type INVALID rewrite");
-    resumption = Json::Value(Json::objectValue);
+    SDL_LOG_ERROR("resumption type INVALID");
+    return Json::Value::nullSingleton();
   }
   return resumption;
 }
 
-ssize_t ResumptionDataJson::GetObjectIndex(const std::string& policy_app_id,
-                                           const std::string& device_id) const {
+ssize_t ResumptionDataJson::GetObjectIndex(
+    const std::string& policy_app_id,
+    const std::string& device_id,
+    const Json::Value& dictionary) const {
   using namespace app_mngr;
   SDL_LOG_AUTO_TRACE();
 
-  resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  Json::Value dictionary = accessor.GetData().dictionary();
   const Json::Value& apps = GetSavedApplications(dictionary);
   const Json::ArrayIndex size = apps.size();
   Json::ArrayIndex idx = 0;
@@ -496,8 +492,8 @@ bool ResumptionDataJson::IsResumptionDataValid(uint32_t index) const {
   SDL_LOG_AUTO_TRACE();
 
   resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  Json::Value dictionary = accessor.GetData().dictionary();
-  const Json::Value& json_app = GetSavedApplications(dictionary)[index];
+  const Json::Value& json_app =
+      GetSavedApplications(accessor.GetData().dictionary_ref())[index];
   if (!json_app.isMember(strings::app_id) ||
       !json_app.isMember(strings::ign_off_count) ||
       !json_app.isMember(strings::hmi_level) ||
@@ -517,24 +513,6 @@ bool ResumptionDataJson::IsResumptionDataValid(uint32_t index) const {
   return true;
 }
 
-void ResumptionDataJson::SetSavedApplication(Json::Value& apps_json,
-                                             Json::Value& dictionary) {
-  SDL_LOG_AUTO_TRACE();
-
-  Json::Value& app_list = GetSavedApplications(dictionary);
-  app_list = apps_json;
-}
-
-void ResumptionDataJson::SetLastIgnOffTime(time_t ign_off_time,
-                                           Json::Value& dictionary) {
-  using namespace app_mngr;
-  SDL_LOG_AUTO_TRACE();
-
-  SDL_LOG_WARN("ign_off_time = " << ign_off_time);
-  Json::Value& resumption = GetResumptionData(dictionary);
-  resumption[strings::last_ign_off_time] = static_cast<uint32_t>(ign_off_time);
-}
-
 bool ResumptionDataJson::Init() {
   SDL_LOG_AUTO_TRACE();
   return true;
@@ -546,23 +524,33 @@ bool ResumptionDataJson::DropAppDataResumption(const std::string& device_id,
   using namespace app_mngr;
 
   resumption::LastStateAccessor accessor = last_state_wrapper_->get_accessor();
-  Json::Value dictionary = accessor.GetData().dictionary();
-  Json::Value& application =
-      GetFromSavedOrAppend(app_id, device_id, dictionary);
-  if (application.isNull()) {
+  resumption::LastState& last_state = accessor.GetMutableData();
+  const int idx =
+      GetObjectIndex(app_id, device_id, last_state.dictionary_ref());
+  if (-1 == idx) {
     SDL_LOG_DEBUG("Application " << app_id << " with device_id " << device_id
                                  << " hasn't been found in resumption data.");
     return false;
   }
-  application[strings::application_commands].clear();
-  application[strings::application_submenus].clear();
-  application[strings::application_choice_sets].clear();
-  application[strings::application_global_properties].clear();
-  application[strings::application_subscriptions].clear();
-  application[strings::application_files].clear();
-  application[strings::user_location].clear();
-  application.removeMember(strings::grammar_id);
-  accessor.GetMutableData().set_dictionary(dictionary);
+  const char* cleared_keys[] = {strings::application_commands,
+                                strings::application_submenus,
+                                strings::application_choice_sets,
+                                strings::application_global_properties,
+                                strings::application_subscriptions,
+                                strings::application_files,
+                                strings::user_location};
+  for (const char* key : cleared_keys) {
+    const Json::Value& saved_app =
+        GetSavedApplications(last_state.dictionary_ref())[idx];
+    // Empty container of the same type, as Json::Value::clear() gives
+    const Json::ValueType type = saved_app[key].type();
+    last_state.set_value(
+        AppPath(idx, key),
+        Json::arrayValue == type || Json::objectValue == type
+            ? Json::Value(type)
+            : Json::Value());
+  }
+  last_state.remove_value(AppPath(idx, strings::grammar_id));
   SDL_LOG_DEBUG("Resumption data for application "
                 << app_id << " with device_id " << device_id
                 << " has been dropped.");
@@ -143,6 +143,7 @@ void RPCHandlerImpl::ProcessMessageFromMobile(
 
 #ifdef TELEMETRY_MONITOR
   metric->message = so_from_mobile;
+  const date_time::TimeDuration run_start_time = date_time::getCurrentTime();
 #endif  // TELEMETRY_MONITOR
 
   if (!app_manager_.GetRPCService().ManageMobileCommand(
@@ -152,6 +153,8 @@ void RPCHandlerImpl::ProcessMessageFromMobile(
 #ifdef TELEMETRY_MONITOR
   metric->end = date_time::getCurrentTime();
   if (metric_observer_) {
+    metric_observer_->OnStageFinished(telemetry_monitor::kCommandRun,
+                                      run_start_time);
     metric_observer_->OnMessage(metric);
   }
 #endif  // TELEMETRY_MONITOR
@@ -164,13 +167,13 @@ void RPCHandlerImpl::ProcessMessageFromHMI(
       std::make_shared<smart_objects::SmartObject>();
   bool allow_unknown_parameters = false;
 
-  smart_objects::SmartObject converted_result;
+  // Message is parsed only once, its function id defines how it is validated
   formatters::FormatterJsonRpc::FromString<hmi_apis::FunctionID::eType,
                                            hmi_apis::messageType::eType>(
-      message->json_message(), converted_result);
+      message->json_message(), *smart_object);
 
   const auto function_id = static_cast<int32_t>(
-      converted_result[jhs::S_PARAMS][jhs::S_FUNCTION_ID].asInt());
+      (*smart_object)[jhs::S_PARAMS][jhs::S_FUNCTION_ID].asInt());
   if (app_manager_.GetRPCService().IsAppServiceRPC(
           function_id, commands::Command::SOURCE_HMI)) {
     SDL_LOG_DEBUG("Allowing unknown parameters for request function "
@@ -178,9 +181,8 @@ void RPCHandlerImpl::ProcessMessageFromHMI(
     allow_unknown_parameters = true;
   }
 
-  std::string warning_info;
-  if (!ConvertMessageToSO(
-          *message, *smart_object, warning_info, allow_unknown_parameters)) {
+  if (!ValidateHMIMessageSO(
+          *message, *smart_object, allow_unknown_parameters, true)) {
     if (application_manager::MessageType::kResponse ==
         (*smart_object)[strings::params][strings::message_type].asInt()) {
       (*smart_object).erase(strings::msg_params);
@@ -194,11 +196,8 @@ void RPCHandlerImpl::ProcessMessageFromHMI(
     }
   }
 
-  if (!warning_info.empty()) {
-    SDL_LOG_WARN("Warning while parsing HMI message: " << warning_info);
-  }
-
   SDL_LOG_DEBUG("Converted message, trying to create hmi command");
+  std::string warning_info;
   if (!app_manager_.GetRPCService().ManageHMICommand(
           smart_object, commands::Command::SOURCE_HMI, warning_info)) {
     SDL_LOG_ERROR("Received command didn't run successfully");
@@ -362,6 +361,10 @@ bool RPCHandlerImpl::ConvertMessageToSO(
     case protocol_handler::MajorProtocolVersion::PROTOCOL_VERSION_4:
     case protocol_handler::MajorProtocolVersion::PROTOCOL_VERSION_3:
     case protocol_handler::MajorProtocolVersion::PROTOCOL_VERSION_2: {
+#ifdef TELEMETRY_MONITOR
+      const date_time::TimeDuration parse_start_time =
+          date_time::getCurrentTime();
+#endif  // TELEMETRY_MONITOR
       const bool conversion_result =
           formatters::CFormatterJsonSDLRPCv2::fromString(
               message.json_message(),
@@ -369,6 +372,12 @@ bool RPCHandlerImpl::ConvertMessageToSO(
               message.function_id(),
               message.type(),
               message.correlation_id());
+#ifdef TELEMETRY_MONITOR
+      if (metric_observer_) {
+        metric_observer_->OnStageFinished(telemetry_monitor::kRpcParse,
+                                          parse_start_time);
+      }
+#endif  // TELEMETRY_MONITOR
 
       rpc::ValidationReport report("RPC");
 
@@ -383,10 +392,23 @@ bool RPCHandlerImpl::ConvertMessageToSO(
         GetMessageVersion(output, msg_version);
       }
 
-      if (!conversion_result ||
-          (validate_params &&
-           !ValidateRpcSO(
-               output, msg_version, report, allow_unknown_parameters))) {
+      bool is_valid = conversion_result;
+      if (is_valid && validate_params) {
+#ifdef TELEMETRY_MONITOR
+        const date_time::TimeDuration validation_start_time =
+            date_time::getCurrentTime();
+#endif  // TELEMETRY_MONITOR
+        is_valid = ValidateRpcSO(
+            output, msg_version, report, allow_unknown_parameters);
+#ifdef TELEMETRY_MONITOR
+        if (metric_observer_) {
+          metric_observer_->OnStageFinished(telemetry_monitor::kValidation,
+                                            validation_start_time);
+        }
+#endif  // TELEMETRY_MONITOR
+      }
+
+      if (!is_valid) {
         SDL_LOG_WARN("Failed to parse string to smart object with API version "
                      << msg_version.toString() << " : "
                      << message.json_message());
@@ -446,24 +468,8 @@ bool RPCHandlerImpl::ConvertMessageToSO(
       SDL_LOG_DEBUG("Convertion result: "
                     << result << " function id "
                     << output[jhs::S_PARAMS][jhs::S_FUNCTION_ID].asInt());
-      if (!hmi_so_factory().attachSchema(output, true)) {
-        SDL_LOG_WARN("Failed to attach schema to object.");
-        return false;
-      }
-
-      rpc::ValidationReport report("RPC");
-
-      utils::SemanticVersion empty_version;
-      if (validate_params &&
-          smart_objects::errors::OK !=
-              output.validate(
-                  &report, empty_version, allow_unknown_parameters)) {
-        SDL_LOG_ERROR("Incorrect parameter from HMI - "
-                      << rpc::PrettyFormat(report));
-
-        return HandleWrongMessageType(output, report);
-      }
-      break;
+      return ValidateHMIMessageSO(
+          message, output, allow_unknown_parameters, validate_params);
     }
     case protocol_handler::MajorProtocolVersion::PROTOCOL_VERSION_1: {
       if (message.function_id() == 0 || message.type() == kUnknownType) {
@@ -512,6 +518,34 @@ bool RPCHandlerImpl::ConvertMessageToSO(
   return true;
 }
 
+bool RPCHandlerImpl::ValidateHMIMessageSO(
+    const Message& message,
+    smart_objects::SmartObject& output,
+    const bool allow_unknown_parameters,
+    const bool validate_params) {
+  SDL_LOG_AUTO_TRACE();
+  if (!hmi_so_factory().attachSchema(output, true)) {
+    SDL_LOG_WARN("Failed to attach schema to object.");
+    return false;
+  }
+
+  rpc::ValidationReport report("RPC");
+
+  utils::SemanticVersion empty_version;
+  if (validate_params &&
+      smart_objects::errors::OK !=
+          output.validate(&report, empty_version, allow_unknown_parameters)) {
+    SDL_LOG_ERROR("Incorrect parameter from HMI - "
+                  << rpc::PrettyFormat(report));
+
+    return HandleWrongMessageType(output, report);
+  }
+  output[strings::params][strings::protection] = message.is_message_encrypted();
+
+  SDL_LOG_DEBUG("Successfully parsed message into smart object");
+  return true;
+}
+
 bool RPCHandlerImpl::HandleWrongMessageType(
     smart_objects::SmartObject& output, rpc::ValidationReport report) const {
   SDL_LOG_AUTO_TRACE();
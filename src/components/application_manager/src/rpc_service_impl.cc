@@ -65,7 +65,12 @@ RPCServiceImpl::RPCServiceImpl(
     , messages_to_mobile_("AM ToMobile", this)
     , messages_to_hmi_("AM ToHMI", this)
     , hmi_so_factory_(hmi_so_factory)
-    , mobile_so_factory_(mobile_so_factory) {}
+    , mobile_so_factory_(mobile_so_factory)
+#ifdef TELEMETRY_MONITOR
+    , metric_observer_(NULL)
+#endif  // TELEMETRY_MONITOR
+{
+}
 
 RPCServiceImpl::~RPCServiceImpl() {}
 
@@ -585,8 +590,8 @@ void RPCServiceImpl::SendMessageToMobile(
     const WindowID window_id =
         MessageHelper::ExtractWindowIdFromSmartObject(s_map);
     if (smart_objects::SmartType_Map == s_map.getType()) {
-      smart_objects::SmartMap::iterator iter = s_map.map_begin();
-      smart_objects::SmartMap::iterator iter_end = s_map.map_end();
+      smart_objects::SmartMap::const_iterator iter = s_map.map_begin();
+      smart_objects::SmartMap::const_iterator iter_end = s_map.map_end();
 
       for (; iter != iter_end; ++iter) {
         if (true == iter->second.asBool()) {
@@ -640,6 +645,9 @@ void RPCServiceImpl::SendMessageToHMI(
     return;
   }
 
+#ifdef TELEMETRY_MONITOR
+  const date_time::TimeDuration start_time = date_time::getCurrentTime();
+#endif  // TELEMETRY_MONITOR
   bool allow_unknown_parameters = false;
   // SmartObject |message| has no way to declare priority for now
   std::shared_ptr<Message> message_to_send(
@@ -667,8 +675,19 @@ void RPCServiceImpl::SendMessageToHMI(
     return;
   }
   messages_to_hmi_.PostMessage(impl::MessageToHmi(message_to_send));
+#ifdef TELEMETRY_MONITOR
+  if (metric_observer_) {
+    metric_observer_->OnStageFinished(telemetry_monitor::kHmiSend, start_time);
+  }
+#endif  // TELEMETRY_MONITOR
 }
 
+#ifdef TELEMETRY_MONITOR
+void RPCServiceImpl::SetTelemetryObserver(AMTelemetryObserver* observer) {
+  metric_observer_ = observer;
+}
+#endif  // TELEMETRY_MONITOR
+
 bool RPCServiceImpl::IsAppServiceRPC(int32_t function_id,
                                      commands::Command::CommandSource source) {
   // General RPCs related to App Services
@@ -770,6 +789,16 @@ bool RPCServiceImpl::ConvertSOtoMessage(
       }
       output.set_protocol_version(
           protocol_handler::MajorProtocolVersion::PROTOCOL_VERSION_HMI);
+      // Method name lets HMI adapter route the message without parsing it
+      std::string function_name;
+      if (smart_objects::EnumConversionHelper<hmi_apis::FunctionID::eType>::
+              EnumToString(static_cast<hmi_apis::FunctionID::eType>(
+                               message.getElement(jhs::S_PARAMS)
+                                   .getElement(jhs::S_FUNCTION_ID)
+                                   .asInt()),
+                           &function_name)) {
+        output.set_function_name(function_name);
+      }
       break;
     }
     default:
@@ -50,6 +50,7 @@ using application_manager::event_engine::EventDispatcherImpl;
 using application_manager::event_engine::EventObserver;
 using testing::_;
 using ::testing::An;
+using ::testing::Invoke;
 using ::testing::Matcher;
 
 class EventEngineTest : public testing::Test {
@@ -167,6 +168,77 @@ TEST_F(
   CheckRaiseEvent(event_id3, 0u, smart_object_with_type_notification);
 }
 
+TEST_F(EventEngineTest,
+       EventDispatcherImpl_RaiseEvent_ObserverRemovedInHandler_NotCalled) {
+  MockEventObserver second_observer(mock_event_dispatcher_);
+  event_dispatcher_instance_->add_observer(
+      event_id3, correlation_id, event_observer_mock_);
+  event_dispatcher_instance_->add_observer(
+      event_id3, correlation_id, second_observer);
+  event_->set_smart_object(smart_object_with_type_response);
+
+  EXPECT_CALL(event_observer_mock_, HandleOnEvent(An<const Event&>()))
+      .WillOnce(Invoke([this, &second_observer](const Event&) {
+        event_dispatcher_instance_->remove_observer(second_observer);
+      }));
+  EXPECT_CALL(second_observer, HandleOnEvent(An<const Event&>())).Times(0);
+  event_dispatcher_instance_->raise_event(*event_);
+
+  EXPECT_EQ(1u, event_dispatcher_instance_->get_observers().observers_count());
+}
+
+TEST_F(EventEngineTest,
+       EventDispatcherImpl_RaiseEvent_ObserverAddedInHandler_NotCalled) {
+  MockEventObserver second_observer(mock_event_dispatcher_);
+  event_dispatcher_instance_->add_observer(
+      event_id3, correlation_id, event_observer_mock_);
+  event_->set_smart_object(smart_object_with_type_response);
+
+  EXPECT_CALL(event_observer_mock_, HandleOnEvent(An<const Event&>()))
+      .WillOnce(Invoke([this, &second_observer](const Event&) {
+        event_dispatcher_instance_->remove_observer(event_observer_mock_);
+        event_dispatcher_instance_->add_observer(
+            event_id3, correlation_id, second_observer);
+      }));
+  EXPECT_CALL(second_observer, HandleOnEvent(An<const Event&>())).Times(0);
+  event_dispatcher_instance_->raise_event(*event_);
+
+  EXPECT_CALL(second_observer, HandleOnEvent(An<const Event&>()));
+  event_dispatcher_instance_->raise_event(*event_);
+  event_dispatcher_instance_->remove_observer(second_observer);
+}
+
+TEST_F(EventEngineTest,
+       EventDispatcherImpl_RemoveObserverByEventId_EmptyKeysErased) {
+  event_dispatcher_instance_->add_observer(
+      event_id, correlation_id, event_observer_mock_);
+  event_dispatcher_instance_->add_observer(
+      event_id, correlation_id + 1, event_observer_mock_);
+  event_dispatcher_instance_->add_observer(
+      event_id2, correlation_id, event_observer_mock_);
+  EXPECT_EQ(3u, event_dispatcher_instance_->get_observers().keys_count());
+
+  event_dispatcher_instance_->remove_observer(event_id, event_observer_mock_);
+  EXPECT_EQ(1u, event_dispatcher_instance_->get_observers().keys_count());
+
+  event_dispatcher_instance_->remove_observer(event_observer_mock_);
+  EXPECT_EQ(0u, event_dispatcher_instance_->get_observers().keys_count());
+  EXPECT_EQ(0u, event_dispatcher_instance_->get_observers().observers_count());
+}
+
+TEST_F(EventEngineTest,
+       EventDispatcherImpl_RemoveObserverByCorrelationId_ExpectEventNotRaised) {
+  event_dispatcher_instance_->add_observer(
+      event_id3, correlation_id, event_observer_mock_);
+  event_dispatcher_instance_->remove_observer(event_id3, correlation_id);
+  EXPECT_EQ(0u, event_dispatcher_instance_->get_observers().keys_count());
+
+  event_->set_smart_object(smart_object_with_type_response);
+  EXPECT_CALL(event_observer_mock_, HandleOnEvent(An<const Event&>()))
+      .Times(0);
+  event_dispatcher_instance_->raise_event(*event_);
+}
+
 TEST_F(EventEngineTest, Event_set_smart_object_ExpectObjectSet) {
   // Act
   event_->set_smart_object(smart_object_with_type_notification);
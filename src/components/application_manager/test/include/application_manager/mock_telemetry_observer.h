@@ -44,6 +44,9 @@ class MockAMTelemetryObserver
     : public application_manager::AMTelemetryObserver {
  public:
   MOCK_METHOD1(OnMessage, void(MessageMetricSharedPtr));
+  MOCK_METHOD2(OnStageFinished,
+               void(const telemetry_monitor::TelemetryStage stage,
+                    const date_time::TimeDuration& begin));
 };
 
 }  // namespace application_manager_test
@@ -306,6 +306,67 @@ TEST_F(RequestControllerTestClass, OnTimer_SUCCESS) {
   EXPECT_TRUE(waiter->WaitFor(1, kTimeScale));
 }
 
+TEST_F(RequestControllerTestClass,
+       OnMobileResponse_RequestTerminated_HMIObserversNotRemoved) {
+  const uint32_t kMobileConnectionKey = 1u;
+  RequestPtr mock_request =
+      GetMockRequest(kDefaultCorrelationID, kMobileConnectionKey);
+  ON_CALL(*mock_request, AllowedToTerminate()).WillByDefault(Return(true));
+
+  auto waiter = TestAsyncWaiter::createInstance();
+  EXPECT_CALL(*mock_request, Init()).WillOnce(Return(true));
+  EXPECT_CALL(*mock_request, Run()).WillOnce(NotifyTestAsyncWaiter(waiter));
+  EXPECT_EQ(RequestController::TResult::SUCCESS,
+            AddRequest(default_settings_,
+                       mock_request,
+                       RequestInfo::RequestType::MobileRequest,
+                       mobile_apis::HMILevel::HMI_FULL));
+  EXPECT_TRUE(waiter->WaitFor(1, 1000));
+
+  // Mobile IDs may be equal to the key of an unrelated HMI request
+  EXPECT_CALL(mock_event_dispatcher_,
+              remove_observer(_, testing::Matcher<int32_t>(_)))
+      .Times(0);
+  request_ctrl_->OnMobileResponse(
+      kDefaultCorrelationID, kMobileConnectionKey, 0);
+}
+
+TEST_F(RequestControllerTestClass,
+       OnHMIResponse_RequestTerminated_HMIObserversRemoved) {
+  RequestPtr mock_request = GetMockRequest(
+      kDefaultCorrelationID, RequestInfo::kHmiConnectionKey);
+  ON_CALL(*mock_request, AllowedToTerminate()).WillByDefault(Return(true));
+  EXPECT_EQ(RequestController::TResult::SUCCESS,
+            AddRequest(default_settings_,
+                       mock_request,
+                       RequestInfo::RequestType::HMIRequest));
+
+  EXPECT_CALL(mock_event_dispatcher_,
+              remove_observer(_, testing::Matcher<int32_t>(
+                                     static_cast<int32_t>(
+                                         kDefaultCorrelationID))));
+  request_ctrl_->OnHMIResponse(kDefaultCorrelationID, 0);
+}
+
+TEST_F(RequestControllerTestClass,
+       OnHMIResponse_RequestTerminated_TimeoutNotHandled) {
+  const uint32_t request_timeout = 50u;
+  RequestPtr mock_request = GetMockRequest(
+      kDefaultCorrelationID, RequestInfo::kHmiConnectionKey, request_timeout);
+  ON_CALL(*mock_request, AllowedToTerminate()).WillByDefault(Return(true));
+  EXPECT_EQ(RequestController::TResult::SUCCESS,
+            AddRequest(default_settings_,
+                       mock_request,
+                       RequestInfo::RequestType::HMIRequest));
+
+  EXPECT_CALL(*mock_request, HandleTimeOut()).Times(0);
+  request_ctrl_->OnHMIResponse(kDefaultCorrelationID, 0);
+
+  // Timeout timer is stopped together with the request
+  auto waiter = TestAsyncWaiter::createInstance();
+  EXPECT_FALSE(waiter->WaitFor(1, 3 * request_timeout));
+}
+
 }  // namespace request_controller_test
 }  // namespace components
 }  // namespace test
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_COMPONENTS_BENCHMARKS_INCLUDE_BENCHMARKS_PAYLOADS_H_
+#define SRC_COMPONENTS_BENCHMARKS_INCLUDE_BENCHMARKS_PAYLOADS_H_
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "protocol_handler/protocol_packet.h"
+
+namespace benchmarks {
+
+/**
+ * @brief Fixed payloads shared by benchmarks.
+ * Messages are taken from MOBILE_API.xml so benchmark results stay
+ * comparable between runs and builds
+ */
+namespace payloads {
+
+/**
+ * @brief msg_params of RegisterAppInterface request, the largest message
+ * every application sends
+ */
+extern const char* const kRegisterAppInterfaceRequest;
+
+/**
+ * @brief msg_params of Show request with soft buttons, the most frequent
+ * UI request
+ */
+extern const char* const kShowRequest;
+
+/**
+ * @brief msg_params of GetVehicleData response carrying a typical set of
+ * subscribed vehicle data
+ */
+extern const char* const kGetVehicleDataResponse;
+
+/**
+ * @brief Size of payload used for multiframe benchmarks, a bit more than
+ * a PutFile chunk
+ */
+const size_t kMultiFrameDataSize = 128 * 1024;
+
+/**
+ * @brief Serializes single frame RPC packets of protocol version 5
+ * @param payload Frame payload
+ * @param count Amount of packets to serialize, message ids go
+ * sequentially starting from 1
+ * @return Raw transport data as it comes from the transport adapter
+ */
+std::vector<uint8_t> SerializeSingleFrames(const std::string& payload,
+                                           const size_t count);
+
+/**
+ * @brief Splits data into frames of multiframe message
+ * @param connection_id Connection the frames belong to
+ * @param message_id Message id of all frames
+ * @param data Message data
+ * @param frames Output list, first frame goes first
+ */
+void PrepareMultiFrames(const protocol_handler::ConnectionID connection_id,
+                        const uint32_t message_id,
+                        const std::vector<uint8_t>& data,
+                        ProtocolFramePtrList& frames);
+
+}  // namespace payloads
+}  // namespace benchmarks
+
+#endif  // SRC_COMPONENTS_BENCHMARKS_INCLUDE_BENCHMARKS_PAYLOADS_H_
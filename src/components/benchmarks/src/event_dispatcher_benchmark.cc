@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "application_manager/event_engine/event.h"
+#include "application_manager/event_engine/event_dispatcher_impl.h"
+#include "application_manager/event_engine/event_observer.h"
+#include "application_manager/smart_object_keys.h"
+#include "benchmark/benchmark.h"
+#include "interfaces/HMI_API.h"
+#include "utils/macro.h"
+
+namespace benchmarks {
+namespace event_dispatcher_benchmark {
+
+namespace event_engine = application_manager::event_engine;
+namespace strings = application_manager::strings;
+namespace smart_objects = ns_smart_device_link::ns_smart_objects;
+
+namespace {
+const hmi_apis::FunctionID::eType kEventId = hmi_apis::FunctionID::UI_Show;
+
+/*
+ * Observer standing for a request waiting for HMI response
+ */
+class PendingRequestObserver : public event_engine::EventObserver {
+ public:
+  PendingRequestObserver(event_engine::EventDispatcher& dispatcher,
+                         const int32_t correlation_id)
+      : event_engine::EventObserver(dispatcher)
+      , correlation_id_(correlation_id) {}
+
+  void Subscribe() {
+    subscribe_on_event(kEventId, correlation_id_);
+  }
+
+  void HandleOnEvent(const event_engine::Event& event) OVERRIDE {
+    benchmark::DoNotOptimize(event.smart_object_correlation_id());
+  }
+
+  int32_t correlation_id() const {
+    return correlation_id_;
+  }
+
+ private:
+  const int32_t correlation_id_;
+};
+
+typedef std::vector<std::unique_ptr<PendingRequestObserver> > Observers;
+
+void CreateObservers(event_engine::EventDispatcher& dispatcher,
+                     const size_t count,
+                     Observers& observers) {
+  for (size_t i = 0; i < count; ++i) {
+    observers.emplace_back(new PendingRequestObserver(dispatcher, i + 1));
+  }
+}
+
+void SetResponse(const int32_t correlation_id, event_engine::Event& event) {
+  smart_objects::SmartObject response(smart_objects::SmartType_Map);
+  response[strings::params][strings::message_type] =
+      hmi_apis::messageType::response;
+  response[strings::params][strings::correlation_id] = correlation_id;
+  response[strings::params][strings::function_id] = kEventId;
+  response[strings::msg_params] =
+      smart_objects::SmartObject(smart_objects::SmartType_Map);
+  event.set_smart_object(response);
+}
+}  // namespace
+
+/*
+ * Delivery of HMI response while state.range(0) requests are waiting for
+ * responses of the same function
+ */
+void BM_EventDispatcherImpl_RaiseEvent(benchmark::State& state) {
+  event_engine::EventDispatcherImpl dispatcher;
+  Observers observers;
+  CreateObservers(dispatcher, static_cast<size_t>(state.range(0)), observers);
+  for (Observers::const_iterator it = observers.begin(); it != observers.end();
+       ++it) {
+    (*it)->Subscribe();
+  }
+
+  std::vector<std::unique_ptr<event_engine::Event> > events;
+  for (Observers::const_iterator it = observers.begin(); it != observers.end();
+       ++it) {
+    events.emplace_back(new event_engine::Event(kEventId));
+    SetResponse((*it)->correlation_id(), *events.back());
+  }
+
+  size_t index = 0;
+  for (auto _ : state) {
+    dispatcher.raise_event(*events[index]);
+    index = (index + 1) % events.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EventDispatcherImpl_RaiseEvent)->Arg(1)->Arg(16)->Arg(256);
+
+/*
+ * Full life cycle of request observer: subscription, response delivery
+ * and unsubscription, with state.range(0) other requests pending
+ */
+void BM_EventDispatcherImpl_RequestLifeCycle(benchmark::State& state) {
+  event_engine::EventDispatcherImpl dispatcher;
+  Observers observers;
+  CreateObservers(dispatcher, static_cast<size_t>(state.range(0)), observers);
+  for (Observers::const_iterator it = observers.begin(); it != observers.end();
+       ++it) {
+    (*it)->Subscribe();
+  }
+
+  PendingRequestObserver observer(dispatcher, state.range(0) + 1);
+  event_engine::Event event(kEventId);
+  SetResponse(observer.correlation_id(), event);
+
+  for (auto _ : state) {
+    observer.Subscribe();
+    dispatcher.raise_event(event);
+    dispatcher.remove_observer(kEventId, observer);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EventDispatcherImpl_RequestLifeCycle)->Arg(0)->Arg(256);
+
+}  // namespace event_dispatcher_benchmark
+}  // namespace benchmarks
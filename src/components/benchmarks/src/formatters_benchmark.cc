@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "benchmarks/payloads.h"
+#include "formatters/CFormatterJsonBase.h"
+#include "formatters/CFormatterJsonSDLRPCv2.h"
+#include "formatters/CSmartFactory.h"
+#include "formatters/smart_json_reader.h"
+#include "formatters/smart_json_writer.h"
+#include "interfaces/MOBILE_API.h"
+#include "interfaces/MOBILE_API_schema.h"
+#include "json/value.h"
+#include "smart_objects/object_schema_item.h"
+#include "smart_objects/smart_object.h"
+#include "smart_objects/smart_schema.h"
+#include "utils/jsoncpp_reader_wrapper.h"
+#include "utils/semantic_version.h"
+
+namespace benchmarks {
+namespace formatters_benchmark {
+
+namespace smart_objects = ns_smart_device_link::ns_smart_objects;
+namespace formatters = ns_smart_device_link::ns_json_handler::formatters;
+
+typedef formatters::CFormatterJsonSDLRPCv2 Formatter;
+
+namespace {
+const int32_t kCorrelationId = 42;
+
+// Version of MOBILE_API the payloads follow
+const utils::SemanticVersion kMessageVersion(7, 0, 0);
+
+smart_objects::SmartObject ParsePayload(
+    const std::string& payload,
+    const mobile_apis::FunctionID::eType function_id,
+    const mobile_apis::messageType::eType message_type) {
+  smart_objects::SmartObject object;
+  Formatter::fromString(
+      payload, object, function_id, message_type, kCorrelationId);
+  return object;
+}
+}  // namespace
+
+void BM_CFormatterJsonSDLRPCv2_FromString(
+    benchmark::State& state,
+    const char* payload,
+    const mobile_apis::FunctionID::eType function_id,
+    const mobile_apis::messageType::eType message_type) {
+  const std::string json(payload);
+  for (auto _ : state) {
+    smart_objects::SmartObject object;
+    const bool result = Formatter::fromString(
+        json, object, function_id, message_type, kCorrelationId);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK_CAPTURE(BM_CFormatterJsonSDLRPCv2_FromString,
+                  RegisterAppInterface,
+                  payloads::kRegisterAppInterfaceRequest,
+                  mobile_apis::FunctionID::RegisterAppInterfaceID,
+                  mobile_apis::messageType::request);
+BENCHMARK_CAPTURE(BM_CFormatterJsonSDLRPCv2_FromString,
+                  Show,
+                  payloads::kShowRequest,
+                  mobile_apis::FunctionID::ShowID,
+                  mobile_apis::messageType::request);
+BENCHMARK_CAPTURE(BM_CFormatterJsonSDLRPCv2_FromString,
+                  GetVehicleDataResponse,
+                  payloads::kGetVehicleDataResponse,
+                  mobile_apis::FunctionID::GetVehicleDataID,
+                  mobile_apis::messageType::response);
+
+void BM_CFormatterJsonSDLRPCv2_ToString(
+    benchmark::State& state,
+    const char* payload,
+    const mobile_apis::FunctionID::eType function_id,
+    const mobile_apis::messageType::eType message_type) {
+  const smart_objects::SmartObject object =
+      ParsePayload(payload, function_id, message_type);
+  std::string json;
+  for (auto _ : state) {
+    json.clear();
+    const bool result = Formatter::toString(object, json);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK_CAPTURE(BM_CFormatterJsonSDLRPCv2_ToString,
+                  RegisterAppInterface,
+                  payloads::kRegisterAppInterfaceRequest,
+                  mobile_apis::FunctionID::RegisterAppInterfaceID,
+                  mobile_apis::messageType::request);
+BENCHMARK_CAPTURE(BM_CFormatterJsonSDLRPCv2_ToString,
+                  Show,
+                  payloads::kShowRequest,
+                  mobile_apis::FunctionID::ShowID,
+                  mobile_apis::messageType::request);
+BENCHMARK_CAPTURE(BM_CFormatterJsonSDLRPCv2_ToString,
+                  GetVehicleDataResponse,
+                  payloads::kGetVehicleDataResponse,
+                  mobile_apis::FunctionID::GetVehicleDataID,
+                  mobile_apis::messageType::response);
+
+/*
+ * Parsing and writing of JSON through intermediate Json::Value, the way
+ * formatters did it before SmartJsonReader and SmartJsonWriter
+ */
+void BM_Json_ParseAndWrite_JsonValue(benchmark::State& state,
+                                     const char* payload) {
+  const std::string json(payload);
+  utils::JsonReader reader;
+  for (auto _ : state) {
+    Json::Value value;
+    reader.parse(json, &value);
+    smart_objects::SmartObject object;
+    formatters::CFormatterJsonBase::jsonValueToObj(value, object);
+    Json::Value out_value;
+    formatters::CFormatterJsonBase::objToJsonValue(object, out_value);
+    const std::string out = out_value.toStyledString();
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK_CAPTURE(BM_Json_ParseAndWrite_JsonValue,
+                  RegisterAppInterface,
+                  payloads::kRegisterAppInterfaceRequest);
+BENCHMARK_CAPTURE(BM_Json_ParseAndWrite_JsonValue,
+                  Show,
+                  payloads::kShowRequest);
+
+/*
+ * Same conversion done by SmartJsonReader and SmartJsonWriter directly
+ */
+void BM_Json_ParseAndWrite_Direct(benchmark::State& state,
+                                  const char* payload) {
+  const std::string json(payload);
+  formatters::SmartJsonReader reader;
+  for (auto _ : state) {
+    smart_objects::SmartObject object;
+    reader.Parse(json, object);
+    std::string out;
+    formatters::SmartJsonWriter::Write(object, out);
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK_CAPTURE(BM_Json_ParseAndWrite_Direct,
+                  RegisterAppInterface,
+                  payloads::kRegisterAppInterfaceRequest);
+BENCHMARK_CAPTURE(BM_Json_ParseAndWrite_Direct, Show, payloads::kShowRequest);
+
+/*
+ * Validation of message with MOBILE_API schema already attached, the way
+ * RPCHandlerImpl validates every incoming mobile request
+ */
+void BM_CSmartSchema_Validate(
+    benchmark::State& state,
+    const char* payload,
+    const mobile_apis::FunctionID::eType function_id,
+    const mobile_apis::messageType::eType message_type) {
+  mobile_apis::MOBILE_API factory;
+  smart_objects::SmartObject object =
+      ParsePayload(payload, function_id, message_type);
+  rpc::ValidationReport attach_report("RPC");
+  if (!factory.attachSchema(object, false, kMessageVersion, &attach_report)) {
+    state.SkipWithError("Failed to attach schema");
+    return;
+  }
+
+  for (auto _ : state) {
+    rpc::ValidationReport report("RPC");
+    const smart_objects::errors::eType result =
+        object.validate(&report, kMessageVersion, false);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK_CAPTURE(BM_CSmartSchema_Validate,
+                  RegisterAppInterface,
+                  payloads::kRegisterAppInterfaceRequest,
+                  mobile_apis::FunctionID::RegisterAppInterfaceID,
+                  mobile_apis::messageType::request);
+BENCHMARK_CAPTURE(BM_CSmartSchema_Validate,
+                  Show,
+                  payloads::kShowRequest,
+                  mobile_apis::FunctionID::ShowID,
+                  mobile_apis::messageType::request);
+BENCHMARK_CAPTURE(BM_CSmartSchema_Validate,
+                  GetVehicleDataResponse,
+                  payloads::kGetVehicleDataResponse,
+                  mobile_apis::FunctionID::GetVehicleDataID,
+                  mobile_apis::messageType::response);
+
+/*
+ * Validation of Show msg_params by schema of generated MOBILE_API, compiled
+ * argument selects the validator emitted by InterfaceGenerator instead of
+ * generic member lookup
+ */
+void BM_CObjectSchemaItem_Validate(benchmark::State& state) {
+  namespace strings = ns_smart_device_link::ns_json_handler::strings;
+  const bool compiled = 0 != state.range(0);
+  // Own factory, since its schema is changed to get generic validation
+  mobile_apis::MOBILE_API factory;
+  smart_objects::SmartObject object =
+      ParsePayload(payloads::kShowRequest,
+                   mobile_apis::FunctionID::ShowID,
+                   mobile_apis::messageType::request);
+  rpc::ValidationReport attach_report("RPC");
+  if (!factory.attachSchema(object, false, kMessageVersion, &attach_report)) {
+    state.SkipWithError("Failed to attach schema");
+    return;
+  }
+  smart_objects::CSmartSchema schema;
+  if (!factory.GetSchema(mobile_apis::FunctionID::ShowID,
+                         mobile_apis::messageType::request,
+                         schema)) {
+    state.SkipWithError("Failed to get schema");
+    return;
+  }
+  boost::optional<smart_objects::SMember&> msg_params =
+      schema.getSchemaItem()->GetMemberSchemaItem(strings::S_MSG_PARAMS);
+  if (!msg_params) {
+    state.SkipWithError("Schema has no msg_params");
+    return;
+  }
+  smart_objects::ISchemaItem* const msg_params_schema =
+      msg_params->mSchemaItem;
+  if (!compiled) {
+    // Member handed out for modification drops the compiled validator
+    msg_params_schema->GetMemberSchemaItem("mainField1");
+  }
+
+  const smart_objects::SmartObject& msg_params_object =
+      object[strings::S_MSG_PARAMS];
+  rpc::ValidationReport check_report("RPC");
+  if (smart_objects::errors::OK !=
+      msg_params_schema->validate(
+          msg_params_object, &check_report, kMessageVersion, false)) {
+    state.SkipWithError("Payload is not valid");
+    return;
+  }
+  for (auto _ : state) {
+    rpc::ValidationReport report("RPC");
+    const smart_objects::errors::eType result = msg_params_schema->validate(
+        msg_params_object, &report, kMessageVersion, false);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CObjectSchemaItem_Validate)->Arg(0)->Arg(1);
+
+/*
+ * Whole incoming mobile message path of formatters: parsing, schema
+ * attachment and validation
+ */
+void BM_CFormatterJsonSDLRPCv2_ParseAndValidate(benchmark::State& state) {
+  mobile_apis::MOBILE_API factory;
+  const std::string json(payloads::kShowRequest);
+  for (auto _ : state) {
+    smart_objects::SmartObject object;
+    Formatter::fromString(json,
+                          object,
+                          mobile_apis::FunctionID::ShowID,
+                          mobile_apis::messageType::request,
+                          kCorrelationId);
+    rpc::ValidationReport report("RPC");
+    const bool result =
+        factory.attachSchema(object, true, kMessageVersion, &report) &&
+        object.validate(&report, kMessageVersion, false) ==
+            smart_objects::errors::OK;
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_CFormatterJsonSDLRPCv2_ParseAndValidate);
+
+}  // namespace formatters_benchmark
+}  // namespace benchmarks
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "benchmarks/payloads.h"
+
+#include "protocol/common.h"
+
+namespace benchmarks {
+namespace payloads {
+
+using namespace protocol_handler;
+
+const char* const kRegisterAppInterfaceRequest =
+    "{\"syncMsgVersion\":{\"majorVersion\":7,\"minorVersion\":0,"
+    "\"patchVersion\":0},"
+    "\"appName\":\"SyncProxyTester\","
+    "\"ttsName\":[{\"text\":\"Sync Proxy Tester\",\"type\":\"TEXT\"}],"
+    "\"ngnMediaScreenAppName\":\"SPT\","
+    "\"vrSynonyms\":[\"Sync Proxy Tester\",\"Proxy Tester\"],"
+    "\"isMediaApplication\":true,"
+    "\"languageDesired\":\"EN-US\","
+    "\"hmiDisplayLanguageDesired\":\"EN-US\","
+    "\"appHMIType\":[\"MEDIA\",\"DEFAULT\"],"
+    "\"hashID\":\"0ab7d8c1f8c6a5e1\","
+    "\"deviceInfo\":{\"hardware\":\"SM-G935F\",\"firmwareRev\":\"1.0\","
+    "\"os\":\"Android\",\"osVersion\":\"11\",\"carrier\":\"Carrier\","
+    "\"maxNumberRFCOMMPorts\":1},"
+    "\"appID\":\"8675309\","
+    "\"fullAppID\":\"8675309-fe46-4b48-a8f4-0a0dd2e6a5d1\","
+    "\"appInfo\":{\"appDisplayName\":\"Sync Proxy Tester\","
+    "\"appBundleID\":\"com.smartdevicelink.tester\","
+    "\"appVersion\":\"4.12.0\"},"
+    "\"dayColorScheme\":{\"primaryColor\":{\"red\":0,\"green\":120,"
+    "\"blue\":215},\"backgroundColor\":{\"red\":255,\"green\":255,"
+    "\"blue\":255}}}";
+
+const char* const kShowRequest =
+    "{\"mainField1\":\"Track 7 of 12\","
+    "\"mainField2\":\"The Artist\","
+    "\"mainField3\":\"The Album\","
+    "\"mainField4\":\"00:42 / 03:55\","
+    "\"alignment\":\"CENTERED\","
+    "\"statusBar\":\"Playing\","
+    "\"mediaTrack\":\"7/12\","
+    "\"softButtons\":["
+    "{\"type\":\"TEXT\",\"text\":\"Prev\",\"softButtonID\":1,"
+    "\"systemAction\":\"DEFAULT_ACTION\",\"isHighlighted\":false},"
+    "{\"type\":\"TEXT\",\"text\":\"Pause\",\"softButtonID\":2,"
+    "\"systemAction\":\"DEFAULT_ACTION\",\"isHighlighted\":true},"
+    "{\"type\":\"TEXT\",\"text\":\"Next\",\"softButtonID\":3,"
+    "\"systemAction\":\"DEFAULT_ACTION\",\"isHighlighted\":false}],"
+    "\"customPresets\":[\"Preset 1\",\"Preset 2\",\"Preset 3\"]}";
+
+const char* const kGetVehicleDataResponse =
+    "{\"success\":true,\"resultCode\":\"SUCCESS\","
+    "\"gps\":{\"longitudeDegrees\":-83.045753,\"latitudeDegrees\":42.331429,"
+    "\"utcYear\":2021,\"utcMonth\":6,\"utcDay\":14,\"utcHours\":13,"
+    "\"utcMinutes\":27,\"utcSeconds\":41,\"compassDirection\":\"NORTH\","
+    "\"pdop\":1.2,\"hdop\":0.8,\"vdop\":0.9,\"actual\":true,"
+    "\"satellites\":9,\"dimension\":\"3D\",\"altitude\":183.5,"
+    "\"heading\":12.5,\"speed\":54.3},"
+    "\"speed\":54.3,\"rpm\":1850,\"fuelLevel\":63.5,"
+    "\"externalTemperature\":21.5,\"odometer\":23874,"
+    "\"prndl\":\"DRIVE\","
+    "\"tirePressure\":{\"pressureTelltale\":\"OFF\","
+    "\"leftFront\":{\"status\":\"NORMAL\"},"
+    "\"rightFront\":{\"status\":\"NORMAL\"},"
+    "\"leftRear\":{\"status\":\"NORMAL\"},"
+    "\"rightRear\":{\"status\":\"NORMAL\"}},"
+    "\"engineTorque\":210.5,\"accPedalPosition\":18.5,"
+    "\"steeringWheelAngle\":-2.5}";
+
+std::vector<uint8_t> SerializeSingleFrames(const std::string& payload,
+                                           const size_t count) {
+  std::vector<uint8_t> data;
+  for (size_t i = 0; i < count; ++i) {
+    const ProtocolPacket packet(
+        0u,
+        PROTOCOL_VERSION_5,
+        PROTECTION_OFF,
+        FRAME_TYPE_SINGLE,
+        kRpc,
+        FRAME_DATA_SINGLE,
+        1u,
+        payload.size(),
+        i + 1,
+        reinterpret_cast<const uint8_t*>(payload.data()));
+    const RawMessagePtr raw = packet.serializePacket();
+    data.insert(data.end(), raw->data(), raw->data() + raw->data_size());
+  }
+  return data;
+}
+
+void PrepareMultiFrames(const ConnectionID connection_id,
+                        const uint32_t message_id,
+                        const std::vector<uint8_t>& data,
+                        ProtocolFramePtrList& frames) {
+  const size_t frame_size = MAXIMUM_FRAME_DATA_V2_SIZE;
+  const size_t frames_count = (data.size() + frame_size - 1) / frame_size;
+
+  uint8_t first_frame_data[FIRST_FRAME_DATA_SIZE];
+  first_frame_data[0] = data.size() >> 24;
+  first_frame_data[1] = data.size() >> 16;
+  first_frame_data[2] = data.size() >> 8;
+  first_frame_data[3] = data.size();
+  first_frame_data[4] = frames_count >> 24;
+  first_frame_data[5] = frames_count >> 16;
+  first_frame_data[6] = frames_count >> 8;
+  first_frame_data[7] = frames_count;
+
+  const ProtocolFramePtr first_frame(new ProtocolPacket(connection_id,
+                                                        PROTOCOL_VERSION_5,
+                                                        PROTECTION_OFF,
+                                                        FRAME_TYPE_FIRST,
+                                                        kBulk,
+                                                        FRAME_DATA_FIRST,
+                                                        1u,
+                                                        FIRST_FRAME_DATA_SIZE,
+                                                        message_id,
+                                                        first_frame_data));
+  first_frame->set_total_data_bytes(data.size());
+  frames.push_back(first_frame);
+
+  for (size_t i = 0; i < frames_count; ++i) {
+    const bool is_last_frame = (frames_count - 1) == i;
+    const size_t offset = frame_size * i;
+    const size_t size =
+        is_last_frame ? data.size() - offset : frame_size;
+    const uint8_t frame_data =
+        is_last_frame ? FRAME_DATA_LAST_CONSECUTIVE
+                      : (i % FRAME_DATA_MAX_CONSECUTIVE + 1);
+    frames.push_back(
+        std::make_shared<ProtocolPacket>(connection_id,
+                                         PROTOCOL_VERSION_5,
+                                         PROTECTION_OFF,
+                                         FRAME_TYPE_CONSECUTIVE,
+                                         kBulk,
+                                         frame_data,
+                                         1u,
+                                         size,
+                                         message_id,
+                                         &data[offset]));
+  }
+}
+
+}  // namespace payloads
+}  // namespace benchmarks
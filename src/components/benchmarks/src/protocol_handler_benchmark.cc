@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmarks/payloads.h"
+#include "protocol_handler/incoming_data_handler.h"
+#include "protocol_handler/multiframe_builder.h"
+#include "protocol_handler/protocol_packet.h"
+#include "utils/shared_buffer.h"
+
+namespace benchmarks {
+namespace protocol_handler_benchmark {
+
+using namespace protocol_handler;
+
+namespace {
+const transport_manager::ConnectionUID kConnectionId = 1u;
+
+// Typical size of data read from transport at once
+const size_t kTransportChunkSize = 1500;
+}  // namespace
+
+/*
+ * IncomingDataHandler::ProcessData with transport data carrying
+ * state.range(0) complete frames at once
+ */
+void BM_IncomingDataHandler_ProcessData(benchmark::State& state) {
+  const std::vector<uint8_t> data = payloads::SerializeSingleFrames(
+      payloads::kShowRequest, static_cast<size_t>(state.range(0)));
+
+  ProtocolPacket::ProtocolHeaderValidator validator;
+  IncomingDataHandler handler;
+  handler.set_validator(&validator);
+  handler.AddConnection(kConnectionId);
+
+  RESULT_CODE result = RESULT_OK;
+  size_t malformed_occurrence = 0;
+  for (auto _ : state) {
+    const RawMessage message(
+        kConnectionId, PROTOCOL_VERSION_5, &data[0], data.size(), false);
+    ProtocolFramePtrList frames =
+        handler.ProcessData(message, result, &malformed_occurrence);
+    benchmark::DoNotOptimize(frames);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IncomingDataHandler_ProcessData)->Arg(1)->Arg(16);
+
+/*
+ * IncomingDataHandler::ProcessData with frames split between transport
+ * reads, so headers and payloads cross chunk borders
+ */
+void BM_IncomingDataHandler_ProcessFragmentedData(benchmark::State& state) {
+  const std::vector<uint8_t> data =
+      payloads::SerializeSingleFrames(payloads::kRegisterAppInterfaceRequest,
+                                      static_cast<size_t>(state.range(0)));
+
+  ProtocolPacket::ProtocolHeaderValidator validator;
+  IncomingDataHandler handler;
+  handler.set_validator(&validator);
+  handler.AddConnection(kConnectionId);
+
+  RESULT_CODE result = RESULT_OK;
+  size_t malformed_occurrence = 0;
+  for (auto _ : state) {
+    for (size_t offset = 0; offset < data.size();
+         offset += kTransportChunkSize) {
+      const size_t size = std::min(kTransportChunkSize, data.size() - offset);
+      const RawMessage message(
+          kConnectionId, PROTOCOL_VERSION_5, &data[offset], size, false);
+      ProtocolFramePtrList frames =
+          handler.ProcessData(message, result, &malformed_occurrence);
+      benchmark::DoNotOptimize(frames);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IncomingDataHandler_ProcessFragmentedData)->Arg(16);
+
+void BM_ProtocolPacket_Serialize(benchmark::State& state) {
+  const std::string payload(payloads::kRegisterAppInterfaceRequest);
+  const ProtocolPacket packet(
+      kConnectionId,
+      PROTOCOL_VERSION_5,
+      PROTECTION_OFF,
+      FRAME_TYPE_SINGLE,
+      kRpc,
+      FRAME_DATA_SINGLE,
+      1u,
+      payload.size(),
+      1u,
+      reinterpret_cast<const uint8_t*>(payload.data()));
+
+  for (auto _ : state) {
+    RawMessagePtr raw = packet.serializePacket();
+    benchmark::DoNotOptimize(raw);
+  }
+  state.SetBytesProcessed(state.iterations() * packet.packet_size());
+}
+BENCHMARK(BM_ProtocolPacket_Serialize);
+
+void BM_ProtocolPacket_Deserialize(benchmark::State& state) {
+  const std::vector<uint8_t> data = payloads::SerializeSingleFrames(
+      payloads::kRegisterAppInterfaceRequest, 1u);
+
+  for (auto _ : state) {
+    ProtocolPacket packet(kConnectionId);
+    const RESULT_CODE result = packet.deserializePacket(&data[0], data.size());
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_ProtocolPacket_Deserialize);
+
+/*
+ * Deserialization referencing the payload as a slice of the transport
+ * buffer, the way IncomingDataHandler does it
+ */
+void BM_ProtocolPacket_DeserializeShared(benchmark::State& state) {
+  const std::vector<uint8_t> data = payloads::SerializeSingleFrames(
+      payloads::kRegisterAppInterfaceRequest, 1u);
+  const utils::SharedBuffer buffer =
+      utils::SharedBuffer::Copy(&data[0], data.size());
+
+  for (auto _ : state) {
+    ProtocolPacket packet(kConnectionId);
+    const RESULT_CODE result = packet.deserializePacket(buffer);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_ProtocolPacket_DeserializeShared);
+
+/*
+ * Assembling of multiframe message from prepared frames
+ */
+void BM_MultiFrameBuilder_Assemble(benchmark::State& state) {
+  std::vector<uint8_t> data(payloads::kMultiFrameDataSize);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<uint8_t>(i);
+  }
+
+  MultiFrameBuilder builder;
+  builder.AddConnection(kConnectionId);
+
+  uint32_t message_id = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    ProtocolFramePtrList frames;
+    payloads::PrepareMultiFrames(kConnectionId, ++message_id, data, frames);
+    state.ResumeTiming();
+
+    for (ProtocolFramePtrList::const_iterator it = frames.begin();
+         it != frames.end();
+         ++it) {
+      builder.AddFrame(*it);
+    }
+    ProtocolFramePtrList assembled = builder.PopMultiframes();
+    benchmark::DoNotOptimize(assembled);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_MultiFrameBuilder_Assemble);
+
+}  // namespace protocol_handler_benchmark
+}  // namespace benchmarks
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <memory>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmarks/payloads.h"
+#include "utils/bucket_prioritized_queue.h"
+#include "utils/message_queue.h"
+#include "utils/mpsc_queue.h"
+#include "utils/prioritized_queue.h"
+
+namespace benchmarks {
+namespace queues_benchmark {
+
+namespace {
+// Amount of priority levels messages are spread between, matches amount of
+// distinct message priorities in application manager
+const size_t kPrioritiesCount = 4;
+
+/*
+ * Message mimicking queued application manager messages: shared pointer
+ * to the message with priority taken from it
+ */
+struct QueuedMessage : public std::shared_ptr<const std::string> {
+  QueuedMessage() : priority_(0) {}
+  QueuedMessage(const std::shared_ptr<const std::string>& message,
+                const size_t priority)
+      : std::shared_ptr<const std::string>(message), priority_(priority) {}
+  // PrioritizedQueue requires this method to decide which priority to assign
+  size_t PriorityOrder() const {
+    return priority_;
+  }
+
+ private:
+  size_t priority_;
+};
+
+std::vector<QueuedMessage> PrepareMessages(const size_t count) {
+  const std::shared_ptr<const std::string> payload =
+      std::make_shared<const std::string>(payloads::kShowRequest);
+  std::vector<QueuedMessage> messages;
+  messages.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    messages.push_back(QueuedMessage(payload, i % kPrioritiesCount));
+  }
+  return messages;
+}
+}  // namespace
+
+/*
+ * Pushes state.range(0) messages of mixed priorities then pops them all
+ */
+template <typename Queue>
+void BM_PrioritizedQueue_PushPop(benchmark::State& state) {
+  const std::vector<QueuedMessage> messages =
+      PrepareMessages(static_cast<size_t>(state.range(0)));
+  Queue queue;
+  for (auto _ : state) {
+    for (size_t i = 0; i < messages.size(); ++i) {
+      queue.push(messages[i]);
+    }
+    while (!queue.empty()) {
+      benchmark::DoNotOptimize(queue.front());
+      queue.pop();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * messages.size());
+}
+BENCHMARK_TEMPLATE(BM_PrioritizedQueue_PushPop,
+                   utils::PrioritizedQueue<QueuedMessage>)
+    ->Arg(1)
+    ->Arg(64);
+BENCHMARK_TEMPLATE(BM_PrioritizedQueue_PushPop,
+                   utils::BucketPrioritizedQueue<QueuedMessage>)
+    ->Arg(1)
+    ->Arg(64);
+
+/*
+ * MessageQueue push/pop on single thread, measures locking and
+ * signalling overhead without contention
+ */
+template <typename Queue>
+void BM_MessageQueue_PushPop(benchmark::State& state) {
+  const std::vector<QueuedMessage> messages =
+      PrepareMessages(static_cast<size_t>(state.range(0)));
+  utils::MessageQueue<QueuedMessage, Queue> queue;
+  QueuedMessage message;
+  for (auto _ : state) {
+    for (size_t i = 0; i < messages.size(); ++i) {
+      queue.push(messages[i]);
+    }
+    while (queue.pop(message)) {
+      benchmark::DoNotOptimize(message);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * messages.size());
+}
+BENCHMARK_TEMPLATE(BM_MessageQueue_PushPop, std::queue<QueuedMessage>)
+    ->Arg(1)
+    ->Arg(64);
+BENCHMARK_TEMPLATE(BM_MessageQueue_PushPop,
+                   utils::BucketPrioritizedQueue<QueuedMessage>)
+    ->Arg(1)
+    ->Arg(64);
+BENCHMARK_TEMPLATE(BM_MessageQueue_PushPop, utils::MpscQueue<QueuedMessage>)
+    ->Arg(1)
+    ->Arg(64);
+
+/*
+ * MessageQueue with consumer on another thread, the way MessageLoopThread
+ * drains it. Measures producer side throughput
+ */
+template <typename Queue>
+void BM_MessageQueue_ProducerConsumer(benchmark::State& state) {
+  const std::vector<QueuedMessage> messages =
+      PrepareMessages(static_cast<size_t>(state.range(0)));
+  utils::MessageQueue<QueuedMessage, Queue> queue;
+
+  std::thread consumer([&queue]() {
+    QueuedMessage message;
+    while (!queue.IsShuttingDown()) {
+      while (queue.pop(message)) {
+      }
+      queue.wait();
+    }
+  });
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < messages.size(); ++i) {
+      queue.push(messages[i]);
+    }
+  }
+  queue.Shutdown();
+  consumer.join();
+  state.SetItemsProcessed(state.iterations() * messages.size());
+}
+BENCHMARK_TEMPLATE(BM_MessageQueue_ProducerConsumer,
+                   std::queue<QueuedMessage>)
+    ->Arg(64)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MessageQueue_ProducerConsumer,
+                   utils::MpscQueue<QueuedMessage>)
+    ->Arg(64)
+    ->UseRealTime();
+
+}  // namespace queues_benchmark
+}  // namespace benchmarks
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "benchmarks/payloads.h"
+#include "formatters/CFormatterJsonBase.h"
+#include "json/value.h"
+#include "smart_objects/smart_object.h"
+#include "utils/jsoncpp_reader_wrapper.h"
+
+namespace benchmarks {
+namespace smart_objects_benchmark {
+
+namespace smart_objects = ns_smart_device_link::ns_smart_objects;
+namespace formatters = ns_smart_device_link::ns_json_handler::formatters;
+
+namespace {
+/**
+ * @brief Builds Show request the way it is passed between AM components
+ */
+smart_objects::SmartObject MakeShowRequest() {
+  Json::Value msg_params;
+  utils::JsonReader reader;
+  reader.parse(payloads::kShowRequest, &msg_params);
+
+  smart_objects::SmartObject request(smart_objects::SmartType_Map);
+  formatters::CFormatterJsonBase::jsonValueToObj(msg_params,
+                                                 request["msg_params"]);
+  smart_objects::SmartObject& params = request["params"];
+  params["function_id"] = 13;
+  params["message_type"] = 0;
+  params["correlation_id"] = 42;
+  params["connection_key"] = 65537;
+  params["protocol_type"] = 0;
+  params["protocol_version"] = 5;
+  return request;
+}
+}  // namespace
+
+/*
+ * Copy of message which containers are already shared, what every command
+ * does with the message it handles
+ */
+void BM_SmartObject_Copy(benchmark::State& state) {
+  const smart_objects::SmartObject original = MakeShowRequest();
+  const smart_objects::SmartObject shared = original;
+  for (auto _ : state) {
+    smart_objects::SmartObject copy = shared;
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SmartObject_Copy);
+
+/*
+ * Copy followed by change of single parameter, which detaches only the
+ * containers on the path to it
+ */
+void BM_SmartObject_CopyAndChange(benchmark::State& state) {
+  const smart_objects::SmartObject original = MakeShowRequest();
+  const smart_objects::SmartObject shared = original;
+  int32_t correlation_id = 0;
+  for (auto _ : state) {
+    smart_objects::SmartObject copy = shared;
+    copy["params"]["correlation_id"] = ++correlation_id;
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SmartObject_CopyAndChange);
+
+}  // namespace smart_objects_benchmark
+}  // namespace benchmarks
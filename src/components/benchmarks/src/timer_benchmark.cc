@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "utils/timer.h"
+#include "utils/timer_task_impl.h"
+
+namespace benchmarks {
+namespace timer_benchmark {
+
+namespace {
+// Long enough for timers to never expire during measurement, like request
+// default timeouts
+const timer::Milliseconds kTimeout = 10000u;
+
+class TimerClient {
+ public:
+  void OnTimeout() {}
+};
+}  // namespace
+
+/*
+ * Arming and disarming of existing timer, what RequestController and
+ * HeartBeatMonitor do on every message
+ */
+void BM_Timer_StartStop(benchmark::State& state) {
+  TimerClient client;
+  timer::Timer timer(
+      "Benchmark",
+      new timer::TimerTaskImpl<TimerClient>(&client, &TimerClient::OnTimeout));
+  for (auto _ : state) {
+    timer.Start(kTimeout, timer::kSingleShot);
+    timer.Stop();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Timer_StartStop);
+
+/*
+ * Re-arming of running timer
+ */
+void BM_Timer_Restart(benchmark::State& state) {
+  TimerClient client;
+  timer::Timer timer(
+      "Benchmark",
+      new timer::TimerTaskImpl<TimerClient>(&client, &TimerClient::OnTimeout));
+  for (auto _ : state) {
+    timer.Start(kTimeout, timer::kSingleShot);
+  }
+  timer.Stop();
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Timer_Restart);
+
+/*
+ * Creation, arming and destruction of timer with state.range(0) other
+ * timers armed, the way short living timers of requests are used
+ */
+void BM_Timer_Churn(benchmark::State& state) {
+  TimerClient client;
+  std::vector<std::unique_ptr<timer::Timer> > armed_timers;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    armed_timers.emplace_back(new timer::Timer(
+        "Armed",
+        new timer::TimerTaskImpl<TimerClient>(&client,
+                                              &TimerClient::OnTimeout)));
+    armed_timers.back()->Start(kTimeout + i, timer::kSingleShot);
+  }
+
+  for (auto _ : state) {
+    timer::Timer timer("Benchmark",
+                       new timer::TimerTaskImpl<TimerClient>(
+                           &client, &TimerClient::OnTimeout));
+    timer.Start(kTimeout, timer::kSingleShot);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Timer_Churn)->Arg(0)->Arg(1024);
+
+}  // namespace timer_benchmark
+}  // namespace benchmarks
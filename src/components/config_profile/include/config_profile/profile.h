@@ -207,6 +207,18 @@ class Profile : public protocol_handler::ProtocolHandlerSettings,
    */
   const uint16_t& time_testing_port() const;
 
+  /**
+   * @brief Returns period of telemetry statistics export in milliseconds,
+   * 0 disables export
+   */
+  uint32_t telemetry_statistics_period() const;
+
+  /**
+   * @brief Returns path of unix socket serving telemetry statistics,
+   * empty if statistics are only written to log
+   */
+  const std::string& telemetry_statistics_socket() const;
+
   /**
    * @brief Returns hmi capabilities file name
    */
@@ -334,6 +346,40 @@ class Profile : public protocol_handler::ProtocolHandlerSettings,
    */
   const uint32_t video_data_stopped_timeout() const;
 
+  /**
+   * @brief Returns limit of messages queued for video consumer,
+   * 0 means no limit
+   */
+  const uint32_t video_streaming_queue_size() const OVERRIDE;
+
+  /**
+   * @brief Returns policy applied when video streaming queue is full
+   */
+  const std::string& video_streaming_queue_policy() const OVERRIDE;
+
+  /**
+   * @brief Returns limit of messages queued for audio consumer,
+   * 0 means no limit
+   */
+  const uint32_t audio_streaming_queue_size() const OVERRIDE;
+
+  /**
+   * @brief Returns policy applied when audio streaming queue is full
+   */
+  const std::string& audio_streaming_queue_policy() const OVERRIDE;
+
+  /**
+   * @brief Returns types of consumers getting video stream in addition to
+   * the one set by video_server_type()
+   */
+  const std::vector<std::string>& video_additional_consumers() const OVERRIDE;
+
+  /**
+   * @brief Returns types of consumers getting audio stream in addition to
+   * the one set by audio_server_type()
+   */
+  const std::vector<std::string>& audio_additional_consumers() const OVERRIDE;
+
   /**
    * @brief Returns allowable max amount of requests per time scale for
    * application in hmi level none
@@ -426,6 +472,12 @@ class Profile : public protocol_handler::ProtocolHandlerSettings,
   const std::string& transport_manager_tcp_adapter_network_interface()
       const OVERRIDE;
 
+  /**
+   * @brief Returns amount of reactor threads serving TCP connections,
+   * 0 means thread per connection
+   */
+  uint16_t transport_manager_tcp_reactor_threads() const OVERRIDE;
+
 #ifdef WEBSOCKET_SERVER_TRANSPORT_SUPPORT
   /**
    * @brief Returns websocket server address
@@ -730,6 +782,10 @@ class Profile : public protocol_handler::ProtocolHandlerSettings,
 
   uint16_t open_attempt_timeout_ms() const;
 
+  bool use_policy_db_write_ahead_log() const;
+
+  uint32_t policy_db_mmap_size() const;
+
   uint32_t resumption_delay_before_ign() const;
 
   const uint32_t resumption_delay_after_ign() const;
@@ -738,6 +794,17 @@ class Profile : public protocol_handler::ProtocolHandlerSettings,
 
   bool logs_enabled() const;
 
+  /**
+   * @brief Returns file enabled log messages are written to in binary form,
+   * empty if text logging is used
+   */
+  const std::string& binary_log_file_name() const;
+
+  /**
+   * @brief Returns max size of binary log file in bytes
+   */
+  uint32_t binary_log_max_file_size() const;
+
   /**
    * @brief Returns true if resumption ctrl uses db, returns false if
    * resumption ctrl uses JSON.
@@ -1008,6 +1075,8 @@ class Profile : public protocol_handler::ProtocolHandlerSettings,
   uint16_t audio_streaming_port_;
   uint32_t stop_streaming_timeout_;
   uint16_t time_testing_port_;
+  uint32_t telemetry_statistics_period_;
+  std::string telemetry_statistics_socket_;
   std::string hmi_capabilities_file_name_;
   std::string hmi_capabilities_cache_file_name_;
   std::vector<std::string> help_prompt_;
@@ -1051,6 +1120,7 @@ class Profile : public protocol_handler::ProtocolHandlerSettings,
   std::string system_files_path_;
   uint16_t transport_manager_tcp_adapter_port_;
   std::string transport_manager_tcp_adapter_network_interface_;
+  uint16_t transport_manager_tcp_reactor_threads_;
 #ifdef WEBSOCKET_SERVER_TRANSPORT_SUPPORT
   std::string websocket_server_address_;
   uint16_t websocket_server_port_;
@@ -1073,6 +1143,12 @@ class Profile : public protocol_handler::ProtocolHandlerSettings,
   std::string tts_delimiter_;
   uint32_t audio_data_stopped_timeout_;
   uint32_t video_data_stopped_timeout_;
+  uint32_t video_streaming_queue_size_;
+  std::string video_streaming_queue_policy_;
+  uint32_t audio_streaming_queue_size_;
+  std::string audio_streaming_queue_policy_;
+  std::vector<std::string> video_additional_consumers_;
+  std::vector<std::string> audio_additional_consumers_;
   std::string mme_db_name_;
   std::string event_mq_name_;
   std::string ack_mq_name_;
@@ -1137,10 +1213,14 @@ class Profile : public protocol_handler::ProtocolHandlerSettings,
   uint32_t multiframe_waiting_timeout_;
   uint16_t attempts_to_open_policy_db_;
   uint16_t open_attempt_timeout_ms_;
+  bool use_policy_db_write_ahead_log_;
+  uint32_t policy_db_mmap_size_;
   uint32_t resumption_delay_before_ign_;
   uint32_t resumption_delay_after_ign_;
   uint32_t hash_string_size_;
   bool logs_enabled_;
+  std::string binary_log_file_name_;
+  uint32_t binary_log_max_file_size_;
   bool use_db_for_resumption_;
   uint16_t attempts_to_open_resumption_db_;
   uint16_t open_attempt_timeout_ms_resumption_db_;
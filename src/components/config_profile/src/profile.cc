@@ -105,11 +105,15 @@ const char* kPathToSnapshotKey = "PathToSnapshot";
 const char* kPreloadedPTKey = "PreloadedPT";
 const char* kAttemptsToOpenPolicyDBKey = "AttemptsToOpenPolicyDB";
 const char* kOpenAttemptTimeoutMsKey = "OpenAttemptTimeoutMs";
+const char* kUsePolicyDBWriteAheadLogKey = "UsePolicyDBWriteAheadLog";
+const char* kPolicyDBMmapSizeKey = "PolicyDBMmapSize";
 const char* kServerAddressKey = "ServerAddress";
 const char* kAppInfoStorageKey = "AppInfoStorage";
 const char* kAppStorageFolderKey = "AppStorageFolder";
 const char* kAppResourseFolderKey = "AppResourceFolder";
 const char* kLogsEnabledKey = "LogsEnabled";
+const char* kBinaryLogFileKey = "BinaryLogFile";
+const char* kBinaryLogMaxFileSizeKey = "BinaryLogMaxFileSize";
 const char* kAppConfigFolderKey = "AppConfigFolder";
 const char* kAppIconsFolderKey = "AppIconsFolder";
 const char* kAppIconsFolderMaxSizeKey = "AppIconsFolderMaxSize";
@@ -146,6 +150,14 @@ const char* kSecurityLevel = "SecurityLevel";
 
 const char* kAudioDataStoppedTimeoutKey = "AudioDataStoppedTimeout";
 const char* kVideoDataStoppedTimeoutKey = "VideoDataStoppedTimeout";
+const char* kVideoStreamingQueueSizeKey = "VideoStreamingQueueSize";
+const char* kVideoStreamingQueuePolicyKey = "VideoStreamingQueuePolicy";
+const char* kAudioStreamingQueueSizeKey = "AudioStreamingQueueSize";
+const char* kAudioStreamingQueuePolicyKey = "AudioStreamingQueuePolicy";
+const char* kVideoStreamAdditionalConsumersKey =
+    "VideoStreamAdditionalConsumers";
+const char* kAudioStreamAdditionalConsumersKey =
+    "AudioStreamAdditionalConsumers";
 const char* kMixingAudioSupportedKey = "MixingAudioSupported";
 const char* kHelpPromptKey = "HelpPromt";
 const char* kTimeoutPromptKey = "TimeOutPromt";
@@ -158,6 +170,7 @@ const char* kMaxSupportedProtocolVersionKey = "MaxSupportedProtocolVersion";
 const char* kUseLastStateKey = "UseLastState";
 const char* kTCPAdapterPortKey = "TCPAdapterPort";
 const char* kTCPAdapterNetworkInterfaceKey = "TCPAdapterNetworkInterface";
+const char* kTCPReactorThreadsKey = "TCPReactorThreads";
 #ifdef WEBSOCKET_SERVER_TRANSPORT_SUPPORT
 const char* kWebSocketServerAddressKey = "WebSocketServerAddress";
 const char* kWebSocketServerPortKey = "WebSocketServerPort";
@@ -174,6 +187,8 @@ const char* kVideoStreamingPortKey = "VideoStreamingPort";
 const char* kAudioStreamingPortKey = "AudioStreamingPort";
 const char* kStopStreamingTimeout = "StopStreamingTimeout";
 const char* kTimeTestingPortKey = "TimeTestingPort";
+const char* kTelemetryStatisticsPeriodKey = "TelemetryStatisticsPeriod";
+const char* kTelemetryStatisticsSocketKey = "TelemetryStatisticsSocket";
 const char* kThreadStackSizeKey = "ThreadStackSize";
 const char* kMaxCmdIdKey = "MaxCmdID";
 const char* kPutFileRequestKey = "PutFileRequest";
@@ -323,6 +338,10 @@ const char* kDefaultPluginsPath = "plugins";
 const char* kDefaultTtsDelimiter = ",";
 const uint32_t kDefaultAudioDataStoppedTimeout = 1000;
 const uint32_t kDefaultVideoDataStoppedTimeout = 1000;
+const uint32_t kDefaultVideoStreamingQueueSize = 1000;
+const char* kDefaultVideoStreamingQueuePolicy = "DropUntilKeyFrame";
+const uint32_t kDefaultAudioStreamingQueueSize = 1000;
+const char* kDefaultAudioStreamingQueuePolicy = "DropOldest";
 const char* kDefaultEventMQ = "/dev/mqueue/ToSDLCoreUSBAdapter";
 const char* kDefaultAckMQ = "/dev/mqueue/FromSDLCoreUSBAdapter";
 const char* kDefaultRecordingFileSourceName = "audio.8bit.wav";
@@ -347,6 +366,7 @@ const uint32_t kDefaultHubProtocolIndex = 0;
 const uint32_t kDefaultHeartBeatTimeout = 5000;
 const uint16_t kDefaultMaxSupportedProtocolVersion = 5;
 const uint16_t kDefautTransportManagerTCPPort = 12345;
+const uint16_t kDefaultTransportManagerTCPReactorThreads = 0;
 const uint16_t kDefaultWebSocketServerPort = 2020;
 const uint16_t kDefaultCloudAppRetryTimeout = 1000;
 const uint16_t kDefaultCloudAppMaxRetryAttempts = 5;
@@ -355,6 +375,8 @@ const uint16_t kDefaultVideoStreamingPort = 5050;
 const uint16_t kDefaultAudioStreamingPort = 5080;
 const uint32_t kDefaultStopStreamingTimeout = 1;
 const uint16_t kDefaultTimeTestingPort = 5090;
+const uint32_t kDefaultTelemetryStatisticsPeriod = 1000;
+const char* kDefaultTelemetryStatisticsSocket = "";
 const uint32_t kDefaultMaxCmdId = 2000000000;
 const uint32_t kDefaultPutFileRequestInNone = 5;
 const uint32_t kDefaultDeleteFileRequestInNone = 5;
@@ -395,7 +417,9 @@ const size_t kDefaultMalformedFrequencyTime = 1000;
 const uint32_t kDefaultExpectedConsecutiveFramesTimeout = 10000;
 const uint16_t kDefaultAttemptsToOpenPolicyDB = 5;
 const uint16_t kDefaultOpenAttemptTimeoutMs = 500;
+const uint32_t kDefaultPolicyDBMmapSize = 0;
 const uint32_t kDefaultAppIconsFolderMaxSize = 104857600;
+const uint32_t kDefaultBinaryLogMaxFileSize = 104857600;
 const uint32_t kDefaultAppIconsAmountToRemove = 1;
 const uint16_t kDefaultAttemptsToOpenResumptionDB = 5;
 const size_t kDefaultMaximumControlPayloadSize = 0;
@@ -475,6 +499,8 @@ Profile::Profile()
     , audio_streaming_port_(kDefaultAudioStreamingPort)
     , stop_streaming_timeout_(kDefaultStopStreamingTimeout)
     , time_testing_port_(kDefaultTimeTestingPort)
+    , telemetry_statistics_period_(kDefaultTelemetryStatisticsPeriod)
+    , telemetry_statistics_socket_(kDefaultTelemetryStatisticsSocket)
     , hmi_capabilities_file_name_(kDefaultHmiCapabilitiesFileName)
     , hmi_capabilities_cache_file_name_()
     , help_prompt_()
@@ -512,6 +538,8 @@ Profile::Profile()
     , supported_diag_modes_()
     , system_files_path_(kDefaultSystemFilesPath)
     , transport_manager_tcp_adapter_port_(kDefautTransportManagerTCPPort)
+    , transport_manager_tcp_reactor_threads_(
+          kDefaultTransportManagerTCPReactorThreads)
 #ifdef WEBSOCKET_SERVER_TRANSPORT_SUPPORT
     , websocket_server_address_(kDefaultWebsocketServerAddress)
     , websocket_server_port_(kDefaultWebSocketServerPort)
@@ -521,6 +549,10 @@ Profile::Profile()
     , tts_delimiter_(kDefaultTtsDelimiter)
     , audio_data_stopped_timeout_(kDefaultAudioDataStoppedTimeout)
     , video_data_stopped_timeout_(kDefaultVideoDataStoppedTimeout)
+    , video_streaming_queue_size_(kDefaultVideoStreamingQueueSize)
+    , video_streaming_queue_policy_(kDefaultVideoStreamingQueuePolicy)
+    , audio_streaming_queue_size_(kDefaultAudioStreamingQueueSize)
+    , audio_streaming_queue_policy_(kDefaultAudioStreamingQueuePolicy)
     , event_mq_name_(kDefaultEventMQ)
     , ack_mq_name_(kDefaultAckMQ)
     , recording_file_source_(kDefaultRecordingFileSourceName)
@@ -545,9 +577,12 @@ Profile::Profile()
     , multiframe_waiting_timeout_(kDefaultExpectedConsecutiveFramesTimeout)
     , attempts_to_open_policy_db_(kDefaultAttemptsToOpenPolicyDB)
     , open_attempt_timeout_ms_(kDefaultAttemptsToOpenPolicyDB)
+    , use_policy_db_write_ahead_log_(false)
+    , policy_db_mmap_size_(kDefaultPolicyDBMmapSize)
     , resumption_delay_before_ign_(kDefaultResumptionDelayBeforeIgn)
     , resumption_delay_after_ign_(kDefaultResumptionDelayAfterIgn)
     , hash_string_size_(kDefaultHashStringSize)
+    , binary_log_max_file_size_(kDefaultBinaryLogMaxFileSize)
     , use_db_for_resumption_(false)
     , attempts_to_open_resumption_db_(kDefaultAttemptsToOpenResumptionDB)
     , open_attempt_timeout_ms_resumption_db_(
@@ -724,6 +759,14 @@ const uint16_t& Profile::time_testing_port() const {
   return time_testing_port_;
 }
 
+uint32_t Profile::telemetry_statistics_period() const {
+  return telemetry_statistics_period_;
+}
+
+const std::string& Profile::telemetry_statistics_socket() const {
+  return telemetry_statistics_socket_;
+}
+
 const uint64_t Profile::thread_min_stack_size() const {
   return min_tread_stack_size_;
 }
@@ -780,6 +823,30 @@ const uint32_t Profile::video_data_stopped_timeout() const {
   return video_data_stopped_timeout_;
 }
 
+const uint32_t Profile::video_streaming_queue_size() const {
+  return video_streaming_queue_size_;
+}
+
+const std::string& Profile::video_streaming_queue_policy() const {
+  return video_streaming_queue_policy_;
+}
+
+const uint32_t Profile::audio_streaming_queue_size() const {
+  return audio_streaming_queue_size_;
+}
+
+const std::string& Profile::audio_streaming_queue_policy() const {
+  return audio_streaming_queue_policy_;
+}
+
+const std::vector<std::string>& Profile::video_additional_consumers() const {
+  return video_additional_consumers_;
+}
+
+const std::vector<std::string>& Profile::audio_additional_consumers() const {
+  return audio_additional_consumers_;
+}
+
 const uint32_t& Profile::app_time_scale() const {
   return app_requests_time_scale_;
 }
@@ -864,6 +931,10 @@ const std::string& Profile::transport_manager_tcp_adapter_network_interface()
   return transport_manager_tcp_adapter_network_interface_;
 }
 
+uint16_t Profile::transport_manager_tcp_reactor_threads() const {
+  return transport_manager_tcp_reactor_threads_;
+}
+
 #ifdef WEBSOCKET_SERVER_TRANSPORT_SUPPORT
 const std::string& Profile::websocket_server_address() const {
   return websocket_server_address_;
@@ -1039,6 +1110,14 @@ uint16_t Profile::open_attempt_timeout_ms() const {
   return open_attempt_timeout_ms_;
 }
 
+bool Profile::use_policy_db_write_ahead_log() const {
+  return use_policy_db_write_ahead_log_;
+}
+
+uint32_t Profile::policy_db_mmap_size() const {
+  return policy_db_mmap_size_;
+}
+
 uint32_t Profile::resumption_delay_before_ign() const {
   return resumption_delay_before_ign_;
 }
@@ -1106,6 +1185,14 @@ bool Profile::logs_enabled() const {
   return logs_enabled_;
 }
 
+const std::string& Profile::binary_log_file_name() const {
+  return binary_log_file_name_;
+}
+
+uint32_t Profile::binary_log_max_file_size() const {
+  return binary_log_max_file_size_;
+}
+
 bool Profile::use_db_for_resumption() const {
   return use_db_for_resumption_;
 }
@@ -1375,6 +1462,20 @@ void Profile::UpdateValues() {
 
   LOG_UPDATED_BOOL_VALUE(logs_enabled_, kLogsEnabledKey, kMainSection);
 
+  // Binary log file
+  ReadStringValue(&binary_log_file_name_, "", kMainSection, kBinaryLogFileKey);
+
+  LOG_UPDATED_VALUE(binary_log_file_name_, kBinaryLogFileKey, kMainSection);
+
+  // Binary log file maximum size
+  ReadUIntValue(&binary_log_max_file_size_,
+                kDefaultBinaryLogMaxFileSize,
+                kMainSection,
+                kBinaryLogMaxFileSizeKey);
+
+  LOG_UPDATED_VALUE(
+      binary_log_max_file_size_, kBinaryLogMaxFileSizeKey, kMainSection);
+
   // Application config folder
   ReadStringValue(&app_config_folder_,
                   file_system::CurrentWorkingDirectory().c_str(),
@@ -1555,6 +1656,26 @@ void Profile::UpdateValues() {
 
   LOG_UPDATED_VALUE(time_testing_port_, kTimeTestingPortKey, kMainSection);
 
+  // Telemetry statistics export period
+  ReadUIntValue(&telemetry_statistics_period_,
+                kDefaultTelemetryStatisticsPeriod,
+                kMainSection,
+                kTelemetryStatisticsPeriodKey);
+
+  LOG_UPDATED_VALUE(telemetry_statistics_period_,
+                    kTelemetryStatisticsPeriodKey,
+                    kMainSection);
+
+  // Telemetry statistics socket
+  ReadStringValue(&telemetry_statistics_socket_,
+                  kDefaultTelemetryStatisticsSocket,
+                  kMainSection,
+                  kTelemetryStatisticsSocketKey);
+
+  LOG_UPDATED_VALUE(telemetry_statistics_socket_,
+                    kTelemetryStatisticsSocketKey,
+                    kMainSection);
+
   // Minimum thread stack size
   ReadUIntValue(&min_tread_stack_size_,
                 threads::Thread::kMinStackSize,
@@ -1662,6 +1783,72 @@ void Profile::UpdateValues() {
                     kVideoDataStoppedTimeoutKey,
                     kMediaManagerSection);
 
+  // Limits of streaming queues
+  ReadUIntValue(&video_streaming_queue_size_,
+                kDefaultVideoStreamingQueueSize,
+                kMediaManagerSection,
+                kVideoStreamingQueueSizeKey);
+
+  LOG_UPDATED_VALUE(video_streaming_queue_size_,
+                    kVideoStreamingQueueSizeKey,
+                    kMediaManagerSection);
+
+  ReadStringValue(&video_streaming_queue_policy_,
+                  kDefaultVideoStreamingQueuePolicy,
+                  kMediaManagerSection,
+                  kVideoStreamingQueuePolicyKey);
+
+  LOG_UPDATED_VALUE(video_streaming_queue_policy_,
+                    kVideoStreamingQueuePolicyKey,
+                    kMediaManagerSection);
+
+  ReadUIntValue(&audio_streaming_queue_size_,
+                kDefaultAudioStreamingQueueSize,
+                kMediaManagerSection,
+                kAudioStreamingQueueSizeKey);
+
+  LOG_UPDATED_VALUE(audio_streaming_queue_size_,
+                    kAudioStreamingQueueSizeKey,
+                    kMediaManagerSection);
+
+  ReadStringValue(&audio_streaming_queue_policy_,
+                  kDefaultAudioStreamingQueuePolicy,
+                  kMediaManagerSection,
+                  kAudioStreamingQueuePolicyKey);
+
+  LOG_UPDATED_VALUE(audio_streaming_queue_policy_,
+                    kAudioStreamingQueuePolicyKey,
+                    kMediaManagerSection);
+
+  {  // Additional stream consumers
+    struct KeyPair {
+      std::vector<std::string>* ini_vector;
+      const char* ini_key_name;
+    } keys[] = {
+        {&video_additional_consumers_, kVideoStreamAdditionalConsumersKey},
+        {&audio_additional_consumers_, kAudioStreamAdditionalConsumersKey},
+        {NULL, NULL}};
+    struct KeyPair* entry = keys;
+
+    while (entry->ini_vector != NULL) {
+      bool exist = false;
+      *entry->ini_vector = ReadStringContainer(
+          kMediaManagerSection, entry->ini_key_name, &exist, true);
+      if (exist) {
+        const std::string list_with_comma = std::accumulate(
+            entry->ini_vector->begin(),
+            entry->ini_vector->end(),
+            std::string(""),
+            [](const std::string& first, const std::string& second) {
+              return first.empty() ? second : first + ", " + second;
+            });
+        LOG_UPDATED_VALUE(
+            list_with_comma, entry->ini_key_name, kMediaManagerSection);
+      }
+      ++entry;
+    }
+  }
+
   // Mixing audio parameter
   std::string mixing_audio_value;
   if (ReadValue(&mixing_audio_value, kMainSection, kMixingAudioSupportedKey) &&
@@ -1996,6 +2183,16 @@ void Profile::UpdateValues() {
   LOG_UPDATED_VALUE(transport_manager_tcp_adapter_network_interface_,
                     kTCPAdapterNetworkInterfaceKey,
                     kTransportManagerSection);
+
+  // Transport manager TCP reactor threads
+  ReadUIntValue(&transport_manager_tcp_reactor_threads_,
+                kDefaultTransportManagerTCPReactorThreads,
+                kTransportManagerSection,
+                kTCPReactorThreadsKey);
+
+  LOG_UPDATED_VALUE(transport_manager_tcp_reactor_threads_,
+                    kTCPReactorThreadsKey,
+                    kTransportManagerSection);
 #ifdef WEBSOCKET_SERVER_TRANSPORT_SUPPORT
   // Websocket server address
   ReadStringValue(&websocket_server_address_,
@@ -2274,6 +2471,24 @@ void Profile::UpdateValues() {
   LOG_UPDATED_VALUE(
       open_attempt_timeout_ms_, kOpenAttemptTimeoutMsKey, kPolicySection);
 
+  // Write-ahead log journal for policy DB
+  ReadBoolValue(&use_policy_db_write_ahead_log_,
+                false,
+                kPolicySection,
+                kUsePolicyDBWriteAheadLogKey);
+
+  LOG_UPDATED_BOOL_VALUE(use_policy_db_write_ahead_log_,
+                         kUsePolicyDBWriteAheadLogKey,
+                         kPolicySection);
+
+  // Memory mapped size of policy DB
+  ReadUIntValue(&policy_db_mmap_size_,
+                kDefaultPolicyDBMmapSize,
+                kPolicySection,
+                kPolicyDBMmapSizeKey);
+
+  LOG_UPDATED_VALUE(policy_db_mmap_size_, kPolicyDBMmapSizeKey, kPolicySection);
+
   // Turn Policy Off?
   std::string enable_policy_string;
   if (ReadValue(&enable_policy_string, kPolicySection, kEnablePolicy) &&
@@ -2335,8 +2550,15 @@ void Profile::UpdateValues() {
                 kDefaultMaxThreadPoolSize,
                 kApplicationManagerSection,
                 kDefaultThreadPoolSize);
-  if (max_thread_pool_size_ > kDefaultMaxThreadPoolSize) {
-    max_thread_pool_size_ = kDefaultMaxThreadPoolSize;
+  {
+    // Requests are processed by work-stealing pool, so it may scale with
+    // cores count. Zero means one thread per core, but not less than default
+    const uint32_t max_pool_size = std::max(
+        static_cast<uint32_t>(std::thread::hardware_concurrency()),
+        kDefaultMaxThreadPoolSize);
+    if (0 == max_thread_pool_size_ || max_thread_pool_size_ > max_pool_size) {
+      max_thread_pool_size_ = max_pool_size;
+    }
   }
   LOG_UPDATED_VALUE(max_thread_pool_size_,
                     kDefaultMaxThreadPoolSize,
@@ -35,6 +35,8 @@
 #ifndef SRC_COMPONENTS_FORMATTERS_INCLUDE_FORMATTERS_CFORMATTERJSONBASE_H_
 #define SRC_COMPONENTS_FORMATTERS_INCLUDE_FORMATTERS_CFORMATTERJSONBASE_H_
 
+#include <string>
+
 #include "json/json.h"
 #include "smart_objects/smart_object.h"
 
@@ -111,6 +113,32 @@ class CFormatterJsonBase {
   static void objToJsonValue(
       const ns_smart_device_link::ns_smart_objects::SmartObject& obj,
       Json::Value& value);
+
+  /**
+   * @brief The method constructs a SmartObject directly from JSON text
+   *        without building an intermediate JSON object.
+   *
+   * @param str Input JSON text.
+   * @param obj The resulting SmartObject. It is not changed if the text
+   *        can not be parsed.
+   *
+   * @return true if str contains a valid JSON document, false otherwise.
+   */
+  static bool jsonStringToObj(
+      const std::string& str,
+      ns_smart_device_link::ns_smart_objects::SmartObject& obj);
+
+  /**
+   * @brief The method writes the input SmartObject directly as styled JSON
+   *        text. The text is the same objToJsonValue followed by
+   *        Json::Value::toStyledString() gives.
+   *
+   * @param obj Input SmartObject. Can contain a complex structure of objects.
+   * @param str The resulting JSON text.
+   */
+  static void objToJsonString(
+      const ns_smart_device_link::ns_smart_objects::SmartObject& obj,
+      std::string& str);
 };
 }  // namespace formatters
 }  // namespace ns_json_handler
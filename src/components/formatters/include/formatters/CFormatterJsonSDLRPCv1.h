@@ -72,11 +72,20 @@ class CFormatterJsonSDLRPCv1 : public CFormatterJsonBase {
       const ns_smart_device_link::ns_smart_objects::SmartObject& obj);
 
   /**
-   * @brief Extracts a message type from the root JSON object.
+   * @brief Extracts a message type from the root of parsed JSON object.
    *
-   * @return Type or empty string if there's no type in the JSON object.
+   * @return Type or empty string if there's no message object of known
+   *         type in the JSON object.
    */
-  static const std::string getMessageType(const Json::Value& root);
+  static const std::string getRootMessageType(
+      const ns_smart_device_link::ns_smart_objects::SmartObject& root);
+
+  /**
+   * @brief Checks whether parsed correlation id can be converted to a 32-bit
+   *        integer.
+   */
+  static bool isCorrelationIdValid(
+      const ns_smart_device_link::ns_smart_objects::SmartObject& id);
 
   // SDLRPCv1 string consts
 
@@ -174,20 +183,16 @@ int32_t formatters::CFormatterJsonSDLRPCv1::fromString(
   int32_t result = kSuccess;
 
   try {
-    Json::CharReaderBuilder reader_builder;
-    const std::unique_ptr<Json::CharReader> reader(
-        reader_builder.newCharReader());
-    Json::Value root;
-    const size_t json_len = str.length();
+    ns_smart_device_link::ns_smart_objects::SmartObject root;
     std::string type;
 
-    if (!reader->parse(str.c_str(), str.c_str() + json_len, &root, nullptr)) {
+    if (!jsonStringToObj(str, root)) {
       result = kParsingError | kMessageTypeNotFound | kFunctionIdNotFound |
                kCorrelationIdNotFound;
     }
 
     if (kSuccess == result) {
-      type = getMessageType(root);
+      type = getRootMessageType(root);
       if (true == type.empty()) {
         result =
             kMessageTypeNotFound | kFunctionIdNotFound | kCorrelationIdNotFound;
@@ -218,19 +223,25 @@ int32_t formatters::CFormatterJsonSDLRPCv1::fromString(
     namespace S = ns_smart_device_link::ns_json_handler::strings;
 
     if (!(result & kMessageTypeNotFound)) {
-      jsonValueToObj(root[type][S_PARAMETERS], out[S::S_MSG_PARAMS]);
+      ns_smart_device_link::ns_smart_objects::SmartObject& message = root[type];
+      out[S::S_MSG_PARAMS] = std::move(message[S_PARAMETERS]);
 
       out[S::S_PARAMS][S::S_MESSAGE_TYPE] = messageType;
       out[S::S_PARAMS][S::S_FUNCTION_ID] = functionId;
-      if (true == root[type][S_CORRELATION_ID].empty()) {
+      const ns_smart_device_link::ns_smart_objects::SmartObject&
+          correlation_id = message.getElement(S_CORRELATION_ID);
+      if (ns_smart_objects::SmartType_Null == correlation_id.getType() ||
+          ns_smart_objects::SmartType_Invalid == correlation_id.getType()) {
         if (type !=
             S_NOTIFICATION) {  // Notification may not have CorrelationId
           result |= kCorrelationIdNotFound;
           out[S::S_PARAMS][S::S_CORRELATION_ID] = -1;
         }
+      } else if (!isCorrelationIdValid(correlation_id)) {
+        return kParsingError;
       } else {
         out[S::S_PARAMS][S::S_CORRELATION_ID] =
-            root[type][S_CORRELATION_ID].asInt();
+            static_cast<int32_t>(correlation_id.asInt());
       }
       out[S::S_PARAMS][S::S_PROTOCOL_TYPE] = 0;
       out[S::S_PARAMS][S::S_PROTOCOL_VERSION] = 1;
@@ -151,14 +151,9 @@ inline bool CFormatterJsonSDLRPCv2::fromString(
   bool result = true;
 
   try {
-    Json::CharReaderBuilder reader_builder;
-    const std::unique_ptr<Json::CharReader> reader(
-        reader_builder.newCharReader());
-    Json::Value root;
-    const size_t json_len = str.length();
+    ns_smart_device_link::ns_smart_objects::SmartObject msg_params;
     namespace strings = ns_smart_device_link::ns_json_handler::strings;
-    const bool result =
-        reader->parse(str.c_str(), str.c_str() + json_len, &root, nullptr);
+    const bool result = jsonStringToObj(str, msg_params);
 
     if (result) {
       out[strings::S_PARAMS][strings::S_MESSAGE_TYPE] = messageType;
@@ -166,7 +161,7 @@ inline bool CFormatterJsonSDLRPCv2::fromString(
       out[strings::S_PARAMS][strings::S_PROTOCOL_TYPE] = 0;
       out[strings::S_PARAMS][strings::S_PROTOCOL_VERSION] = 2;
 
-      jsonValueToObj(root, out[strings::S_MSG_PARAMS]);
+      out[strings::S_MSG_PARAMS] = std::move(msg_params);
     }
   } catch (...) {
     result = false;
@@ -35,6 +35,7 @@
 #ifndef SRC_COMPONENTS_FORMATTERS_INCLUDE_FORMATTERS_FORMATTER_JSON_RPC_H_
 #define SRC_COMPONENTS_FORMATTERS_INCLUDE_FORMATTERS_FORMATTER_JSON_RPC_H_
 
+#include <string.h>
 #include <sys/stat.h>
 #include <string>
 
@@ -217,15 +218,22 @@ class FormatterJsonRpc : public CFormatterJsonBase {
    *
    * @tparam FunctionId Type of function id enumeration.
    *
-   * @param method_value JSON value with function id.
+   * @param method_value Parsed JSON value with function id.
    * @param out The resulting SmartObject.
    *
    * @return An integer that is a bitwise-or of all error codes occurred
    *         during the parsing of the function id. 0 if no errors occurred.
    */
   template <typename FunctionId>
-  static int32_t ParseFunctionId(const Json::Value& method_value,
-                                 ns_smart_objects::SmartObject& out);
+  static int32_t ParseFunctionId(
+      const ns_smart_objects::SmartObject& method_value,
+      ns_smart_objects::SmartObject& out);
+
+  /**
+   * @brief Checks whether parsed JSON value is an integer which fits into
+   *        32 bits, as integral doubles do.
+   */
+  static bool IsInt(const ns_smart_objects::SmartObject& value);
 
   /**
    * @brief Set method.
@@ -240,7 +248,7 @@ class FormatterJsonRpc : public CFormatterJsonBase {
    *         value of "method" field.
    */
   static bool SetMethod(const ns_smart_objects::SmartObject& params,
-                        Json::Value& method_container);
+                        ns_smart_objects::SmartObject& method_container);
 
   /**
    * @brief Set id.
@@ -255,7 +263,7 @@ class FormatterJsonRpc : public CFormatterJsonBase {
    *         as a value of "id" field.
    */
   static bool SetId(const ns_smart_objects::SmartObject& params,
-                    Json::Value& id_container);
+                    ns_smart_objects::SmartObject& id_container);
 
   /**
    * @brief Set message
@@ -270,7 +278,7 @@ class FormatterJsonRpc : public CFormatterJsonBase {
    *         as a value of "message" field.
    */
   static bool SetMessage(const ns_smart_objects::SmartObject& params,
-                         Json::Value& id_container);
+                         ns_smart_objects::SmartObject& id_container);
 };
 
 template <typename FunctionId, typename MessageType>
@@ -279,106 +287,106 @@ int32_t FormatterJsonRpc::FromString(const std::string& str,
   int32_t result = kSuccess;
   try {
     namespace strings = ns_smart_device_link::ns_json_handler::strings;
-    Json::CharReaderBuilder reader_builder;
-    const std::unique_ptr<Json::CharReader> reader(
-        reader_builder.newCharReader());
-    Json::Value root;
-    const size_t json_len = str.length();
+    using ns_smart_objects::SmartObject;
+    SmartObject root;
 
-    if (!reader->parse(str.c_str(), str.c_str() + json_len, &root, nullptr)) {
+    if (!jsonStringToObj(str, root)) {
       result = kParsingError | kMethodNotSpecified | kUnknownMethod |
                kUnknownMessageType;
+    } else if ((ns_smart_objects::SmartType_Map != root.getType()) &&
+               (ns_smart_objects::SmartType_Null != root.getType())) {
+      return kParsingError;
     } else {
-      if (false == root.isMember(kJsonRpc)) {
+      if (false == root.keyExists(kJsonRpc)) {
         result |= kInvalidFormat;
       } else {
-        const Json::Value& jsonRpcValue = root[kJsonRpc];
+        const SmartObject& jsonRpcValue = root.getElement(kJsonRpc);
 
-        if ((false == jsonRpcValue.isString()) ||
-            (jsonRpcValue.asString() != kJsonRpcExpectedValue)) {
+        if ((ns_smart_objects::SmartType_String != jsonRpcValue.getType()) ||
+            (0 != strcmp(jsonRpcValue.asCharArray(), kJsonRpcExpectedValue))) {
           result |= kInvalidFormat;
         }
       }
 
       std::string message_type_string;
-      Json::Value response_value;
-      bool response_value_found = false;
+      const SmartObject* response_value = NULL;
       bool is_error_response = false;
 
-      if (false == root.isMember(kId)) {
+      if (false == root.keyExists(kId)) {
         message_type_string = kNotification;
 
-        if (false == root.isMember(kMethod)) {
+        if (false == root.keyExists(kMethod)) {
           result |= kMethodNotSpecified | kUnknownMethod;
         } else {
-          result |= ParseFunctionId<FunctionId>(root[kMethod], out);
+          result |= ParseFunctionId<FunctionId>(root.getElement(kMethod), out);
         }
         out[strings::S_MSG_PARAMS] =
-            ns_smart_objects::SmartObject(ns_smart_objects::SmartType_Map);
+            SmartObject(ns_smart_objects::SmartType_Map);
       } else {
-        const Json::Value& id_value = root[kId];
+        const SmartObject& id_value = root.getElement(kId);
+        const ns_smart_objects::SmartType id_type = id_value.getType();
 
-        if (true == id_value.isString()) {
+        if (ns_smart_objects::SmartType_String == id_type) {
+          out[strings::S_PARAMS][strings::S_CORRELATION_ID] = id_value;
+        } else if (true == IsInt(id_value)) {
           out[strings::S_PARAMS][strings::S_CORRELATION_ID] =
-              id_value.asString();
-        } else if (true == id_value.isInt()) {
-          out[strings::S_PARAMS][strings::S_CORRELATION_ID] = id_value.asInt();
-        } else if (true == id_value.isDouble()) {
+              static_cast<int32_t>(id_value.asInt());
+        } else if (ns_smart_objects::SmartType_UInteger == id_type) {
+          out[strings::S_PARAMS][strings::S_CORRELATION_ID] =
+              static_cast<double>(id_value.asUInt());
+        } else if ((ns_smart_objects::SmartType_Integer == id_type) ||
+                   (ns_smart_objects::SmartType_Double == id_type)) {
           out[strings::S_PARAMS][strings::S_CORRELATION_ID] =
               id_value.asDouble();
-        } else if (true == id_value.isNull()) {
+        } else if (ns_smart_objects::SmartType_Null == id_type) {
           out[strings::S_PARAMS][strings::S_CORRELATION_ID] =
-              ns_smart_objects::SmartObject(ns_smart_objects::SmartType_Null);
+              SmartObject(ns_smart_objects::SmartType_Null);
         } else {
           result |= kInvalidFormat | kInvalidId;
         }
 
-        if (true == root.isMember(kMethod)) {
+        if (true == root.keyExists(kMethod)) {
           message_type_string = kRequest;
-          result |= ParseFunctionId<FunctionId>(root[kMethod], out);
+          result |= ParseFunctionId<FunctionId>(root.getElement(kMethod), out);
           out[strings::S_MSG_PARAMS] =
-              ns_smart_objects::SmartObject(ns_smart_objects::SmartType_Map);
+              SmartObject(ns_smart_objects::SmartType_Map);
         } else {
-          Json::Value method_container;
-          bool method_container_found = false;
+          const SmartObject* method_container = NULL;
 
-          if (true == root.isMember(kResult)) {
+          if (true == root.keyExists(kResult)) {
             out[strings::S_MSG_PARAMS] =
-                ns_smart_objects::SmartObject(ns_smart_objects::SmartType_Map);
+                SmartObject(ns_smart_objects::SmartType_Map);
 
             message_type_string = kResponse;
-            response_value = root[kResult];
-            response_value_found = true;
-            method_container = root[kResult];
-            method_container_found = true;
-          } else if (true == root.isMember(kError)) {
+            response_value = &root.getElement(kResult);
+            method_container = response_value;
+          } else if (true == root.keyExists(kError)) {
             out[strings::S_MSG_PARAMS] =
-                ns_smart_objects::SmartObject(ns_smart_objects::SmartType_Map);
+                SmartObject(ns_smart_objects::SmartType_Map);
             message_type_string = kErrorResponse;
-            response_value = root[kError];
-            response_value_found = true;
+            response_value = &root.getElement(kError);
             is_error_response = true;
 
-            if (true == response_value.isObject()) {
-              if (true == response_value.isMember(kData)) {
-                method_container = response_value[kData];
-                method_container_found = true;
+            if (ns_smart_objects::SmartType_Map == response_value->getType()) {
+              if (true == response_value->keyExists(kData)) {
+                method_container = &response_value->getElement(kData);
               }
             }
           } else {
             result |= kUnknownMessageType;
           }
 
-          if (false == method_container_found) {
+          if (NULL == method_container) {
             result |= kMethodNotSpecified | kUnknownMethod;
-          } else if (false == method_container.isObject()) {
+          } else if (ns_smart_objects::SmartType_Map !=
+                     method_container->getType()) {
             result |= kInvalidFormat | kMethodNotSpecified | kUnknownMethod;
           } else {
-            if (false == method_container.isMember(kMethod)) {
+            if (false == method_container->keyExists(kMethod)) {
               result |= kMethodNotSpecified | kUnknownMethod;
             } else {
-              result |=
-                  ParseFunctionId<FunctionId>(method_container[kMethod], out);
+              result |= ParseFunctionId<FunctionId>(
+                  method_container->getElement(kMethod), out);
             }
           }
         }
@@ -395,24 +403,35 @@ int32_t FormatterJsonRpc::FromString(const std::string& str,
         }
       }
 
-      if (true == root.isMember(kParams)) {
-        const Json::Value& params_value = root[kParams];
+      if (true == root.keyExists(kParams)) {
+        SmartObject& params_value = root[kParams];
 
-        if (false == params_value.isObject()) {
+        if (ns_smart_objects::SmartType_Map != params_value.getType()) {
           result |= kInvalidFormat;
         } else {
-          jsonValueToObj(root[kParams], out[strings::S_MSG_PARAMS]);
+          out[strings::S_MSG_PARAMS] = std::move(params_value);
         }
-      } else if (true == root.isMember(kResult)) {
-        const Json::Value& result_value = root[kResult];
+      } else if (true == root.keyExists(kResult)) {
+        const SmartObject& result_value = root.getElement(kResult);
 
-        if (false == result_value.isObject()) {
+        if (ns_smart_objects::SmartType_Map != result_value.getType()) {
           result |= kInvalidFormat;
         } else {
-          jsonValueToObj(root[kResult], out[strings::S_MSG_PARAMS]);
+          // Result object is still checked for the response code below,
+          // so it is shared rather than moved
+          out[strings::S_MSG_PARAMS] = result_value;
         }
       } else if (true == is_error_response) {
-        jsonValueToObj(response_value[kData], out[strings::S_PARAMS][kData]);
+        SmartObject& data = out[strings::S_PARAMS][kData];
+        if (true == response_value->keyExists(kData)) {
+          data = response_value->getElement(kData);
+        } else if (ns_smart_objects::SmartType_Map !=
+                       response_value->getType() &&
+                   ns_smart_objects::SmartType_Null !=
+                       response_value->getType()) {
+          // Error of other than object type has no members to look up
+          return kParsingError;
+        }
       }
 
       if ((kResponse == message_type_string) ||
@@ -422,39 +441,41 @@ int32_t FormatterJsonRpc::FromString(const std::string& str,
           out[strings::S_MSG_PARAMS].erase(kCode);
         }
 
-        if (false == response_value_found) {
+        if (NULL == response_value) {
           result |= kResponseCodeNotAvailable;
         } else {
-          if (false == response_value.isObject()) {
+          if (ns_smart_objects::SmartType_Map != response_value->getType()) {
             result |= kInvalidFormat | kResponseCodeNotAvailable;
 
             if (true == is_error_response) {
               result |= kErrorResponseMessageNotAvailable;
             }
           } else {
-            if (false == response_value.isMember(kCode)) {
+            if (false == response_value->keyExists(kCode)) {
               result |= kResponseCodeNotAvailable;
             } else {
-              const Json::Value& code_value = response_value[kCode];
+              const SmartObject& code_value = response_value->getElement(kCode);
 
-              if (false == code_value.isInt()) {
+              if (false == IsInt(code_value)) {
                 result |= kInvalidFormat | kResponseCodeNotAvailable;
               } else {
-                out[strings::S_PARAMS][strings::kCode] = code_value.asInt();
+                out[strings::S_PARAMS][strings::kCode] =
+                    static_cast<int32_t>(code_value.asInt());
               }
             }
 
             if (true == is_error_response) {
-              if (false == response_value.isMember(kMessage)) {
+              if (false == response_value->keyExists(kMessage)) {
                 result |= kErrorResponseMessageNotAvailable;
               } else {
-                const Json::Value& message_value = response_value[kMessage];
+                const SmartObject& message_value =
+                    response_value->getElement(kMessage);
 
-                if (false == message_value.isString()) {
+                if (ns_smart_objects::SmartType_String !=
+                    message_value.getType()) {
                   result |= kErrorResponseMessageNotAvailable;
                 } else {
-                  out[strings::S_PARAMS][strings::kMessage] =
-                      message_value.asString();
+                  out[strings::S_PARAMS][strings::kMessage] = message_value;
                 }
               }
             }
@@ -473,17 +494,18 @@ int32_t FormatterJsonRpc::FromString(const std::string& str,
 }
 
 template <typename FunctionId>
-int32_t FormatterJsonRpc::ParseFunctionId(const Json::Value& method_value,
-                                          ns_smart_objects::SmartObject& out) {
+int32_t FormatterJsonRpc::ParseFunctionId(
+    const ns_smart_objects::SmartObject& method_value,
+    ns_smart_objects::SmartObject& out) {
   int32_t result = kSuccess;
 
-  if (false == method_value.isString()) {
+  if (ns_smart_objects::SmartType_String != method_value.getType()) {
     result |= kInvalidFormat | kUnknownMethod;
   } else {
     FunctionId function_id;
 
     if (!ns_smart_objects::EnumConversionHelper<FunctionId>::CStringToEnum(
-            method_value.asCString(), &function_id)) {
+            method_value.asCharArray(), &function_id)) {
       result |= kUnknownMethod;
     } else {
       namespace strings = ns_smart_device_link::ns_json_handler::strings;
@@ -0,0 +1,129 @@
+/*
+ * @file smart_json_reader.h
+ * @brief JSON to SmartObject reader header file.
+ */
+// Copyright (c) 2021, Ford Motor Company
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer.
+//
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following
+// disclaimer in the documentation and/or other materials provided with the
+// distribution.
+//
+// Neither the name of the Ford Motor Company nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 'A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_COMPONENTS_FORMATTERS_INCLUDE_FORMATTERS_SMART_JSON_READER_H_
+#define SRC_COMPONENTS_FORMATTERS_INCLUDE_FORMATTERS_SMART_JSON_READER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+#include "smart_objects/smart_object.h"
+#include "utils/macro.h"
+
+namespace ns_smart_device_link {
+namespace ns_json_handler {
+namespace formatters {
+
+/**
+ * @brief Streaming JSON parser which builds SmartObject directly from text
+ * without intermediate Json::Value tree.
+ *
+ * Accepts the same documents as default Json::CharReader: comments are
+ * skipped, the last of duplicated keys wins and anything after the root
+ * value is ignored. Produced objects are the same as
+ * CFormatterJsonBase::jsonValueToObj builds from the parsed Json::Value.
+ */
+class SmartJsonReader {
+ public:
+  SmartJsonReader();
+
+  /**
+   * @brief Parses JSON text.
+   *
+   * @param begin Beginning of the text.
+   * @param end End of the text.
+   * @param out The resulting SmartObject. Not changed if parsing fails.
+   *
+   * @return true if text is a valid JSON document, false otherwise.
+   */
+  bool Parse(const char* begin,
+             const char* end,
+             ns_smart_objects::SmartObject& out);
+
+  /**
+   * @brief Parses JSON text.
+   *
+   * @param str Input JSON text.
+   * @param out The resulting SmartObject. Not changed if parsing fails.
+   *
+   * @return true if text is a valid JSON document, false otherwise.
+   */
+  bool Parse(const std::string& str, ns_smart_objects::SmartObject& out);
+
+ private:
+  bool ParseValue(ns_smart_objects::SmartObject& out, const size_t depth);
+  bool ParseObject(ns_smart_objects::SmartObject& out, const size_t depth);
+  bool ParseArray(ns_smart_objects::SmartObject& out, const size_t depth);
+  bool ParseNumber(ns_smart_objects::SmartObject& out);
+
+  /**
+   * @brief Reads string token with the opening quote already consumed.
+   * Escape sequences are decoded, \uXXXX are converted to UTF-8.
+   */
+  bool ParseString(std::string& out);
+  bool ParseHex(uint32_t& code_point);
+  bool ParseLiteral(const char* literal, const size_t length);
+
+  void SkipWhitespaces();
+
+  /**
+   * @brief Skips whitespaces and comments.
+   *
+   * @return false if text contains unterminated or malformed comment.
+   */
+  bool SkipSpaces();
+
+  const char* current_;
+  const char* end_;
+
+  /**
+   * @brief Scratch buffer for member names, reused while parsing so that
+   * looking up existing keys does not allocate.
+   */
+  std::string key_;
+
+  /**
+   * @brief Scratch buffer for string values.
+   */
+  std::string value_;
+
+  DISALLOW_COPY_AND_ASSIGN(SmartJsonReader);
+};
+
+}  // namespace formatters
+}  // namespace ns_json_handler
+}  // namespace ns_smart_device_link
+
+#endif  // SRC_COMPONENTS_FORMATTERS_INCLUDE_FORMATTERS_SMART_JSON_READER_H_
@@ -0,0 +1,114 @@
+/*
+ * @file smart_json_writer.h
+ * @brief SmartObject to JSON writer header file.
+ */
+// Copyright (c) 2021, Ford Motor Company
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer.
+//
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following
+// disclaimer in the documentation and/or other materials provided with the
+// distribution.
+//
+// Neither the name of the Ford Motor Company nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 'A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_COMPONENTS_FORMATTERS_INCLUDE_FORMATTERS_SMART_JSON_WRITER_H_
+#define SRC_COMPONENTS_FORMATTERS_INCLUDE_FORMATTERS_SMART_JSON_WRITER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+#include "smart_objects/smart_object.h"
+#include "utils/macro.h"
+
+namespace ns_smart_device_link {
+namespace ns_json_handler {
+namespace formatters {
+
+/**
+ * @brief Serializes SmartObject straight into a JSON string without
+ * intermediate Json::Value tree.
+ *
+ * Output is the same text Json::Value::toStyledString() produces for the
+ * tree built by CFormatterJsonBase::objToJsonValue: three spaces indent,
+ * members in key order, short arrays of plain values on a single line.
+ */
+class SmartJsonWriter {
+ public:
+  /**
+   * @brief Creates a styled JSON string from a SmartObject.
+   *
+   * @param obj Input SmartObject.
+   * @param out The resulting JSON string, previous contents are replaced.
+   */
+  static void Write(const ns_smart_objects::SmartObject& obj,
+                    std::string& out);
+
+ private:
+  explicit SmartJsonWriter(std::string& out);
+
+  void WriteValue(const ns_smart_objects::SmartObject& obj);
+  void WriteMap(const ns_smart_objects::SmartObject& obj);
+  void WriteArray(const ns_smart_objects::SmartObject& obj);
+
+  /**
+   * @brief Checks whether array has to be split into several lines.
+   * For a single line array fills array_line_ with rendered elements.
+   */
+  bool IsMultilineArray(const ns_smart_objects::SmartObject& obj);
+
+  /**
+   * @brief Appends value which is neither non-empty map nor array
+   */
+  static void AppendPlainValue(const ns_smart_objects::SmartObject& obj,
+                               std::string& out);
+  static void AppendQuotedString(const char* str,
+                                 const size_t length,
+                                 std::string& out);
+  static void AppendInteger(const uint64_t value,
+                            const bool is_negative,
+                            std::string& out);
+  static void AppendDouble(const double value, std::string& out);
+
+  void WriteIndent();
+  void WriteWithIndent(const char* value, const size_t length);
+  void Indent();
+  void Unindent();
+
+  std::string& out_;
+  std::string indent_;
+
+  /**
+   * @brief Elements of the array being written joined with ", "
+   */
+  std::string array_line_;
+
+  DISALLOW_COPY_AND_ASSIGN(SmartJsonWriter);
+};
+
+}  // namespace formatters
+}  // namespace ns_json_handler
+}  // namespace ns_smart_device_link
+
+#endif  // SRC_COMPONENTS_FORMATTERS_INCLUDE_FORMATTERS_SMART_JSON_WRITER_H_
@@ -32,6 +32,8 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 #include "formatters/CFormatterJsonBase.h"
+#include "formatters/smart_json_reader.h"
+#include "formatters/smart_json_writer.h"
 #include "json/json.h"
 #include "utils/convert_utils.h"
 
@@ -123,3 +125,21 @@ void ns_smart_device_link::ns_json_handler::formatters::CFormatterJsonBase::
   } catch (...) {
   }
 }
+
+// ----------------------------------------------------------------------------
+
+bool ns_smart_device_link::ns_json_handler::formatters::CFormatterJsonBase::
+    jsonStringToObj(const std::string& str,
+                    ns_smart_device_link::ns_smart_objects::SmartObject& obj) {
+  SmartJsonReader reader;
+  return reader.Parse(str, obj);
+}
+
+// ----------------------------------------------------------------------------
+
+void ns_smart_device_link::ns_json_handler::formatters::CFormatterJsonBase::
+    objToJsonString(
+        const ns_smart_device_link::ns_smart_objects::SmartObject& obj,
+        std::string& str) {
+  SmartJsonWriter::Write(obj, str);
+}
@@ -31,6 +31,9 @@
  */
 
 #include "formatters/CFormatterJsonSDLRPCv1.h"
+
+#include <limits>
+
 #include "formatters/meta_formatter.h"
 #include "utils/convert_utils.h"
 
@@ -66,52 +69,78 @@ const std::string CFormatterJsonSDLRPCv1::getMessageType(
 
 // ----------------------------------------------------------------------------
 
-const std::string CFormatterJsonSDLRPCv1::getMessageType(
-    const Json::Value& root) {
+const std::string CFormatterJsonSDLRPCv1::getRootMessageType(
+    const smart_objects_ns::SmartObject& root) {
   std::string type;
 
-  if (true == root.isMember(S_REQUEST)) {
+  if (root.keyExists(S_REQUEST)) {
     type = S_REQUEST;
-  } else if (true == root.isMember(S_RESPONSE)) {
+  } else if (root.keyExists(S_RESPONSE)) {
     type = S_RESPONSE;
-  } else if (true == root.isMember(S_NOTIFICATION)) {
+  } else if (root.keyExists(S_NOTIFICATION)) {
     type = S_NOTIFICATION;
   } else {
   }
 
+  if (!type.empty() &&
+      smart_objects_ns::SmartType_Map != root.getElement(type).getType()) {
+    type.clear();
+  }
+
   return type;
 }
 
 // ----------------------------------------------------------------------------
 
+bool CFormatterJsonSDLRPCv1::isCorrelationIdValid(
+    const smart_objects_ns::SmartObject& id) {
+  switch (id.getType()) {
+    case smart_objects_ns::SmartType_Boolean:
+      return true;
+    case smart_objects_ns::SmartType_Integer:
+      return id.asInt() >= std::numeric_limits<int32_t>::min() &&
+             id.asInt() <= std::numeric_limits<int32_t>::max();
+    case smart_objects_ns::SmartType_Double:
+      return id.asDouble() >= std::numeric_limits<int32_t>::min() &&
+             id.asDouble() <= std::numeric_limits<int32_t>::max();
+    default:
+      return false;
+  }
+}
+
+// ----------------------------------------------------------------------------
+
 bool CFormatterJsonSDLRPCv1::toString(const smart_objects_ns::SmartObject& obj,
                                       std::string& outStr,
                                       const bool remove_unknown_parameters) {
   bool result = false;
   try {
-    Json::Value root(Json::objectValue);
-    Json::Value params(Json::objectValue);
-
     smart_objects_ns::SmartObject formattedObj(obj);
     formattedObj.getSchema().unapplySchema(
         formattedObj,
         remove_unknown_parameters);  // converts enums(as int32_t) to strings
 
-    objToJsonValue(formattedObj.getElement(strings::S_MSG_PARAMS), params);
-
-    std::string type = getMessageType(formattedObj);
-    root[type] = Json::Value(Json::objectValue);
-    root[type][S_PARAMETERS] = params;
+    smart_objects_ns::SmartObject root(smart_objects_ns::SmartType_Map);
+    smart_objects_ns::SmartObject& message =
+        root[getMessageType(formattedObj)];
+    message = smart_objects_ns::SmartObject(smart_objects_ns::SmartType_Map);
+    if (formattedObj.keyExists(strings::S_MSG_PARAMS)) {
+      message[S_PARAMETERS] = formattedObj[strings::S_MSG_PARAMS];
+    } else {
+      // Missing parameters are written as an empty string the same way
+      // objToJsonValue writes an invalid object
+      message[S_PARAMETERS] = std::string();
+    }
 
     if (formattedObj[strings::S_PARAMS].keyExists(strings::S_CORRELATION_ID)) {
-      root[type][S_CORRELATION_ID] =
+      message[S_CORRELATION_ID] =
           formattedObj[strings::S_PARAMS][strings::S_CORRELATION_ID].asInt();
     }
 
-    root[type][S_NAME] =
+    message[S_NAME] =
         formattedObj[strings::S_PARAMS][strings::S_FUNCTION_ID].asString();
 
-    outStr = root.toStyledString();
+    objToJsonString(root, outStr);
 
     result = true;
   } catch (...) {
@@ -45,16 +45,12 @@ bool CFormatterJsonSDLRPCv2::toString(const smart_objects_ns::SmartObject& obj,
                                       const bool remove_unknown_parameters) {
   bool result = true;
   try {
-    Json::Value root(Json::objectValue);
-
     smart_objects_ns::SmartObject formattedObj(obj);
     formattedObj.getSchema().unapplySchema(
         formattedObj,
         remove_unknown_parameters);  // converts enums(as int32_t) to strings
 
-    objToJsonValue(formattedObj.getElement(strings::S_MSG_PARAMS), root);
-
-    outStr = root.toStyledString();
+    objToJsonString(formattedObj.getElement(strings::S_MSG_PARAMS), outStr);
 
     result = true;
   } catch (...) {
@@ -33,6 +33,9 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 #include "formatters/formatter_json_rpc.h"
+
+#include <limits>
+
 #include "utils/convert_utils.h"
 
 namespace ns_smart_device_link {
@@ -61,12 +64,13 @@ bool FormatterJsonRpc::ToString(const ns_smart_objects::SmartObject& obj,
                                 const bool remove_unknown_parameters) {
   bool result = true;
   try {
-    Json::Value root(Json::objectValue);
+    ns_smart_objects::SmartObject root(ns_smart_objects::SmartType_Map);
 
     root[kJsonRpc] = kJsonRpcExpectedValue;
 
     ns_smart_objects::SmartObject formatted_object(obj);
-    Json::Value msg_params_json(Json::objectValue);
+    ns_smart_objects::SmartObject msg_params_json(
+        ns_smart_objects::SmartType_Map);
     formatted_object.getSchema().unapplySchema(formatted_object,
                                                remove_unknown_parameters);
 
@@ -78,7 +82,7 @@ bool FormatterJsonRpc::ToString(const ns_smart_objects::SmartObject& obj,
 
       result = (ns_smart_objects::SmartType_Map == msg_params.getType());
       if (true == result) {
-        objToJsonValue(msg_params, msg_params_json);
+        msg_params_json = msg_params;
       }
       if (0 < msg_params.length()) {
         empty_message_params = false;
@@ -144,7 +148,7 @@ bool FormatterJsonRpc::ToString(const ns_smart_objects::SmartObject& obj,
         }
       }
     }
-    out_str = root.toStyledString();
+    objToJsonString(root, out_str);
   } catch (...) {
     result = false;
   }
@@ -152,8 +156,25 @@ bool FormatterJsonRpc::ToString(const ns_smart_objects::SmartObject& obj,
   return result;
 }
 
-bool FormatterJsonRpc::SetMethod(const ns_smart_objects::SmartObject& params,
-                                 Json::Value& method_container) {
+bool FormatterJsonRpc::IsInt(const ns_smart_objects::SmartObject& value) {
+  switch (value.getType()) {
+    case ns_smart_objects::SmartType_Integer:
+      return value.asInt() >= std::numeric_limits<int32_t>::min() &&
+             value.asInt() <= std::numeric_limits<int32_t>::max();
+    case ns_smart_objects::SmartType_Double: {
+      const double number = value.asDouble();
+      return number >= std::numeric_limits<int32_t>::min() &&
+             number <= std::numeric_limits<int32_t>::max() &&
+             number == static_cast<double>(static_cast<int32_t>(number));
+    }
+    default:
+      return false;
+  }
+}
+
+bool FormatterJsonRpc::SetMethod(
+    const ns_smart_objects::SmartObject& params,
+    ns_smart_objects::SmartObject& method_container) {
   bool result = false;
 
   if (true == params.keyExists(strings::S_FUNCTION_ID)) {
@@ -161,7 +182,7 @@ bool FormatterJsonRpc::SetMethod(const ns_smart_objects::SmartObject& params,
         params.getElement(strings::S_FUNCTION_ID);
 
     if (ns_smart_objects::SmartType_String == function_id.getType()) {
-      method_container[kMethod] = function_id.asString();
+      method_container[kMethod] = function_id;
       result = true;
     }
   }
@@ -170,7 +191,7 @@ bool FormatterJsonRpc::SetMethod(const ns_smart_objects::SmartObject& params,
 }
 
 bool FormatterJsonRpc::SetId(const ns_smart_objects::SmartObject& params,
-                             Json::Value& id_container) {
+                             ns_smart_objects::SmartObject& id_container) {
   bool result = false;
 
   if (true == params.keyExists(strings::S_CORRELATION_ID)) {
@@ -186,8 +207,9 @@ bool FormatterJsonRpc::SetId(const ns_smart_objects::SmartObject& params,
   return result;
 }
 
-bool FormatterJsonRpc::SetMessage(const ns_smart_objects::SmartObject& params,
-                                  Json::Value& message_container) {
+bool FormatterJsonRpc::SetMessage(
+    const ns_smart_objects::SmartObject& params,
+    ns_smart_objects::SmartObject& message_container) {
   bool result = false;
 
   if (true == params.keyExists(strings::kMessage)) {
@@ -195,7 +217,7 @@ bool FormatterJsonRpc::SetMessage(const ns_smart_objects::SmartObject& params,
         params.getElement(strings::kMessage);
 
     if (ns_smart_objects::SmartType_String == message.getType()) {
-      message_container[kMessage] = message.asString();
+      message_container[kMessage] = message;
       result = true;
     }
   }
@@ -33,7 +33,6 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 #include "formatters/generic_json_formatter.h"
-#include "utils/jsoncpp_reader_wrapper.h"
 
 namespace ns_smart_device_link {
 namespace ns_json_handler {
@@ -41,22 +40,12 @@ namespace formatters {
 
 void GenericJsonFormatter::ToString(const ns_smart_objects::SmartObject& obj,
                                     std::string& out_str) {
-  Json::Value json_root;
-  objToJsonValue(obj, json_root);
-  out_str = json_root.toStyledString();
+  objToJsonString(obj, out_str);
 }
 
 bool GenericJsonFormatter::FromString(const std::string& str,
                                       ns_smart_objects::SmartObject& out) {
-  Json::Value json_root;
-  utils::JsonReader reader;
-  const bool result = reader.parse(str, &json_root);
-
-  if (result) {
-    jsonValueToObj(json_root, out);
-  }
-
-  return result;
+  return jsonStringToObj(str, out);
 }
 
 }  // namespace formatters
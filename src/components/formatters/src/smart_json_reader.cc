@@ -0,0 +1,445 @@
+/*
+ * @file smart_json_reader.cc
+ * @brief JSON to SmartObject reader source file.
+ */
+// Copyright (c) 2021, Ford Motor Company
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer.
+//
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following
+// disclaimer in the documentation and/or other materials provided with the
+// distribution.
+//
+// Neither the name of the Ford Motor Company nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 'A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "formatters/smart_json_reader.h"
+
+#include <errno.h>
+#include <locale.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+namespace ns_smart_device_link {
+namespace ns_json_handler {
+namespace formatters {
+
+namespace smart_objects = ns_smart_device_link::ns_smart_objects;
+
+namespace {
+/**
+ * @brief Same nesting limit as default Json::CharReader has
+ */
+const size_t kMaxDepth = 1000;
+
+bool IsDigit(const char c) {
+  return c >= '0' && c <= '9';
+}
+
+void AppendUTF8(const uint32_t code_point, std::string& out) {
+  if (code_point < 0x80) {
+    out += static_cast<char>(code_point);
+  } else if (code_point < 0x800) {
+    out += static_cast<char>(0xC0 | (code_point >> 6));
+    out += static_cast<char>(0x80 | (code_point & 0x3F));
+  } else if (code_point < 0x10000) {
+    out += static_cast<char>(0xE0 | (code_point >> 12));
+    out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (code_point & 0x3F));
+  } else {
+    out += static_cast<char>(0xF0 | (code_point >> 18));
+    out += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+    out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (code_point & 0x3F));
+  }
+}
+
+/**
+ * @brief Converts number token to double regardless of current C locale
+ */
+bool StringToDouble(const char* begin, const char* end, double& value) {
+  std::string token(begin, end);
+  const char decimal_point = *localeconv()->decimal_point;
+  if ('.' != decimal_point) {
+    std::replace(token.begin(), token.end(), '.', decimal_point);
+  }
+  char* token_end = NULL;
+  errno = 0;
+  value = strtod(token.c_str(), &token_end);
+  if (token_end != token.c_str() + token.size()) {
+    return false;
+  }
+  return !(ERANGE == errno && HUGE_VAL == fabs(value));
+}
+}  // namespace
+
+SmartJsonReader::SmartJsonReader() : current_(NULL), end_(NULL) {}
+
+bool SmartJsonReader::Parse(const std::string& str,
+                            smart_objects::SmartObject& out) {
+  return Parse(str.data(), str.data() + str.size(), out);
+}
+
+bool SmartJsonReader::Parse(const char* begin,
+                            const char* end,
+                            smart_objects::SmartObject& out) {
+  current_ = begin;
+  end_ = end;
+
+  smart_objects::SmartObject value;
+  if (!ParseValue(value, 0)) {
+    return false;
+  }
+  // Trailing data is ignored the same way Json::CharReader does
+  out = std::move(value);
+  return true;
+}
+
+bool SmartJsonReader::ParseValue(smart_objects::SmartObject& out,
+                                 const size_t depth) {
+  if (depth > kMaxDepth || !SkipSpaces() || current_ == end_) {
+    return false;
+  }
+
+  switch (*current_) {
+    case '{':
+      ++current_;
+      return ParseObject(out, depth + 1);
+    case '[':
+      ++current_;
+      return ParseArray(out, depth + 1);
+    case '"':
+      ++current_;
+      if (!ParseString(value_)) {
+        return false;
+      }
+      out = value_;
+      return true;
+    case 't':
+      if (!ParseLiteral("true", 4)) {
+        return false;
+      }
+      out = true;
+      return true;
+    case 'f':
+      if (!ParseLiteral("false", 5)) {
+        return false;
+      }
+      out = false;
+      return true;
+    case 'n':
+      // Null value leaves SmartObject untouched as jsonValueToObj does
+      return ParseLiteral("null", 4);
+    default:
+      if ('-' == *current_ || IsDigit(*current_)) {
+        return ParseNumber(out);
+      }
+      return false;
+  }
+}
+
+bool SmartJsonReader::ParseObject(smart_objects::SmartObject& out,
+                                  const size_t depth) {
+  out = smart_objects::SmartObject(smart_objects::SmartType_Map);
+
+  if (!SkipSpaces() || current_ == end_) {
+    return false;
+  }
+  if ('}' == *current_) {
+    ++current_;
+    return true;
+  }
+
+  for (;;) {
+    if (current_ == end_ || '"' != *current_) {
+      return false;
+    }
+    ++current_;
+    if (!ParseString(key_)) {
+      return false;
+    }
+    // Comments are not allowed between a member name and the colon
+    SkipWhitespaces();
+    if (current_ == end_ || ':' != *current_) {
+      return false;
+    }
+    ++current_;
+
+    const size_t size = out.length();
+    smart_objects::SmartObject* value = &out[key_];
+    if (out.length() == size) {
+      // The last of duplicated keys wins. Assignment of null does not reset
+      // SmartObject, so the member is recreated
+      out.erase(key_);
+      value = &out[key_];
+    }
+    if (!ParseValue(*value, depth)) {
+      return false;
+    }
+
+    if (!SkipSpaces() || current_ == end_) {
+      return false;
+    }
+    const char separator = *current_++;
+    if ('}' == separator) {
+      return true;
+    }
+    if (',' != separator || !SkipSpaces()) {
+      return false;
+    }
+  }
+}
+
+bool SmartJsonReader::ParseArray(smart_objects::SmartObject& out,
+                                 const size_t depth) {
+  out = smart_objects::SmartObject(smart_objects::SmartType_Array);
+
+  // Json::CharReader does not allow comments inside of an empty array
+  SkipWhitespaces();
+  if (current_ != end_ && ']' == *current_) {
+    ++current_;
+    return true;
+  }
+
+  for (int32_t index = 0;; ++index) {
+    if (!ParseValue(out[index], depth)) {
+      return false;
+    }
+
+    if (!SkipSpaces() || current_ == end_) {
+      return false;
+    }
+    const char separator = *current_++;
+    if (']' == separator) {
+      return true;
+    }
+    if (',' != separator) {
+      return false;
+    }
+  }
+}
+
+bool SmartJsonReader::ParseNumber(smart_objects::SmartObject& out) {
+  // Number grammar of Json::CharReader: it is a bit more permissive
+  // than RFC 8259, e.g. "1." and "-.5" are accepted
+  const char* const begin = current_;
+  bool is_negative = false;
+  bool is_double = false;
+
+  if ('-' == *current_) {
+    is_negative = true;
+    ++current_;
+  }
+  while (current_ != end_ && IsDigit(*current_)) {
+    ++current_;
+  }
+  if (current_ != end_ && '.' == *current_) {
+    is_double = true;
+    ++current_;
+    while (current_ != end_ && IsDigit(*current_)) {
+      ++current_;
+    }
+  }
+  if (current_ != end_ && ('e' == *current_ || 'E' == *current_)) {
+    is_double = true;
+    ++current_;
+    if (current_ != end_ && ('+' == *current_ || '-' == *current_)) {
+      ++current_;
+    }
+    while (current_ != end_ && IsDigit(*current_)) {
+      ++current_;
+    }
+  }
+
+  if (!is_double) {
+    const uint64_t max_value =
+        is_negative ? static_cast<uint64_t>(INT64_MAX) + 1 : UINT64_MAX;
+    uint64_t value = 0;
+    const char* digit = is_negative ? begin + 1 : begin;
+    for (; digit != current_; ++digit) {
+      const uint64_t digit_value = *digit - '0';
+      if (value > (max_value - digit_value) / 10) {
+        // Too big for any integer type, falls back to double
+        break;
+      }
+      value = value * 10 + digit_value;
+    }
+
+    if (digit == current_) {
+      if (is_negative) {
+        out = static_cast<int64_t>(0 - value);
+      } else {
+        out = value;
+      }
+      return true;
+    }
+  }
+
+  double value = 0.0;
+  if (!StringToDouble(begin, current_, value)) {
+    return false;
+  }
+  out = value;
+  return true;
+}
+
+bool SmartJsonReader::ParseString(std::string& out) {
+  out.clear();
+
+  for (;;) {
+    const char* chunk_end = current_;
+    while (chunk_end != end_ && '"' != *chunk_end && '\\' != *chunk_end) {
+      ++chunk_end;
+    }
+    out.append(current_, chunk_end);
+    current_ = chunk_end;
+
+    if (current_ == end_) {
+      return false;
+    }
+    if ('"' == *current_++) {
+      return true;
+    }
+
+    if (current_ == end_) {
+      return false;
+    }
+    switch (*current_++) {
+      case '"':
+        out += '"';
+        break;
+      case '/':
+        out += '/';
+        break;
+      case '\\':
+        out += '\\';
+        break;
+      case 'b':
+        out += '\b';
+        break;
+      case 'f':
+        out += '\f';
+        break;
+      case 'n':
+        out += '\n';
+        break;
+      case 'r':
+        out += '\r';
+        break;
+      case 't':
+        out += '\t';
+        break;
+      case 'u': {
+        uint32_t code_point = 0;
+        if (!ParseHex(code_point)) {
+          return false;
+        }
+        if (code_point >= 0xD800 && code_point <= 0xDBFF) {
+          // High surrogate must be followed by the second half of the pair
+          uint32_t low_surrogate = 0;
+          if (end_ - current_ < 6 || '\\' != current_[0] ||
+              'u' != current_[1]) {
+            return false;
+          }
+          current_ += 2;
+          if (!ParseHex(low_surrogate)) {
+            return false;
+          }
+          code_point =
+              0x10000 + ((code_point & 0x3FF) << 10) + (low_surrogate & 0x3FF);
+        }
+        AppendUTF8(code_point, out);
+        break;
+      }
+      default:
+        return false;
+    }
+  }
+}
+
+bool SmartJsonReader::ParseHex(uint32_t& code_point) {
+  if (end_ - current_ < 4) {
+    return false;
+  }
+  code_point = 0;
+  for (const char* const hex_end = current_ + 4; current_ != hex_end;
+       ++current_) {
+    const char c = *current_;
+    code_point <<= 4;
+    if (IsDigit(c)) {
+      code_point += c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+      code_point += c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+      code_point += c - 'A' + 10;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SmartJsonReader::ParseLiteral(const char* literal, const size_t length) {
+  if (static_cast<size_t>(end_ - current_) < length ||
+      0 != memcmp(current_, literal, length)) {
+    return false;
+  }
+  current_ += length;
+  return true;
+}
+
+void SmartJsonReader::SkipWhitespaces() {
+  while (current_ != end_ && (' ' == *current_ || '\t' == *current_ ||
+                              '\r' == *current_ || '\n' == *current_)) {
+    ++current_;
+  }
+}
+
+bool SmartJsonReader::SkipSpaces() {
+  for (SkipWhitespaces(); current_ != end_ && '/' == *current_;
+       SkipWhitespaces()) {
+    ++current_;
+    if (current_ == end_) {
+      return false;
+    }
+    if ('/' == *current_) {
+      current_ = std::find(current_, end_, '\n');
+    } else if ('*' == *current_) {
+      static const char kCommentEnd[] = "*/";
+      const char* comment_end =
+          std::search(current_ + 1, end_, kCommentEnd, kCommentEnd + 2);
+      if (comment_end == end_) {
+        return false;
+      }
+      current_ = comment_end + 2;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace formatters
+}  // namespace ns_json_handler
+}  // namespace ns_smart_device_link
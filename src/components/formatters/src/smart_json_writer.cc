@@ -0,0 +1,327 @@
+/*
+ * @file smart_json_writer.cc
+ * @brief SmartObject to JSON writer source file.
+ */
+// Copyright (c) 2021, Ford Motor Company
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer.
+//
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following
+// disclaimer in the documentation and/or other materials provided with the
+// distribution.
+//
+// Neither the name of the Ford Motor Company nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 'A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "formatters/smart_json_writer.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+namespace ns_smart_device_link {
+namespace ns_json_handler {
+namespace formatters {
+
+namespace smart_objects = ns_smart_device_link::ns_smart_objects;
+
+namespace {
+/**
+ * @brief Line width limit used by Json::StyledWriter for arrays
+ */
+const size_t kRightMargin = 74;
+const char kIndent[] = "   ";
+}  // namespace
+
+void SmartJsonWriter::Write(const smart_objects::SmartObject& obj,
+                            std::string& out) {
+  out.clear();
+  SmartJsonWriter writer(out);
+  writer.WriteValue(obj);
+  out += '\n';
+}
+
+SmartJsonWriter::SmartJsonWriter(std::string& out) : out_(out) {}
+
+void SmartJsonWriter::WriteValue(const smart_objects::SmartObject& obj) {
+  switch (obj.getType()) {
+    case smart_objects::SmartType_Map:
+      WriteMap(obj);
+      break;
+    case smart_objects::SmartType_Array:
+      WriteArray(obj);
+      break;
+    default:
+      AppendPlainValue(obj, out_);
+      break;
+  }
+}
+
+void SmartJsonWriter::WriteMap(const smart_objects::SmartObject& obj) {
+  if (obj.empty()) {
+    out_ += "{}";
+    return;
+  }
+
+  WriteWithIndent("{", 1);
+  Indent();
+  // Const iteration keeps the map shared with copies of the object
+  const smart_objects::SmartMap::const_iterator end = obj.map_end();
+  smart_objects::SmartMap::const_iterator it = obj.map_begin();
+  while (it != end) {
+    const std::string& key = it->first;
+    WriteIndent();
+    AppendQuotedString(key.c_str(), key.size(), out_);
+    out_ += " : ";
+    WriteValue(it->second);
+    if (++it != end) {
+      out_ += ',';
+    }
+  }
+  Unindent();
+  WriteWithIndent("}", 1);
+}
+
+void SmartJsonWriter::WriteArray(const smart_objects::SmartObject& obj) {
+  if (obj.empty()) {
+    out_ += "[]";
+    return;
+  }
+
+  if (!IsMultilineArray(obj)) {
+    out_ += "[ ";
+    out_ += array_line_;
+    out_ += " ]";
+    return;
+  }
+
+  WriteWithIndent("[", 1);
+  Indent();
+  const size_t size = obj.length();
+  for (size_t i = 0; i < size; ++i) {
+    WriteIndent();
+    WriteValue(obj.getElement(i));
+    if (i + 1 != size) {
+      out_ += ',';
+    }
+  }
+  Unindent();
+  WriteWithIndent("]", 1);
+}
+
+bool SmartJsonWriter::IsMultilineArray(const smart_objects::SmartObject& obj) {
+  const size_t size = obj.length();
+  if (size * 3 >= kRightMargin) {
+    return true;
+  }
+
+  for (size_t i = 0; i < size; ++i) {
+    const smart_objects::SmartObject& element = obj.getElement(i);
+    const smart_objects::SmartType type = element.getType();
+    if ((smart_objects::SmartType_Map == type ||
+         smart_objects::SmartType_Array == type) &&
+        !element.empty()) {
+      return true;
+    }
+  }
+
+  array_line_.clear();
+  for (size_t i = 0; i < size; ++i) {
+    if (0 != i) {
+      array_line_ += ", ";
+    }
+    AppendPlainValue(obj.getElement(i), array_line_);
+  }
+  // Brackets with the surrounding spaces take four more characters
+  return array_line_.size() + 4 >= kRightMargin;
+}
+
+void SmartJsonWriter::AppendPlainValue(const smart_objects::SmartObject& obj,
+                                       std::string& out) {
+  switch (obj.getType()) {
+    case smart_objects::SmartType_Map:
+      out += "{}";
+      break;
+    case smart_objects::SmartType_Array:
+      out += "[]";
+      break;
+    case smart_objects::SmartType_Null:
+      out += "null";
+      break;
+    case smart_objects::SmartType_Boolean:
+      out += obj.asBool() ? "true" : "false";
+      break;
+    case smart_objects::SmartType_Integer: {
+      const int64_t value = obj.asInt();
+      AppendInteger(value < 0 ? 0 - static_cast<uint64_t>(value) : value,
+                    value < 0,
+                    out);
+      break;
+    }
+    case smart_objects::SmartType_UInteger:
+      AppendInteger(obj.asUInt(), false, out);
+      break;
+    case smart_objects::SmartType_Double:
+      AppendDouble(obj.asDouble(), out);
+      break;
+    case smart_objects::SmartType_String: {
+      const char* str = obj.asCharArray();
+      AppendQuotedString(str, strlen(str), out);
+      break;
+    }
+    default: {
+      const std::string str = obj.asString();
+      AppendQuotedString(str.c_str(), str.size(), out);
+      break;
+    }
+  }
+}
+
+void SmartJsonWriter::AppendQuotedString(const char* str,
+                                         const size_t length,
+                                         std::string& out) {
+  static const char kHexDigits[] = "0123456789ABCDEF";
+
+  out += '"';
+  const char* const end = str + length;
+  const char* chunk_begin = str;
+  for (const char* c = str; c != end; ++c) {
+    const unsigned char ch = static_cast<unsigned char>(*c);
+    if (ch >= 0x20 && '"' != ch && '\\' != ch) {
+      continue;
+    }
+
+    out.append(chunk_begin, c);
+    chunk_begin = c + 1;
+    switch (ch) {
+      case '"':
+        out += "\\\"";
+        break;
+      case '\\':
+        out += "\\\\";
+        break;
+      case '\b':
+        out += "\\b";
+        break;
+      case '\f':
+        out += "\\f";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      case '\r':
+        out += "\\r";
+        break;
+      case '\t':
+        out += "\\t";
+        break;
+      default: {
+        const char escaped[] = {'\\',
+                                'u',
+                                '0',
+                                '0',
+                                kHexDigits[ch >> 4],
+                                kHexDigits[ch & 0xF]};
+        out.append(escaped, sizeof(escaped));
+        break;
+      }
+    }
+  }
+  out.append(chunk_begin, end);
+  out += '"';
+}
+
+void SmartJsonWriter::AppendInteger(const uint64_t value,
+                                    const bool is_negative,
+                                    std::string& out) {
+  char buffer[24];
+  char* const end = buffer + sizeof(buffer);
+  char* begin = end;
+  uint64_t rest = value;
+  do {
+    *--begin = static_cast<char>('0' + rest % 10);
+    rest /= 10;
+  } while (0 != rest);
+  if (is_negative) {
+    *--begin = '-';
+  }
+  out.append(begin, end);
+}
+
+void SmartJsonWriter::AppendDouble(const double value, std::string& out) {
+  char buffer[32];
+  const int length = snprintf(buffer, sizeof(buffer), "%#.16g", value);
+  if (length <= 0) {
+    return;
+  }
+  // Decimal separator of current C locale is replaced like jsoncpp does
+  std::replace(buffer, buffer + length, ',', '.');
+
+  // Trailing zeros of the fraction are truncated keeping one of them,
+  // e.g. "15.20000000000000" becomes "15.20". Exponent is left untouched
+  char* end = buffer + length;
+  char* last_nonzero = end - 1;
+  while (last_nonzero > buffer && '0' == *last_nonzero) {
+    --last_nonzero;
+  }
+  if (last_nonzero != end - 1) {
+    const char* c = last_nonzero;
+    while (c >= buffer && *c >= '0' && *c <= '9') {
+      --c;
+    }
+    if (c >= buffer && '.' == *c) {
+      end = last_nonzero + 2;
+    }
+  }
+  out.append(buffer, end);
+}
+
+void SmartJsonWriter::WriteIndent() {
+  if (!out_.empty()) {
+    const char last = out_[out_.size() - 1];
+    if (' ' == last) {
+      // Already indented, e.g. value following the member name
+      return;
+    }
+    if ('\n' != last) {
+      out_ += '\n';
+    }
+  }
+  out_ += indent_;
+}
+
+void SmartJsonWriter::WriteWithIndent(const char* value, const size_t length) {
+  WriteIndent();
+  out_.append(value, length);
+}
+
+void SmartJsonWriter::Indent() {
+  indent_ += kIndent;
+}
+
+void SmartJsonWriter::Unindent() {
+  indent_.resize(indent_.size() - (sizeof(kIndent) - 1));
+}
+
+}  // namespace formatters
+}  // namespace ns_json_handler
+}  // namespace ns_smart_device_link
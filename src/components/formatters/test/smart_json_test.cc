@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "formatters/CFormatterJsonBase.h"
+#include "formatters/smart_json_reader.h"
+#include "formatters/smart_json_writer.h"
+#include "json/value.h"
+#include "utils/jsoncpp_reader_wrapper.h"
+
+namespace test {
+namespace components {
+namespace formatters {
+
+using namespace ns_smart_device_link::ns_smart_objects;
+using namespace ns_smart_device_link::ns_json_handler::formatters;
+
+namespace {
+const char* kRequest =
+    "{\n"
+    "   \"appID\" : 65537,\n"
+    "   \"displayLayout\" : \"MEDIA\",\n"
+    "   \"ignoreFlag\" : false,\n"
+    "   \"position\" : -15.50,\n"
+    "   \"softButtons\" : [\n"
+    "      {\n"
+    "         \"softButtonID\" : 1,\n"
+    "         \"text\" : \"Play\",\n"
+    "         \"type\" : \"TEXT\"\n"
+    "      },\n"
+    "      {\n"
+    "         \"softButtonID\" : 2,\n"
+    "         \"text\" : \"\\\"Stop\\\"\",\n"
+    "         \"type\" : \"TEXT\"\n"
+    "      }\n"
+    "   ],\n"
+    "   \"vrSynonyms\" : [ \"first\", \"second\", \"third\" ]\n"
+    "}\n";
+}  // namespace
+
+TEST(SmartJsonReaderTest, Parse_Request_ExpectObjectsTree) {
+  SmartObject obj;
+  SmartJsonReader reader;
+  ASSERT_TRUE(reader.Parse(std::string(kRequest), obj));
+
+  ASSERT_EQ(SmartType_Map, obj.getType());
+  EXPECT_EQ(65537, obj["appID"].asInt());
+  EXPECT_EQ("MEDIA", obj["displayLayout"].asString());
+  EXPECT_EQ(SmartType_Boolean, obj["ignoreFlag"].getType());
+  EXPECT_FALSE(obj["ignoreFlag"].asBool());
+  EXPECT_DOUBLE_EQ(-15.5, obj["position"].asDouble());
+  ASSERT_EQ(2u, obj["softButtons"].length());
+  EXPECT_EQ("\"Stop\"", obj["softButtons"][1]["text"].asString());
+  ASSERT_EQ(SmartType_Array, obj["vrSynonyms"].getType());
+  EXPECT_EQ("third", obj["vrSynonyms"][2].asString());
+}
+
+TEST(SmartJsonReaderTest, Parse_SameAsJsonValueToObj) {
+  Json::Value json_value;
+  utils::JsonReader json_reader;
+  ASSERT_TRUE(json_reader.parse(kRequest, &json_value));
+  SmartObject expected;
+  CFormatterJsonBase::jsonValueToObj(json_value, expected);
+
+  SmartObject obj;
+  EXPECT_TRUE(CFormatterJsonBase::jsonStringToObj(kRequest, obj));
+  EXPECT_EQ(expected, obj);
+}
+
+TEST(SmartJsonReaderTest, Parse_Numbers_ExpectJsonCppTypes) {
+  SmartObject obj;
+  SmartJsonReader reader;
+  ASSERT_TRUE(reader.Parse(
+      "[ -1, 2, 4294967296, -9223372036854775808, "
+      "9223372036854775807, 18446744073709551616, 1e2, 0.5 ]",
+      obj));
+
+  EXPECT_EQ(SmartType_Integer, obj[0].getType());
+  EXPECT_EQ(-1, obj[0].asInt());
+  EXPECT_EQ(2u, obj[1].asUInt());
+  EXPECT_EQ(4294967296u, obj[2].asUInt());
+  EXPECT_EQ(INT64_MIN, obj[3].asInt());
+  EXPECT_EQ(INT64_MAX, obj[4].asInt());
+  // Does not fit into 64 bits, falls back to double like jsoncpp does
+  EXPECT_EQ(SmartType_Double, obj[5].getType());
+  EXPECT_EQ(SmartType_Double, obj[6].getType());
+  EXPECT_DOUBLE_EQ(100.0, obj[6].asDouble());
+  EXPECT_DOUBLE_EQ(0.5, obj[7].asDouble());
+}
+
+TEST(SmartJsonReaderTest, Parse_UnicodeEscapes_ExpectUtf8) {
+  SmartObject obj;
+  SmartJsonReader reader;
+  ASSERT_TRUE(reader.Parse(
+      "{\"s\" : \"\\u0041\\u00e9\\u20ac\\ud83d\\ude00\\n\"}", obj));
+  EXPECT_EQ("A\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\n", obj["s"].asString());
+}
+
+TEST(SmartJsonReaderTest, Parse_DuplicatedKeys_LastValueWins) {
+  SmartObject obj;
+  SmartJsonReader reader;
+  ASSERT_TRUE(reader.Parse("{\"a\" : 1, \"b\" : 2, \"a\" : \"x\"}", obj));
+  EXPECT_EQ(2u, obj.length());
+  EXPECT_EQ("x", obj["a"].asString());
+}
+
+TEST(SmartJsonReaderTest, Parse_Comments_ExpectSkipped) {
+  SmartObject obj;
+  SmartJsonReader reader;
+  ASSERT_TRUE(reader.Parse(
+      "// header\n{ /* first */ \"a\" : 1, // tail\n \"b\" : [ 2 ] }", obj));
+  EXPECT_EQ(1, obj["a"].asInt());
+  EXPECT_EQ(2, obj["b"][0].asInt());
+}
+
+TEST(SmartJsonReaderTest, Parse_InvalidDocument_OutputNotChanged) {
+  const char* invalid_documents[] = {"",
+                                     "{",
+                                     "{\"a\" 1}",
+                                     "{\"a\" : 1,}",
+                                     "[1 2]",
+                                     "\"unterminated",
+                                     "\"\\ud83d\"",
+                                     "tru",
+                                     "/* comment"};
+  SmartJsonReader reader;
+  for (size_t i = 0; i < sizeof(invalid_documents) / sizeof(char*); ++i) {
+    SmartObject obj("untouched");
+    EXPECT_FALSE(reader.Parse(invalid_documents[i], obj))
+        << invalid_documents[i];
+    EXPECT_EQ("untouched", obj.asString()) << invalid_documents[i];
+  }
+}
+
+TEST(SmartJsonReaderTest, Parse_TooDeepNesting_ExpectFail) {
+  const std::string document = std::string(2000, '[') + std::string(2000, ']');
+  SmartObject obj;
+  SmartJsonReader reader;
+  EXPECT_FALSE(reader.Parse(document, obj));
+}
+
+TEST(SmartJsonWriterTest, Write_Request_ExpectStyledString) {
+  SmartObject obj;
+  ASSERT_TRUE(CFormatterJsonBase::jsonStringToObj(kRequest, obj));
+
+  std::string result;
+  SmartJsonWriter::Write(obj, result);
+  EXPECT_EQ(kRequest, result);
+}
+
+TEST(SmartJsonWriterTest, Write_ExpectStyledLayout) {
+  SmartObject obj(SmartType_Map);
+  obj["empty_array"] = SmartObject(SmartType_Array);
+  obj["empty_map"] = SmartObject(SmartType_Map);
+  obj["nested"][0]["key"] = "value";
+  obj["long_array"] = SmartObject(SmartType_Array);
+  for (int i = 0; i < 25; ++i) {
+    obj["long_array"][i] = i;
+  }
+  obj["escaped"] = "tab\tquote\"backslash\\\x01";
+  obj["null"] = SmartObject(SmartType_Null);
+  obj["negative"] = -42;
+
+  std::string expected =
+      "{\n"
+      "   \"empty_array\" : [],\n"
+      "   \"empty_map\" : {},\n"
+      "   \"escaped\" : \"tab\\tquote\\\"backslash\\\\\\u0001\",\n"
+      "   \"long_array\" : [\n";
+  for (int i = 0; i < 25; ++i) {
+    expected += "      " + std::to_string(i) + (i < 24 ? ",\n" : "\n");
+  }
+  expected +=
+      "   ],\n"
+      "   \"negative\" : -42,\n"
+      "   \"nested\" : [\n"
+      "      {\n"
+      "         \"key\" : \"value\"\n"
+      "      }\n"
+      "   ],\n"
+      "   \"null\" : null\n"
+      "}\n";
+
+  std::string result;
+  CFormatterJsonBase::objToJsonString(obj, result);
+  EXPECT_EQ(expected, result);
+}
+
+TEST(SmartJsonWriterTest, Write_Doubles_ExpectFixedPrecision) {
+  SmartObject obj(SmartType_Array);
+  obj[0] = 15.2;
+  obj[1] = 10.0;
+  obj[2] = -0.125;
+
+  std::string result;
+  SmartJsonWriter::Write(obj, result);
+  EXPECT_EQ("[ 15.20, 10.0, -0.1250 ]\n", result);
+}
+
+}  // namespace formatters
+}  // namespace components
+}  // namespace test
@@ -37,9 +37,9 @@
 #include "hmi_message_handler/hmi_message_adapter.h"
 #include "hmi_message_handler/hmi_message_handler.h"
 #include "hmi_message_handler/hmi_message_handler_settings.h"
+#include "utils/bucket_prioritized_queue.h"
 #include "utils/macro.h"
 #include "utils/message_queue.h"
-#include "utils/prioritized_queue.h"
 #include "utils/threads/message_loop_thread.h"
 #include "utils/threads/thread.h"
 
@@ -73,9 +73,10 @@ struct MessageToHmi : public MessageSharedPointer {
   }
 };
 
-typedef threads::MessageLoopThread<utils::PrioritizedQueue<MessageFromHmi> >
+typedef threads::MessageLoopThread<
+    utils::BucketPrioritizedQueue<MessageFromHmi> >
     FromHmiQueue;
-typedef threads::MessageLoopThread<utils::PrioritizedQueue<MessageToHmi> >
+typedef threads::MessageLoopThread<utils::BucketPrioritizedQueue<MessageToHmi> >
     ToHmiQueue;
 }  // namespace impl
 
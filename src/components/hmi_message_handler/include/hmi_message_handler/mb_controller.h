@@ -100,6 +100,15 @@ class CMessageBrokerController {
 
   bool sendJsonMessage(Json::Value& message);
 
+  /**
+   * @brief Sends message already encoded to JSON-RPC without parsing it
+   * @param message Encoded message
+   * @param info Routing data of the message
+   * @return false if there is no controller for request
+   */
+  bool sendEncodedMessage(const std::string& message,
+                          const EncodedMessageInfo& info);
+
   void subscribeTo(std::string property);
 
   void registerController(int id = 0);
@@ -145,9 +154,20 @@ class CMessageBrokerController {
 
   int getNextControllerId();
 
+  /**
+   * @brief Checks whether caller runs on the thread which serves sessions
+   */
+  bool IsIoThread();
+
  private:
   void CloseConnection();
 
+  /**
+   * @brief Finds session of controller which handles requests of the method
+   * @return Session or empty pointer if controller is not registered
+   */
+  std::shared_ptr<WebsocketSession> getControllerByMethod(std::string& method);
+
   boost::asio::io_context ioc_;
   const std::string& address_;
   uint16_t port_;
@@ -81,9 +81,21 @@ class MessageBrokerAdapter
   void ProcessRecievedFromMB(Json::Value& root);
 
  private:
+  /**
+   * @brief Fills routing data of encoded message from its metadata
+   * @return false if metadata is not enough to route the message
+   */
+  static bool GetEncodedMessageInfo(const application_manager::Message& message,
+                                    EncodedMessageInfo& info);
+
   static const std::string ADDRESS;
   static const uint16_t PORT;
 
+  /**
+   * @brief Writer of messages received from HMI, produces compact JSON
+   */
+  Json::StreamWriterBuilder writer_builder_;
+
   DISALLOW_COPY_AND_ASSIGN(MessageBrokerAdapter);
 };
 }  //  namespace hmi_message_handler
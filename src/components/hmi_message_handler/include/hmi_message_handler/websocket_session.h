@@ -36,11 +36,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <boost/asio/bind_executor.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/placeholders.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/strand.hpp>
 #include <boost/beast/core.hpp>
 #include <boost/beast/websocket.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/thread/thread.hpp>
 #include <cstdlib>
+#include <deque>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -50,14 +53,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <thread>
 #include <vector>
 #include "json/json.h"
+#include "utils/conditional_variable.h"
 #include "utils/lock.h"
 #include "utils/macro.h"
-#include "utils/message_queue.h"
-#include "utils/threads/message_loop_thread.h"
-#include "utils/threads/thread.h"
 
 using namespace boost::beast::websocket;
-using ::utils::MessageQueue;
 
 #ifdef DEBUG_ON
 /**
@@ -77,17 +77,36 @@ using ::utils::MessageQueue;
   printf("ERROR!!! %s:%d ", __FILE__, __LINE__); \
   printf x
 
-typedef std::queue<std::shared_ptr<std::string> > AsyncQueue;
 typedef std::shared_ptr<std::string> Message;
 
 namespace hmi_message_handler {
 
 class CMessageBrokerController;
 
+/**
+ * @brief Routing data of a message which is already encoded to JSON-RPC,
+ * so that it can be sent without being parsed back
+ */
+struct EncodedMessageInfo {
+  enum Type { kRequest, kResponse, kNotification };
+
+  Type type;
+
+  /**
+   * @brief Value of "id" field, is empty for notifications
+   */
+  std::string id;
+
+  /**
+   * @brief Value of "method" field
+   */
+  std::string method;
+};
+
 class WebsocketSession : public std::enable_shared_from_this<WebsocketSession> {
   boost::beast::websocket::stream<boost::asio::ip::tcp::socket> ws_;
+  boost::asio::strand<boost::asio::io_context::executor_type> strand_;
   boost::beast::multi_buffer buffer_;
-  boost::beast::multi_buffer send_buffer_;
   CMessageBrokerController* controller_;
 
  public:
@@ -104,15 +123,23 @@ class WebsocketSession : public std::enable_shared_from_this<WebsocketSession> {
 
   void Recv(boost::system::error_code ec);
 
-  void Send(const std::string& message, Json::Value& json_message);
-
+  /**
+   * @brief Takes all pending messages as one batch and starts writing them,
+   * runs on the session strand only
+   */
   void SendFromQueue();
 
   void sendJsonMessage(Json::Value& message);
 
-  void OnWrite(boost::system::error_code ec,
-               std::size_t bytes_transferred,
-               std::shared_ptr<std::string> message);
+  /**
+   * @brief Queues already encoded message for sending as is
+   * @param message Encoded message shared with other sessions
+   * @param info Routing data of the message
+   */
+  void sendEncodedMessage(const Message& message,
+                          const EncodedMessageInfo& info);
+
+  void OnWrite(boost::system::error_code ec, std::size_t bytes_transferred);
 
   void Read(boost::system::error_code ec, std::size_t bytes_transferred);
 
@@ -150,50 +177,48 @@ class WebsocketSession : public std::enable_shared_from_this<WebsocketSession> {
   std::atomic_bool stop;
 
  private:
-  void onMessageReceived(Json::Value message);
+  void onMessageReceived(Json::Value& message);
 
   std::map<std::string, std::string> mWaitResponseQueue;
 
-  std::string m_receivingBuffer;
-
   int mControllersIdStart;
 
   int mControllersIdCurrent;
 
   Json::StreamWriterBuilder m_writer;
-  Json::StreamWriterBuilder m_receiver_writer;
 
-  sync_primitives::Lock queue_lock_;
-  sync_primitives::Lock message_queue_lock_;
-  std::atomic_bool shutdown_;
-
-  MessageQueue<Message, AsyncQueue> message_queue_;
-
-  class LoopThreadDelegate : public threads::ThreadDelegate {
-   public:
-    LoopThreadDelegate(MessageQueue<Message, AsyncQueue>* message_queue,
-                       WebsocketSession* handler);
-
-    virtual void threadMain() OVERRIDE;
-    virtual void exitThreadMain() OVERRIDE;
+  /**
+   * @brief Adds message to the outbound queue. If the queue is full, waits
+   * for the space unless called on the I/O thread, which drains the queue.
+   * Request is awaited for the response only if it is queued
+   * @param info Routing data of the message
+   * @return false if message was dropped
+   */
+  bool PushMessage(const Message& message, const EncodedMessageInfo& info);
 
-    void OnWrite();
+  /**
+   * @brief Writes the next message of the current batch asynchronously
+   */
+  void WriteNext();
 
-    void SetShutdown();
-
-   private:
-    void DrainQueue();
-    MessageQueue<Message, AsyncQueue>& message_queue_;
-    WebsocketSession& handler_;
-    sync_primitives::Lock queue_lock_;
-    sync_primitives::ConditionalVariable queue_new_items_;
-    std::atomic_bool shutdown_;
-
-    sync_primitives::Lock write_lock_;
-  };
+  sync_primitives::Lock queue_lock_;
+  std::atomic_bool shutdown_;
 
-  LoopThreadDelegate* thread_delegate_;
-  threads::Thread* thread_;
+  /**
+   * @brief Outbound messages which are not taken for writing yet, guarded by
+   * message_queue_lock_ as well as accepted_ and write_scheduled_ flags
+   */
+  sync_primitives::Lock message_queue_lock_;
+  sync_primitives::ConditionalVariable queue_space_available_;
+  std::deque<Message> pending_messages_;
+  bool accepted_;
+  bool write_scheduled_;
+
+  /**
+   * @brief Messages being written, accessed on the strand only
+   */
+  std::vector<Message> write_batch_;
+  size_t write_batch_index_;
 };
 
 }  // namespace hmi_message_handler
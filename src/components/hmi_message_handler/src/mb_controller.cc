@@ -186,8 +186,66 @@ bool CMessageBrokerController::sendJsonMessage(Json::Value& message) {
   }
 
   // Send request
-  std::shared_ptr<WebsocketSession> ws;
   std::string method = message["method"].asString();
+  std::shared_ptr<WebsocketSession> ws = getControllerByMethod(method);
+  if (!ws) {
+    return false;
+  }
+
+  ws->sendJsonMessage(message);
+  return true;
+}
+
+bool CMessageBrokerController::sendEncodedMessage(
+    const std::string& message, const EncodedMessageInfo& info) {
+  // Single buffer is shared by all the sessions the message is sent to
+  const std::shared_ptr<std::string> buffer =
+      std::make_shared<std::string>();
+  buffer->reserve(message.size() + 1);
+  buffer->append(message).push_back('\n');
+
+  if (EncodedMessageInfo::kNotification == info.type) {
+    const auto result = getSubscribersFd(info.method);
+    if (result.empty()) {
+      SDL_LOG_ERROR("No subscribers for method: " << info.method);
+    }
+    for (const auto& ws : result) {
+      ws->sendEncodedMessage(buffer, info);
+    }
+    return true;
+  }
+
+  if (EncodedMessageInfo::kResponse == info.type) {
+    std::weak_ptr<WebsocketSession> weak_ws;
+    {
+      sync_primitives::AutoLock request_lock(mRequestListLock);
+      const auto it = mRequestList.find(info.id);
+      if (it != mRequestList.end()) {
+        std::swap(weak_ws, it->second);
+        mRequestList.erase(it);
+      }
+    }
+    if (auto ws = weak_ws.lock()) {
+      ws->sendEncodedMessage(buffer, info);
+    } else {
+      SDL_LOG_ERROR("A request is not found for id: " << info.id);
+    }
+    return true;
+  }
+
+  std::string method = info.method;
+  std::shared_ptr<WebsocketSession> ws = getControllerByMethod(method);
+  if (!ws) {
+    return false;
+  }
+
+  ws->sendEncodedMessage(buffer, info);
+  return true;
+}
+
+std::shared_ptr<WebsocketSession>
+CMessageBrokerController::getControllerByMethod(std::string& method) {
+  std::shared_ptr<WebsocketSession> ws;
   std::string component_name = GetComponentName(method);
 
   {
@@ -205,11 +263,8 @@ bool CMessageBrokerController::sendJsonMessage(Json::Value& message) {
   if (!ws) {
     SDL_LOG_ERROR(
         "A controller is not found for the method: " << component_name);
-    return false;
   }
-
-  ws->sendJsonMessage(message);
-  return true;
+  return ws;
 }
 
 void CMessageBrokerController::subscribeTo(std::string property) {}
@@ -484,6 +539,10 @@ int CMessageBrokerController::getNextControllerId() {
   return 1000 * mControllersIdCounter++;
 }
 
+bool CMessageBrokerController::IsIoThread() {
+  return ioc_.get_executor().running_in_this_thread();
+}
+
 void CMessageBrokerController::CloseConnection() {
   if (!ioc_.stopped()) {
     boost::system::error_code ec;
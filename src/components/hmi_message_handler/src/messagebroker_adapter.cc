@@ -47,6 +47,7 @@ MessageBrokerAdapter::MessageBrokerAdapter(HMIMessageHandler* handler_param,
                                            uint16_t port)
     : HMIMessageAdapterImpl(handler_param)
     , MessageBrokerController(server_address, port, "SDL", 8) {
+  writer_builder_["indentation"] = "";
   SDL_LOG_TRACE("Created MessageBrokerAdapter");
 }
 
@@ -61,9 +62,18 @@ void MessageBrokerAdapter::SendMessageToHMI(
     return;
   }
 
+  EncodedMessageInfo info;
+  if (GetEncodedMessageInfo(*message, info)) {
+    if (!sendEncodedMessage(message->json_message(), info)) {
+      handler()->OnErrorSending(message);
+    }
+    return;
+  }
+
+  // Routing data is unknown, so it is taken from the message itself
   utils::JsonReader reader;
   Json::Value json_value;
-  const std::string str = message->json_message();
+  const std::string& str = message->json_message();
 
   if (!reader.parse(str, &json_value)) {
     SDL_LOG_ERROR("Received invalid json string. ");
@@ -75,6 +85,32 @@ void MessageBrokerAdapter::SendMessageToHMI(
   }
 }
 
+bool MessageBrokerAdapter::GetEncodedMessageInfo(
+    const application_manager::Message& message, EncodedMessageInfo& info) {
+  info.method = message.function_name();
+  if (info.method.empty()) {
+    return false;
+  }
+
+  switch (message.type()) {
+    case application_manager::MessageType::kRequest:
+      info.type = EncodedMessageInfo::kRequest;
+      break;
+    case application_manager::MessageType::kResponse:
+    case application_manager::MessageType::kErrorResponse:
+      info.type = EncodedMessageInfo::kResponse;
+      break;
+    case application_manager::MessageType::kNotification:
+      info.type = EncodedMessageInfo::kNotification;
+      return true;
+    default:
+      return false;
+  }
+  // Formatter writes correlation id as integer "id" field
+  info.id = std::to_string(message.correlation_id());
+  return true;
+}
+
 void MessageBrokerAdapter::processResponse(std::string method,
                                            Json::Value& root) {
   SDL_LOG_AUTO_TRACE();
@@ -162,14 +198,13 @@ void* MessageBrokerAdapter::SubscribeAndBeginReceiverThread(void* param) {
 
 void MessageBrokerAdapter::ProcessRecievedFromMB(Json::Value& root) {
   SDL_LOG_AUTO_TRACE();
-  SDL_LOG_INFO("MB_Adapter: " << root);
   if (root.isNull()) {
     // LOG
     return;
   }
 
-  Json::StreamWriterBuilder writer_builder;
-  const std::string message_string = Json::writeString(writer_builder, root);
+  const std::string message_string = Json::writeString(writer_builder_, root);
+  SDL_LOG_INFO("MB_Adapter: " << message_string);
 
   if (message_string.empty()) {
     // LOG
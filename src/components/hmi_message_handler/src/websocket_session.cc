@@ -38,34 +38,45 @@ namespace hmi_message_handler {
 
 SDL_CREATE_LOG_VARIABLE("HMIMessageHandler")
 
+namespace {
+// Bound of outbound messages queued for a session
+const size_t kMaxPendingMessages = 1024u;
+// Time the producer waits for the space in the full outbound queue
+const uint32_t kQueueFullTimeoutMs = 1000u;
+}  // namespace
+
 WebsocketSession::WebsocketSession(boost::asio::ip::tcp::socket socket,
                                    CMessageBrokerController* controller)
     : ws_(std::move(socket))
+    , strand_(static_cast<boost::asio::io_context&>(
+                  ws_.get_executor().context())
+                  .get_executor())
     , controller_(controller)
     , stop(false)
-    , m_receivingBuffer("")
     , mControllersIdStart(-1)
     , mControllersIdCurrent(0)
     , shutdown_(false)
-    , thread_delegate_(new LoopThreadDelegate(&message_queue_, this))
-    , thread_(threads::CreateThread("WS Async Send", thread_delegate_)) {
+    , accepted_(false)
+    , write_scheduled_(false)
+    , write_batch_index_(0) {
   m_writer["indentation"] = "";
-  thread_->Start(threads::ThreadOptions());
 }
 
 WebsocketSession::~WebsocketSession() {}
 
 void WebsocketSession::Accept() {
-  ws_.async_accept(std::bind(
-      &WebsocketSession::Recv, shared_from_this(), std::placeholders::_1));
+  ws_.async_accept(boost::asio::bind_executor(
+      strand_,
+      std::bind(&WebsocketSession::Recv,
+                shared_from_this(),
+                std::placeholders::_1)));
 }
 
 void WebsocketSession::Shutdown() {
   shutdown_ = true;
-  thread_delegate_->SetShutdown();
-  thread_->Stop(threads::Thread::kThreadSoftStop);
-  delete thread_delegate_;
-  threads::DeleteThread(thread_);
+  sync_primitives::AutoLock auto_lock(message_queue_lock_);
+  pending_messages_.clear();
+  queue_space_available_.Broadcast();
 }
 
 bool WebsocketSession::IsShuttingDown() {
@@ -80,38 +91,142 @@ void WebsocketSession::Recv(boost::system::error_code ec) {
   if (ec) {
     std::string str_err = "ErrorMessage: " + ec.message();
     SDL_LOG_ERROR(str_err);
-    shutdown_ = true;
-    thread_delegate_->SetShutdown();
+    Shutdown();
     controller_->deleteController(*this);
     return;
   }
 
+  {
+    sync_primitives::AutoLock auto_lock(message_queue_lock_);
+    if (!accepted_) {
+      // Messages queued before the handshake are sent right after it
+      accepted_ = true;
+      if (!pending_messages_.empty()) {
+        write_scheduled_ = true;
+        boost::asio::post(
+            strand_,
+            std::bind(&WebsocketSession::SendFromQueue, shared_from_this()));
+      }
+    }
+  }
+
   ws_.async_read(buffer_,
-                 std::bind(&WebsocketSession::Read,
-                           shared_from_this(),
-                           std::placeholders::_1,
-                           std::placeholders::_2));
+                 boost::asio::bind_executor(
+                     strand_,
+                     std::bind(&WebsocketSession::Read,
+                               shared_from_this(),
+                               std::placeholders::_1,
+                               std::placeholders::_2)));
 }
 
-void WebsocketSession::Send(const std::string& message,
-                            Json::Value& json_message) {
+void WebsocketSession::sendJsonMessage(Json::Value& message) {
   if (shutdown_) {
     return;
   }
-  std::shared_ptr<std::string> message_ptr =
-      std::make_shared<std::string>(message);
-  message_queue_.push(message_ptr);
+  EncodedMessageInfo info;
+  if (isNotification(message)) {
+    info.type = EncodedMessageInfo::kNotification;
+  } else if (isResponse(message)) {
+    info.type = EncodedMessageInfo::kResponse;
+  } else {
+    info.type = EncodedMessageInfo::kRequest;
+    info.id = message["id"].asString();
+    info.method = message["method"].asString();
+  }
+  const std::string str_msg = Json::writeString(m_writer, message) + '\n';
+  PushMessage(std::make_shared<std::string>(str_msg), info);
 }
 
-void WebsocketSession::sendJsonMessage(Json::Value& message) {
-  const std::string str_msg = Json::writeString(m_writer, message) + '\n';
-  sync_primitives::AutoLock auto_lock(queue_lock_);
-  if (!isNotification(message) && !isResponse(message)) {
-    mWaitResponseQueue.insert(std::map<std::string, std::string>::value_type(
-        message["id"].asString(), message["method"].asString()));
+void WebsocketSession::sendEncodedMessage(const Message& message,
+                                          const EncodedMessageInfo& info) {
+  if (shutdown_) {
+    return;
   }
+  PushMessage(message, info);
+}
 
-  Send(str_msg, message);
+bool WebsocketSession::PushMessage(const Message& message,
+                                   const EncodedMessageInfo& info) {
+  // Waiting on the I/O thread would block the writes which free the queue
+  const bool can_wait = controller_ && !controller_->IsIoThread();
+
+  sync_primitives::AutoLock auto_lock(message_queue_lock_);
+  while (can_wait && !shutdown_ &&
+         pending_messages_.size() >= kMaxPendingMessages) {
+    if (sync_primitives::ConditionalVariable::kTimeout ==
+        queue_space_available_.WaitFor(auto_lock, kQueueFullTimeoutMs)) {
+      break;
+    }
+  }
+
+  if (shutdown_) {
+    return false;
+  }
+
+  if (pending_messages_.size() >= kMaxPendingMessages) {
+    SDL_LOG_ERROR("Outbound queue is full, message is dropped");
+    return false;
+  }
+
+  if (EncodedMessageInfo::kRequest == info.type) {
+    // Added while the message can't be written yet, so the response can't
+    // outrun it
+    sync_primitives::AutoLock wait_response_lock(queue_lock_);
+    mWaitResponseQueue.insert(
+        std::map<std::string, std::string>::value_type(info.id, info.method));
+  }
+  pending_messages_.push_back(message);
+  if (accepted_ && !write_scheduled_) {
+    write_scheduled_ = true;
+    boost::asio::post(
+        strand_,
+        std::bind(&WebsocketSession::SendFromQueue, shared_from_this()));
+  }
+  return true;
+}
+
+void WebsocketSession::SendFromQueue() {
+  {
+    sync_primitives::AutoLock auto_lock(message_queue_lock_);
+    if (shutdown_ || pending_messages_.empty()) {
+      write_scheduled_ = false;
+      return;
+    }
+    write_batch_.assign(pending_messages_.begin(), pending_messages_.end());
+    pending_messages_.clear();
+    queue_space_available_.Broadcast();
+  }
+
+  write_batch_index_ = 0;
+  WriteNext();
+}
+
+void WebsocketSession::WriteNext() {
+  // Every message is a separate frame as HMI expects a single JSON per frame
+  ws_.async_write(
+      boost::asio::buffer(*write_batch_[write_batch_index_]),
+      boost::asio::bind_executor(strand_,
+                                 std::bind(&WebsocketSession::OnWrite,
+                                           shared_from_this(),
+                                           std::placeholders::_1,
+                                           std::placeholders::_2)));
+}
+
+void WebsocketSession::OnWrite(boost::system::error_code ec,
+                               std::size_t bytes_transferred) {
+  boost::ignore_unused(bytes_transferred);
+  if (ec) {
+    SDL_LOG_ERROR("A system error has occurred: " << ec.message());
+  }
+
+  ++write_batch_index_;
+  if (!shutdown_ && write_batch_index_ < write_batch_.size()) {
+    WriteNext();
+    return;
+  }
+
+  write_batch_.clear();
+  SendFromQueue();
 }
 
 void WebsocketSession::Read(boost::system::error_code ec,
@@ -120,31 +235,23 @@ void WebsocketSession::Read(boost::system::error_code ec,
   if (ec) {
     std::string str_err = "ErrorMessage: " + ec.message();
     SDL_LOG_ERROR(str_err);
-    shutdown_ = true;
-    thread_delegate_->SetShutdown();
+    Shutdown();
     controller_->deleteController(*this);
     buffer_.consume(buffer_.size());
     return;
   }
 
-  std::string data = boost::beast::buffers_to_string(buffer_.data());
-  m_receivingBuffer += data;
+  const std::string data = boost::beast::buffers_to_string(buffer_.data());
 
   utils::JsonReader reader;
   Json::Value root;
 
+  // Whole frame is a single message, so parsed value is passed further as is
   if (!reader.parse(data, &root)) {
     SDL_LOG_ERROR("Invalid JSON Message.");
     return;
   }
 
-  const std::string wmes = Json::writeString(m_receiver_writer, root);
-  ssize_t beginpos = m_receivingBuffer.find(wmes);
-  if (-1 != beginpos) {
-    m_receivingBuffer.erase(0, beginpos + wmes.length());
-  } else {
-    m_receivingBuffer.clear();
-  }
   onMessageReceived(root);
 
   buffer_.consume(buffer_.size());
@@ -163,7 +270,7 @@ std::string WebsocketSession::GetComponentName(std::string& method) {
   return return_string;
 }
 
-void WebsocketSession::onMessageReceived(Json::Value message) {
+void WebsocketSession::onMessageReceived(Json::Value& message) {
   // Determine message type and process...
   Json::Value error;
   if (checkMessage(message, error)) {
@@ -285,40 +392,4 @@ bool WebsocketSession::checkMessage(Json::Value& root, Json::Value& error) {
   return true;
 }
 
-WebsocketSession::LoopThreadDelegate::LoopThreadDelegate(
-    MessageQueue<Message, AsyncQueue>* message_queue, WebsocketSession* handler)
-    : message_queue_(*message_queue), handler_(*handler), shutdown_(false) {}
-
-void WebsocketSession::LoopThreadDelegate::threadMain() {
-  while (!message_queue_.IsShuttingDown() && !shutdown_) {
-    DrainQueue();
-    message_queue_.wait();
-  }
-  DrainQueue();
-}
-
-void WebsocketSession::LoopThreadDelegate::exitThreadMain() {
-  shutdown_ = true;
-  if (!message_queue_.IsShuttingDown()) {
-    message_queue_.Shutdown();
-  }
-}
-
-void WebsocketSession::LoopThreadDelegate::DrainQueue() {
-  Message message_ptr;
-  while (!shutdown_ && message_queue_.pop(message_ptr)) {
-    boost::system::error_code ec;
-    handler_.ws_.write(boost::asio::buffer(*message_ptr), ec);
-    if (ec) {
-      SDL_LOG_ERROR("A system error has occurred: " << ec.message());
-    }
-  }
-}
-
-void WebsocketSession::LoopThreadDelegate::SetShutdown() {
-  shutdown_ = true;
-  if (!message_queue_.IsShuttingDown()) {
-    message_queue_.Shutdown();
-  }
-}
 }  // namespace hmi_message_handler
@@ -237,6 +237,49 @@ TEST(WebsocketSessionTest, SendMessage_UnpreparedConnection_WithoutFall) {
   EXPECT_EXIT(send_message(), ::testing::ExitedWithCode(0), "");
 }
 
+TEST(WebsocketSessionTest,
+     SendEncodedMessage_UnpreparedConnection_WithoutFall) {
+  ::testing::FLAGS_gtest_death_test_style = "fast";
+
+  auto send_message = []() {
+    auto message = std::make_shared<std::string>(
+        "{\"id\":1,\"jsonrpc\":\"2.0\",\"method\":"
+        "\"BasicCommunication.GetSystemInfo\"}\n");
+    hmi_message_handler::EncodedMessageInfo info;
+    info.type = hmi_message_handler::EncodedMessageInfo::kRequest;
+    info.id = "1";
+    info.method = "BasicCommunication.GetSystemInfo";
+
+    // Make unprepared connection
+    boost::asio::io_context ioc{1};
+    boost::asio::ip::tcp::acceptor acceptor{
+        ioc, {boost::asio::ip::make_address("127.0.0.1"), 8088}};
+    boost::asio::ip::tcp::socket socket{ioc};
+
+    std::unique_ptr<hmi_message_handler::WebsocketSession> session(
+        new hmi_message_handler::WebsocketSession(std::move(socket), nullptr));
+
+    // Send message to unprepared connection
+    session->sendEncodedMessage(message, info);
+
+    // Wait for the message to be processed
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // Response is matched with the request without parsing it
+    if (info.method != session->findMethodById(info.id)) {
+      exit(1);
+    }
+
+    // Stopping connection thread
+    session->Shutdown();
+    session = nullptr;
+
+    exit(0);
+  };
+
+  EXPECT_EXIT(send_message(), ::testing::ExitedWithCode(0), "");
+}
+
 }  // namespace hmi_message_handler_test
 }  // namespace components
 }  // namespace test
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "hmi_message_handler/mb_controller.h"
+#include "hmi_message_handler/websocket_session.h"
+#include "utils/date_time.h"
+
+namespace test {
+namespace components {
+namespace hmi_message_handler_test {
+
+using hmi_message_handler::CMessageBrokerController;
+using hmi_message_handler::EncodedMessageInfo;
+using hmi_message_handler::WebsocketSession;
+
+namespace {
+const size_t kMaxPendingMessages = 1024u;
+const int64_t kQueueFullTimeoutMs = 1000;
+const std::string kMethod = "UI.Show";
+
+EncodedMessageInfo RequestInfo(const std::string& id) {
+  EncodedMessageInfo info;
+  info.type = EncodedMessageInfo::kRequest;
+  info.id = id;
+  info.method = kMethod;
+  return info;
+}
+
+Message MakeMessage() {
+  return std::make_shared<std::string>("{\"jsonrpc\":\"2.0\"}");
+}
+
+/**
+ * @brief Controller which is never started, so no thread is its I/O thread
+ */
+class IdleController : public CMessageBrokerController {
+ public:
+  IdleController() : CMessageBrokerController("127.0.0.1", 8087, "SDL", 1) {}
+  void processResponse(std::string method, Json::Value& root) OVERRIDE {}
+  void processRequest(Json::Value& root) OVERRIDE {}
+  void processNotification(Json::Value& root) OVERRIDE {}
+};
+}  // namespace
+
+/**
+ * Session is never accepted, so nothing drains its outbound queue
+ */
+class WebsocketSessionTest : public ::testing::Test {
+ protected:
+  WebsocketSessionTest()
+      : session_(std::make_shared<WebsocketSession>(
+            boost::asio::ip::tcp::socket(ioc_), &controller_)) {}
+
+  void FillQueue() {
+    for (size_t i = 0; i < kMaxPendingMessages; ++i) {
+      session_->sendEncodedMessage(MakeMessage(),
+                                   RequestInfo(std::to_string(i)));
+    }
+  }
+
+  boost::asio::io_context ioc_;
+  IdleController controller_;
+  std::shared_ptr<WebsocketSession> session_;
+};
+
+TEST_F(WebsocketSessionTest, SendEncodedMessage_QueueNotFull_ResponseAwaited) {
+  FillQueue();
+  EXPECT_EQ(kMethod, session_->findMethodById("0"));
+  EXPECT_EQ(kMethod,
+            session_->findMethodById(std::to_string(kMaxPendingMessages - 1)));
+}
+
+TEST_F(WebsocketSessionTest,
+       SendEncodedMessage_QueueFull_DroppedAfterWaitNotAwaited) {
+  FillQueue();
+
+  const date_time::TimeDuration start = date_time::getCurrentTime();
+  session_->sendEncodedMessage(MakeMessage(), RequestInfo("dropped"));
+  EXPECT_GE(date_time::calculateTimeSpan(start), kQueueFullTimeoutMs - 50);
+
+  EXPECT_EQ("", session_->findMethodById("dropped"));
+}
+
+TEST_F(WebsocketSessionTest,
+       SendEncodedMessage_QueueFull_ShutdownWakesProducer) {
+  FillQueue();
+
+  const date_time::TimeDuration start = date_time::getCurrentTime();
+  std::thread producer([this]() {
+    session_->sendEncodedMessage(MakeMessage(), RequestInfo("dropped"));
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  session_->Shutdown();
+  producer.join();
+
+  EXPECT_LT(date_time::calculateTimeSpan(start), kQueueFullTimeoutMs);
+  EXPECT_EQ("", session_->findMethodById("dropped"));
+}
+
+TEST_F(WebsocketSessionTest,
+       SendEncodedMessage_NoController_DroppedWithoutWait) {
+  // Session without controller behaves like one served on the I/O thread
+  session_ = std::make_shared<WebsocketSession>(
+      boost::asio::ip::tcp::socket(ioc_), nullptr);
+  FillQueue();
+
+  const date_time::TimeDuration start = date_time::getCurrentTime();
+  session_->sendEncodedMessage(MakeMessage(), RequestInfo("dropped"));
+  EXPECT_LT(date_time::calculateTimeSpan(start), kQueueFullTimeoutMs);
+
+  EXPECT_EQ("", session_->findMethodById("dropped"));
+}
+
+}  // namespace hmi_message_handler_test
+}  // namespace components
+}  // namespace test
@@ -41,12 +41,21 @@
 #include "protocol_handler/protocol_handler.h"
 #include "smart_objects/object_schema_item.h"
 
+#ifdef TELEMETRY_MONITOR
+#include "application_manager/telemetry_observer.h"
+#include "telemetry_monitor/telemetry_observable.h"
+#endif  // TELEMETRY_MONITOR
+
 namespace application_manager {
 namespace rpc_service {
 
 using ns_smart_device_link::ns_smart_objects::SMember;
 
-class RPCService {
+class RPCService
+#ifdef TELEMETRY_MONITOR
+    : public telemetry_monitor::TelemetryObservable<AMTelemetryObserver>
+#endif  // TELEMETRY_MONITOR
+{
  public:
   virtual ~RPCService() {}
 
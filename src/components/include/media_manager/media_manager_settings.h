@@ -34,6 +34,7 @@
 #define SRC_COMPONENTS_INCLUDE_MEDIA_MANAGER_MEDIA_MANAGER_SETTINGS_H_
 #include <stdint.h>
 #include <string>
+#include <vector>
 
 namespace media_manager {
 
@@ -57,6 +58,14 @@ class MediaManagerSettings {
   virtual const std::string& app_storage_folder() const = 0;
   virtual const std::string& app_resource_folder() const = 0;
   virtual const std::string& recording_file_source() const = 0;
+  virtual const uint32_t video_streaming_queue_size() const = 0;
+  virtual const std::string& video_streaming_queue_policy() const = 0;
+  virtual const uint32_t audio_streaming_queue_size() const = 0;
+  virtual const std::string& audio_streaming_queue_policy() const = 0;
+  virtual const std::vector<std::string>& video_additional_consumers()
+      const = 0;
+  virtual const std::vector<std::string>& audio_additional_consumers()
+      const = 0;
 };
 
 }  // namespace media_manager
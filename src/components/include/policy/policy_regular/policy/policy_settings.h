@@ -25,6 +25,18 @@ class PolicySettings {
 
   virtual uint16_t open_attempt_timeout_ms() const = 0;
 
+  /**
+   * @brief Should policy DB use write-ahead log journal
+   * @return Flag
+   */
+  virtual bool use_policy_db_write_ahead_log() const = 0;
+
+  /**
+   * @brief Maximum number of bytes of policy DB to be memory mapped,
+   * used only together with write-ahead log. 0 disables memory mapped I/O
+   */
+  virtual uint32_t policy_db_mmap_size() const = 0;
+
   /**
    * @brief Path to policies snapshot file
    * @return file path
@@ -36,6 +36,7 @@
 #include "protocol/message_priority.h"
 #include "protocol/service_type.h"
 #include "utils/macro.h"
+#include "utils/shared_buffer.h"
 
 namespace protocol_handler {
 /**
@@ -61,6 +62,20 @@ class RawMessage {
              bool protection,
              uint8_t type = ServiceType::kRpc,
              uint32_t payload_size = 0);
+  /**
+   * \brief Constructor adopting already filled buffer without copying it
+   * \param connection_key Identifier of connection within which message
+   * is transferred
+   * \param protocolVersion Version of protocol of the message
+   * \param buffer Message data, shared with its other owners
+   * \param payload_size Received data size
+   */
+  RawMessage(uint32_t connection_key,
+             uint32_t protocol_version,
+             const utils::SharedBuffer& buffer,
+             bool protection,
+             uint8_t type = ServiceType::kRpc,
+             uint32_t payload_size = 0);
   /**
    * \brief Destructor
    */
@@ -78,6 +93,11 @@ class RawMessage {
    * \brief Getter for message string data
    */
   uint8_t* data() const;
+  /**
+   * \brief Getter for buffer holding message data, lets consumers keep
+   * the data or its parts without copying
+   */
+  const utils::SharedBuffer& buffer() const;
   /**
    * \brief Getter for message size
    */
@@ -109,8 +129,7 @@ class RawMessage {
 
  private:
   uint32_t connection_key_;
-  uint8_t* data_;
-  size_t data_size_;
+  utils::SharedBuffer buffer_;
   uint32_t protocol_version_;
   bool protection_;
   ServiceType service_type_;
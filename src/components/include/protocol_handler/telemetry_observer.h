@@ -35,11 +35,12 @@
 #include "protocol/common.h"
 
 #include <stdint.h>
+#include "telemetry_monitor/telemetry_stage.h"
 #include "utils/date_time.h"
 
 namespace protocol_handler {
 
-class PHTelemetryObserver {
+class PHTelemetryObserver : public telemetry_monitor::StageTelemetryObserver {
  public:
   struct MessageMetric {
     RawMessagePtr raw_msg;
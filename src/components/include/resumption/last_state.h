@@ -68,6 +68,30 @@ class LastState {
    * @param dictionary New dictionary json value to be set
    */
   virtual void set_dictionary(const Json::Value& dictionary) = 0;
+
+  /**
+   * @brief dictionary_ref Gets internal dictionary without copying it
+   * @return Reference to internal dictionary, valid only while
+   * LastStateAccessor it was obtained through is alive
+   */
+  virtual const Json::Value& dictionary_ref() const = 0;
+
+  /**
+   * @brief set_value Sets single value of internal dictionary. Only this
+   * change is written to filesystem on the next save
+   * @param path Array of member names and array indexes leading to the value,
+   * missing containers on the path are created
+   * @param value New json value to be set
+   */
+  virtual void set_value(const Json::Value& path,
+                         const Json::Value& value) = 0;
+
+  /**
+   * @brief remove_value Removes single value from internal dictionary.
+   * Following elements of array are shifted in case of array index
+   * @param path Array of member names and array indexes leading to the value
+   */
+  virtual void remove_value(const Json::Value& path) = 0;
 };
 
 }  // namespace resumption
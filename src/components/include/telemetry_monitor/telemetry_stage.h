@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_COMPONENTS_INCLUDE_TELEMETRY_MONITOR_TELEMETRY_STAGE_H_
+#define SRC_COMPONENTS_INCLUDE_TELEMETRY_MONITOR_TELEMETRY_STAGE_H_
+
+#include "utils/date_time.h"
+
+namespace telemetry_monitor {
+
+/**
+ * @brief Stages of incoming message processing aggregated by
+ * TelemetryMonitor into latency histograms
+ */
+enum TelemetryStage {
+  /**
+   * @brief Raw message waiting in transport manager queue
+   */
+  kTransportReceive = 0,
+  /**
+   * @brief Splitting of raw data into protocol frames
+   */
+  kFrameParse,
+  /**
+   * @brief Adding of a frame to a multiframe message
+   */
+  kMultiFrameAssembly,
+  /**
+   * @brief Conversion of RPC JSON into smart object
+   */
+  kRpcParse,
+  /**
+   * @brief Validation of RPC smart object against schema
+   */
+  kValidation,
+  /**
+   * @brief Creation and run of mobile command
+   */
+  kCommandRun,
+  /**
+   * @brief Conversion of smart object into HMI message
+   */
+  kHmiSend,
+  kStagesCount
+};
+
+/**
+ * @brief Common part of component telemetry observers reporting
+ * stage latencies
+ */
+class StageTelemetryObserver {
+ public:
+  /**
+   * @brief Reports that stage is finished right now
+   * @param stage Finished stage
+   * @param begin Time stage was started
+   */
+  virtual void OnStageFinished(const TelemetryStage stage,
+                               const date_time::TimeDuration& begin) = 0;
+  virtual ~StageTelemetryObserver() {}
+};
+}  // namespace telemetry_monitor
+#endif  // SRC_COMPONENTS_INCLUDE_TELEMETRY_MONITOR_TELEMETRY_STAGE_H_
@@ -55,6 +55,10 @@ class MockRPCService : public application_manager::rpc_service::RPCService {
                     const std::map<std::string, SMember>& members));
 
   MOCK_METHOD0(Stop, void());
+#ifdef TELEMETRY_MONITOR
+  MOCK_METHOD1(SetTelemetryObserver,
+               void(application_manager::AMTelemetryObserver* observer));
+#endif  // TELEMETRY_MONITOR
 };
 }  // namespace application_manager_test
 }  // namespace components
@@ -34,6 +34,7 @@
 
 #include <gmock/gmock.h>
 #include <string>
+#include <vector>
 #include "media_manager/media_manager_settings.h"
 
 namespace test {
@@ -54,6 +55,14 @@ class MockMediaManagerSettings : public ::media_manager::MediaManagerSettings {
   MOCK_CONST_METHOD0(app_storage_folder, const std::string&());
   MOCK_CONST_METHOD0(app_resource_folder, const std::string&());
   MOCK_CONST_METHOD0(recording_file_source, const std::string&());
+  MOCK_CONST_METHOD0(video_streaming_queue_size, const uint32_t());
+  MOCK_CONST_METHOD0(video_streaming_queue_policy, const std::string&());
+  MOCK_CONST_METHOD0(audio_streaming_queue_size, const uint32_t());
+  MOCK_CONST_METHOD0(audio_streaming_queue_policy, const std::string&());
+  MOCK_CONST_METHOD0(video_additional_consumers,
+                     const std::vector<std::string>&());
+  MOCK_CONST_METHOD0(audio_additional_consumers,
+                     const std::vector<std::string>&());
 };
 
 }  // namespace media_manager_test
@@ -47,6 +47,8 @@ class MockPolicySettings : public ::policy::PolicySettings {
   MOCK_CONST_METHOD0(app_storage_folder, const std::string&());
   MOCK_CONST_METHOD0(attempts_to_open_policy_db, uint16_t());
   MOCK_CONST_METHOD0(open_attempt_timeout_ms, uint16_t());
+  MOCK_CONST_METHOD0(use_policy_db_write_ahead_log, bool());
+  MOCK_CONST_METHOD0(policy_db_mmap_size, uint32_t());
   MOCK_CONST_METHOD0(policies_snapshot_file_name, const std::string&());
   MOCK_CONST_METHOD0(system_files_path, const std::string&());
   MOCK_CONST_METHOD0(use_full_app_id, bool());
@@ -47,6 +47,9 @@ class MockLastState : public resumption::LastState {
   MOCK_METHOD0(RemoveFromFileSystem, void());
   MOCK_CONST_METHOD0(dictionary, Json::Value());
   MOCK_METHOD1(set_dictionary, void(const Json::Value&));
+  MOCK_CONST_METHOD0(dictionary_ref, const Json::Value&());
+  MOCK_METHOD2(set_value, void(const Json::Value&, const Json::Value&));
+  MOCK_METHOD1(remove_value, void(const Json::Value&));
 };
 
 }  // namespace resumption_test
@@ -63,6 +63,7 @@ class MockTransportManagerSettings
   MOCK_CONST_METHOD0(app_transport_change_timer_addition, uint32_t());
   MOCK_CONST_METHOD0(transport_manager_tcp_adapter_network_interface,
                      std::string&());
+  MOCK_CONST_METHOD0(transport_manager_tcp_reactor_threads, uint16_t());
   MOCK_CONST_METHOD0(websocket_server_address, const std::string&());
   MOCK_CONST_METHOD0(websocket_server_port, uint16_t());
   MOCK_CONST_METHOD0(cloud_app_retry_timeout, uint32_t());
@@ -36,6 +36,9 @@
 #include "protocol/common.h"
 #include "transport_manager/common.h"
 #include "transport_manager/transport_adapter/transport_adapter.h"
+#ifdef TELEMETRY_MONITOR
+#include "utils/date_time.h"
+#endif  // TELEMETRY_MONITOR
 
 namespace transport_manager {
 
@@ -87,7 +90,12 @@ class TransportAdapterEvent {
       , device_uid(device_handle)
       , transport_adapter(adapter)
       , event_data(data)
-      , event_error(error) {}
+      , event_error(error)
+#ifdef TELEMETRY_MONITOR
+      , raise_time(date_time::getCurrentTime())
+#endif  // TELEMETRY_MONITOR
+  {
+  }
 
   /**
    * @brief Value that describe event type.
@@ -113,6 +121,12 @@ class TransportAdapterEvent {
    * @brief Pointer to the class that contain details of error.
    */
   BaseErrorPtr event_error;
+#ifdef TELEMETRY_MONITOR
+  /**
+   * @brief Time the event was raised by transport adapter
+   */
+  date_time::TimeDuration raise_time;
+#endif  // TELEMETRY_MONITOR
 };
 }  // namespace transport_manager
 #endif  // SRC_COMPONENTS_INCLUDE_TRANSPORT_MANAGER_TRANSPORT_ADAPTER_TRANSPORT_ADAPTER_EVENT_H_
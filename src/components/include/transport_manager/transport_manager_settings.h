@@ -69,6 +69,8 @@ class TransportManagerSettings : public TransportManagerMMESettings {
    */
   virtual const std::string& transport_manager_tcp_adapter_network_interface()
       const = 0;
+
+  virtual uint16_t transport_manager_tcp_reactor_threads() const = 0;
 #ifdef WEBSOCKET_SERVER_TRANSPORT_SUPPORT
   /**
    *@brief Returns websocket server address
@@ -38,14 +38,31 @@
 
 namespace logger {
 
+/**
+ * @brief Logs entering and leaving the scope with TRACE level.
+ * Does nothing if TRACE level was disabled for the component on entering
+ */
 class AutoTrace {
  public:
-  AutoTrace(const std::string& component, const LocationInfo& location);
-  ~AutoTrace();
+  AutoTrace(const std::string& component, const bool enabled, LogSite& site)
+      : component_(component), enabled_(enabled), site_(site) {
+    if (enabled_) {
+      PushLog("Enter");
+    }
+  }
+
+  ~AutoTrace() {
+    if (enabled_) {
+      PushLog("Exit");
+    }
+  }
 
  private:
-  std::string component_;
-  LocationInfo location_;
+  void PushLog(const char* log_event) const;
+
+  const std::string& component_;
+  const bool enabled_;
+  LogSite& site_;
 };
 
 }  // namespace logger
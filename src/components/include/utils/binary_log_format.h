@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_COMPONENTS_INCLUDE_UTILS_BINARY_LOG_FORMAT_H_
+#define SRC_COMPONENTS_INCLUDE_UTILS_BINARY_LOG_FORMAT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Layout of binary log files. All values are stored in host byte order,
+ * file is expected to be decoded on the same architecture or one with the
+ * same endianness.
+ *
+ * File starts with FileHeader followed by records. Every record starts with
+ * RecordHeader, record of zero size marks the end of written data.
+ * Message record refers to a call site described by site record, message
+ * arguments follow it as (ArgumentType, value) pairs, so decoding a message
+ * is concatenating text representations of arguments in the same way
+ * std::ostream does.
+ */
+namespace logger {
+namespace binary_log {
+
+const char kFileMagic[8] = {'S', 'D', 'L', 'B', 'L', 'O', 'G', '\0'};
+const uint32_t kFormatVersion = 1u;
+
+/**
+ * @brief Max size of arguments of a single message. Arguments not fitting
+ * into it are cut and the message is marked with kTruncatedMessage
+ */
+const size_t kMaxArgumentsSize = 1024u;
+
+struct FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t header_size;
+};
+
+enum RecordKind { kSiteRecord = 1, kMessageRecord = 2, kDroppedRecord = 3 };
+
+struct RecordHeader {
+  /**
+   * @brief Size of record including this header
+   */
+  uint32_t size;
+  uint32_t kind;
+};
+
+/**
+ * @brief Followed by component, file name and function name strings
+ */
+struct SiteRecord {
+  uint32_t site_id;
+  uint32_t log_level;
+  uint32_t line_number;
+  uint16_t component_size;
+  uint16_t file_name_size;
+  uint32_t function_name_size;
+};
+
+/**
+ * @brief Flags of message record
+ */
+enum MessageFlags { kTruncatedMessage = 1 };
+
+/**
+ * @brief Followed by message arguments
+ */
+struct MessageRecord {
+  uint32_t site_id;
+  /**
+   * @brief Combination of MessageFlags
+   */
+  uint32_t flags;
+  uint64_t thread_id;
+  /**
+   * @brief Nanoseconds since epoch
+   */
+  int64_t timestamp;
+};
+
+/**
+ * @brief Amount of messages of a thread dropped because its buffer
+ * was full. Messages dropped because file reached its max size are
+ * reported by the last record of the file with zero thread id
+ */
+struct DroppedRecord {
+  uint64_t thread_id;
+  uint64_t count;
+};
+
+/**
+ * @brief Type tag of message argument. Integers are followed by 8 bytes,
+ * char by 1 byte, string by uint16_t size and characters
+ */
+enum ArgumentType {
+  kSignedArgument = 1,
+  kUnsignedArgument = 2,
+  kCharArgument = 3,
+  kDoubleArgument = 4,
+  kStringArgument = 5,
+  kPointerArgument = 6
+};
+
+}  // namespace binary_log
+}  // namespace logger
+
+#endif  // SRC_COMPONENTS_INCLUDE_UTILS_BINARY_LOG_FORMAT_H_
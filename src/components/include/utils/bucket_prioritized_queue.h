@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_COMPONENTS_INCLUDE_UTILS_BUCKET_PRIORITIZED_QUEUE_H_
+#define SRC_COMPONENTS_INCLUDE_UTILS_BUCKET_PRIORITIZED_QUEUE_H_
+
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+
+#include "utils/macro.h"
+
+namespace utils {
+
+/*
+ * Template queue class that gives out messages respecting their priority.
+ * Drop-in replacement of PrioritizedQueue for bounded priorities:
+ * each priority level has its own ring buffer and a bitmap of non-empty
+ * levels gives the highest one in O(1). Ring buffers only grow, so there is
+ * no allocation in steady state.
+ * Message class must have size_t PriorityOrder() method implemented
+ * returning value less than kPriorityLevels, bigger values are clamped
+ */
+template <typename M, size_t kPriorityLevels = 256>
+class BucketPrioritizedQueue {
+ public:
+  typedef M value_type;
+
+  BucketPrioritizedQueue() : buckets_(kPriorityLevels), total_size_(0) {
+    std::fill(non_empty_, non_empty_ + kBitmapWords, 0);
+  }
+
+  // All api mimics usual std queue interface
+  void push(const value_type& message) {
+    size_t priority = message.PriorityOrder();
+    DCHECK(priority < kPriorityLevels);
+    if (priority >= kPriorityLevels) {
+      priority = kPriorityLevels - 1;
+    }
+    buckets_[priority].push(message);
+    non_empty_[priority / kBitsInWord] |= Bit(priority);
+    ++total_size_;
+  }
+
+  size_t size() const {
+    return total_size_;
+  }
+
+  bool empty() const {
+    return 0 == total_size_;
+  }
+
+  void swap(BucketPrioritizedQueue<M, kPriorityLevels>& x) {
+    std::swap(buckets_, x.buckets_);
+    std::swap_ranges(non_empty_, non_empty_ + kBitmapWords, x.non_empty_);
+    std::swap(total_size_, x.total_size_);
+  }
+
+  const value_type& front() const {
+    DCHECK(!empty());
+    return buckets_[HighestPriority()].front();
+  }
+
+  void pop() {
+    DCHECK(!empty());
+    const size_t priority = HighestPriority();
+    Bucket& bucket = buckets_[priority];
+    bucket.pop();
+    --total_size_;
+    if (bucket.empty()) {
+      non_empty_[priority / kBitsInWord] &= ~Bit(priority);
+    }
+  }
+
+ private:
+  /*
+   * Growing ring buffer keeping its storage between uses
+   */
+  class Bucket {
+   public:
+    Bucket() : head_(0), count_(0) {}
+
+    bool empty() const {
+      return 0 == count_;
+    }
+
+    const value_type& front() const {
+      return storage_[head_];
+    }
+
+    void push(const value_type& message) {
+      if (count_ == storage_.size()) {
+        Grow();
+      }
+      storage_[(head_ + count_) % storage_.size()] = message;
+      ++count_;
+    }
+
+    void pop() {
+      // Release message resources right away, slot itself is kept
+      storage_[head_] = value_type();
+      head_ = (head_ + 1) % storage_.size();
+      --count_;
+    }
+
+   private:
+    void Grow() {
+      std::vector<value_type> storage(std::max<size_t>(4, storage_.size() * 2));
+      for (size_t i = 0; i < count_; ++i) {
+        storage[i] = storage_[(head_ + i) % storage_.size()];
+      }
+      storage_.swap(storage);
+      head_ = 0;
+    }
+
+    std::vector<value_type> storage_;
+    size_t head_;
+    size_t count_;
+  };
+
+  static const size_t kBitsInWord = 64;
+  static const size_t kBitmapWords =
+      (kPriorityLevels + kBitsInWord - 1) / kBitsInWord;
+
+  static uint64_t Bit(const size_t priority) {
+    return 1ULL << (priority % kBitsInWord);
+  }
+
+  size_t HighestPriority() const {
+    for (size_t word = kBitmapWords; word > 0; --word) {
+      const uint64_t bits = non_empty_[word - 1];
+      if (bits) {
+        return (word - 1) * kBitsInWord + (kBitsInWord - 1) -
+               __builtin_clzll(bits);
+      }
+    }
+    NOTREACHED();
+    return 0;
+  }
+
+  std::vector<Bucket> buckets_;
+  uint64_t non_empty_[kBitmapWords];
+  size_t total_size_;
+};
+
+}  // namespace utils
+
+#endif  // SRC_COMPONENTS_INCLUDE_UTILS_BUCKET_PRIORITIZED_QUEUE_H_
@@ -32,6 +32,8 @@
 
 #pragma once
 
+#include <stdint.h>
+#include <atomic>
 #include <chrono>
 #include <string>
 #include <thread>
@@ -55,6 +57,74 @@ struct LocationInfo {
 
 typedef std::chrono::high_resolution_clock::time_point TimePoint;
 
+/**
+ * @brief Location of a log statement. Must be a static object of the call
+ * site
+ */
+struct LogSite {
+  constexpr LogSite(const char* file_name,
+                    const char* function_name,
+                    const int line_number)
+      : file_name(file_name)
+      , function_name(function_name)
+      , line_number(line_number)
+      , binary_site_id(0) {}
+
+  const char* const file_name;
+  const char* const function_name;
+  const int line_number;
+  /**
+   * @brief Id of the site registered in binary log sink, upper half holds
+   * the sink instance id the site was registered in
+   */
+  std::atomic<uint64_t> binary_site_id;
+};
+
+/**
+ * @brief Receiver of log messages encoded in binary form, see
+ * utils/binary_log_format.h
+ */
+class BinaryLogSink {
+ public:
+  virtual ~BinaryLogSink() {}
+
+  /**
+   * @brief Gets id unique for each sink object, never 0
+   */
+  virtual uint32_t instance_id() const = 0;
+
+  /**
+   * @brief Gets id of log site, site is described in the log on first call
+   */
+  virtual uint32_t RegisterSite(const LogSite& site,
+                                const std::string& component,
+                                LogLevel log_level) = 0;
+
+  /**
+   * @brief Writes message, must not block
+   * @param site_id Id returned by RegisterSite
+   * @param arguments Encoded message arguments
+   * @param size Size of arguments
+   * @param truncated Arguments not fitting into message were cut
+   */
+  virtual void Write(const uint32_t site_id,
+                     const char* arguments,
+                     const size_t size,
+                     const bool truncated) = 0;
+
+  /**
+   * @brief Writes all messages buffered so far
+   */
+  virtual void Flush() = 0;
+
+  /**
+   * @brief Writes all buffered messages and stops writing. Messages passed
+   * after it are ignored, so sink may be still used by log statements
+   * which got it before
+   */
+  virtual void DeInit() = 0;
+};
+
 struct LogMessage {
   std::string component_;  // <- component_name
   LogLevel log_level_;
@@ -66,12 +136,78 @@ struct LogMessage {
 
 class Logger {
  public:
+  Logger() : levels_generation_(1), binary_log_sink_(nullptr) {}
+
   virtual bool IsEnabledFor(const std::string& component,
                             LogLevel log_level) const = 0;
   virtual void DeInit() = 0;
   virtual void Flush() = 0;
   virtual void PushLog(const LogMessage& log_message) = 0;
   static Logger& instance(Logger* pre_init = nullptr);
+
+  /**
+   * @brief Gets generation of logger levels configuration. Results of
+   * IsEnabledFor cached by call sites are valid while it stays the same
+   */
+  uint32_t levels_generation() const {
+    return levels_generation_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Drops results of IsEnabledFor cached by call sites, must be
+   * called each time levels of components may have been changed
+   */
+  void ResetCachedLevels() {
+    levels_generation_.fetch_add(1, std::memory_order_acq_rel);
+  }
+
+  /**
+   * @brief Gets sink messages are written to in binary form instead of
+   * PushLog, nullptr if binary logging is off
+   */
+  BinaryLogSink* binary_log_sink() const {
+    return binary_log_sink_.load(std::memory_order_acquire);
+  }
+
+ protected:
+  void set_binary_log_sink(BinaryLogSink* sink) {
+    binary_log_sink_.store(sink, std::memory_order_release);
+  }
+
+ private:
+  std::atomic<uint32_t> levels_generation_;
+  std::atomic<BinaryLogSink*> binary_log_sink_;
+};
+
+/**
+ * @brief Cached result of Logger::IsEnabledFor for a single log statement.
+ * Must be a static object of the call site, so component and level are
+ * the same for every check. Disabled statement costs one atomic load and
+ * a comparison until logger levels are changed
+ */
+class CallSiteLevel {
+ public:
+  constexpr CallSiteLevel() : state_(0) {}
+
+  bool IsEnabled(const Logger& logger,
+                 const std::string& component,
+                 const LogLevel log_level) {
+    // Generation and enabled flag are packed to be updated at once
+    const uint32_t generation = logger.levels_generation() << 1;
+    uint32_t state = state_.load(std::memory_order_relaxed);
+    if ((state & ~kEnabledFlag) != generation) {
+      state = generation;
+      if (logger.IsEnabledFor(component, log_level)) {
+        state |= kEnabledFlag;
+      }
+      state_.store(state, std::memory_order_relaxed);
+    }
+    return state & kEnabledFlag;
+  }
+
+ private:
+  static const uint32_t kEnabledFlag = 1u;
+  std::atomic<uint32_t> state_;
 };
 
 class ThirdPartyLoggerInterface {
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_COMPONENTS_INCLUDE_UTILS_LOG_STREAM_H_
+#define SRC_COMPONENTS_INCLUDE_UTILS_LOG_STREAM_H_
+
+#include <stdint.h>
+#include <string.h>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <type_traits>
+
+#include "utils/binary_log_format.h"
+#include "utils/ilogger.h"
+
+namespace logger {
+
+/**
+ * @brief Checks if value of type is stored in binary log without
+ * formatting. Holds for exact types only, so values of other types are
+ * formatted by operator<< visible at the log statement
+ */
+template <typename T>
+struct IsRawLogArgument
+    : std::integral_constant<
+          bool,
+          std::is_arithmetic<T>::value && !std::is_same<T, wchar_t>::value &&
+              !std::is_same<T, char16_t>::value &&
+              !std::is_same<T, char32_t>::value &&
+              !std::is_same<T, long double>::value> {};
+
+template <>
+struct IsRawLogArgument<std::string> : std::true_type {};
+
+template <>
+struct IsRawLogArgument<const char*> : std::true_type {};
+
+template <>
+struct IsRawLogArgument<char*> : std::true_type {};
+
+template <typename T>
+struct IsRawLogArgument<T*>
+    : std::integral_constant<bool,
+                             std::is_void<T>::value ||
+                                 std::is_class<T>::value> {};
+
+/**
+ * @brief Collects a single log message. Formats it as text for PushLog
+ * or, if binary log sink is set, stores raw arguments and leaves their
+ * formatting to the log decoder.
+ * Values of other types are formatted by std::ostream into the same
+ * message. After a stream manipulator was applied the rest of message is
+ * formatted by std::ostream too, so output is always the same as of
+ * std::ostream
+ */
+class LogStream : public std::ostream {
+ public:
+  LogStream(Logger& logger,
+            LogSite& site,
+            const std::string& component,
+            const LogLevel log_level)
+      : std::ostream(nullptr)
+      , logger_(logger)
+      , site_(site)
+      , component_(component)
+      , log_level_(log_level)
+      , binary_log_sink_(logger.binary_log_sink())
+      , stream_buffer_(*this)
+      , raw_(nullptr != binary_log_sink_)
+      , size_(0)
+      , text_argument_(kNoTextArgument)
+      , truncated_(false) {
+    rdbuf(&stream_buffer_);
+  }
+
+  // Operators are found by argument dependent lookup only and match
+  // LogStream exactly, so they win over std::ostream ones for raw arguments
+  // and do not hide operators of other types
+  template <typename T>
+  friend typename std::enable_if<IsRawLogArgument<T>::value, LogStream&>::type
+  operator<<(LogStream& stream, const T& value) {
+    if (stream.raw_) {
+      stream.Append(value);
+    } else {
+      static_cast<std::ostream&>(stream) << value;
+    }
+    return stream;
+  }
+
+  template <size_t N>
+  friend LogStream& operator<<(LogStream& stream, const char (&value)[N]) {
+    return stream << static_cast<const char*>(value);
+  }
+
+  friend LogStream& operator<<(LogStream& stream,
+                               std::ostream& (*manipulator)(std::ostream&)) {
+    stream.raw_ = false;
+    static_cast<std::ostream&>(stream) << manipulator;
+    return stream;
+  }
+
+  friend LogStream& operator<<(
+      LogStream& stream, std::ios_base& (*manipulator)(std::ios_base&)) {
+    stream.raw_ = false;
+    static_cast<std::ostream&>(stream) << manipulator;
+    return stream;
+  }
+
+  /**
+   * @brief Passes collected message to logger
+   */
+  void Push();
+
+ private:
+  class StreamBuffer : public std::streambuf {
+   public:
+    explicit StreamBuffer(LogStream& stream) : stream_(stream) {}
+
+   protected:
+    int_type overflow(int_type c) override {
+      if (!traits_type::eq_int_type(c, traits_type::eof())) {
+        const char ch = traits_type::to_char_type(c);
+        stream_.AppendText(&ch, 1);
+      }
+      return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+      stream_.AppendText(s, static_cast<size_t>(n));
+      return n;
+    }
+
+   private:
+    LogStream& stream_;
+  };
+
+  static const size_t kNoTextArgument = static_cast<size_t>(-1);
+
+  template <typename T>
+  typename std::enable_if<std::is_signed<T>::value &&
+                          std::is_integral<T>::value>::type
+  Append(const T value) {
+    AppendValue(binary_log::kSignedArgument, static_cast<int64_t>(value));
+  }
+
+  template <typename T>
+  typename std::enable_if<std::is_unsigned<T>::value &&
+                          std::is_integral<T>::value>::type
+  Append(const T value) {
+    AppendValue(binary_log::kUnsignedArgument, static_cast<uint64_t>(value));
+  }
+
+  template <typename T>
+  typename std::enable_if<std::is_floating_point<T>::value>::type Append(
+      const T value) {
+    AppendValue(binary_log::kDoubleArgument, static_cast<double>(value));
+  }
+
+  template <typename T>
+  typename std::enable_if<std::is_pointer<T>::value>::type Append(
+      const T value) {
+    AppendValue(binary_log::kPointerArgument,
+                static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+  }
+
+  void Append(const char value) {
+    AppendChar(value);
+  }
+
+  void Append(const signed char value) {
+    AppendChar(static_cast<char>(value));
+  }
+
+  void Append(const unsigned char value) {
+    AppendChar(static_cast<char>(value));
+  }
+
+  void Append(const bool value) {
+    AppendValue(binary_log::kUnsignedArgument, static_cast<uint64_t>(value));
+  }
+
+  void Append(const char* value) {
+    // std::ostream outputs nothing for null string
+    if (value) {
+      AppendString(value, strlen(value));
+    }
+  }
+
+  void Append(char* value) {
+    Append(static_cast<const char*>(value));
+  }
+
+  void Append(const std::string& value) {
+    AppendString(value.data(), value.size());
+  }
+
+  template <typename T>
+  void AppendValue(const binary_log::ArgumentType type, const T value) {
+    text_argument_ = kNoTextArgument;
+    if (size_ + 1 + sizeof(value) <= sizeof(buffer_)) {
+      buffer_[size_++] = static_cast<char>(type);
+      memcpy(buffer_ + size_, &value, sizeof(value));
+      size_ += sizeof(value);
+    } else {
+      truncated_ = true;
+    }
+  }
+
+  void AppendChar(const char value) {
+    text_argument_ = kNoTextArgument;
+    if (size_ + 2 <= sizeof(buffer_)) {
+      buffer_[size_++] = static_cast<char>(binary_log::kCharArgument);
+      buffer_[size_++] = value;
+    } else {
+      truncated_ = true;
+    }
+  }
+
+  void AppendString(const char* value, const size_t size) {
+    text_argument_ = kNoTextArgument;
+    AppendText(value, size);
+    text_argument_ = kNoTextArgument;
+  }
+
+  /**
+   * @brief Appends characters to message text or, for binary message, to
+   * the last string argument if nothing else was appended after it
+   */
+  void AppendText(const char* value, const size_t size);
+
+  Logger& logger_;
+  LogSite& site_;
+  const std::string& component_;
+  const LogLevel log_level_;
+  BinaryLogSink* const binary_log_sink_;
+  StreamBuffer stream_buffer_;
+  /**
+   * @brief Arguments are stored without formatting
+   */
+  bool raw_;
+  std::string text_;
+  size_t size_;
+  /**
+   * @brief Offset of the size of the string argument characters are
+   * appended to
+   */
+  size_t text_argument_;
+  /**
+   * @brief Some arguments did not fit into the buffer
+   */
+  bool truncated_;
+  char buffer_[binary_log::kMaxArgumentsSize];
+
+  LogStream(const LogStream&) = delete;
+  LogStream& operator=(const LogStream&) = delete;
+};
+
+}  // namespace logger
+
+#endif  // SRC_COMPONENTS_INCLUDE_UTILS_LOG_STREAM_H_
@@ -40,6 +40,7 @@
 #include <string>
 
 #include "utils/auto_trace.h"
+#include "utils/log_stream.h"
 #define SDL_CREATE_LOG_VARIABLE(component_name) \
   namespace {                                   \
   static std::string logger_(component_name);   \
@@ -57,28 +58,34 @@
 // destroyed by exit()
 #define SDL_DEINIT_LOGGER() logger::Logger::instance().DeInit();
 
-#define LOG_WITH_LEVEL(logLevel, logEvent)                               \
-  do {                                                                   \
-    if (logger::Logger::instance().IsEnabledFor(logger_, logLevel)) {    \
-      std::stringstream accumulator;                                     \
-      accumulator << logEvent;                                           \
-      logger::LogMessage message{                                        \
-          logger_,                                                       \
-          logLevel,                                                      \
-          accumulator.str(),                                             \
-          std::chrono::high_resolution_clock::now(),                     \
-          logger::LocationInfo{__FILE__, __PRETTY_FUNCTION__, __LINE__}, \
-          std::this_thread::get_id()};                                   \
-      logger::Logger::instance().PushLog(message);                       \
-    }                                                                    \
+// Level is checked via static cache of the call site, so disabled
+// statement does not reach logger implementation
+#define LOG_WITH_LEVEL(logLevel, logEvent)                              \
+  do {                                                                  \
+    static logger::CallSiteLevel call_site_level;                       \
+    if (call_site_level.IsEnabled(                                      \
+            logger::Logger::instance(), logger_, logLevel)) {           \
+      static logger::LogSite log_site(                                  \
+          __FILE__, __PRETTY_FUNCTION__, __LINE__);                     \
+      logger::LogStream accumulator(                                    \
+          logger::Logger::instance(), log_site, logger_, logLevel);     \
+      accumulator << logEvent;                                          \
+      accumulator.Push();                                               \
+    }                                                                   \
   } while (false)
 
 #define SDL_LOG_TRACE(logEvent) \
   LOG_WITH_LEVEL(logger::LogLevel::TRACE_LEVEL, logEvent)
 
-#define SDL_LOG_AUTO_TRACE()    \
-  logger::AutoTrace auto_trace( \
-      logger_, logger::LocationInfo{__FILE__, __PRETTY_FUNCTION__, __LINE__})
+#define SDL_LOG_AUTO_TRACE()                                                   \
+  static logger::CallSiteLevel auto_trace_level;                               \
+  static logger::LogSite auto_trace_site(                                      \
+      __FILE__, __PRETTY_FUNCTION__, __LINE__);                                \
+  logger::AutoTrace auto_trace(                                                \
+      logger_,                                                                 \
+      auto_trace_level.IsEnabled(                                              \
+          logger::Logger::instance(), logger_, logger::LogLevel::TRACE_LEVEL), \
+      auto_trace_site)
 
 #define SDL_LOG_DEBUG(logEvent) \
   LOG_WITH_LEVEL(logger::LogLevel::DEBUG_LEVEL, logEvent)
@@ -34,10 +34,12 @@
 #define SRC_COMPONENTS_INCLUDE_UTILS_MESSAGE_QUEUE_H_
 
 #include <algorithm>
+#include <atomic>
 #include <queue>
 
 #include "utils/conditional_variable.h"
 #include "utils/lock.h"
+#include "utils/mpsc_queue.h"
 #include "utils/prioritized_queue.h"
 
 /**
@@ -212,6 +214,106 @@ void MessageQueue<T, Q>::Reset() {
   }
 }
 
+/**
+ * \class MessageQueue<T, MpscQueue<T> >
+ * \brief Lock-free variant of MessageQueue.
+ * push(), pop(), empty() and size() take no lock, consumer is woken up only
+ * when it sleeps in wait() and queue goes from empty to non-empty.
+ * pop() must be called from a single consumer thread.
+ */
+template <typename T>
+class MessageQueue<T, MpscQueue<T> > {
+ public:
+  typedef MpscQueue<T> Queue;
+
+  MessageQueue()
+      : shutting_down_(false), consumer_waiting_(false), drain_waiters_(0) {}
+
+  ~MessageQueue() {}
+
+  size_t size() const {
+    return queue_.size();
+  }
+
+  bool empty() const {
+    return queue_.empty();
+  }
+
+  bool IsShuttingDown() const {
+    return shutting_down_;
+  }
+
+  void push(const T& element) {
+    if (shutting_down_) {
+      return;
+    }
+    const bool was_empty = queue_.push(element);
+    if (was_empty && consumer_waiting_) {
+      sync_primitives::AutoLock auto_lock(queue_lock_);
+      queue_new_items_.Broadcast();
+    }
+  }
+
+  bool pop(T& element) {
+    if (!queue_.pop(element)) {
+      return false;
+    }
+    if (queue_.empty() && drain_waiters_ > 0) {
+      sync_primitives::AutoLock auto_lock(queue_lock_);
+      queue_new_items_.Broadcast();
+    }
+    return true;
+  }
+
+  void wait() {
+    sync_primitives::AutoLock auto_lock(queue_lock_);
+    consumer_waiting_ = true;
+    while ((!shutting_down_) && queue_.empty()) {
+      queue_new_items_.Wait(auto_lock);
+    }
+    consumer_waiting_ = false;
+  }
+
+  void WaitUntilEmpty() {
+    sync_primitives::AutoLock auto_lock(queue_lock_);
+    ++drain_waiters_;
+    while ((!shutting_down_) && !queue_.empty()) {
+      queue_new_items_.Wait(auto_lock);
+    }
+    --drain_waiters_;
+  }
+
+  /**
+   * \brief Shutdown the queue.
+   * Elements already taken by consumer into its batch are still served
+   */
+  void Shutdown() {
+    sync_primitives::AutoLock auto_lock(queue_lock_);
+    shutting_down_ = true;
+    queue_.clear_pending();
+    queue_new_items_.Broadcast();
+  }
+
+  void Reset() {
+    sync_primitives::AutoLock auto_lock(queue_lock_);
+    shutting_down_ = false;
+    queue_.clear_pending();
+  }
+
+ private:
+  Queue queue_;
+  std::atomic<bool> shutting_down_;
+
+  /**
+   *\brief Lets producers skip locking while consumer is busy
+   */
+  std::atomic<bool> consumer_waiting_;
+  std::atomic<size_t> drain_waiters_;
+
+  mutable sync_primitives::Lock queue_lock_;
+  sync_primitives::ConditionalVariable queue_new_items_;
+};
+
 }  // namespace utils
 
 #endif  // SRC_COMPONENTS_INCLUDE_UTILS_MESSAGE_QUEUE_H_
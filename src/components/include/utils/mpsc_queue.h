@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_COMPONENTS_INCLUDE_UTILS_MPSC_QUEUE_H_
+#define SRC_COMPONENTS_INCLUDE_UTILS_MPSC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+
+#include "utils/macro.h"
+
+namespace utils {
+
+/*
+ * Lock-free multi-producer/single-consumer queue.
+ * Producers push onto an atomic list, consumer takes the whole pending list
+ * in one exchange and serves it in FIFO order from a private batch.
+ * push(), size() and empty() are safe from any thread,
+ * pop() and clear() must be called from the single consumer only.
+ * Used as Q template parameter of utils::MessageQueue and
+ * threads::MessageLoopThread.
+ */
+template <typename T>
+class MpscQueue {
+ public:
+  typedef T value_type;
+
+  MpscQueue() : pending_(NULL), batch_(NULL), size_(0) {}
+
+  ~MpscQueue() {
+    DeleteList(pending_.exchange(NULL));
+    DeleteList(batch_);
+  }
+
+  /*
+   * Adds element to the queue.
+   * Returns true if pending list was empty, i.e. consumer might need a wakeup
+   */
+  bool push(const value_type& value) {
+    Node* node = new Node(value);
+    ++size_;
+    Node* head = pending_.load(std::memory_order_relaxed);
+    do {
+      node->next = head;
+    } while (!pending_.compare_exchange_weak(head, node));
+    return NULL == head;
+  }
+
+  /*
+   * Removes oldest element. Consumer only.
+   * Returns false if queue is empty
+   */
+  bool pop(value_type& value) {
+    if (!batch_ && !TakePending()) {
+      return false;
+    }
+    Node* node = batch_;
+    batch_ = node->next;
+    value = node->value;
+    delete node;
+    --size_;
+    return true;
+  }
+
+  /*
+   * Removes all elements. Consumer only
+   */
+  void clear() {
+    size_t count = CountList(batch_);
+    DeleteList(batch_);
+    batch_ = NULL;
+    Node* pending = pending_.exchange(NULL);
+    count += CountList(pending);
+    DeleteList(pending);
+    size_ -= count;
+  }
+
+  /*
+   * Removes elements not yet taken by consumer.
+   * Safe from any thread
+   */
+  void clear_pending() {
+    Node* pending = pending_.exchange(NULL);
+    size_ -= CountList(pending);
+    DeleteList(pending);
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  bool empty() const {
+    return 0 == size_;
+  }
+
+ private:
+  struct Node {
+    explicit Node(const value_type& value) : value(value), next(NULL) {}
+    value_type value;
+    Node* next;
+  };
+
+  /*
+   * Moves whole pending list into consumer batch restoring FIFO order
+   */
+  bool TakePending() {
+    Node* node = pending_.exchange(NULL);
+    if (!node) {
+      return false;
+    }
+    Node* reversed = NULL;
+    while (node) {
+      Node* next = node->next;
+      node->next = reversed;
+      reversed = node;
+      node = next;
+    }
+    batch_ = reversed;
+    return true;
+  }
+
+  static size_t CountList(const Node* node) {
+    size_t count = 0;
+    for (; node; node = node->next) {
+      ++count;
+    }
+    return count;
+  }
+
+  static void DeleteList(Node* node) {
+    while (node) {
+      Node* next = node->next;
+      delete node;
+      node = next;
+    }
+  }
+
+  std::atomic<Node*> pending_;
+  Node* batch_;
+  std::atomic<size_t> size_;
+
+  DISALLOW_COPY_AND_ASSIGN(MpscQueue);
+};
+
+}  // namespace utils
+
+#endif  // SRC_COMPONENTS_INCLUDE_UTILS_MPSC_QUEUE_H_
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_COMPONENTS_INCLUDE_UTILS_SHARED_BUFFER_H_
+#define SRC_COMPONENTS_INCLUDE_UTILS_SHARED_BUFFER_H_
+
+#include <stdint.h>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace utils {
+
+/*
+ * Reference-counted byte block with slice views.
+ * Copying a buffer or taking a Slice() never copies bytes: every view keeps
+ * the underlying block alive and refers to its own [data, data + size) range.
+ * Writing through data() is allowed, views are expected not to overlap
+ * while someone is writing.
+ * Not thread-safe, but distinct views of one block may be used and destroyed
+ * from different threads.
+ */
+class SharedBuffer {
+ public:
+  /*
+   * Creates empty view
+   */
+  SharedBuffer() : data_(NULL), size_(0) {}
+
+  /*
+   * Allocates new block of given size.
+   * Stays empty if size is 0 or allocation failed
+   */
+  explicit SharedBuffer(const size_t size) : data_(NULL), size_(0) {
+    if (size) {
+      block_.reset(new (std::nothrow) uint8_t[size],
+                   std::default_delete<uint8_t[]>());
+      data_ = block_.get();
+      size_ = data_ ? size : 0;
+    }
+  }
+
+  /*
+   * Allocates new block holding copy of given bytes
+   */
+  static SharedBuffer Copy(const uint8_t* const data, const size_t size) {
+    SharedBuffer buffer;
+    if (data && size) {
+      buffer = SharedBuffer(size);
+      if (!buffer.empty()) {
+        memcpy(buffer.data(), data, size);
+      }
+    }
+    return buffer;
+  }
+
+  /*
+   * Returns view of [offset, offset + size) range of this view.
+   * Range is clamped to the view bounds
+   */
+  SharedBuffer Slice(const size_t offset, const size_t size) const {
+    SharedBuffer slice;
+    if (offset < size_) {
+      slice.block_ = block_;
+      slice.data_ = data_ + offset;
+      slice.size_ = size < size_ - offset ? size : size_ - offset;
+    }
+    return slice;
+  }
+
+  uint8_t* data() const {
+    return data_;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  bool empty() const {
+    return 0 == size_;
+  }
+
+  /*
+   * Returns amount of views sharing the underlying block
+   */
+  long use_count() const {
+    return block_.use_count();
+  }
+
+ private:
+  std::shared_ptr<uint8_t> block_;
+  uint8_t* data_;
+  size_t size_;
+};
+
+}  // namespace utils
+
+#endif  // SRC_COMPONENTS_INCLUDE_UTILS_SHARED_BUFFER_H_
@@ -195,11 +195,10 @@ void MessageLoopThread<Q>::LoopThreadDelegate::exitThreadMain() {
 
 template <class Q>
 void MessageLoopThread<Q>::LoopThreadDelegate::DrainQue() {
-  while (!message_queue_.empty()) {
-    Message msg;
-    if (message_queue_.pop(msg)) {
-      handler_.Handle(msg);
-    }
+  // pop() reports emptiness itself, no separate empty() round trip needed
+  Message msg;
+  while (message_queue_.pop(msg)) {
+    handler_.Handle(msg);
   }
 }
 
@@ -57,6 +57,8 @@ class FromMicRecorderListener : public MediaAdapterListener {
                                const DataForListener& data);
   virtual void OnActivityStarted(int32_t application_key);
   virtual void OnActivityEnded(int32_t application_key);
+  virtual void OnQueueStatistics(int32_t application_key,
+                                 const StreamingQueueStatistics& statistics);
 
  private:
   threads::Thread* reader_;
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_COMPONENTS_MEDIA_MANAGER_INCLUDE_MEDIA_MANAGER_FAN_OUT_STREAMER_ADAPTER_H_
+#define SRC_COMPONENTS_MEDIA_MANAGER_INCLUDE_MEDIA_MANAGER_FAN_OUT_STREAMER_ADAPTER_H_
+
+#include <vector>
+#include "media_manager/media_adapter_impl.h"
+#include "media_manager/streamer_adapter.h"
+
+namespace media_manager {
+
+/**
+ * Class FanOutStreamerAdapter passes one stream to several streamer
+ * adapters (sinks). All sinks get the same RawMessage, so data is shared
+ * instead of being copied, while every sink takes messages from its own
+ * queue in its own thread with its own drop policy, so slow sink doesn't
+ * delay the others. Listeners are notified by the first (primary) sink only,
+ * whose progress is reported to mobile as processed frames
+ */
+class FanOutStreamerAdapter : public MediaAdapterImpl {
+ public:
+  explicit FanOutStreamerAdapter(const std::vector<StreamerAdapterPtr>& sinks);
+  virtual ~FanOutStreamerAdapter();
+
+  virtual void AddListener(const MediaListenerPtr& listener);
+  virtual void RemoveListener(const MediaListenerPtr& listener);
+
+  virtual void StartActivity(int32_t application_key);
+  virtual void StopActivity(int32_t application_key);
+  virtual void SendData(int32_t application_key,
+                        const ::protocol_handler::RawMessagePtr msg);
+  virtual bool is_app_performing_activity(int32_t application_key) const;
+
+ private:
+  std::vector<StreamerAdapterPtr> sinks_;
+
+  DISALLOW_COPY_AND_ASSIGN(FanOutStreamerAdapter);
+};
+
+}  // namespace media_manager
+
+#endif  // SRC_COMPONENTS_MEDIA_MANAGER_INCLUDE_MEDIA_MANAGER_FAN_OUT_STREAMER_ADAPTER_H_
@@ -39,6 +39,30 @@ namespace media_manager {
 
 typedef int32_t DataForListener;
 
+/**
+ * @brief State of streaming queue reported to listeners after each message
+ * passed to the consumer
+ */
+struct StreamingQueueStatistics {
+  StreamingQueueStatistics()
+      : dropped_messages(0), queue_age_ms(0), queue_size(0) {}
+
+  /**
+   * @brief Messages dropped by the queue policy since the activity start
+   */
+  uint32_t dropped_messages;
+
+  /**
+   * @brief Time the last passed message spent in the queue
+   */
+  uint32_t queue_age_ms;
+
+  /**
+   * @brief Messages left in the queue
+   */
+  uint32_t queue_size;
+};
+
 class MediaAdapterListener {
  public:
   virtual ~MediaAdapterListener() {}
@@ -48,6 +72,8 @@ class MediaAdapterListener {
                                const DataForListener& data) = 0;
   virtual void OnActivityStarted(int32_t application_key) = 0;
   virtual void OnActivityEnded(int32_t application_key) = 0;
+  virtual void OnQueueStatistics(
+      int32_t application_key, const StreamingQueueStatistics& statistics) = 0;
 };
 }  //  namespace media_manager
 #endif  // SRC_COMPONENTS_MEDIA_MANAGER_INCLUDE_MEDIA_MANAGER_MEDIA_ADAPTER_LISTENER_H_
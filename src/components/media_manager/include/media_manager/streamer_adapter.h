@@ -35,8 +35,8 @@
 
 #include <atomic>
 #include "media_manager/media_adapter_impl.h"
+#include "media_manager/streaming_queue.h"
 #include "protocol/raw_message.h"
-#include "utils/message_queue.h"
 #include "utils/threads/thread.h"
 #include "utils/threads/thread_delegate.h"
 
@@ -62,6 +62,13 @@ class StreamerAdapter : public MediaAdapterImpl {
   virtual bool is_app_performing_activity(int32_t application_key) const;
   virtual size_t GetMsgQueueSize();
 
+  /**
+   * @brief Limits queue of messages waiting for the consumer
+   * @param max_size Amount of messages, 0 means no limit
+   * @param policy Policy applied when the limit is reached
+   */
+  void SetQueueLimits(size_t max_size, StreamingQueuePolicy policy);
+
  protected:
   // TODO(AN): APPLINK-15203 Use MessageLoopThread
   class Streamer : public threads::ThreadDelegate {
@@ -82,13 +89,14 @@ class StreamerAdapter : public MediaAdapterImpl {
    private:
     std::atomic_bool stop_flag_;
     StreamerAdapter* adapter_;
+    int32_t messages_for_session_;
 
     DISALLOW_COPY_AND_ASSIGN(Streamer);
   };
 
  private:
   std::atomic_int current_application_;
-  utils::MessageQueue<protocol_handler::RawMessagePtr> messages_;
+  StreamingQueue messages_;
 
   Streamer* streamer_;
   threads::Thread* thread_;
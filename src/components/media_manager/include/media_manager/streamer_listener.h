@@ -51,9 +51,12 @@ class StreamerListener : public MediaAdapterListener {
                                const DataForListener& data);
   virtual void OnActivityStarted(int32_t application_key);
   virtual void OnActivityEnded(int32_t application_key);
+  virtual void OnQueueStatistics(int32_t application_key,
+                                 const StreamingQueueStatistics& statistics);
 
  private:
   int32_t current_application_;
+  uint32_t dropped_messages_;
   media_manager::MediaManager& media_manager_;
   DISALLOW_COPY_AND_ASSIGN(StreamerListener);
 };
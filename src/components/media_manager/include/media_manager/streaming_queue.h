@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_COMPONENTS_MEDIA_MANAGER_INCLUDE_MEDIA_MANAGER_STREAMING_QUEUE_H_
+#define SRC_COMPONENTS_MEDIA_MANAGER_INCLUDE_MEDIA_MANAGER_STREAMING_QUEUE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <deque>
+#include <string>
+
+#include "media_manager/media_adapter_listener.h"
+#include "protocol/raw_message.h"
+#include "utils/conditional_variable.h"
+#include "utils/date_time.h"
+#include "utils/lock.h"
+#include "utils/macro.h"
+
+namespace media_manager {
+
+/**
+ * @brief Policy applied when streaming queue reaches its size limit
+ */
+enum StreamingQueuePolicy {
+  // The oldest queued message is dropped
+  kDropOldest,
+  // Queued messages are dropped up to the newest H.264 key frame, when there
+  // is no such frame, incoming messages are dropped until it comes
+  kDropUntilKeyFrame,
+  // Producer waits until consumer takes a message
+  kBlockProducer
+};
+
+/**
+ * @brief Converts value of streaming queue policy setting
+ * @param str DropOldest, DropUntilKeyFrame or BlockProducer
+ * @param policy Converted value, is left untouched for unknown string
+ * @return false if string is unknown
+ */
+bool StringToStreamingQueuePolicy(const std::string& str,
+                                  StreamingQueuePolicy* policy);
+
+/**
+ * @brief Queue of streaming messages with limited size, which keeps time
+ * of queueing for every message and counts messages dropped by the policy.
+ * Interface repeats the one of utils::MessageQueue
+ */
+class StreamingQueue {
+ public:
+  StreamingQueue();
+  ~StreamingQueue();
+
+  /**
+   * @brief Sets limit of the queue
+   * @param max_size Amount of queued messages, 0 means no limit
+   * @param policy Policy applied when the limit is reached
+   */
+  void SetLimits(size_t max_size, StreamingQueuePolicy policy);
+
+  /**
+   * @brief Adds message to the queue, applies the policy if queue is full
+   * @return false if message was dropped
+   */
+  bool push(const protocol_handler::RawMessagePtr& message);
+
+  /**
+   * @brief Takes the oldest message from the queue
+   * @param message Taken message
+   * @param age_ms Time the message spent in the queue
+   * @return false if queue is empty
+   */
+  bool pop(protocol_handler::RawMessagePtr& message, uint32_t& age_ms);
+
+  size_t size() const;
+
+  bool empty() const;
+
+  /**
+   * @brief Fills statistics of the queue
+   * @param age_ms Age of the message taken last
+   */
+  StreamingQueueStatistics GetStatistics(uint32_t age_ms) const;
+
+  /**
+   * @brief Waits until queue has messages or is shut down
+   */
+  void wait();
+
+  /**
+   * @brief Drops all messages and wakes up waiting consumer and producers,
+   * messages pushed after that are dropped
+   */
+  void Shutdown();
+
+  bool IsShuttingDown() const;
+
+  /**
+   * @brief Clears the queue, its counters and shut down state
+   */
+  void Reset();
+
+  /**
+   * @brief Checks whether decoding can be started from the message, which
+   * is true for H.264 IDR slice or sequence parameter set. Data not in
+   * Annex B byte stream format can't be checked and is considered as key frame.
+   * Only the leading NAL unit headers are checked, scan stops at first slice
+   */
+  static bool IsKeyFrame(const protocol_handler::RawMessage& message);
+
+ private:
+  struct QueuedMessage {
+    protocol_handler::RawMessagePtr message;
+    date_time::TimeDuration queued_at;
+    bool key_frame;
+  };
+
+  /**
+   * @brief Frees the space for a new message according to the policy and
+   * counts dropped messages including the new one if it is dropped
+   * @param auto_lock Acquired lock of the queue
+   * @param key_frame Whether the new message is a key frame
+   * @return false if the new message has to be dropped
+   */
+  bool MakeSpace(sync_primitives::AutoLock& auto_lock, bool key_frame);
+
+  mutable sync_primitives::Lock queue_lock_;
+  sync_primitives::ConditionalVariable queue_new_items_;
+  sync_primitives::ConditionalVariable queue_space_available_;
+  std::deque<QueuedMessage> queue_;
+  size_t max_size_;
+  StreamingQueuePolicy policy_;
+  bool waiting_for_key_frame_;
+  uint32_t dropped_messages_;
+  bool shutting_down_;
+
+  DISALLOW_COPY_AND_ASSIGN(StreamingQueue);
+};
+
+}  // namespace media_manager
+
+#endif  // SRC_COMPONENTS_MEDIA_MANAGER_INCLUDE_MEDIA_MANAGER_STREAMING_QUEUE_H_
@@ -95,4 +95,7 @@ void FromMicRecorderListener::OnActivityEnded(int32_t application_key) {
   current_application_ = 0;
 }
 
+void FromMicRecorderListener::OnQueueStatistics(
+    int32_t application_key, const StreamingQueueStatistics& statistics) {}
+
 }  //  namespace media_manager
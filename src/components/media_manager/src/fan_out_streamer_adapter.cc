@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "media_manager/fan_out_streamer_adapter.h"
+#include "utils/logger.h"
+
+namespace media_manager {
+
+SDL_CREATE_LOG_VARIABLE("StreamerAdapter")
+
+namespace {
+/**
+ * @brief Reports drops of secondary sink, which has no other listeners
+ */
+class SecondarySinkListener : public MediaAdapterListener {
+ public:
+  explicit SecondarySinkListener(size_t sink_index)
+      : sink_index_(sink_index), dropped_messages_(0) {}
+
+  void OnDataReceived(int32_t application_key,
+                      const DataForListener& data) OVERRIDE {}
+  void OnErrorReceived(int32_t application_key,
+                       const DataForListener& data) OVERRIDE {}
+  void OnActivityStarted(int32_t application_key) OVERRIDE {
+    dropped_messages_ = 0;
+  }
+  void OnActivityEnded(int32_t application_key) OVERRIDE {}
+  void OnQueueStatistics(int32_t application_key,
+                         const StreamingQueueStatistics& statistics) OVERRIDE {
+    if (statistics.dropped_messages != dropped_messages_) {
+      SDL_LOG_WARN("Streaming queue of sink " << sink_index_ << " of "
+                                              << application_key << " dropped "
+                                              << statistics.dropped_messages
+                                              << " messages");
+      dropped_messages_ = statistics.dropped_messages;
+    }
+  }
+
+ private:
+  const size_t sink_index_;
+  uint32_t dropped_messages_;
+};
+}  // namespace
+
+FanOutStreamerAdapter::FanOutStreamerAdapter(
+    const std::vector<StreamerAdapterPtr>& sinks)
+    : sinks_(sinks) {
+  DCHECK(!sinks_.empty());
+  for (size_t i = 1; i < sinks_.size(); ++i) {
+    sinks_[i]->AddListener(std::make_shared<SecondarySinkListener>(i));
+  }
+}
+
+FanOutStreamerAdapter::~FanOutStreamerAdapter() {}
+
+void FanOutStreamerAdapter::AddListener(const MediaListenerPtr& listener) {
+  MediaAdapterImpl::AddListener(listener);
+  if (!sinks_.empty()) {
+    sinks_.front()->AddListener(listener);
+  }
+}
+
+void FanOutStreamerAdapter::RemoveListener(const MediaListenerPtr& listener) {
+  MediaAdapterImpl::RemoveListener(listener);
+  if (!sinks_.empty()) {
+    sinks_.front()->RemoveListener(listener);
+  }
+}
+
+void FanOutStreamerAdapter::StartActivity(int32_t application_key) {
+  SDL_LOG_AUTO_TRACE();
+  for (size_t i = 0; i < sinks_.size(); ++i) {
+    sinks_[i]->StartActivity(application_key);
+  }
+}
+
+void FanOutStreamerAdapter::StopActivity(int32_t application_key) {
+  SDL_LOG_AUTO_TRACE();
+  for (size_t i = 0; i < sinks_.size(); ++i) {
+    sinks_[i]->StopActivity(application_key);
+  }
+}
+
+void FanOutStreamerAdapter::SendData(
+    int32_t application_key, const ::protocol_handler::RawMessagePtr msg) {
+  for (size_t i = 0; i < sinks_.size(); ++i) {
+    sinks_[i]->SendData(application_key, msg);
+  }
+}
+
+bool FanOutStreamerAdapter::is_app_performing_activity(
+    int32_t application_key) const {
+  return !sinks_.empty() &&
+         sinks_.front()->is_app_performing_activity(application_key);
+}
+
+}  // namespace media_manager
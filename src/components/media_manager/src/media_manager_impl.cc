@@ -31,6 +31,8 @@
  */
 
 #include "media_manager/media_manager_impl.h"
+#include <algorithm>
+#include <vector>
 #include "application_manager/application.h"
 #include "application_manager/application_impl.h"
 #include "application_manager/application_manager.h"
@@ -50,6 +52,7 @@
 #include "media_manager/audio/file_audio_streamer_adapter.h"
 #include "media_manager/audio/pipe_audio_streamer_adapter.h"
 #include "media_manager/audio/socket_audio_streamer_adapter.h"
+#include "media_manager/fan_out_streamer_adapter.h"
 #include "media_manager/media_manager_settings.h"
 #include "media_manager/video/file_video_streamer_adapter.h"
 #include "media_manager/video/pipe_video_streamer_adapter.h"
@@ -59,6 +62,99 @@ namespace media_manager {
 
 SDL_CREATE_LOG_VARIABLE("MediaManager")
 
+namespace {
+typedef StreamerAdapterPtr (*StreamerFactory)(
+    const std::string& consumer_type, const MediaManagerSettings& settings);
+
+StreamerAdapterPtr CreateVideoStreamer(const std::string& consumer_type,
+                                       const MediaManagerSettings& settings) {
+  if ("socket" == consumer_type) {
+    return std::make_shared<SocketVideoStreamerAdapter>(
+        settings.server_address(), settings.video_streaming_port());
+  } else if ("pipe" == consumer_type) {
+    return std::make_shared<PipeVideoStreamerAdapter>(
+        settings.named_video_pipe_path(), settings.app_storage_folder());
+  } else if ("file" == consumer_type) {
+    return std::make_shared<FileVideoStreamerAdapter>(
+        settings.video_stream_file(), settings.app_storage_folder());
+  }
+  return StreamerAdapterPtr();
+}
+
+StreamerAdapterPtr CreateAudioStreamer(const std::string& consumer_type,
+                                       const MediaManagerSettings& settings) {
+  if ("socket" == consumer_type) {
+    return std::make_shared<SocketAudioStreamerAdapter>(
+        settings.server_address(), settings.audio_streaming_port());
+  } else if ("pipe" == consumer_type) {
+    return std::make_shared<PipeAudioStreamerAdapter>(
+        settings.named_audio_pipe_path(), settings.app_storage_folder());
+  } else if ("file" == consumer_type) {
+    return std::make_shared<FileAudioStreamerAdapter>(
+        settings.audio_stream_file(), settings.app_storage_folder());
+  }
+  return StreamerAdapterPtr();
+}
+
+/**
+ * @brief Creates streamer of the main consumer, or fan-out of the main and
+ * additional ones, all having the same queue limits
+ */
+MediaAdapterImplPtr CreateStreamer(
+    StreamerFactory factory,
+    const MediaManagerSettings& settings,
+    const std::string& consumer_type,
+    const std::vector<std::string>& additional_consumer_types,
+    const uint32_t queue_size,
+    const std::string& policy_name,
+    StreamingQueuePolicy default_policy) {
+  std::vector<std::string> consumer_types(1, consumer_type);
+  for (size_t i = 0; i < additional_consumer_types.size(); ++i) {
+    const std::string& type = additional_consumer_types[i];
+    if (consumer_types.end() !=
+        std::find(consumer_types.begin(), consumer_types.end(), type)) {
+      SDL_LOG_WARN("Stream consumer " << type << " is set more than once");
+      continue;
+    }
+    consumer_types.push_back(type);
+  }
+
+  StreamingQueuePolicy policy = default_policy;
+  if (!StringToStreamingQueuePolicy(policy_name, &policy)) {
+    SDL_LOG_WARN("Unknown streaming queue policy: " << policy_name);
+  }
+
+  std::vector<StreamerAdapterPtr> sinks;
+  for (size_t i = 0; i < consumer_types.size(); ++i) {
+    StreamerAdapterPtr sink = factory(consumer_types[i], settings);
+    if (sink) {
+      sinks.push_back(sink);
+    } else if (!consumer_types[i].empty()) {
+      SDL_LOG_WARN("Unknown stream consumer: " << consumer_types[i]);
+    }
+  }
+
+  if (sinks.size() > 1 && kBlockProducer == policy) {
+    // Slow consumer must not hold the stream for the others
+    SDL_LOG_WARN("BlockProducer policy is replaced with DropOldest "
+                 "for several stream consumers");
+    policy = kDropOldest;
+  }
+
+  for (size_t i = 0; i < sinks.size(); ++i) {
+    sinks[i]->SetQueueLimits(queue_size, policy);
+  }
+
+  if (sinks.empty()) {
+    return MediaAdapterImplPtr();
+  }
+  if (1 == sinks.size()) {
+    return sinks.front();
+  }
+  return std::make_shared<FanOutStreamerAdapter>(sinks);
+}
+}  // namespace
+
 MediaManagerImpl::MediaManagerImpl(
     application_manager::ApplicationManager& application_manager,
     const MediaManagerSettings& settings)
@@ -124,32 +220,23 @@ void MediaManagerImpl::Init() {
   from_mic_recorder_ = new FromMicRecorderAdapter();
 #endif
 
-  if ("socket" == settings().video_server_type()) {
-    streamer_[ServiceType::kMobileNav] =
-        std::make_shared<SocketVideoStreamerAdapter>(
-            settings().server_address(), settings().video_streaming_port());
-  } else if ("pipe" == settings().video_server_type()) {
-    streamer_[ServiceType::kMobileNav] =
-        std::make_shared<PipeVideoStreamerAdapter>(
-            settings().named_video_pipe_path(),
-            settings().app_storage_folder());
-  } else if ("file" == settings().video_server_type()) {
-    streamer_[ServiceType::kMobileNav] =
-        std::make_shared<FileVideoStreamerAdapter>(
-            settings().video_stream_file(), settings().app_storage_folder());
-  }
-
-  if ("socket" == settings().audio_server_type()) {
-    streamer_[ServiceType::kAudio] =
-        std::make_shared<SocketAudioStreamerAdapter>(
-            settings().server_address(), settings().audio_streaming_port());
-  } else if ("pipe" == settings().audio_server_type()) {
-    streamer_[ServiceType::kAudio] = std::make_shared<PipeAudioStreamerAdapter>(
-        settings().named_audio_pipe_path(), settings().app_storage_folder());
-  } else if ("file" == settings().audio_server_type()) {
-    streamer_[ServiceType::kAudio] = std::make_shared<FileAudioStreamerAdapter>(
-        settings().audio_stream_file(), settings().app_storage_folder());
-  }
+  streamer_[ServiceType::kMobileNav] =
+      CreateStreamer(&CreateVideoStreamer,
+                     settings(),
+                     settings().video_server_type(),
+                     settings().video_additional_consumers(),
+                     settings().video_streaming_queue_size(),
+                     settings().video_streaming_queue_policy(),
+                     kDropUntilKeyFrame);
+
+  streamer_[ServiceType::kAudio] =
+      CreateStreamer(&CreateAudioStreamer,
+                     settings(),
+                     settings().audio_server_type(),
+                     settings().audio_additional_consumers(),
+                     settings().audio_streaming_queue_size(),
+                     settings().audio_streaming_queue_policy(),
+                     kDropOldest);
 
   streamer_listener_[ServiceType::kMobileNav] =
       std::make_shared<StreamerListener>(*this);
@@ -77,6 +77,11 @@ size_t StreamerAdapter::GetMsgQueueSize() {
   return messages_.size();
 }
 
+void StreamerAdapter::SetQueueLimits(size_t max_size,
+                                     StreamingQueuePolicy policy) {
+  messages_.SetLimits(max_size, policy);
+}
+
 void StreamerAdapter::StopActivity(int32_t application_key) {
   SDL_LOG_AUTO_TRACE();
   if (!is_app_performing_activity(application_key)) {
@@ -104,7 +109,9 @@ void StreamerAdapter::SendData(int32_t application_key,
                                                << " has not been started");
     return;
   }
-  messages_.push(msg);
+  if (!messages_.push(msg)) {
+    SDL_LOG_DEBUG("Message is dropped by streaming queue");
+  }
 }
 
 bool StreamerAdapter::is_app_performing_activity(
@@ -113,7 +120,7 @@ bool StreamerAdapter::is_app_performing_activity(
 }
 
 StreamerAdapter::Streamer::Streamer(StreamerAdapter* const adapter)
-    : stop_flag_(false), adapter_(adapter) {
+    : stop_flag_(false), adapter_(adapter), messages_for_session_(0) {
   DCHECK(adapter_);
 }
 
@@ -127,14 +134,18 @@ void StreamerAdapter::Streamer::threadMain() {
   }
   if (!Connect()) {
     SDL_LOG_ERROR("Unable to connect");
+    // Producer must not wait for space in the queue nobody takes from
+    adapter_->messages_.Shutdown();
     return;
   }
   stop_flag_ = false;
-  while (!stop_flag_) {
+  // Stop may be requested while connecting, the queue keeps that request
+  while (!stop_flag_ && !adapter_->messages_.IsShuttingDown()) {
     adapter_->messages_.wait();
     while (!adapter_->messages_.empty()) {
       protocol_handler::RawMessagePtr msg;
-      if (!adapter_->messages_.pop(msg)) {
+      uint32_t queue_age_ms = 0;
+      if (!adapter_->messages_.pop(msg, queue_age_ms)) {
         SDL_LOG_ERROR("Empty message queue");
         continue;
       }
@@ -144,20 +155,23 @@ void StreamerAdapter::Streamer::threadMain() {
       }
       if (!Send(msg)) {
         SDL_LOG_ERROR("Unable to send. Disconnecting");
+        adapter_->messages_.Shutdown();
         Disconnect();
         return;
       }
-      static int32_t messages_for_session = 0;
-      ++messages_for_session;
+      ++messages_for_session_;
 
       SDL_LOG_TRACE("Handling map streaming message. This is "
-                    << messages_for_session << " message for "
+                    << messages_for_session_ << " message for "
                     << adapter_->current_application_);
+      const StreamingQueueStatistics statistics =
+          adapter_->messages_.GetStatistics(queue_age_ms);
       std::set<MediaListenerPtr>::iterator it =
           adapter_->media_listeners_.begin();
       for (; adapter_->media_listeners_.end() != it; ++it) {
         (*it)->OnDataReceived(adapter_->current_application_,
-                              messages_for_session);
+                              messages_for_session_);
+        (*it)->OnQueueStatistics(adapter_->current_application_, statistics);
       }
     }
   }
@@ -39,7 +39,9 @@ namespace media_manager {
 SDL_CREATE_LOG_VARIABLE("MediaManager")
 
 StreamerListener::StreamerListener(MediaManager& media_manager)
-    : current_application_(0), media_manager_(media_manager) {}
+    : current_application_(0)
+    , dropped_messages_(0)
+    , media_manager_(media_manager) {}
 
 StreamerListener::~StreamerListener() {
   OnActivityEnded(current_application_);
@@ -62,6 +64,7 @@ void StreamerListener::OnActivityStarted(int32_t application_key) {
     return;
   }
   current_application_ = application_key;
+  dropped_messages_ = 0;
 }
 
 void StreamerListener::OnActivityEnded(int32_t application_key) {
@@ -72,4 +75,19 @@ void StreamerListener::OnActivityEnded(int32_t application_key) {
   }
   current_application_ = 0;
 }
+
+void StreamerListener::OnQueueStatistics(
+    int32_t application_key, const StreamingQueueStatistics& statistics) {
+  if (statistics.dropped_messages != dropped_messages_) {
+    SDL_LOG_WARN("Streaming queue of " << application_key << " dropped "
+                                       << statistics.dropped_messages
+                                       << " messages, queue age is "
+                                       << statistics.queue_age_ms << " ms");
+    dropped_messages_ = statistics.dropped_messages;
+  }
+  SDL_LOG_TRACE("Streaming queue of " << application_key << " has "
+                                      << statistics.queue_size
+                                      << " messages, queue age is "
+                                      << statistics.queue_age_ms << " ms");
+}
 }  //  namespace media_manager
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "media_manager/streaming_queue.h"
+
+namespace media_manager {
+
+namespace {
+const uint8_t kNalUnitTypeMask = 0x1F;
+const uint8_t kNalUnitTypeIdrSlice = 5;
+const uint8_t kNalUnitTypeSequenceParameterSet = 7;
+// Access unit starts with a few non-VCL units (AUD, SEI, SPS, PPS) followed
+// by the slice, so only the leading NAL headers have to be checked
+const size_t kMaxCheckedNalUnits = 4;
+
+bool IsSliceNalUnit(const uint8_t nal_unit_type) {
+  return nal_unit_type >= 1 && nal_unit_type <= kNalUnitTypeIdrSlice;
+}
+}  // namespace
+
+bool StringToStreamingQueuePolicy(const std::string& str,
+                                  StreamingQueuePolicy* policy) {
+  DCHECK_OR_RETURN(policy, false);
+  if ("DropOldest" == str) {
+    *policy = kDropOldest;
+  } else if ("DropUntilKeyFrame" == str) {
+    *policy = kDropUntilKeyFrame;
+  } else if ("BlockProducer" == str) {
+    *policy = kBlockProducer;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+StreamingQueue::StreamingQueue()
+    : max_size_(0)
+    , policy_(kDropOldest)
+    , waiting_for_key_frame_(false)
+    , dropped_messages_(0)
+    , shutting_down_(false) {}
+
+StreamingQueue::~StreamingQueue() {
+  Shutdown();
+}
+
+void StreamingQueue::SetLimits(size_t max_size, StreamingQueuePolicy policy) {
+  sync_primitives::AutoLock auto_lock(queue_lock_);
+  max_size_ = max_size;
+  policy_ = policy;
+  waiting_for_key_frame_ = false;
+  queue_space_available_.Broadcast();
+}
+
+bool StreamingQueue::push(const protocol_handler::RawMessagePtr& message) {
+  // Message is classified before locking to not stall the consumer, the
+  // result is used only by kDropUntilKeyFrame policy
+  const bool key_frame = message && IsKeyFrame(*message);
+
+  sync_primitives::AutoLock auto_lock(queue_lock_);
+  if (shutting_down_) {
+    return false;
+  }
+
+  if (waiting_for_key_frame_) {
+    if (!key_frame) {
+      ++dropped_messages_;
+      return false;
+    }
+    waiting_for_key_frame_ = false;
+  }
+
+  if (max_size_ && queue_.size() >= max_size_ &&
+      !MakeSpace(auto_lock, key_frame)) {
+    return false;
+  }
+
+  const QueuedMessage queued_message = {
+      message, date_time::getCurrentTime(), key_frame};
+  queue_.push_back(queued_message);
+  queue_new_items_.NotifyOne();
+  return true;
+}
+
+bool StreamingQueue::MakeSpace(sync_primitives::AutoLock& auto_lock,
+                               bool key_frame) {
+  switch (policy_) {
+    case kDropOldest:
+      queue_.pop_front();
+      ++dropped_messages_;
+      return true;
+    case kDropUntilKeyFrame:
+      // Queue is restarted from the newest key frame, so decoder doesn't get
+      // frames referring to dropped ones
+      for (size_t i = queue_.size() - 1; i > 0; --i) {
+        if (queue_[i].key_frame) {
+          queue_.erase(queue_.begin(), queue_.begin() + i);
+          dropped_messages_ += i;
+          return true;
+        }
+      }
+      dropped_messages_ += queue_.size();
+      queue_.clear();
+      if (key_frame) {
+        return true;
+      }
+      ++dropped_messages_;
+      waiting_for_key_frame_ = true;
+      return false;
+    case kBlockProducer:
+      while (!shutting_down_ && max_size_ && queue_.size() >= max_size_) {
+        queue_space_available_.Wait(auto_lock);
+      }
+      return !shutting_down_;
+  }
+  return false;
+}
+
+bool StreamingQueue::pop(protocol_handler::RawMessagePtr& message,
+                         uint32_t& age_ms) {
+  sync_primitives::AutoLock auto_lock(queue_lock_);
+  if (queue_.empty()) {
+    return false;
+  }
+  message = queue_.front().message;
+  age_ms = static_cast<uint32_t>(
+      date_time::calculateTimeSpan(queue_.front().queued_at));
+  queue_.pop_front();
+  queue_space_available_.NotifyOne();
+  return true;
+}
+
+size_t StreamingQueue::size() const {
+  sync_primitives::AutoLock auto_lock(queue_lock_);
+  return queue_.size();
+}
+
+bool StreamingQueue::empty() const {
+  sync_primitives::AutoLock auto_lock(queue_lock_);
+  return queue_.empty();
+}
+
+StreamingQueueStatistics StreamingQueue::GetStatistics(uint32_t age_ms) const {
+  sync_primitives::AutoLock auto_lock(queue_lock_);
+  StreamingQueueStatistics statistics;
+  statistics.dropped_messages = dropped_messages_;
+  statistics.queue_age_ms = age_ms;
+  statistics.queue_size = static_cast<uint32_t>(queue_.size());
+  return statistics;
+}
+
+void StreamingQueue::wait() {
+  sync_primitives::AutoLock auto_lock(queue_lock_);
+  while (!shutting_down_ && queue_.empty()) {
+    queue_new_items_.Wait(auto_lock);
+  }
+}
+
+void StreamingQueue::Shutdown() {
+  sync_primitives::AutoLock auto_lock(queue_lock_);
+  shutting_down_ = true;
+  queue_.clear();
+  queue_new_items_.Broadcast();
+  queue_space_available_.Broadcast();
+}
+
+bool StreamingQueue::IsShuttingDown() const {
+  sync_primitives::AutoLock auto_lock(queue_lock_);
+  return shutting_down_;
+}
+
+void StreamingQueue::Reset() {
+  sync_primitives::AutoLock auto_lock(queue_lock_);
+  shutting_down_ = false;
+  queue_.clear();
+  waiting_for_key_frame_ = false;
+  dropped_messages_ = 0;
+}
+
+bool StreamingQueue::IsKeyFrame(const protocol_handler::RawMessage& message) {
+  const uint8_t* data = message.data();
+  const size_t size = message.data_size();
+  if (!data) {
+    return true;
+  }
+
+  size_t checked_nal_units = 0;
+  for (size_t i = 0; i + 3 < size; ++i) {
+    if (0 != data[i] || 0 != data[i + 1] || 1 != data[i + 2]) {
+      continue;
+    }
+    const uint8_t nal_unit_type = data[i + 3] & kNalUnitTypeMask;
+    if (kNalUnitTypeIdrSlice == nal_unit_type ||
+        kNalUnitTypeSequenceParameterSet == nal_unit_type) {
+      return true;
+    }
+    // Slice payload is not scanned, it can be the whole frame
+    if (IsSliceNalUnit(nal_unit_type) ||
+        ++checked_nal_units >= kMaxCheckedNalUnits) {
+      return false;
+    }
+    i += 2;
+  }
+  return 0 == checked_nal_units;
+}
+
+}  // namespace media_manager
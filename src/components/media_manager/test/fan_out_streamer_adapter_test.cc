@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "media_manager/fan_out_streamer_adapter.h"
+#include "media_manager/mock_media_adapter_listener.h"
+#include "media_manager/video/file_video_streamer_adapter.h"
+#include "protocol/common.h"
+#include "utils/file_system.h"
+#include "utils/test_async_waiter.h"
+
+namespace test {
+namespace components {
+namespace media_manager_test {
+
+using media_manager::FanOutStreamerAdapter;
+using media_manager::FileVideoStreamerAdapter;
+using media_manager::StreamerAdapter;
+using media_manager::StreamerAdapterPtr;
+using media_manager::StreamingQueueStatistics;
+using protocol_handler::RawMessage;
+using protocol_handler::RawMessagePtr;
+using ::testing::_;
+using ::testing::NiceMock;
+
+namespace {
+const int32_t kApplicationKey = 1;
+const uint32_t kMessagesCount = 10u;
+const uint32_t kTimeoutMs = 1000u;
+const std::string kStorageFolder = "fan_out_test_storage";
+const uint8_t kData[] = {0x00, 0x00, 0x00, 0x01, 0x65, 0x88, 0x84, 0x00};
+
+/**
+ * @brief Sink whose Send() blocks until the test releases it
+ */
+class BlockingStreamerAdapter : public StreamerAdapter {
+ public:
+  explicit BlockingStreamerAdapter(
+      const std::shared_ptr<TestAsyncWaiter>& release)
+      : StreamerAdapter(new BlockingStreamer(this, release)) {}
+
+ private:
+  class BlockingStreamer : public StreamerAdapter::Streamer {
+   public:
+    BlockingStreamer(StreamerAdapter* const adapter,
+                     const std::shared_ptr<TestAsyncWaiter>& release)
+        : Streamer(adapter), release_(release) {}
+
+    void Close() OVERRIDE {}
+
+   protected:
+    bool Connect() OVERRIDE {
+      return true;
+    }
+    void Disconnect() OVERRIDE {}
+    bool Send(RawMessagePtr) OVERRIDE {
+      release_->WaitFor(1u, 10 * kTimeoutMs);
+      return true;
+    }
+
+   private:
+    std::shared_ptr<TestAsyncWaiter> release_;
+  };
+};
+
+RawMessagePtr CreateMessage() {
+  return std::make_shared<RawMessage>(0u,
+                                      ::protocol_handler::PROTOCOL_VERSION_2,
+                                      kData,
+                                      sizeof(kData),
+                                      false,
+                                      ::protocol_handler::kMobileNav);
+}
+}  // namespace
+
+class FanOutStreamerAdapterTest : public ::testing::Test {
+ protected:
+  void SetUp() OVERRIDE {
+    primary_sink_ = std::make_shared<FileVideoStreamerAdapter>(
+        kStorageFolder + "/primary", kStorageFolder);
+    secondary_sink_ = std::make_shared<FileVideoStreamerAdapter>(
+        kStorageFolder + "/secondary", kStorageFolder);
+    std::vector<StreamerAdapterPtr> sinks;
+    sinks.push_back(primary_sink_);
+    sinks.push_back(secondary_sink_);
+    fan_out_.reset(new FanOutStreamerAdapter(sinks));
+  }
+
+  void TearDown() OVERRIDE {
+    fan_out_.reset();
+    primary_sink_.reset();
+    secondary_sink_.reset();
+    file_system::RemoveDirectory(kStorageFolder, true);
+  }
+
+  StreamerAdapterPtr primary_sink_;
+  StreamerAdapterPtr secondary_sink_;
+  std::unique_ptr<FanOutStreamerAdapter> fan_out_;
+};
+
+TEST_F(FanOutStreamerAdapterTest, StartActivity_AllSinksStarted) {
+  fan_out_->StartActivity(kApplicationKey);
+  EXPECT_TRUE(fan_out_->is_app_performing_activity(kApplicationKey));
+  EXPECT_TRUE(primary_sink_->is_app_performing_activity(kApplicationKey));
+  EXPECT_TRUE(secondary_sink_->is_app_performing_activity(kApplicationKey));
+
+  fan_out_->StopActivity(kApplicationKey);
+  EXPECT_FALSE(fan_out_->is_app_performing_activity(kApplicationKey));
+  EXPECT_FALSE(secondary_sink_->is_app_performing_activity(kApplicationKey));
+}
+
+TEST_F(FanOutStreamerAdapterTest, SendData_EverySinkGetsAllMessages) {
+  std::shared_ptr<NiceMock<MockMediaAdapterListener> > listener =
+      std::make_shared<NiceMock<MockMediaAdapterListener> >();
+  std::shared_ptr<NiceMock<MockMediaAdapterListener> > secondary_listener =
+      std::make_shared<NiceMock<MockMediaAdapterListener> >();
+  std::shared_ptr<TestAsyncWaiter> waiter = TestAsyncWaiter::createInstance();
+
+  // Listeners of fan-out are notified by the primary sink only
+  EXPECT_CALL(*listener, OnActivityStarted(kApplicationKey));
+  EXPECT_CALL(*listener, OnDataReceived(kApplicationKey, _))
+      .Times(kMessagesCount)
+      .WillRepeatedly(NotifyTestAsyncWaiter(waiter));
+  EXPECT_CALL(*secondary_listener, OnDataReceived(kApplicationKey, _))
+      .Times(kMessagesCount)
+      .WillRepeatedly(NotifyTestAsyncWaiter(waiter));
+  EXPECT_CALL(*listener, OnActivityEnded(kApplicationKey));
+
+  fan_out_->AddListener(listener);
+  secondary_sink_->AddListener(secondary_listener);
+  fan_out_->StartActivity(kApplicationKey);
+
+  for (uint32_t i = 0; i < kMessagesCount; ++i) {
+    fan_out_->SendData(kApplicationKey, CreateMessage());
+  }
+
+  EXPECT_TRUE(waiter->WaitFor(2 * kMessagesCount, kTimeoutMs));
+  fan_out_->StopActivity(kApplicationKey);
+}
+
+TEST_F(FanOutStreamerAdapterTest, SendData_SinkBlocked_OtherSinkNotAffected) {
+  std::shared_ptr<TestAsyncWaiter> release = TestAsyncWaiter::createInstance();
+  std::shared_ptr<StreamerAdapter> blocked_sink =
+      std::make_shared<BlockingStreamerAdapter>(release);
+  // Queue of the blocked sink overflows, the other one never does
+  const size_t kBlockedQueueSize = 2u;
+  blocked_sink->SetQueueLimits(kBlockedQueueSize, media_manager::kDropOldest);
+  primary_sink_->SetQueueLimits(kMessagesCount, media_manager::kDropOldest);
+  std::vector<StreamerAdapterPtr> sinks;
+  sinks.push_back(primary_sink_);
+  sinks.push_back(blocked_sink);
+  fan_out_.reset(new FanOutStreamerAdapter(sinks));
+
+  std::shared_ptr<NiceMock<MockMediaAdapterListener> > listener =
+      std::make_shared<NiceMock<MockMediaAdapterListener> >();
+  std::shared_ptr<NiceMock<MockMediaAdapterListener> > blocked_listener =
+      std::make_shared<NiceMock<MockMediaAdapterListener> >();
+  std::shared_ptr<TestAsyncWaiter> waiter = TestAsyncWaiter::createInstance();
+  std::shared_ptr<TestAsyncWaiter> blocked_waiter =
+      TestAsyncWaiter::createInstance();
+  std::atomic<uint32_t> dropped(0);
+  std::atomic<uint32_t> blocked_dropped(0);
+
+  EXPECT_CALL(*listener, OnDataReceived(kApplicationKey, _))
+      .Times(kMessagesCount)
+      .WillRepeatedly(NotifyTestAsyncWaiter(waiter));
+  EXPECT_CALL(*listener, OnQueueStatistics(kApplicationKey, _))
+      .WillRepeatedly(::testing::Invoke(
+          [&dropped](int32_t, const StreamingQueueStatistics& statistics) {
+            dropped += statistics.dropped_messages;
+          }));
+  EXPECT_CALL(*blocked_listener, OnQueueStatistics(kApplicationKey, _))
+      .WillOnce(::testing::DoAll(
+          ::testing::Invoke([&blocked_dropped](
+                                int32_t,
+                                const StreamingQueueStatistics& statistics) {
+            blocked_dropped = statistics.dropped_messages;
+          }),
+          NotifyTestAsyncWaiter(blocked_waiter)))
+      .WillRepeatedly(::testing::Return());
+
+  fan_out_->AddListener(listener);
+  blocked_sink->AddListener(blocked_listener);
+  fan_out_->StartActivity(kApplicationKey);
+
+  for (uint32_t i = 0; i < kMessagesCount; ++i) {
+    fan_out_->SendData(kApplicationKey, CreateMessage());
+  }
+
+  // Producer is not blocked and the other sink gets everything meanwhile
+  EXPECT_TRUE(waiter->WaitFor(kMessagesCount, kTimeoutMs));
+  EXPECT_EQ(0u, dropped);
+
+  release->Notify();
+  EXPECT_TRUE(blocked_waiter->WaitFor(1u, kTimeoutMs));
+  // One message is held by Send(), the queue keeps only the newest ones
+  EXPECT_LE(kMessagesCount - kBlockedQueueSize - 1u, blocked_dropped);
+  fan_out_->StopActivity(kApplicationKey);
+}
+
+}  // namespace media_manager_test
+}  // namespace components
+}  // namespace test
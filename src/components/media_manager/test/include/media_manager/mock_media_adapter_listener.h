@@ -51,6 +51,10 @@ class MockMediaAdapterListener : public ::media_manager::MediaAdapterListener {
   MOCK_METHOD1(OnActivityEnded, void(int32_t application_key));
   MOCK_METHOD2(OnErrorReceived,
                void(int32_t application_key, const int32_t& data));
+  MOCK_METHOD2(
+      OnQueueStatistics,
+      void(int32_t application_key,
+           const ::media_manager::StreamingQueueStatistics& statistics));
 };
 
 }  // namespace media_manager_test
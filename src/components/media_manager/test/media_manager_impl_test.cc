@@ -85,6 +85,9 @@ const std::string kSocketValue = "socket";
 const std::string kPipeValue = "pipe";
 const std::string kFileValue = "file";
 const std::string kDefaultValue = "";
+const std::string kVideoStreamingQueuePolicy = "DropUntilKeyFrame";
+const std::string kAudioStreamingQueuePolicy = "DropOldest";
+const std::vector<std::string> kAdditionalConsumers;
 const std::string kOutputFilePath = kStorageFolder + "/" + kOutputFile;
 const uint32_t kProtocolVersion = ::protocol_handler::PROTOCOL_VERSION_2;
 const uint32_t kConnectionKey = 1u;
@@ -110,6 +113,14 @@ class MediaManagerImplTest : public ::testing::Test {
         .WillByDefault(ReturnRef(kDefaultValue));
     ON_CALL(mock_media_manager_settings_, audio_server_type())
         .WillByDefault(ReturnRef(kDefaultValue));
+    ON_CALL(mock_media_manager_settings_, video_streaming_queue_policy())
+        .WillByDefault(ReturnRef(kVideoStreamingQueuePolicy));
+    ON_CALL(mock_media_manager_settings_, audio_streaming_queue_policy())
+        .WillByDefault(ReturnRef(kAudioStreamingQueuePolicy));
+    ON_CALL(mock_media_manager_settings_, video_additional_consumers())
+        .WillByDefault(ReturnRef(kAdditionalConsumers));
+    ON_CALL(mock_media_manager_settings_, audio_additional_consumers())
+        .WillByDefault(ReturnRef(kAdditionalConsumers));
     ON_CALL(mock_hmi_capabilities_, pcm_stream_capabilities())
         .WillByDefault(Return(nullptr));
     ON_CALL(app_mngr_, hmi_capabilities())
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "media_manager/streaming_queue.h"
+#include "protocol/common.h"
+
+namespace test {
+namespace components {
+namespace media_manager_test {
+
+using media_manager::StreamingQueue;
+using media_manager::StringToStreamingQueuePolicy;
+using protocol_handler::RawMessage;
+using protocol_handler::RawMessagePtr;
+
+namespace {
+const uint32_t kConnectionKey = 1u;
+const uint32_t kProtocolVersion = ::protocol_handler::PROTOCOL_VERSION_2;
+
+// H.264 NAL units in Annex B format
+const uint8_t kIdrSlice[] = {0x00, 0x00, 0x00, 0x01, 0x65, 0x88, 0x84, 0x00};
+const uint8_t kSpsAndPps[] = {
+    0x00, 0x00, 0x00, 0x01, 0x67, 0x42, 0x00, 0x00, 0x01, 0x68, 0xCE, 0x38};
+const uint8_t kNonIdrSlice[] = {0x00, 0x00, 0x01, 0x41, 0x9A, 0x02, 0x00};
+const uint8_t kAudAndIdrSlice[] = {
+    0x00, 0x00, 0x01, 0x09, 0xF0, 0x00, 0x00, 0x01, 0x65, 0x88, 0x84};
+// Slice payload isn't escaped here, so it looks like a start code of IDR slice
+const uint8_t kNonIdrSliceWithIdrPattern[] = {
+    0x00, 0x00, 0x01, 0x41, 0x9A, 0x00, 0x00, 0x01, 0x65, 0x88};
+const uint8_t kNotAnnexB[] = {0x80, 0x60, 0x12, 0x34, 0x56, 0x78};
+
+RawMessagePtr CreateMessage(const uint8_t* data, size_t size) {
+  return std::make_shared<RawMessage>(kConnectionKey,
+                                      kProtocolVersion,
+                                      data,
+                                      size,
+                                      false,
+                                      ::protocol_handler::kMobileNav);
+}
+
+RawMessagePtr KeyFrame() {
+  return CreateMessage(kIdrSlice, sizeof(kIdrSlice));
+}
+
+RawMessagePtr DeltaFrame() {
+  return CreateMessage(kNonIdrSlice, sizeof(kNonIdrSlice));
+}
+}  // namespace
+
+TEST(StreamingQueueTest, StringToStreamingQueuePolicy) {
+  media_manager::StreamingQueuePolicy policy = media_manager::kBlockProducer;
+  EXPECT_TRUE(StringToStreamingQueuePolicy("DropOldest", &policy));
+  EXPECT_EQ(media_manager::kDropOldest, policy);
+  EXPECT_TRUE(StringToStreamingQueuePolicy("DropUntilKeyFrame", &policy));
+  EXPECT_EQ(media_manager::kDropUntilKeyFrame, policy);
+  EXPECT_TRUE(StringToStreamingQueuePolicy("BlockProducer", &policy));
+  EXPECT_EQ(media_manager::kBlockProducer, policy);
+  EXPECT_FALSE(StringToStreamingQueuePolicy("Unknown", &policy));
+  EXPECT_EQ(media_manager::kBlockProducer, policy);
+}
+
+TEST(StreamingQueueTest, IsKeyFrame) {
+  EXPECT_TRUE(StreamingQueue::IsKeyFrame(*KeyFrame()));
+  EXPECT_TRUE(StreamingQueue::IsKeyFrame(
+      *CreateMessage(kSpsAndPps, sizeof(kSpsAndPps))));
+  EXPECT_FALSE(StreamingQueue::IsKeyFrame(*DeltaFrame()));
+  EXPECT_TRUE(StreamingQueue::IsKeyFrame(
+      *CreateMessage(kAudAndIdrSlice, sizeof(kAudAndIdrSlice))));
+  EXPECT_FALSE(StreamingQueue::IsKeyFrame(*CreateMessage(
+      kNonIdrSliceWithIdrPattern, sizeof(kNonIdrSliceWithIdrPattern))));
+  EXPECT_TRUE(StreamingQueue::IsKeyFrame(
+      *CreateMessage(kNotAnnexB, sizeof(kNotAnnexB))));
+}
+
+TEST(StreamingQueueTest, NoLimit_AllMessagesQueued) {
+  StreamingQueue queue;
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(queue.push(DeltaFrame()));
+  }
+  EXPECT_EQ(100u, queue.size());
+  EXPECT_EQ(0u, queue.GetStatistics(0).dropped_messages);
+}
+
+TEST(StreamingQueueTest, DropOldest_NewestMessagesKept) {
+  StreamingQueue queue;
+  queue.SetLimits(2, media_manager::kDropOldest);
+
+  const RawMessagePtr first = DeltaFrame();
+  const RawMessagePtr second = DeltaFrame();
+  const RawMessagePtr third = DeltaFrame();
+  EXPECT_TRUE(queue.push(first));
+  EXPECT_TRUE(queue.push(second));
+  EXPECT_TRUE(queue.push(third));
+
+  EXPECT_EQ(2u, queue.size());
+  EXPECT_EQ(1u, queue.GetStatistics(0).dropped_messages);
+
+  RawMessagePtr message;
+  uint32_t age_ms = 0;
+  ASSERT_TRUE(queue.pop(message, age_ms));
+  EXPECT_EQ(second, message);
+  ASSERT_TRUE(queue.pop(message, age_ms));
+  EXPECT_EQ(third, message);
+  EXPECT_FALSE(queue.pop(message, age_ms));
+}
+
+TEST(StreamingQueueTest, DropUntilKeyFrame_QueueRestartsFromNewestKeyFrame) {
+  StreamingQueue queue;
+  queue.SetLimits(3, media_manager::kDropUntilKeyFrame);
+
+  const RawMessagePtr key_frame = KeyFrame();
+  EXPECT_TRUE(queue.push(DeltaFrame()));
+  EXPECT_TRUE(queue.push(key_frame));
+  EXPECT_TRUE(queue.push(DeltaFrame()));
+  EXPECT_TRUE(queue.push(DeltaFrame()));
+
+  EXPECT_EQ(3u, queue.size());
+  EXPECT_EQ(1u, queue.GetStatistics(0).dropped_messages);
+
+  RawMessagePtr message;
+  uint32_t age_ms = 0;
+  ASSERT_TRUE(queue.pop(message, age_ms));
+  EXPECT_EQ(key_frame, message);
+}
+
+TEST(StreamingQueueTest, DropUntilKeyFrame_DeltaFramesDroppedUntilKeyFrame) {
+  StreamingQueue queue;
+  queue.SetLimits(2, media_manager::kDropUntilKeyFrame);
+
+  EXPECT_TRUE(queue.push(DeltaFrame()));
+  EXPECT_TRUE(queue.push(DeltaFrame()));
+  // No key frame to restart from, so the whole queue is dropped
+  EXPECT_FALSE(queue.push(DeltaFrame()));
+  EXPECT_FALSE(queue.push(DeltaFrame()));
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(4u, queue.GetStatistics(0).dropped_messages);
+
+  const RawMessagePtr key_frame = KeyFrame();
+  EXPECT_TRUE(queue.push(key_frame));
+  EXPECT_TRUE(queue.push(DeltaFrame()));
+  EXPECT_EQ(2u, queue.size());
+
+  RawMessagePtr message;
+  uint32_t age_ms = 0;
+  ASSERT_TRUE(queue.pop(message, age_ms));
+  EXPECT_EQ(key_frame, message);
+}
+
+TEST(StreamingQueueTest, BlockProducer_PushWaitsForPop) {
+  StreamingQueue queue;
+  queue.SetLimits(1, media_manager::kBlockProducer);
+
+  const RawMessagePtr first = DeltaFrame();
+  const RawMessagePtr second = DeltaFrame();
+  EXPECT_TRUE(queue.push(first));
+
+  bool pushed = false;
+  std::thread producer([&queue, &second, &pushed]() {
+    pushed = queue.push(second);
+  });
+
+  RawMessagePtr message;
+  uint32_t age_ms = 0;
+  queue.wait();
+  ASSERT_TRUE(queue.pop(message, age_ms));
+  EXPECT_EQ(first, message);
+
+  producer.join();
+  EXPECT_TRUE(pushed);
+  ASSERT_TRUE(queue.pop(message, age_ms));
+  EXPECT_EQ(second, message);
+  EXPECT_EQ(0u, queue.GetStatistics(0).dropped_messages);
+}
+
+TEST(StreamingQueueTest, BlockProducer_ShutdownReleasesProducer) {
+  StreamingQueue queue;
+  queue.SetLimits(1, media_manager::kBlockProducer);
+  EXPECT_TRUE(queue.push(DeltaFrame()));
+
+  bool pushed = true;
+  std::thread producer(
+      [&queue, &pushed]() { pushed = queue.push(DeltaFrame()); });
+
+  queue.Shutdown();
+  producer.join();
+  EXPECT_FALSE(pushed);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(StreamingQueueTest, Reset_CountersCleared) {
+  StreamingQueue queue;
+  queue.SetLimits(1, media_manager::kDropOldest);
+  EXPECT_TRUE(queue.push(DeltaFrame()));
+  EXPECT_TRUE(queue.push(DeltaFrame()));
+  queue.Shutdown();
+  EXPECT_FALSE(queue.push(DeltaFrame()));
+
+  queue.Reset();
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(0u, queue.GetStatistics(0).dropped_messages);
+  EXPECT_TRUE(queue.push(DeltaFrame()));
+}
+
+}  // namespace media_manager_test
+}  // namespace components
+}  // namespace test
@@ -38,6 +38,7 @@
 #include "policy/sql_pt_queries.h"
 #include "policy/sql_wrapper.h"
 #include "utils/logger.h"
+#include "utils/scope_guard.h"
 
 namespace policy {
 
@@ -652,6 +653,13 @@ bool SQLPTExtRepresentation::SetSystemLanguage(const std::string& language) {
 
 bool SQLPTExtRepresentation::SaveApplicationPoliciesSection(
     const policy_table::ApplicationPoliciesSection& policies) {
+  // Runs as a nested transaction when called from Save()
+  if (!db()->BeginTransaction()) {
+    SDL_LOG_WARN("Failed to begin transaction for application policies.");
+    return false;
+  }
+  utils::ScopeGuard rollback = utils::MakeObjGuard(
+      *db(), &utils::dbms::SQLDatabase::RollbackTransaction);
   SDL_LOG_INFO("SaveApplicationPolicies ext");
   utils::dbms::SQLQuery query_delete(db());
   if (!query_delete.Exec(sql_pt::kDeleteAppGroup)) {
@@ -728,7 +736,8 @@ bool SQLPTExtRepresentation::SaveApplicationPoliciesSection(
     }
   }
 
-  return true;
+  rollback.Dismiss();
+  return db()->CommitTransaction();
 }
 
 bool SQLPTExtRepresentation::SaveSpecificAppPolicy(
@@ -1653,7 +1662,16 @@ bool SQLPTExtRepresentation::SaveMessageString(
 
 bool SQLPTExtRepresentation::SaveUsageAndErrorCounts(
     const policy_table::UsageAndErrorCounts& counts) {
-  return SaveAppCounters(*counts.app_level) && SaveGlobalCounters(counts);
+  // Runs as a nested transaction when called from Save()
+  if (!db()->BeginTransaction()) {
+    SDL_LOG_WARN("Failed to begin transaction for usage and error counts.");
+    return false;
+  }
+  if (!SaveAppCounters(*counts.app_level) || !SaveGlobalCounters(counts)) {
+    db()->RollbackTransaction();
+    return false;
+  }
+  return db()->CommitTransaction();
 }
 
 bool SQLPTExtRepresentation::SaveModuleMeta(
@@ -47,6 +47,7 @@
 #include "utils/file_system.h"
 #include "utils/gen_hash.h"
 #include "utils/logger.h"
+#include "utils/scope_guard.h"
 #include "utils/sqlite_wrapper/sql_database.h"
 
 namespace policy {
@@ -364,6 +365,12 @@ InitResult SQLPTRepresentation::Init(const PolicySettings* settings) {
   }
 
 #endif  // __QNX__
+  if (get_settings().use_policy_db_write_ahead_log() &&
+      !db_->EnableWriteAheadLog(get_settings().policy_db_mmap_size())) {
+    SDL_LOG_WARN("Failed to switch database to write-ahead log: "
+                 << db_->LastError().text());
+  }
+
   utils::dbms::SQLQuery check_pages(db());
   if (!check_pages.Prepare(sql_pt::kCheckPgNumber) || !check_pages.Next()) {
     SDL_LOG_WARN("Incorrect pragma for page counting.");
@@ -1043,6 +1050,13 @@ bool SQLPTRepresentation::SaveRpcs(int64_t group_id,
 
 bool SQLPTRepresentation::SaveApplicationPoliciesSection(
     const policy_table::ApplicationPoliciesSection& policies) {
+  // Runs as a nested transaction when called from Save()
+  if (!db_->BeginTransaction()) {
+    SDL_LOG_WARN("Failed to begin transaction for application policies.");
+    return false;
+  }
+  utils::ScopeGuard rollback = utils::MakeObjGuard(
+      *db_, &utils::dbms::SQLDatabase::RollbackTransaction);
   utils::dbms::SQLQuery query_delete(db());
   if (!query_delete.Exec(sql_pt::kDeleteAppGroup)) {
     SDL_LOG_WARN("Incorrect delete from app_group.");
@@ -1107,7 +1121,8 @@ bool SQLPTRepresentation::SaveApplicationPoliciesSection(
     }
   }
 
-  return true;
+  rollback.Dismiss();
+  return db_->CommitTransaction();
 }
 
 bool SQLPTRepresentation::SaveSpecificAppPolicy(
@@ -1892,6 +1907,13 @@ bool SQLPTRepresentation::SaveDeviceData(
 
 bool SQLPTRepresentation::SaveUsageAndErrorCounts(
     const policy_table::UsageAndErrorCounts& counts) {
+  // Runs as a nested transaction when called from Save()
+  if (!db_->BeginTransaction()) {
+    SDL_LOG_WARN("Failed to begin transaction for usage and error counts.");
+    return false;
+  }
+  utils::ScopeGuard rollback = utils::MakeObjGuard(
+      *db_, &utils::dbms::SQLDatabase::RollbackTransaction);
   const_cast<policy_table::UsageAndErrorCounts&>(counts).mark_initialized();
   utils::dbms::SQLQuery query(db());
   if (!query.Exec(sql_pt::kDeleteAppLevel)) {
@@ -1913,7 +1935,8 @@ bool SQLPTRepresentation::SaveUsageAndErrorCounts(
       return false;
     }
   }
-  return true;
+  rollback.Dismiss();
+  return db_->CommitTransaction();
 }
 
 void SQLPTRepresentation::IncrementIgnitionCycles() {
@@ -2500,7 +2523,13 @@ bool SQLPTRepresentation::SetIsDefault(const std::string& app_id,
 }
 
 void SQLPTRepresentation::RemoveDB() const {
-  file_system::DeleteFile(db_->get_path());
+  const std::string path = db_->get_path();
+  file_system::DeleteFile(path);
+  // Journal files left by write-ahead log must not be applied to a new DB
+  if (get_settings().use_policy_db_write_ahead_log()) {
+    file_system::DeleteFile(path + "-wal");
+    file_system::DeleteFile(path + "-shm");
+  }
 }
 
 bool SQLPTRepresentation::IsDBVersionActual() const {
@@ -32,8 +32,6 @@
 
 #include "protocol/raw_message.h"
 
-#include <memory.h>
-
 namespace protocol_handler {
 
 RawMessage::RawMessage(uint32_t connection_key,
@@ -44,22 +42,28 @@ RawMessage::RawMessage(uint32_t connection_key,
                        uint8_t type,
                        uint32_t payload_size)
     : connection_key_(connection_key)
-    , data_(NULL)
-    , data_size_(data_sz)
+    , buffer_(utils::SharedBuffer::Copy(data_param, data_sz))
     , protocol_version_(protocol_version)
     , protection_(protection)
     , service_type_(ServiceTypeFromByte(type))
     , payload_size_(payload_size)
-    , waiting_(false) {
-  if (data_param && data_sz > 0) {
-    data_ = new uint8_t[data_sz];
-    memcpy(data_, data_param, sizeof(*data_) * data_sz);
-  }
-}
+    , waiting_(false) {}
 
-RawMessage::~RawMessage() {
-  delete[] data_;
-}
+RawMessage::RawMessage(uint32_t connection_key,
+                       uint32_t protocol_version,
+                       const utils::SharedBuffer& buffer,
+                       bool protection,
+                       uint8_t type,
+                       uint32_t payload_size)
+    : connection_key_(connection_key)
+    , buffer_(buffer)
+    , protocol_version_(protocol_version)
+    , protection_(protection)
+    , service_type_(ServiceTypeFromByte(type))
+    , payload_size_(payload_size)
+    , waiting_(false) {}
+
+RawMessage::~RawMessage() {}
 
 uint32_t RawMessage::connection_key() const {
   return connection_key_;
@@ -70,7 +74,11 @@ void RawMessage::set_connection_key(uint32_t key) {
 }
 
 uint8_t* RawMessage::data() const {
-  return data_;
+  return buffer_.data();
+}
+
+const utils::SharedBuffer& RawMessage::buffer() const {
+  return buffer_;
 }
 
 size_t RawMessage::payload_size() const {
@@ -78,7 +86,7 @@ size_t RawMessage::payload_size() const {
 }
 
 size_t RawMessage::data_size() const {
-  return data_size_;
+  return buffer_.size();
 }
 
 uint32_t RawMessage::protocol_version() const {
@@ -32,11 +32,12 @@
 #ifndef SRC_COMPONENTS_PROTOCOL_HANDLER_INCLUDE_PROTOCOL_HANDLER_INCOMING_DATA_HANDLER_H_
 #define SRC_COMPONENTS_PROTOCOL_HANDLER_INCLUDE_PROTOCOL_HANDLER_INCOMING_DATA_HANDLER_H_
 
+#include <deque>
 #include <map>
-#include <vector>
 #include "protocol_handler/protocol_packet.h"
 #include "transport_manager/common.h"
 #include "utils/macro.h"
+#include "utils/shared_buffer.h"
 
 namespace protocol_handler {
 
@@ -79,12 +80,56 @@ class IncomingDataHandler {
   void RemoveConnection(const transport_manager::ConnectionUID connection_id);
 
  private:
+  /**
+   * @brief Received data of a connection not yet turned into frames.
+   * Chunks are slices of received buffers, consumed bytes are dropped by
+   * narrowing the front chunk, so data is never moved or compacted
+   */
+  class ChunkList {
+   public:
+    typedef std::deque<utils::SharedBuffer> Chunks;
+
+    ChunkList();
+    void Append(const utils::SharedBuffer& chunk);
+    /**
+     * @brief Copies up to count leading bytes across chunk boundaries
+     * \return amount of copied bytes
+     */
+    size_t Peek(uint8_t* out, const size_t count) const;
+    /**
+     * @brief Gets count leading bytes as one buffer. It is a slice of the
+     * front chunk if bytes are there, otherwise only these bytes are copied
+     */
+    utils::SharedBuffer Front(const size_t count) const;
+    void Consume(size_t count);
+    const Chunks& chunks() const;
+    size_t size() const;
+
+   private:
+    Chunks chunks_;
+    size_t size_;
+  };
+
   /**
    * @brief Returns size of frame to be formed from raw bytes.
    */
   static uint32_t GetPacketSize(const ProtocolPacket::ProtocolHeader& header);
   /**
-   * @brief Try to create frame from incoming data
+   * @brief Cheap check of the first header bytes, false means that header
+   * starting there would be rejected anyway
+   */
+  bool IsHeaderStart(const uint8_t first_byte) const;
+  bool IsHeaderStart(const uint8_t first_byte, const uint8_t second_byte) const;
+  /**
+   * @brief Scans for the nearest offset after the first byte where header
+   * may start
+   * \return offset found or size of data if there is no such offset
+   */
+  size_t FindHeaderStart(const ChunkList& data) const;
+  /**
+   * @brief Try to create frame from incoming data.
+   * Frames reference their bodies inside incoming_data without copying
+   * unless they span several chunks, consumed bytes are removed
    * \param incommung_data raw stream
    * \param malformed_occurrence count of malformed messages occurrence
    * \param out_frames list for read frames
@@ -94,12 +139,12 @@ class IncomingDataHandler {
    *   - RESULT_OK - one or more frames successfully created
    *   - RESULT_FAIL - packet serialization or validation error occurs
    */
-  RESULT_CODE CreateFrame(std::vector<uint8_t>& incoming_data,
+  RESULT_CODE CreateFrame(ChunkList& incoming_data,
                           ProtocolFramePtrList& out_frames,
                           size_t& malformed_occurrence,
                           const transport_manager::ConnectionUID connection_id);
 
-  typedef std::map<transport_manager::ConnectionUID, std::vector<uint8_t> >
+  typedef std::map<transport_manager::ConnectionUID, ChunkList>
       ConnectionsDataMap;
   ConnectionsDataMap connections_data_;
   ProtocolPacket::ProtocolHeader header_;
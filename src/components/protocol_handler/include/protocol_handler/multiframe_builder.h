@@ -35,8 +35,11 @@
 
 #include <algorithm>  // std::copy
 #include <iterator>   // std::ostream_iterator
-#include <map>
+#include <list>
 #include <ostream>  // std::basic_ostream
+#include <set>
+#include <unordered_map>
+#include <utility>
 
 #include "protocol_handler/protocol_packet.h"
 #include "utils/date_time.h"
@@ -63,21 +66,43 @@ struct ProtocolFrameData {
   ProtocolFramePtr frame;
   date_time::TimeDuration append_time;
 };
+
 /**
- *\brief Map of frames with last frame data for messages received in multiple
- *frames.
+ *\brief Identifier of message received in multiple frames.
  */
-typedef std::map<MessageID, ProtocolFrameData> MessageIDToFrameMap;
+struct MultiFrameKey {
+  ConnectionID connection_id;
+  SessionID session_id;
+  MessageID message_id;
+
+  bool operator==(const MultiFrameKey& other) const {
+    return connection_id == other.connection_id &&
+           session_id == other.session_id && message_id == other.message_id;
+  }
+};
+
+struct MultiFrameKeyHash {
+  size_t operator()(const MultiFrameKey& key) const {
+    const uint64_t value = (static_cast<uint64_t>(key.connection_id) << 40) ^
+                           (static_cast<uint64_t>(key.session_id) << 32) ^
+                           key.message_id;
+    return std::hash<uint64_t>()(value);
+  }
+};
+
 /**
- *\brief Map of frames with last frame data for messages received in multiple
- *frames.
+ *\brief Frames of messages received in multiple frames ordered by time of
+ *their last frame, so the oldest one is at front.
  */
-typedef std::map<SessionID, MessageIDToFrameMap> SessionToFrameMap;
+typedef std::list<std::pair<MultiFrameKey, ProtocolFrameData> >
+    MultiFrameList;
 /**
- *\brief Map of frames with last frame data for messages received in multiple
- *frames.
+ *\brief Index of waiting messages by their identifiers.
  */
-typedef std::map<ConnectionID, SessionToFrameMap> MultiFrameMap;
+typedef std::unordered_map<MultiFrameKey,
+                           MultiFrameList::iterator,
+                           MultiFrameKeyHash>
+    MultiFrameMap;
 
 /**
  * \class MultiFrameBuilder
@@ -123,9 +148,13 @@ class MultiFrameBuilder {
   RESULT_CODE HandleFirstFrame(const ProtocolFramePtr packet);
   RESULT_CODE HandleConsecutiveFrame(const ProtocolFramePtr packet);
 
-  //  Map of frames with last frame data for messages received in multiple
-  //  frames.
+  std::set<ConnectionID> connections_;
+  //  Frames of messages waiting for CONSECUTIVE frames, oldest first, so
+  //  expired ones are found without walking the whole list.
+  MultiFrameList waiting_frames_;
   MultiFrameMap multiframes_map_;
+  //  Messages assembled since last PopMultiframes call.
+  ProtocolFramePtrList ready_frames_;
   sync_primitives::Lock multiframes_map_lock_;
   int64_t consecutive_frame_wait_msecs_;
 };
@@ -133,33 +162,18 @@ class MultiFrameBuilder {
 template <typename _CharT>
 std::basic_ostream<_CharT>& operator<<(
     std::basic_ostream<_CharT>& stream,
-    const protocol_handler::MultiFrameMap& map) {
-  if (map.empty()) {
+    const protocol_handler::MultiFrameList& list) {
+  if (list.empty()) {
     stream << "{empty}";
     return stream;
   }
-  for (MultiFrameMap::const_iterator connection_it = map.begin();
-       connection_it != map.end();
-       ++connection_it) {
-    const SessionToFrameMap& session_map = connection_it->second;
-
-    for (SessionToFrameMap::const_iterator session_it = session_map.begin();
-         session_it != session_map.end();
-         ++session_it) {
-      const MessageIDToFrameMap& messageId_map = session_it->second;
-
-      for (MessageIDToFrameMap::const_iterator messageId_it =
-               messageId_map.begin();
-           messageId_it != messageId_map.end();
-           ++messageId_it) {
-        const ProtocolFrameData& frame_data = messageId_it->second;
-
-        stream << "ConnectionID: " << connection_it->first
-               << ", SessionID: " << static_cast<uint32_t>(session_it->first)
-               << ", MessageID: " << static_cast<uint32_t>(messageId_it->first)
-               << " msec, frame: " << frame_data.frame << std::endl;
-      }
-    }
+  for (MultiFrameList::const_iterator it = list.begin(); it != list.end();
+       ++it) {
+    const MultiFrameKey& key = it->first;
+    stream << "ConnectionID: " << key.connection_id
+           << ", SessionID: " << static_cast<uint32_t>(key.session_id)
+           << ", MessageID: " << static_cast<uint32_t>(key.message_id)
+           << " msec, frame: " << it->second.frame << std::endl;
   }
   return stream;
 }
@@ -39,8 +39,8 @@
 #include <set>
 #include <utility>  // std::make_pair
 #include <vector>
+#include "utils/bucket_prioritized_queue.h"
 #include "utils/message_queue.h"
-#include "utils/prioritized_queue.h"
 #include "utils/threads/message_loop_thread.h"
 
 #include "utils/convert_utils.h"
@@ -135,10 +135,10 @@ struct RawFordMessageToMobile : public ProtocolFramePtr {
 
 // Short type names for prioritized message queues
 typedef threads::MessageLoopThread<
-    utils::PrioritizedQueue<RawFordMessageFromMobile> >
+    utils::BucketPrioritizedQueue<RawFordMessageFromMobile> >
     FromMobileQueue;
 typedef threads::MessageLoopThread<
-    utils::PrioritizedQueue<RawFordMessageToMobile> >
+    utils::BucketPrioritizedQueue<RawFordMessageToMobile> >
     ToMobileQueue;
 
 // Type to allow easy mapping between a device type and transport
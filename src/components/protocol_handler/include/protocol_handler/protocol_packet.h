@@ -37,6 +37,7 @@
 #include "protocol/common.h"
 #include "transport_manager/common.h"
 #include "utils/macro.h"
+#include "utils/shared_buffer.h"
 
 /**
  *\namespace protocol_handlerHandler
@@ -58,8 +59,7 @@ class ProtocolPacket {
    */
   struct ProtocolData {
     ProtocolData();
-    ~ProtocolData();
-    uint8_t* data;
+    utils::SharedBuffer buffer;
     uint32_t totalDataBytes;
   };
 
@@ -203,6 +203,14 @@ class ProtocolPacket {
   RESULT_CODE deserializePacket(const uint8_t* message,
                                 const size_t messageSize);
 
+  /**
+   * \brief Parses protocol header, message body is referenced as a slice
+   * of the given buffer instead of being copied
+   * \param message Incoming buffer containing both header and message body
+   * \return \saRESULT_CODE Status of serialization
+   */
+  RESULT_CODE deserializePacket(const utils::SharedBuffer& message);
+
   /**
    * @brief Calculates FIRST_FRAME data for further handling of consecutive
    * frames
@@ -262,6 +270,11 @@ class ProtocolPacket {
    */
   uint8_t* data() const;
 
+  /**
+   *\brief Getter of buffer holding message body
+   */
+  const utils::SharedBuffer& data_buffer() const;
+
   /**
    *\brief Setter for size of multiframe message
    */
@@ -304,6 +317,13 @@ class ProtocolPacket {
    */
   ProtocolHeader packet_header_;
 
+  /**
+   * \brief Parses message, takes body as slice of owner if it is not empty
+   */
+  RESULT_CODE DeserializePacket(const uint8_t* message,
+                                const size_t messageSize,
+                                const utils::SharedBuffer& owner);
+
   /**
    *\brief Message body (without header)
    */
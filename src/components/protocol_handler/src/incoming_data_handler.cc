@@ -30,6 +30,10 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 #include "protocol_handler/incoming_data_handler.h"
+
+#include <algorithm>
+#include <cstring>
+
 #include "protocol/common.h"
 #include "utils/logger.h"
 
@@ -71,8 +75,8 @@ ProtocolFramePtrList IncomingDataHandler::ProcessData(
     out_result = RESULT_FAIL;
     return ProtocolFramePtrList();
   }
-  std::vector<uint8_t>& connection_data = it->second;
-  connection_data.insert(connection_data.end(), data, data + tm_message_size);
+  ChunkList& connection_data = it->second;
+  connection_data.Append(tm_message.buffer());
   SDL_LOG_TRACE("Total data size for connection " << connection_id << " is "
                                                   << connection_data.size());
   ProtocolFramePtrList out_frames;
@@ -129,19 +133,72 @@ uint32_t IncomingDataHandler::GetPacketSize(
   return 0u;
 }
 
+bool IncomingDataHandler::IsHeaderStart(const uint8_t first_byte) const {
+  const uint8_t version = first_byte >> 4u;
+  if (version < PROTOCOL_VERSION_1 || version > PROTOCOL_VERSION_5) {
+    return false;
+  }
+  // Validator accepts no frame types above consecutive one
+  return !validator_ || (first_byte & 0x07u) <= FRAME_TYPE_CONSECUTIVE;
+}
+
+bool IncomingDataHandler::IsHeaderStart(const uint8_t first_byte,
+                                        const uint8_t second_byte) const {
+  if (!IsHeaderStart(first_byte)) {
+    return false;
+  }
+  if (!validator_) {
+    return true;
+  }
+  switch (second_byte) {
+    case SERVICE_TYPE_CONTROL:
+    case SERVICE_TYPE_RPC:
+    case SERVICE_TYPE_AUDIO:
+    case SERVICE_TYPE_NAVI:
+    case SERVICE_TYPE_BULK:
+      return true;
+    default:
+      return false;
+  }
+}
+
+size_t IncomingDataHandler::FindHeaderStart(const ChunkList& data) const {
+  size_t offset = 0u;
+  uint8_t previous_byte = 0u;
+  bool previous_matches = false;
+  for (ChunkList::Chunks::const_iterator it = data.chunks().begin();
+       it != data.chunks().end();
+       ++it) {
+    const uint8_t* const bytes = it->data();
+    for (size_t i = 0u; i < it->size(); ++i, ++offset) {
+      if (previous_matches && IsHeaderStart(previous_byte, bytes[i])) {
+        return offset - 1u;
+      }
+      // Header at offset 0 has already been rejected
+      previous_matches = offset > 0u && IsHeaderStart(bytes[i]);
+      previous_byte = bytes[i];
+    }
+  }
+  // Last byte may start a header which is not fully received yet
+  return previous_matches ? offset - 1u : offset;
+}
+
 RESULT_CODE IncomingDataHandler::CreateFrame(
-    std::vector<uint8_t>& incoming_data,
+    ChunkList& incoming_data,
     ProtocolFramePtrList& out_frames,
     size_t& malformed_occurrence,
     const transport_manager::ConnectionUID connection_id) {
   SDL_LOG_AUTO_TRACE();
-  std::vector<uint8_t>::iterator data_it = incoming_data.begin();
-  size_t data_size = incoming_data.size();
+  uint8_t header_data[PROTOCOL_HEADER_V2_SIZE];
 
-  while (data_size >= MIN_HEADER_SIZE) {
-    header_.deserialize(&*data_it, data_size);
-    const RESULT_CODE validate_result =
-        validator_ ? validator_->validate(header_) : RESULT_OK;
+  while (incoming_data.size() >= MIN_HEADER_SIZE) {
+    const size_t header_size =
+        incoming_data.Peek(header_data, sizeof(header_data));
+    RESULT_CODE validate_result = RESULT_FAIL;
+    if (IsHeaderStart(header_data[0], header_data[1])) {
+      header_.deserialize(header_data, header_size);
+      validate_result = validator_ ? validator_->validate(header_) : RESULT_OK;
+    }
 
     if (validate_result != RESULT_OK) {
       SDL_LOG_WARN("Packet validation failed");
@@ -150,34 +207,29 @@ RESULT_CODE IncomingDataHandler::CreateFrame(
         SDL_LOG_DEBUG("Malformed message found " << malformed_occurrence);
       }
       last_portion_of_data_was_malformed_ = true;
-      ++data_it;
-      --data_size;
-      SDL_LOG_DEBUG("Moved to the next byte "
-                    << std::hex << static_cast<const void*>(&*data_it));
+      const size_t skipped_size = FindHeaderStart(incoming_data);
+      incoming_data.Consume(skipped_size);
+      SDL_LOG_DEBUG("Skipped " << skipped_size << " malformed bytes");
       continue;
     }
     SDL_LOG_TRACE("Payload size " << header_.dataSize);
     const uint32_t packet_size = GetPacketSize(header_);
     if (packet_size == 0) {
       SDL_LOG_WARN("Null packet size");
-      ++data_it;
-      --data_size;
-      SDL_LOG_DEBUG("Moved to the next byte "
-                    << std::hex << static_cast<const void*>(&*data_it));
+      incoming_data.Consume(1u);
+      SDL_LOG_DEBUG("Moved to the next byte");
       continue;
     }
-    if (data_size < packet_size) {
+    if (incoming_data.size() < packet_size) {
       SDL_LOG_TRACE("Packet data is not available yet");
-      incoming_data.erase(incoming_data.begin(), data_it);
       return RESULT_DEFERRED;
     }
     ProtocolFramePtr frame(new protocol_handler::ProtocolPacket(connection_id));
     const RESULT_CODE deserialize_result =
-        frame->deserializePacket(&*data_it, packet_size);
+        frame->deserializePacket(incoming_data.Front(packet_size));
     SDL_LOG_TRACE("Deserialized frame " << frame);
     if (deserialize_result != RESULT_OK) {
       SDL_LOG_WARN("Packet deserialization failed");
-      incoming_data.erase(incoming_data.begin(), data_it);
       return RESULT_FAIL;
     }
 
@@ -186,10 +238,66 @@ RESULT_CODE IncomingDataHandler::CreateFrame(
     SDL_LOG_TRACE("Frame added. "
                   << "Connection ID " << connection_id);
 
-    data_it += packet_size;
-    data_size -= packet_size;
+    incoming_data.Consume(packet_size);
   }
-  incoming_data.erase(incoming_data.begin(), data_it);
   return RESULT_OK;
 }
+
+IncomingDataHandler::ChunkList::ChunkList() : chunks_(), size_(0u) {}
+
+void IncomingDataHandler::ChunkList::Append(const utils::SharedBuffer& chunk) {
+  if (!chunk.empty()) {
+    chunks_.push_back(chunk);
+    size_ += chunk.size();
+  }
+}
+
+size_t IncomingDataHandler::ChunkList::Peek(uint8_t* out,
+                                            const size_t count) const {
+  size_t copied = 0u;
+  for (Chunks::const_iterator it = chunks_.begin();
+       it != chunks_.end() && copied < count;
+       ++it) {
+    const size_t part_size = std::min(count - copied, it->size());
+    memcpy(out + copied, it->data(), part_size);
+    copied += part_size;
+  }
+  return copied;
+}
+
+utils::SharedBuffer IncomingDataHandler::ChunkList::Front(
+    const size_t count) const {
+  DCHECK_OR_RETURN(count <= size_, utils::SharedBuffer());
+  if (!chunks_.empty() && chunks_.front().size() >= count) {
+    return chunks_.front().Slice(0u, count);
+  }
+  utils::SharedBuffer joined(count);
+  if (!joined.empty()) {
+    Peek(joined.data(), count);
+  }
+  return joined;
+}
+
+void IncomingDataHandler::ChunkList::Consume(size_t count) {
+  count = std::min(count, size_);
+  size_ -= count;
+  while (count > 0u) {
+    utils::SharedBuffer& front = chunks_.front();
+    if (front.size() > count) {
+      front = front.Slice(count, front.size() - count);
+      return;
+    }
+    count -= front.size();
+    chunks_.pop_front();
+  }
+}
+
+const IncomingDataHandler::ChunkList::Chunks&
+IncomingDataHandler::ChunkList::chunks() const {
+  return chunks_;
+}
+
+size_t IncomingDataHandler::ChunkList::size() const {
+  return size_;
+}
 }  // namespace protocol_handler
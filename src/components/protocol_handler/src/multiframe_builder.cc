@@ -59,83 +59,69 @@ void MultiFrameBuilder::set_waiting_timeout(
 bool MultiFrameBuilder::AddConnection(const ConnectionID connection_id) {
   SDL_LOG_DEBUG("Adding connection_id: " << connection_id);
   sync_primitives::AutoLock lock(multiframes_map_lock_);
-  SDL_LOG_DEBUG("Current state is: " << multiframes_map_);
-  const MultiFrameMap::const_iterator it = multiframes_map_.find(connection_id);
-  if (it != multiframes_map_.end()) {
+  SDL_LOG_DEBUG("Current state is: " << waiting_frames_);
+  if (!connections_.insert(connection_id).second) {
     SDL_LOG_ERROR("Exists connection_id: " << connection_id);
     return false;
   }
-  multiframes_map_[connection_id] = SessionToFrameMap();
   return true;
 }
 
 bool MultiFrameBuilder::RemoveConnection(const ConnectionID connection_id) {
   SDL_LOG_DEBUG("Removing connection_id: " << connection_id);
   sync_primitives::AutoLock lock(multiframes_map_lock_);
-  SDL_LOG_DEBUG("Current state is: " << multiframes_map_);
-  const MultiFrameMap::iterator it = multiframes_map_.find(connection_id);
-  if (it == multiframes_map_.end()) {
+  SDL_LOG_DEBUG("Current state is: " << waiting_frames_);
+  if (0u == connections_.erase(connection_id)) {
     SDL_LOG_ERROR("Non-existent connection_id: " << connection_id);
     return false;
   }
-  const SessionToFrameMap& session_to_frame_map = it->second;
-  if (!session_to_frame_map.empty()) {
+  MultiFrameList::iterator it = waiting_frames_.begin();
+  while (it != waiting_frames_.end()) {
+    if (it->first.connection_id != connection_id) {
+      ++it;
+      continue;
+    }
     // FIXME(EZamakhov): Ask ReqManager - do we need to send GenericError
     SDL_LOG_WARN("For connection_id: " << connection_id
-                                       << " waiting: " << multiframes_map_);
+                                       << " waiting: " << it->second.frame);
+    multiframes_map_.erase(it->first);
+    it = waiting_frames_.erase(it);
+  }
+  ProtocolFramePtrList::iterator ready_it = ready_frames_.begin();
+  while (ready_it != ready_frames_.end()) {
+    if ((*ready_it)->connection_id() == connection_id) {
+      ready_it = ready_frames_.erase(ready_it);
+    } else {
+      ++ready_it;
+    }
   }
-  multiframes_map_.erase(it);
   return true;
 }
 
 ProtocolFramePtrList MultiFrameBuilder::PopMultiframes() {
   SDL_LOG_AUTO_TRACE();
   sync_primitives::AutoLock lock(multiframes_map_lock_);
-  SDL_LOG_TRACE("Current state is: " << multiframes_map_);
+  SDL_LOG_TRACE("Current state is: " << waiting_frames_);
   SDL_LOG_TRACE("Current multiframe map size is: " << multiframes_map_.size());
   ProtocolFramePtrList outpute_frame_list;
-  for (MultiFrameMap::iterator connection_it = multiframes_map_.begin();
-       connection_it != multiframes_map_.end();
-       ++connection_it) {
-    SDL_LOG_TRACE("Step over connection: " << connection_it->first);
-    SessionToFrameMap& session_map = connection_it->second;
-
-    for (SessionToFrameMap::iterator session_it = session_map.begin();
-         session_it != session_map.end();
-         ++session_it) {
-      SDL_LOG_TRACE(
-          "Step over session: " << static_cast<int>(session_it->first));
-      MessageIDToFrameMap& messageId_map = session_it->second;
-
-      MessageIDToFrameMap::iterator messageId_it = messageId_map.begin();
-      while (messageId_it != messageId_map.end()) {
-        SDL_LOG_TRACE("Step over messageId: " << messageId_it->first);
-        ProtocolFrameData& frame_data = messageId_it->second;
-        ProtocolFramePtr frame = frame_data.frame;
-
-        if (frame && frame->frame_data() == FRAME_DATA_LAST_CONSECUTIVE &&
-            frame->payload_size() > 0u) {
-          SDL_LOG_TRACE("Ready frame: " << frame);
-          outpute_frame_list.push_back(frame);
-          messageId_map.erase(messageId_it++);
-          continue;
-        }
-        if (consecutive_frame_wait_msecs_ != 0) {
-          SDL_LOG_TRACE("Expiration verification");
-          const int64_t time_left =
-              date_time::calculateTimeSpan(frame_data.append_time);
-          SDL_LOG_DEBUG("mSecs left: " << time_left);
-          if (time_left >= consecutive_frame_wait_msecs_) {
-            SDL_LOG_WARN("Expired frame: " << frame);
-            outpute_frame_list.push_back(frame);
-            messageId_map.erase(messageId_it++);
-            continue;
-          }
-        }
-        ++messageId_it;
-      }  // iteration over messageId_map
-    }    // iteration over session_map
-  }      // iteration over multiframes_map_
+  outpute_frame_list.swap(ready_frames_);
+  if (consecutive_frame_wait_msecs_ != 0) {
+    SDL_LOG_TRACE("Expiration verification");
+    // Frames are ordered by append time, so only expired ones are visited
+    while (!waiting_frames_.empty()) {
+      const ProtocolFrameData& frame_data = waiting_frames_.front().second;
+      const int64_t time_left =
+          date_time::calculateTimeSpan(frame_data.append_time);
+      SDL_LOG_DEBUG("mSecs left: " << time_left);
+      if (time_left < consecutive_frame_wait_msecs_) {
+        break;
+      }
+      SDL_LOG_WARN("Expired frame: " << frame_data.frame);
+      outpute_frame_list.push_back(frame_data.frame);
+      multiframes_map_.erase(waiting_frames_.front().first);
+      waiting_frames_.pop_front();
+    }
+  }
   SDL_LOG_TRACE("Result frames count: " << outpute_frame_list.size());
   return outpute_frame_list;
 }
@@ -164,7 +150,7 @@ RESULT_CODE MultiFrameBuilder::AddFrame(const ProtocolFramePtr packet) {
 RESULT_CODE MultiFrameBuilder::HandleFirstFrame(const ProtocolFramePtr packet) {
   DCHECK_OR_RETURN(packet->frame_type() == FRAME_TYPE_FIRST, RESULT_FAIL);
   sync_primitives::AutoLock lock(multiframes_map_lock_);
-  SDL_LOG_TRACE("Waiting : " << multiframes_map_);
+  SDL_LOG_TRACE("Waiting : " << waiting_frames_);
   SDL_LOG_TRACE("Handling FIRST frame: " << packet);
   if (packet->payload_size() != 0u) {
     SDL_LOG_ERROR("First frame shall have no data:" << packet);
@@ -172,20 +158,15 @@ RESULT_CODE MultiFrameBuilder::HandleFirstFrame(const ProtocolFramePtr packet) {
   }
 
   const ConnectionID connection_id = packet->connection_id();
-  MultiFrameMap::iterator connection_it = multiframes_map_.find(connection_id);
-  if (connection_it == multiframes_map_.end()) {
+  if (0u == connections_.count(connection_id)) {
     SDL_LOG_ERROR("Unknown connection_id: " << connection_id);
     return RESULT_FAIL;
   }
-  SessionToFrameMap& session_map = connection_it->second;
 
   const SessionID session_id = packet->session_id();
-  // No need to verify session existance
-  MessageIDToFrameMap& messageId_map = session_map[session_id];
-
   const MessageID message_id = packet->message_id();
-  MessageIDToFrameMap::iterator messageId_it = messageId_map.find(message_id);
-  if (messageId_it != messageId_map.end()) {
+  const MultiFrameKey key = {connection_id, session_id, message_id};
+  if (multiframes_map_.count(key)) {
     SDL_LOG_ERROR("Already waiting message for connection_id: "
                   << connection_id
                   << ", session_id: " << static_cast<int>(session_id)
@@ -198,7 +179,9 @@ RESULT_CODE MultiFrameBuilder::HandleFirstFrame(const ProtocolFramePtr packet) {
                 << ", session_id: " << static_cast<int>(session_id)
                 << ", message_id: " << message_id);
   packet->set_frame_data(FRAME_DATA_FIRST);
-  messageId_map[message_id] = {packet, date_time::getCurrentTime()};
+  const ProtocolFrameData frame_data = {packet, date_time::getCurrentTime()};
+  waiting_frames_.push_back(std::make_pair(key, frame_data));
+  multiframes_map_[key] = --waiting_frames_.end();
   return RESULT_OK;
 }
 
@@ -209,20 +192,16 @@ RESULT_CODE MultiFrameBuilder::HandleConsecutiveFrame(
   SDL_LOG_DEBUG("Handling CONSECUTIVE frame: " << packet);
 
   const ConnectionID connection_id = packet->connection_id();
-  MultiFrameMap::iterator connection_it = multiframes_map_.find(connection_id);
-  if (connection_it == multiframes_map_.end()) {
+  if (0u == connections_.count(connection_id)) {
     SDL_LOG_ERROR("Unknown connection_id: " << connection_id);
     return RESULT_FAIL;
   }
-  SessionToFrameMap& session_map = connection_it->second;
 
   const SessionID session_id = packet->session_id();
-  // No need to verify session existance
-  MessageIDToFrameMap& messageId_map = session_map[session_id];
-
   const MessageID message_id = packet->message_id();
-  MessageIDToFrameMap::iterator messageId_it = messageId_map.find(message_id);
-  if (messageId_it == messageId_map.end()) {
+  const MultiFrameKey key = {connection_id, session_id, message_id};
+  const MultiFrameMap::iterator map_it = multiframes_map_.find(key);
+  if (map_it == multiframes_map_.end()) {
     SDL_LOG_ERROR("No waiting message for connection_id: "
                   << connection_id
                   << ", session_id: " << static_cast<int>(session_id)
@@ -230,7 +209,8 @@ RESULT_CODE MultiFrameBuilder::HandleConsecutiveFrame(
     return RESULT_FAIL;
   }
 
-  ProtocolFrameData& frame_data = messageId_it->second;
+  const MultiFrameList::iterator list_it = map_it->second;
+  ProtocolFrameData& frame_data = list_it->second;
   ProtocolFramePtr assembling_frame = frame_data.frame;
   DCHECK_OR_RETURN(packet->message_id() == assembling_frame->message_id(),
                    RESULT_FAIL);
@@ -278,7 +258,16 @@ RESULT_CODE MultiFrameBuilder::HandleConsecutiveFrame(
   }
   SDL_LOG_TRACE("Assembled frame with payload size: "
                 << assembling_frame->payload_size());
+  if (is_last_consecutive && assembling_frame->payload_size() > 0u) {
+    SDL_LOG_TRACE("Ready frame: " << assembling_frame);
+    ready_frames_.push_back(assembling_frame);
+    multiframes_map_.erase(map_it);
+    waiting_frames_.erase(list_it);
+    return RESULT_OK;
+  }
   frame_data.append_time = date_time::getCurrentTime();
+  // Keep list ordered by append time
+  waiting_frames_.splice(waiting_frames_.end(), waiting_frames_, list_it);
   return RESULT_OK;
 }
 
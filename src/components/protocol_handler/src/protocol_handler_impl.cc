@@ -1027,9 +1027,19 @@ void ProtocolHandlerImpl::OnTMMessageReceived(const RawMessagePtr tm_message) {
 
   RESULT_CODE result;
   size_t malformed_occurs = 0u;
+#ifdef TELEMETRY_MONITOR
+  const date_time::TimeDuration parse_start_time =
+      date_time::getCurrentTime();
+#endif  // TELEMETRY_MONITOR
   const ProtocolFramePtrList protocol_frames =
       incoming_data_handler_.ProcessData(
           *tm_message, result, &malformed_occurs);
+#ifdef TELEMETRY_MONITOR
+  if (metric_observer_) {
+    metric_observer_->OnStageFinished(telemetry_monitor::kFrameParse,
+                                      parse_start_time);
+  }
+#endif  // TELEMETRY_MONITOR
   SDL_LOG_TRACE("Processed " << protocol_frames.size() << " frames");
   if (result != RESULT_OK) {
     if (result == RESULT_MALFORMED_OCCURS) {
@@ -1505,8 +1515,7 @@ RESULT_CODE ProtocolHandlerImpl::HandleSingleFrameMessage(
 
   const RawMessagePtr rawMessage(new RawMessage(connection_key,
                                                 packet->protocol_version(),
-                                                packet->data(),
-                                                packet->total_data_bytes(),
+                                                packet->data_buffer(),
                                                 packet->protection_flag(),
                                                 packet->service_type(),
                                                 packet->payload_size()));
@@ -1540,9 +1549,18 @@ RESULT_CODE ProtocolHandlerImpl::HandleMultiFrameMessage(
     packet->set_connection_id(st.primary_transport);
   }
 
+#ifdef TELEMETRY_MONITOR
+  const date_time::TimeDuration start_time = date_time::getCurrentTime();
+#endif  // TELEMETRY_MONITOR
   if (multiframe_builder_.AddFrame(packet) != RESULT_OK) {
     SDL_LOG_WARN("Frame assembling issue");
   }
+#ifdef TELEMETRY_MONITOR
+  if (metric_observer_) {
+    metric_observer_->OnStageFinished(telemetry_monitor::kMultiFrameAssembly,
+                                      start_time);
+  }
+#endif  // TELEMETRY_MONITOR
 
   return RESULT_OK;
 }
@@ -2178,8 +2196,7 @@ void ProtocolHandlerImpl::PopValidAndExpiredMultiframes() {
                                  << connection_key);
     const RawMessagePtr rawMessage(new RawMessage(connection_key,
                                                   frame->protocol_version(),
-                                                  frame->data(),
-                                                  frame->total_data_bytes(),
+                                                  frame->data_buffer(),
                                                   frame->protection_flag(),
                                                   frame->service_type(),
                                                   frame->payload_size()));
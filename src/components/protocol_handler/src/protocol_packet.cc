@@ -72,11 +72,7 @@ std::string StringifyFrameType(uint8_t type) {
 }
 }  // namespace
 
-ProtocolPacket::ProtocolData::ProtocolData() : data(NULL), totalDataBytes(0u) {}
-
-ProtocolPacket::ProtocolData::~ProtocolData() {
-  delete[] data;
-}
+ProtocolPacket::ProtocolData::ProtocolData() : buffer(), totalDataBytes(0u) {}
 
 ProtocolPacket::ProtocolHeader::ProtocolHeader()
     : version(0x00)
@@ -443,27 +439,25 @@ RawMessagePtr ProtocolPacket::serializePacket() const {
     header[offset++] = packet_header_.messageId;
   }
 
+  const uint8_t* const payload = packet_data_.buffer.data();
   size_t total_packet_size =
-      offset + (packet_data_.data ? packet_data_.totalDataBytes : 0);
+      offset + (payload ? packet_data_.totalDataBytes : 0);
 
-  uint8_t* packet = new (std::nothrow) uint8_t[total_packet_size];
-  if (!packet) {
+  utils::SharedBuffer packet(total_packet_size);
+  if (packet.empty()) {
     return RawMessagePtr();
   }
 
-  memcpy(packet, header, offset);
-  if (packet_data_.data && packet_data_.totalDataBytes) {
-    memcpy(packet + offset, packet_data_.data, packet_data_.totalDataBytes);
+  memcpy(packet.data(), header, offset);
+  if (payload && packet_data_.totalDataBytes) {
+    memcpy(packet.data() + offset, payload, packet_data_.totalDataBytes);
   }
 
   const RawMessagePtr out_message(new RawMessage(connection_id(),
                                                  packet_header_.version,
                                                  packet,
-                                                 total_packet_size,
                                                  false,
                                                  packet_header_.serviceType));
-
-  delete[] packet;
   return out_message;
 }
 
@@ -471,8 +465,10 @@ RESULT_CODE ProtocolPacket::appendData(uint8_t* chunkData,
                                        uint32_t chunkDataSize) {
   if (payload_size_ + chunkDataSize <= packet_data_.totalDataBytes) {
     if (chunkData && chunkDataSize > 0) {
-      if (packet_data_.data) {
-        memcpy(packet_data_.data + payload_size_, chunkData, chunkDataSize);
+      if (packet_data_.buffer.data()) {
+        memcpy(packet_data_.buffer.data() + payload_size_,
+               chunkData,
+               chunkDataSize);
         payload_size_ += chunkDataSize;
         return RESULT_OK;
       }
@@ -501,10 +497,8 @@ bool ProtocolPacket::operator==(const ProtocolPacket& other) const {
       return true;
     }
     // Compare payload data
-    if (packet_data_.data && other.packet_data_.data &&
-        0 == memcmp(packet_data_.data,
-                    other.packet_data_.data,
-                    packet_data_.totalDataBytes)) {
+    if (data() && other.data() &&
+        0 == memcmp(data(), other.data(), packet_data_.totalDataBytes)) {
       return true;
     }
   }
@@ -526,6 +520,20 @@ RESULT_CODE ProtocolPacket::deserializePacket(const uint8_t* message,
                                               const size_t messageSize) {
   SDL_LOG_AUTO_TRACE();
   DCHECK_OR_RETURN(message, RESULT_FAIL);
+  return DeserializePacket(message, messageSize, utils::SharedBuffer());
+}
+
+RESULT_CODE ProtocolPacket::deserializePacket(
+    const utils::SharedBuffer& message) {
+  SDL_LOG_AUTO_TRACE();
+  DCHECK_OR_RETURN(message.data(), RESULT_FAIL);
+  return DeserializePacket(message.data(), message.size(), message);
+}
+
+RESULT_CODE ProtocolPacket::DeserializePacket(
+    const uint8_t* message,
+    const size_t messageSize,
+    const utils::SharedBuffer& owner) {
   packet_header_.deserialize(message, messageSize);
   const uint8_t offset = packet_header_.version == PROTOCOL_VERSION_1
                              ? PROTOCOL_HEADER_V1_SIZE
@@ -543,13 +551,14 @@ RESULT_CODE ProtocolPacket::deserializePacket(const uint8_t* message,
     payload_size_ = 0;
     const uint8_t* data = message + offset;
     HandleRawFirstFrameData(data);
-    if (0 == packet_data_.data) {
+    if (0 == packet_data_.buffer.data()) {
       return RESULT_FAIL;
     }
   } else if (dataPayloadSize) {
-    delete[] packet_data_.data;
-    packet_data_.data = new (std::nothrow) uint8_t[dataPayloadSize];
-    memcpy(packet_data_.data, message + offset, dataPayloadSize);
+    packet_data_.buffer =
+        owner.empty() ? utils::SharedBuffer::Copy(message + offset,
+                                                  dataPayloadSize)
+                      : owner.Slice(offset, dataPayloadSize);
     payload_size_ = dataPayloadSize;
   }
 
@@ -597,16 +606,19 @@ uint32_t ProtocolPacket::message_id() const {
 }
 
 uint8_t* ProtocolPacket::data() const {
-  return packet_data_.data;
+  return packet_data_.buffer.data();
+}
+
+const utils::SharedBuffer& ProtocolPacket::data_buffer() const {
+  return packet_data_.buffer;
 }
 
 void ProtocolPacket::set_total_data_bytes(size_t dataBytes) {
   SDL_LOG_AUTO_TRACE();
   SDL_LOG_DEBUG("Data bytes : " << dataBytes);
   if (dataBytes) {
-    delete[] packet_data_.data;
-    packet_data_.data = new (std::nothrow) uint8_t[dataBytes];
-    packet_data_.totalDataBytes = packet_data_.data ? dataBytes : 0u;
+    packet_data_.buffer = utils::SharedBuffer(dataBytes);
+    packet_data_.totalDataBytes = packet_data_.buffer.size();
   }
 }
 
@@ -614,11 +626,8 @@ void ProtocolPacket::set_data(const uint8_t* const new_data,
                               const size_t new_data_size) {
   if (new_data_size && new_data) {
     packet_header_.dataSize = packet_data_.totalDataBytes = new_data_size;
-    delete[] packet_data_.data;
-    packet_data_.data = new (std::nothrow) uint8_t[packet_data_.totalDataBytes];
-    if (packet_data_.data) {
-      memcpy(packet_data_.data, new_data, packet_data_.totalDataBytes);
-    } else {
+    packet_data_.buffer = utils::SharedBuffer::Copy(new_data, new_data_size);
+    if (packet_data_.buffer.empty()) {
       // TODO(EZamakhov): add log info about memory problem
       packet_header_.dataSize = packet_data_.totalDataBytes = 0u;
     }
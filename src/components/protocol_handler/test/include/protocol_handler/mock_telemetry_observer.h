@@ -46,6 +46,9 @@ class MockPHTelemetryObserver : public ::protocol_handler::PHTelemetryObserver {
                void(uint32_t message_id,
                     const date_time::TimeDuration& start_time));
   MOCK_METHOD1(EndMessageProcess, void(std::shared_ptr<MessageMetric> m));
+  MOCK_METHOD2(OnStageFinished,
+               void(const telemetry_monitor::TelemetryStage stage,
+                    const date_time::TimeDuration& begin));
 };
 
 }  // namespace protocol_handler_test
@@ -200,6 +200,62 @@ TEST_F(IncomingDataHandlerTest, Heartbeat_pack) {
   }
 }
 
+TEST_F(IncomingDataHandlerTest, SingleFrames_PayloadNotCopied) {
+  const ProtocolPacket packet(uid1,
+                              PROTOCOL_VERSION_3,
+                              PROTECTION_OFF,
+                              FRAME_TYPE_SINGLE,
+                              kRpc,
+                              FRAME_DATA_SINGLE,
+                              some_session_id,
+                              some_data2_size,
+                              some_message_id,
+                              some_data2);
+  AppendPacketToTMData(packet);
+  AppendPacketToTMData(packet);
+  const RawMessage message(uid1, 0, tm_data.data(), tm_data.size(), false);
+  actual_frames =
+      data_handler.ProcessData(message, result_code, &malformed_occurs);
+  EXPECT_EQ(RESULT_OK, result_code);
+  ASSERT_EQ(2u, actual_frames.size());
+  const uint8_t* const message_end = message.data() + message.data_size();
+  for (FrameList::iterator it = actual_frames.begin();
+       it != actual_frames.end();
+       ++it) {
+    EXPECT_EQ(packet, **it);
+    // Payload is a view of the received message
+    EXPECT_GT((*it)->data(), message.data());
+    EXPECT_LT((*it)->data(), message_end);
+  }
+}
+
+TEST_F(IncomingDataHandlerTest, GarbageBeforeSplitFrame_ResyncedOnce) {
+  const ProtocolPacket packet(uid1,
+                              PROTOCOL_VERSION_3,
+                              PROTECTION_OFF,
+                              FRAME_TYPE_SINGLE,
+                              kMobileNav,
+                              FRAME_DATA_SINGLE,
+                              some_session_id,
+                              some_data2_size,
+                              some_message_id,
+                              some_data2);
+  // Bytes with valid version but invalid service type and frame type
+  tm_data.assign(1000u, 0x3F);
+  AppendPacketToTMData(packet);
+  const size_t first_part_size = tm_data.size() / 2;
+  ProcessData(uid1, &tm_data[0], first_part_size);
+  EXPECT_EQ(RESULT_MALFORMED_OCCURS, result_code);
+  EXPECT_EQ(1u, malformed_occurs);
+  EXPECT_TRUE(actual_frames.empty());
+
+  ProcessData(
+      uid1, &tm_data[first_part_size], tm_data.size() - first_part_size);
+  EXPECT_EQ(0u, malformed_occurs);
+  ASSERT_EQ(1u, actual_frames.size());
+  EXPECT_EQ(packet, *actual_frames.front());
+}
+
 TEST_F(IncomingDataHandlerTest, MixedPayloadData_TwoConnections) {
   FrameList mobile_packets;
   // single packet RPC
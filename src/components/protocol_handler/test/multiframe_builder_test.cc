@@ -512,6 +512,29 @@ TEST_F(MultiFrameBuilderTest, FrameExpired_OneMSec) {
   EXPECT_EQ(first_frame, list.front());
 }
 
+TEST_F(MultiFrameBuilderTest, FrameExpired_OnlyStaleFramesPopped) {
+  multiframe_builder_.set_waiting_timeout(50);
+
+  ASSERT_FALSE(test_data_map_.empty());
+  const ConnectionID& connection_id = test_data_map_.begin()->first;
+  MessageIDToMutiframeDataTestMap& messageId_map =
+      test_data_map_.begin()->second.begin()->second;
+  ASSERT_LT(1u, messageId_map.size());
+  ASSERT_TRUE(multiframe_builder_.AddConnection(connection_id));
+
+  MessageIDToMutiframeDataTestMap::iterator it = messageId_map.begin();
+  const ProtocolFramePtr stale_frame = it->second.multiframes.front();
+  const ProtocolFramePtr fresh_frame = (++it)->second.multiframes.front();
+
+  EXPECT_EQ(RESULT_OK, multiframe_builder_.AddFrame(stale_frame));
+  usleep(60000);
+  EXPECT_EQ(RESULT_OK, multiframe_builder_.AddFrame(fresh_frame));
+
+  const ProtocolFramePtrList& list = multiframe_builder_.PopMultiframes();
+  ASSERT_EQ(1u, list.size());
+  EXPECT_EQ(stale_frame, list.front());
+}
+
 TEST_F(MultiFrameBuilderTest, RemoveConnection_NoConnection_ResultFail) {
   // Arrange
   const ConnectionID& connection_id = test_data_map_.begin()->first;
@@ -33,6 +33,7 @@
 #ifndef SRC_COMPONENTS_RESUMPTION_INCLUDE_RESUMPTION_LAST_STATE_IMPL_H_
 #define SRC_COMPONENTS_RESUMPTION_INCLUDE_RESUMPTION_LAST_STATE_IMPL_H_
 
+#include <stdint.h>
 #include <string>
 
 #include "resumption/last_state.h"
@@ -79,15 +80,92 @@ class LastStateImpl : public LastState {
    */
   void set_dictionary(const Json::Value& dictionary) OVERRIDE;
 
+  /**
+   * @brief Get the dictionary without copying it
+   * @return Reference to the dictionary instance
+   */
+  const Json::Value& dictionary_ref() const OVERRIDE;
+
+  /**
+   * @brief Sets single value of the dictionary and records the change
+   * to the journal
+   * @param path Array of member names and array indexes
+   * @param value New json value to be set
+   */
+  void set_value(const Json::Value& path, const Json::Value& value) OVERRIDE;
+
+  /**
+   * @brief Removes single value of the dictionary and records the change
+   * to the journal
+   * @param path Array of member names and array indexes
+   */
+  void remove_value(const Json::Value& path) OVERRIDE;
+
  private:
   /**
-   * @brief Load dictionary from filesystem
+   * @brief Load dictionary from filesystem and replay the journal over it
    */
   void LoadFromFileSystem();
 
+  /**
+   * @brief Replays changes recorded to the journal
+   * @param journal Content of the journal file
+   * @return false if the journal has a broken record, records following it
+   * are ignored
+   */
+  bool ReplayJournal(const std::string& journal);
+
+  /**
+   * @brief Applies single journal record to the dictionary
+   * @return false if the record is malformed
+   */
+  bool ApplyChange(const Json::Value& change);
+
+  /**
+   * @brief Serializes whole dictionary along with the generation number
+   * @param generation Generation of the snapshot
+   * @return Styled dictionary
+   */
+  std::string SnapshotData(const uint64_t generation);
+
+  /**
+   * @brief Replaces the snapshot file and removes the journal
+   * @param snapshot Styled dictionary
+   * @return false if the snapshot is not written or the journal is not
+   * removed, the snapshot has to be written again on the next save then
+   */
+  bool WriteSnapshot(const std::string& snapshot);
+
+  std::string SnapshotPath() const;
+  std::string JournalPath() const;
+
   Json::Value dictionary_;
   mutable sync_primitives::Lock dictionary_lock_;
 
+  /**
+   * @brief Changes made since the last save, guarded by dictionary_lock_
+   */
+  Json::Value pending_changes_;
+
+  /**
+   * @brief Whole dictionary has to be written on the next save, guarded by
+   * dictionary_lock_
+   */
+  bool snapshot_required_;
+
+  /**
+   * @brief Generation of the last written snapshot, stored in both snapshot
+   * and the journal header, so that stale journal is not replayed
+   */
+  uint64_t generation_;
+
+  /**
+   * @brief Keeps journal appends in order of saves
+   */
+  sync_primitives::Lock save_lock_;
+  uint64_t snapshot_size_;
+  uint64_t journal_size_;
+
   std::string app_storage_folder_;
   std::string app_info_storage_;
 
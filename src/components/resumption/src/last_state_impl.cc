@@ -31,6 +31,10 @@
  */
 
 #include "resumption/last_state_impl.h"
+
+#include <algorithm>
+#include <sstream>
+
 #include "utils/file_system.h"
 #include "utils/jsoncpp_reader_wrapper.h"
 #include "utils/logger.h"
@@ -39,9 +43,100 @@ namespace resumption {
 
 SDL_CREATE_LOG_VARIABLE("Resumption")
 
+namespace {
+const char* kJournalExtension = ".journal";
+const char* kTemporaryExtension = ".tmp";
+const char* kGenerationKey = "last_state_generation";
+const char* kSetKey = "set";
+const char* kRemoveKey = "remove";
+const char* kValueKey = "value";
+
+/**
+ * @brief Journal is compacted into the snapshot as soon as it grows bigger
+ * than the snapshot itself, but not before it reaches this size
+ */
+const uint64_t kMinJournalSizeToCompact = 64 * 1024;
+
+bool IsIndex(const Json::Value& element) {
+  return element.isIntegral() && element.isConvertibleTo(Json::uintValue);
+}
+
+/**
+ * @brief Finds value addressed by path elements preceding the last one
+ * @param create Creates missing containers on the path if true, values of
+ * mismatching type are replaced
+ * @return Pointer to found value or NULL
+ */
+Json::Value* FindParent(Json::Value& root,
+                        const Json::Value& path,
+                        const bool create) {
+  Json::Value* current = &root;
+  for (Json::ArrayIndex i = 0; i + 1 < path.size(); ++i) {
+    const Json::Value& element = path[i];
+    if (element.isString()) {
+      if (!current->isObject()) {
+        if (!create) {
+          return NULL;
+        }
+        *current = Json::Value(Json::objectValue);
+      }
+      current = &(*current)[element.asString()];
+    } else if (IsIndex(element)) {
+      const Json::ArrayIndex index = element.asUInt();
+      if (!current->isArray()) {
+        if (!create) {
+          return NULL;
+        }
+        *current = Json::Value(Json::arrayValue);
+      }
+      if (!create && index >= current->size()) {
+        return NULL;
+      }
+      current = &(*current)[index];
+    } else {
+      return NULL;
+    }
+  }
+  return current;
+}
+
+bool SetValue(Json::Value& root,
+              const Json::Value& path,
+              const Json::Value& value) {
+  if (!path.isArray() || path.empty()) {
+    return false;
+  }
+  Json::Value* parent = FindParent(root, path, true);
+  if (!parent) {
+    return false;
+  }
+  const Json::Value& last = path[path.size() - 1];
+  if (last.isString()) {
+    if (!parent->isObject()) {
+      *parent = Json::Value(Json::objectValue);
+    }
+    (*parent)[last.asString()] = value;
+    return true;
+  }
+  if (IsIndex(last)) {
+    if (!parent->isArray()) {
+      *parent = Json::Value(Json::arrayValue);
+    }
+    (*parent)[last.asUInt()] = value;
+    return true;
+  }
+  return false;
+}
+}  // namespace
+
 LastStateImpl::LastStateImpl(const std::string& app_storage_folder,
                              const std::string& app_info_storage)
-    : app_storage_folder_(app_storage_folder)
+    : pending_changes_(Json::arrayValue)
+    , snapshot_required_(false)
+    , generation_(0)
+    , snapshot_size_(0)
+    , journal_size_(0)
+    , app_storage_folder_(app_storage_folder)
     , app_info_storage_(app_info_storage) {
   LoadFromFileSystem();
   SDL_LOG_AUTO_TRACE();
@@ -54,40 +149,196 @@ LastStateImpl::~LastStateImpl() {
 
 void LastStateImpl::SaveToFileSystem() {
   SDL_LOG_AUTO_TRACE();
+  sync_primitives::AutoLock save_lock(save_lock_);
 
-  std::string styled_string;
+  bool write_snapshot = false;
+  std::string data;
   {
     sync_primitives::AutoLock lock(dictionary_lock_);
-    styled_string = dictionary_.toStyledString();
-  }
+    if (!snapshot_required_ && pending_changes_.empty()) {
+      SDL_LOG_DEBUG("Nothing changed since the last save");
+      return;
+    }
+
+    if (!snapshot_required_) {
+      Json::StreamWriterBuilder writer_builder;
+      writer_builder["indentation"] = "";
+      if (0 == journal_size_) {
+        // Journal is valid only over the snapshot of the same generation
+        Json::Value header(Json::objectValue);
+        header[kGenerationKey] = Json::Value::UInt64(generation_);
+        data += Json::writeString(writer_builder, header);
+        data += '\n';
+      }
+      for (Json::ArrayIndex i = 0; i < pending_changes_.size(); ++i) {
+        data += Json::writeString(writer_builder, pending_changes_[i]);
+        data += '\n';
+      }
+    }
 
-  const std::string full_path =
-      !app_storage_folder_.empty()
-          ? app_storage_folder_ + "/" + app_info_storage_
-          : app_info_storage_;
+    write_snapshot =
+        snapshot_required_ ||
+        journal_size_ + data.size() >
+            std::max(kMinJournalSizeToCompact, snapshot_size_);
+    if (write_snapshot) {
+      data = SnapshotData(generation_ + 1);
+    }
+    pending_changes_ = Json::Value(Json::arrayValue);
+    snapshot_required_ = false;
+  }
 
-  const std::vector<uint8_t> char_vector_pdata(styled_string.begin(),
-                                               styled_string.end());
   DCHECK(file_system::CreateDirectoryRecursively(app_storage_folder_));
-  SDL_LOG_INFO("LastState::SaveToFileSystem " << app_info_storage_
-                                              << full_path);
-  DCHECK(file_system::Write(full_path, char_vector_pdata));
+  const std::vector<uint8_t> char_vector_pdata(data.begin(), data.end());
+  if (write_snapshot) {
+    SDL_LOG_INFO("LastState::SaveToFileSystem " << SnapshotPath());
+    if (WriteSnapshot(data)) {
+      return;
+    }
+  } else {
+    SDL_LOG_DEBUG("LastState::SaveToFileSystem " << JournalPath());
+    if (file_system::Write(
+            JournalPath(), char_vector_pdata, std::ios_base::app)) {
+      journal_size_ += data.size();
+      return;
+    }
+  }
+
+  SDL_LOG_ERROR("Failed to save last state, will retry on the next save");
+  sync_primitives::AutoLock lock(dictionary_lock_);
+  snapshot_required_ = true;
+}
+
+std::string LastStateImpl::SnapshotData(const uint64_t generation) {
+  if (!dictionary_.isObject()) {
+    Json::Value snapshot(Json::objectValue);
+    snapshot[kGenerationKey] = Json::Value::UInt64(generation);
+    return snapshot.toStyledString();
+  }
+  // Member is added in place to not copy the whole dictionary
+  dictionary_[kGenerationKey] = Json::Value::UInt64(generation);
+  const std::string snapshot = dictionary_.toStyledString();
+  dictionary_.removeMember(kGenerationKey);
+  return snapshot;
+}
+
+bool LastStateImpl::WriteSnapshot(const std::string& snapshot) {
+  const std::vector<uint8_t> char_vector_pdata(snapshot.begin(),
+                                               snapshot.end());
+  // Snapshot is replaced at once, so it is never seen partially written
+  const std::string temporary_path = SnapshotPath() + kTemporaryExtension;
+  if (!file_system::Write(temporary_path, char_vector_pdata) ||
+      !file_system::MoveFile(temporary_path, SnapshotPath())) {
+    return false;
+  }
+  ++generation_;
+  snapshot_size_ = snapshot.size();
+  // Journal left from the previous generation is never replayed, but it has
+  // to be gone before the next append as that would follow its records
+  if (file_system::FileExists(JournalPath()) &&
+      !file_system::DeleteFile(JournalPath())) {
+    SDL_LOG_WARN("Failed attempt to delete " << JournalPath());
+    return false;
+  }
+  journal_size_ = 0;
+  return true;
 }
 
 void LastStateImpl::LoadFromFileSystem() {
-  const std::string full_path =
-      !app_storage_folder_.empty()
-          ? app_storage_folder_ + "/" + app_info_storage_
-          : app_info_storage_;
   std::string buffer;
-  const bool result = file_system::ReadFile(full_path, buffer);
+  const bool result = file_system::ReadFile(SnapshotPath(), buffer);
   utils::JsonReader reader;
 
   if (result && reader.parse(buffer, &dictionary_)) {
+    if (dictionary_.isObject()) {
+      Json::Value generation;
+      if (dictionary_.removeMember(kGenerationKey, &generation) &&
+          generation.isUInt64()) {
+        generation_ = generation.asUInt64();
+      }
+    }
     SDL_LOG_INFO("Valid last state was found." << dictionary_.toStyledString());
+    snapshot_size_ = buffer.size();
+  } else {
+    SDL_LOG_WARN("No valid last state was found.");
+  }
+
+  std::string journal;
+  if (!file_system::ReadFile(JournalPath(), journal) || journal.empty()) {
     return;
   }
-  SDL_LOG_WARN("No valid last state was found.");
+  if (!ReplayJournal(journal)) {
+    SDL_LOG_WARN("Last state journal is stale or broken, rest is ignored");
+  }
+  // Compact on the next save, so that appends never follow a broken record
+  journal_size_ = journal.size();
+  snapshot_required_ = true;
+}
+
+bool LastStateImpl::ReplayJournal(const std::string& journal) {
+  SDL_LOG_AUTO_TRACE();
+  std::istringstream stream(journal);
+  std::string line;
+  utils::JsonReader reader;
+  size_t replayed = 0;
+  bool header_found = false;
+  while (std::getline(stream, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    Json::Value change;
+    if (!header_found) {
+      // Journal of other generation was written over another snapshot
+      if (!reader.parse(line, &change) || !change.isObject() ||
+          !change[kGenerationKey].isUInt64() ||
+          generation_ != change[kGenerationKey].asUInt64()) {
+        SDL_LOG_WARN("Journal doesn't match snapshot generation "
+                     << generation_);
+        return false;
+      }
+      header_found = true;
+      continue;
+    }
+    // Last record may be incomplete if SDL was stopped while appending it
+    if (!reader.parse(line, &change) || !ApplyChange(change)) {
+      SDL_LOG_WARN("Broken journal record after " << replayed << " records");
+      return false;
+    }
+    ++replayed;
+  }
+  SDL_LOG_INFO("Replayed " << replayed << " last state journal records");
+  return true;
+}
+
+bool LastStateImpl::ApplyChange(const Json::Value& change) {
+  if (!change.isObject()) {
+    return false;
+  }
+  if (change.isMember(kSetKey) && change.isMember(kValueKey)) {
+    return SetValue(dictionary_, change[kSetKey], change[kValueKey]);
+  }
+  if (change.isMember(kRemoveKey)) {
+    const Json::Value& path = change[kRemoveKey];
+    if (!path.isArray() || path.empty()) {
+      return false;
+    }
+    Json::Value* parent = FindParent(dictionary_, path, false);
+    const Json::Value& last = path[path.size() - 1];
+    if (parent && parent->isObject() && last.isString()) {
+      parent->removeMember(last.asString());
+    }
+    return true;
+  }
+  return false;
+}
+
+std::string LastStateImpl::SnapshotPath() const {
+  return !app_storage_folder_.empty()
+             ? app_storage_folder_ + "/" + app_info_storage_
+             : app_info_storage_;
+}
+
+std::string LastStateImpl::JournalPath() const {
+  return SnapshotPath() + kJournalExtension;
 }
 
 void LastStateImpl::RemoveFromFileSystem() {
@@ -95,6 +346,14 @@ void LastStateImpl::RemoveFromFileSystem() {
   if (!file_system::DeleteFile(app_info_storage_)) {
     SDL_LOG_WARN("Failed attempt to delete " << app_info_storage_);
   }
+  if (file_system::FileExists(JournalPath()) &&
+      !file_system::DeleteFile(JournalPath())) {
+    SDL_LOG_WARN("Failed attempt to delete " << JournalPath());
+  }
+  sync_primitives::AutoLock lock(dictionary_lock_);
+  journal_size_ = 0;
+  pending_changes_ = Json::Value(Json::arrayValue);
+  snapshot_required_ = true;
 }
 
 Json::Value LastStateImpl::dictionary() const {
@@ -102,11 +361,79 @@ Json::Value LastStateImpl::dictionary() const {
   return dictionary_;
 }
 
+const Json::Value& LastStateImpl::dictionary_ref() const {
+  return dictionary_;
+}
+
 void LastStateImpl::set_dictionary(const Json::Value& dictionary) {
   DCHECK(dictionary.type() == Json::objectValue ||
          dictionary.type() == Json::nullValue);
   sync_primitives::AutoLock lock(dictionary_lock_);
   dictionary_ = dictionary;
+  pending_changes_ = Json::Value(Json::arrayValue);
+  snapshot_required_ = true;
+}
+
+void LastStateImpl::set_value(const Json::Value& path,
+                              const Json::Value& value) {
+  sync_primitives::AutoLock lock(dictionary_lock_);
+  if (!SetValue(dictionary_, path, value)) {
+    SDL_LOG_ERROR("Invalid last state path " << path.toStyledString());
+    return;
+  }
+  if (snapshot_required_) {
+    return;
+  }
+  Json::Value change(Json::objectValue);
+  change[kSetKey] = path;
+  change[kValueKey] = value;
+  pending_changes_.append(change);
+}
+
+void LastStateImpl::remove_value(const Json::Value& path) {
+  sync_primitives::AutoLock lock(dictionary_lock_);
+  if (!path.isArray() || path.empty()) {
+    SDL_LOG_ERROR("Invalid last state path " << path.toStyledString());
+    return;
+  }
+  Json::Value* parent = FindParent(dictionary_, path, false);
+  if (!parent) {
+    return;
+  }
+  const Json::Value& last = path[path.size() - 1];
+  if (parent->isObject() && last.isString()) {
+    parent->removeMember(last.asString());
+    if (!snapshot_required_) {
+      Json::Value change(Json::objectValue);
+      change[kRemoveKey] = path;
+      pending_changes_.append(change);
+    }
+    return;
+  }
+  if (!parent->isArray() || !IsIndex(last) ||
+      last.asUInt() >= parent->size()) {
+    return;
+  }
+  Json::Value removed;
+  parent->removeIndex(last.asUInt(), &removed);
+  if (snapshot_required_) {
+    return;
+  }
+  // Removal by index shifts following elements, so whole array is recorded
+  // to keep journal records idempotent
+  Json::Value parent_path(Json::arrayValue);
+  for (Json::ArrayIndex i = 0; i + 1 < path.size(); ++i) {
+    parent_path.append(path[i]);
+  }
+  if (parent_path.empty()) {
+    snapshot_required_ = true;
+    pending_changes_ = Json::Value(Json::arrayValue);
+    return;
+  }
+  Json::Value change(Json::objectValue);
+  change[kSetKey] = parent_path;
+  change[kValueKey] = *parent;
+  pending_changes_.append(change);
 }
 
 }  // namespace resumption
@@ -67,6 +67,7 @@ class LastStateTest : public ::testing::Test {
 
   void TearDown() OVERRIDE {
     EXPECT_TRUE(file_system::DeleteFile((app_info_dat_file_)));
+    file_system::DeleteFile(app_info_dat_file_ + ".journal");
   }
 
   const std::string empty_dictionary_;
@@ -121,6 +122,93 @@ TEST_F(LastStateTest, SetGetData) {
       tcp_adapter_info.toStyledString());
 }
 
+TEST_F(LastStateTest, SetRemoveValue_ChangesRestoredFromJournal) {
+  Value app(objectValue);
+  app["app_id"] = "app1";
+  app["time_stamp"] = 1;
+
+  Value list_path(arrayValue);
+  list_path.append("resumption");
+  list_path.append("resume_app_list");
+  Value app_path = list_path;
+  app_path.append(0u);
+  last_state_.set_value(app_path, app);
+
+  app["app_id"] = "app2";
+  app_path[2] = 1u;
+  last_state_.set_value(app_path, app);
+
+  Value time_stamp_path = app_path;
+  time_stamp_path.append("time_stamp");
+  last_state_.set_value(time_stamp_path, 2);
+
+  Value ign_off_path(arrayValue);
+  ign_off_path.append("resumption");
+  ign_off_path.append("last_ign_off_time");
+  last_state_.set_value(ign_off_path, 3);
+  last_state_.remove_value(ign_off_path);
+
+  app_path[2] = 0u;
+  last_state_.remove_value(app_path);
+  last_state_.SaveToFileSystem();
+
+  EXPECT_TRUE(file_system::FileExists(app_info_dat_file_ + ".journal"));
+  const Value& expected = last_state_.dictionary_ref();
+  ASSERT_EQ(1u, expected["resumption"]["resume_app_list"].size());
+  EXPECT_EQ("app2",
+            expected["resumption"]["resume_app_list"][0]["app_id"].asString());
+  EXPECT_EQ(
+      2, expected["resumption"]["resume_app_list"][0]["time_stamp"].asInt());
+  EXPECT_FALSE(expected["resumption"].isMember("last_ign_off_time"));
+
+  resumption::LastStateImpl restored_state(kAppStorageFolder,
+                                           kAppInfoStorageFile);
+  EXPECT_EQ(expected, restored_state.dictionary());
+}
+
+TEST_F(LastStateTest, SaveToFileSystem_BrokenJournalRecord_TailIgnored) {
+  Value path(arrayValue);
+  path.append("value");
+  last_state_.set_value(path, 1);
+  last_state_.SaveToFileSystem();
+
+  const std::string broken_record = "{\"set\":[\"value\"],\"val";
+  ASSERT_TRUE(file_system::Write(
+      app_info_dat_file_ + ".journal",
+      std::vector<uint8_t>(broken_record.begin(), broken_record.end()),
+      std::ios_base::app));
+
+  resumption::LastStateImpl restored_state(kAppStorageFolder,
+                                           kAppInfoStorageFile);
+  EXPECT_EQ(1, restored_state.dictionary()["value"].asInt());
+}
+
+TEST_F(LastStateTest, SaveToFileSystem_StaleJournal_NotReplayed) {
+  Value path(arrayValue);
+  path.append("value");
+  last_state_.set_value(path, 1);
+  last_state_.SaveToFileSystem();
+
+  const std::string journal_file = app_info_dat_file_ + ".journal";
+  std::string stale_journal;
+  ASSERT_TRUE(file_system::ReadFile(journal_file, stale_journal));
+
+  Value dictionary(objectValue);
+  dictionary["value"] = 2;
+  last_state_.set_dictionary(dictionary);
+  last_state_.SaveToFileSystem();
+  EXPECT_FALSE(file_system::FileExists(journal_file));
+
+  // Journal which removal was interrupted must not override the snapshot
+  ASSERT_TRUE(file_system::Write(
+      journal_file,
+      std::vector<uint8_t>(stale_journal.begin(), stale_journal.end())));
+
+  resumption::LastStateImpl restored_state(kAppStorageFolder,
+                                           kAppInfoStorageFile);
+  EXPECT_EQ(dictionary, restored_state.dictionary());
+}
+
 }  // namespace resumption_test
 }  // namespace components
 }  // namespace test
@@ -35,6 +35,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <boost/optional.hpp>
 #include "utils/macro.h"
@@ -42,6 +43,7 @@
 
 #include "smart_objects/schema_item.h"
 #include "smart_objects/schema_item_parameter.h"
+#include "smart_objects/smart_map.h"
 
 namespace ns_smart_device_link {
 namespace ns_smart_objects {
@@ -101,6 +103,37 @@ struct SMember {
 };
 typedef std::map<std::string, SMember> Members;
 
+/**
+ * @brief Object member as seen by a generated validator.
+ **/
+struct CompiledMember {
+  CompiledMember(const std::string& Key, const SMember* Member);
+
+  /**
+   * @brief Interned member key, lookup by it compares key pointers only.
+   **/
+  SmartKey mKey;
+  const SMember* mMember;
+};
+typedef std::vector<CompiledMember> CompiledMembers;
+
+/**
+ * @brief Validator generated by InterfaceGenerator for a particular object
+ * schema. Must give the same result and report as the generic validation.
+ * @param Object Object to validate.
+ * @param Members Members of the schema in the order of their keys.
+ * @param report object for reporting errors during validation
+ * @param MessageVersion to check mobile RPC version against RPC Spec History
+ * @param allow_unknown_enums true if unknown enum values are valid
+ * @return ns_smart_objects::errors::eType
+ **/
+typedef errors::eType (*CompiledValidator)(
+    const SmartObject& Object,
+    const CompiledMembers& Members,
+    rpc::ValidationReport* report,
+    const utils::SemanticVersion& MessageVersion,
+    const bool allow_unknown_enums);
+
 /**
  * @brief Object schema item.
  **/
@@ -179,6 +212,49 @@ class CObjectSchemaItem : public ISchemaItem {
   void AddMemberSchemaItem(const std::string& member_key,
                            SMember& member) OVERRIDE;
 
+  /**
+   * @brief Sets validator generated for this schema.
+   * Generic validation is used again as soon as members are changed.
+   * @param Validator Generated validator.
+   * @param Keys Member keys the validator was generated for, in the order
+   *             of schema members.
+   * @param KeysCount Amount of keys.
+   * @return false if keys do not match schema members, generic validation
+   *         is kept in this case.
+   **/
+  bool SetCompiledValidator(CompiledValidator Validator,
+                            const char* const* Keys,
+                            const size_t KeysCount);
+
+  /**
+   * @brief Checks that object is a map for generated validators.
+   * @return false if object is not a map, error is reported in this case.
+   **/
+  static bool ValidateMapType(const SmartObject& Object,
+                              rpc::ValidationReport* report);
+
+  /**
+   * @brief Validates member which has no version restrictions nor history
+   * for generated validators.
+   **/
+  static errors::eType ValidatePlainMember(
+      const SmartObject& Object,
+      const CompiledMember& Member,
+      rpc::ValidationReport* report,
+      const utils::SemanticVersion& MessageVersion,
+      const bool allow_unknown_enums);
+
+  /**
+   * @brief Validates member against its schema or history item matching
+   * message version for generated validators.
+   **/
+  static errors::eType ValidateVersionedMember(
+      const SmartObject& Object,
+      const CompiledMember& Member,
+      rpc::ValidationReport* report,
+      const utils::SemanticVersion& MessageVersion,
+      const bool allow_unknown_enums);
+
  protected:
   /**
    * @brief Constructor.
@@ -203,14 +279,43 @@ class CObjectSchemaItem : public ISchemaItem {
    * @return Pointer to correct schema item if item found or nullptr, if item
    *         was not found.
    **/
-  const SMember* GetCorrectMember(const SMember& member,
-                                  const utils::SemanticVersion& messageVersion);
+  static const SMember* GetCorrectMember(
+      const SMember& member, const utils::SemanticVersion& messageVersion);
+
+  /**
+   * @brief Validates single member of object.
+   * @param Key Member key.
+   * @param Field Member value or nullptr if object has no such member.
+   * @param Member Schema member matching message version or nullptr.
+   **/
+  static errors::eType ValidateMember(
+      const std::string& Key,
+      const SmartObject* Field,
+      const SMember* Member,
+      rpc::ValidationReport* report,
+      const utils::SemanticVersion& MessageVersion,
+      const bool allow_unknown_enums);
+
+  /**
+   * @brief Drops generated validator, used when members are changed.
+   **/
+  void ResetCompiledValidator();
 
   /**
    * @brief Map of member name to SMember structure describing the object
    *        member.
    **/
   Members mMembers;
+
+  /**
+   * @brief Generated validator, generic validation is used if not set.
+   **/
+  CompiledValidator mCompiledValidator;
+
+  /**
+   * @brief Members of mMembers in the order the generated validator expects.
+   **/
+  CompiledMembers mCompiledMembers;
   DISALLOW_COPY_AND_ASSIGN(CObjectSchemaItem);
 };
 }  // namespace ns_smart_objects
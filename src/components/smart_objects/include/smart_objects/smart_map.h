@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_COMPONENTS_SMART_OBJECTS_INCLUDE_SMART_OBJECTS_SMART_MAP_H_
+#define SRC_COMPONENTS_SMART_OBJECTS_INCLUDE_SMART_OBJECTS_SMART_MAP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ns_smart_device_link {
+namespace ns_smart_objects {
+
+class SmartObject;
+
+/**
+ * @brief Key of SmartObject map.
+ *
+ * Key strings are interned in a process-wide table, so every key holds
+ * only a pointer to the single shared copy of its string and two keys are
+ * compared by pointer. Strings no key refers to any more are removed from
+ * the table once it has grown twice since the previous cleanup.
+ **/
+class SmartKey {
+ public:
+  /**
+   * @brief Constructs key, interns Key if it was not interned yet
+   **/
+  explicit SmartKey(const std::string& Key);
+  explicit SmartKey(const char* Key);
+
+  SmartKey(const SmartKey& Other);
+  SmartKey& operator=(const SmartKey& Other);
+  ~SmartKey();
+
+  /**
+   * @brief Gets amount of interned strings including unused ones which
+   * are not removed yet
+   **/
+  static size_t interned_count();
+
+  const std::string& str() const;
+
+  operator const std::string&() const {
+    return str();
+  }
+
+  bool operator==(const SmartKey& Other) const {
+    return atom_ == Other.atom_;
+  }
+
+  bool operator!=(const SmartKey& Other) const {
+    return atom_ != Other.atom_;
+  }
+
+  /**
+   * @brief Orders keys by their strings
+   **/
+  bool operator<(const SmartKey& Other) const;
+
+  /**
+   * @brief Hash of key string, the same as used by the key table
+   **/
+  static size_t Hash(const char* Data, const size_t Size);
+
+  struct Atom;
+
+ private:
+  friend class SmartMap;
+
+  Atom* atom_;
+};
+
+std::ostream& operator<<(std::ostream& stream, const SmartKey& key);
+
+/**
+ * @brief Map of SmartObject keyed by SmartKey.
+ *
+ * Keys are kept in a sorted vector next to pointers to key-value nodes, so
+ * iteration order is the same as for std::map with string keys, and
+ * references to values stay valid until the value is erased.
+ * Lookup by SmartKey compares key pointers only. Lookup by string compares
+ * hashes and does not touch the key table.
+ **/
+class SmartMap {
+ public:
+  typedef SmartKey key_type;
+  typedef SmartObject mapped_type;
+  typedef std::pair<const SmartKey, SmartObject> value_type;
+  typedef size_t size_type;
+
+ private:
+  struct Entry {
+    SmartKey::Atom* atom;
+    size_t hash;
+    value_type* node;
+  };
+  typedef std::vector<Entry> Entries;
+
+ public:
+  template <typename Value>
+  class Iterator {
+   public:
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef Value value_type;
+    typedef ptrdiff_t difference_type;
+    typedef Value* pointer;
+    typedef Value& reference;
+
+    Iterator() : it_() {}
+    explicit Iterator(Entries::const_iterator it) : it_(it) {}
+
+    template <typename OtherValue,
+              typename = typename std::enable_if<
+                  std::is_convertible<OtherValue*, Value*>::value>::type>
+    Iterator(const Iterator<OtherValue>& Other) : it_(Other.base()) {}
+
+    reference operator*() const {
+      return *it_->node;
+    }
+    pointer operator->() const {
+      return it_->node;
+    }
+    Iterator& operator++() {
+      ++it_;
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator result(*this);
+      ++it_;
+      return result;
+    }
+    Iterator& operator--() {
+      --it_;
+      return *this;
+    }
+    Iterator operator--(int) {
+      Iterator result(*this);
+      --it_;
+      return result;
+    }
+    template <typename OtherValue>
+    bool operator==(const Iterator<OtherValue>& Other) const {
+      return it_ == Other.base();
+    }
+    template <typename OtherValue>
+    bool operator!=(const Iterator<OtherValue>& Other) const {
+      return it_ != Other.base();
+    }
+
+    Entries::const_iterator base() const {
+      return it_;
+    }
+
+   private:
+    Entries::const_iterator it_;
+  };
+
+  typedef Iterator<value_type> iterator;
+  typedef Iterator<const value_type> const_iterator;
+
+  SmartMap();
+  SmartMap(const SmartMap& Other);
+  SmartMap& operator=(const SmartMap& Other);
+  ~SmartMap();
+
+  iterator begin() {
+    return iterator(entries_.begin());
+  }
+  iterator end() {
+    return iterator(entries_.end());
+  }
+  const_iterator begin() const {
+    return const_iterator(entries_.begin());
+  }
+  const_iterator end() const {
+    return const_iterator(entries_.end());
+  }
+
+  size_type size() const {
+    return entries_.size();
+  }
+  bool empty() const {
+    return entries_.empty();
+  }
+
+  iterator find(const SmartKey& Key);
+  const_iterator find(const SmartKey& Key) const;
+  iterator find(const char* Key, const size_t Size);
+  const_iterator find(const char* Key, const size_t Size) const;
+
+  /**
+   * @brief Gets value by key, inserts Null value if key is not present
+   **/
+  SmartObject& operator[](const SmartKey& Key);
+
+  /**
+   * @brief Removes value by key
+   * @return Amount of removed values
+   **/
+  size_type erase(const SmartKey& Key);
+  void erase(iterator Position);
+
+  void clear();
+
+ private:
+  /**
+   * @brief Maps with up to this amount of keys are searched linearly
+   **/
+  static const size_t kLinearSearchLimit = 16;
+
+  /**
+   * @brief Gets position of key or size() if key is not present
+   **/
+  size_t IndexOf(const SmartKey& Key) const;
+  size_t IndexOf(const char* Key, const size_t Size) const;
+
+  /**
+   * @brief Gets position of first key not less than Key
+   **/
+  size_t LowerBound(const char* Key, const size_t Size) const;
+
+  Entries entries_;
+};
+
+}  // namespace ns_smart_objects
+}  // namespace ns_smart_device_link
+
+#endif  // SRC_COMPONENTS_SMART_OBJECTS_INCLUDE_SMART_OBJECTS_SMART_MAP_H_
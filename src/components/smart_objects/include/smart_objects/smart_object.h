@@ -33,6 +33,7 @@
 #ifndef SRC_COMPONENTS_SMART_OBJECTS_INCLUDE_SMART_OBJECTS_SMART_OBJECT_H_
 #define SRC_COMPONENTS_SMART_OBJECTS_INCLUDE_SMART_OBJECTS_SMART_OBJECT_H_
 
+#include <atomic>
 #include <map>
 #include <set>
 #include <sstream>
@@ -40,6 +41,7 @@
 #include <vector>
 
 #include "rpc_base/validation_report.h"
+#include "smart_objects/smart_map.h"
 #include "smart_objects/smart_schema.h"
 #include "utils/custom_string.h"
 
@@ -117,11 +119,6 @@ enum SmartType {
  **/
 typedef std::vector<SmartObject> SmartArray;
 
-/**
- * @brief SmartMap type
- **/
-typedef std::map<std::string, SmartObject> SmartMap;
-
 /**
  * @brief SmartBinary type
  **/
@@ -159,6 +156,13 @@ class SmartObject FINAL {
    **/
   SmartObject(const SmartObject& Other);
 
+  /**
+   * @brief Move constructor.
+   *
+   * @param Other Object to take data from, it becomes Null.
+   **/
+  SmartObject(SmartObject&& Other) noexcept;
+
   /**
    * @brief Constructor for avoid cast
    * from unknown type
@@ -191,6 +195,14 @@ class SmartObject FINAL {
    **/
   SmartObject& operator=(const SmartObject& Other);
 
+  /**
+   * @brief Move assignment operator.
+   *
+   * @param  Other Other SmartObject, it becomes Null
+   * @return SmartObject&
+   **/
+  SmartObject& operator=(SmartObject&& Other);
+
   /**
    * @brief Comparison operator
    *
@@ -527,9 +539,21 @@ class SmartObject FINAL {
   /**
    * @brief Returns current object converted to array
    *
+   * Array stops being shared with copies of this object.
+   *
+   * @return SmartArray
+   **/
+  SmartArray* asArray();
+
+  /**
+   * @brief Returns current object converted to array
+   *
+   * Array may still be shared with copies of this object, so it is
+   * read without being detached.
+   *
    * @return SmartArray
    **/
-  SmartArray* asArray() const;
+  const SmartArray* asArray() const;
 
   /**
    * @brief Assignment operator for type: binary
@@ -613,6 +637,16 @@ class SmartObject FINAL {
    **/
   const SmartObject& operator[](const char* Key) const;
 
+  /**
+   * @brief Support of map-like access by key interned beforehand, such
+   * lookup does not touch key table and compares key pointers only
+   *
+   * @param  Key Key of element to return
+   * @return SmartObject&
+   **/
+  SmartObject& operator[](const SmartKey& Key);
+  const SmartObject& operator[](const SmartKey& Key) const;
+
   /**
    * @brief Get map element.
    *
@@ -625,6 +659,7 @@ class SmartObject FINAL {
    * @return Element of map or null object if element can't be provided.
    **/
   const SmartObject& getElement(const std::string& Key) const;
+  const SmartObject& getElement(const SmartKey& Key) const;
 
   /**
    * @brief Enumerates content of the object when it behaves like a map.
@@ -633,14 +668,19 @@ class SmartObject FINAL {
    **/
   std::set<std::string> enumerate() const;
 
-  SmartMap::iterator map_begin() const {
-    DCHECK(m_type == SmartType_Map);
-    return m_data.map_value->begin();
-  }
-  SmartMap::iterator map_end() const {
-    DCHECK(m_type == SmartType_Map);
-    return m_data.map_value->end();
-  }
+  /**
+   * @brief Iterators over map content. Map stops being shared with copies
+   * of this object.
+   **/
+  SmartMap::iterator map_begin();
+  SmartMap::iterator map_end();
+
+  /**
+   * @brief Read-only iterators over map content. Map is not detached, so
+   * copies of this object may be iterated concurrently.
+   **/
+  SmartMap::const_iterator map_begin() const;
+  SmartMap::const_iterator map_end() const;
 
   /**
    * @brief Checks for key presense when object is behaves like a map
@@ -649,6 +689,7 @@ class SmartObject FINAL {
    * @return bool
    **/
   bool keyExists(const std::string& Key) const;
+  bool keyExists(const SmartKey& Key) const;
 
   /**
    * @brief Removes element from the map.
@@ -768,6 +809,45 @@ class SmartObject FINAL {
   }
 
  protected:
+  /**
+   * @brief Map or array data shared by copies of an object until one of
+   * them changes it. Copying an object with large content costs only
+   * a reference count increment.
+   *
+   * References returned by const methods stay valid while the object is
+   * not modified.
+   **/
+  template <typename T>
+  struct SharedContainer {
+    SharedContainer() : value(), ref_count(1), shareable(true) {}
+    explicit SharedContainer(const T& Other)
+        : value(Other), ref_count(1), shareable(true) {}
+
+    T value;
+    std::atomic<int32_t> ref_count;
+    /**
+     * @brief Reset once a non-const reference to an element is handed out,
+     * such data is copied rather than shared since it can be changed
+     * without notice. So object built by non-const operator[] is copied
+     * in full on its first copy, while that copy is shareable again
+     **/
+    std::atomic<bool> shareable;
+  };
+
+  typedef SharedContainer<SmartArray> SharedArray;
+  typedef SharedContainer<SmartMap> SharedMap;
+
+  /**
+   * @brief Strings of up to this amount of ASCII characters are stored
+   * right in the object
+   **/
+  static const size_t kInlineStringCapacity = 14;
+
+  struct InlineString {
+    char chars[kInlineStringCapacity + 1];
+    uint8_t length;
+  };
+
   static std::string OperatorToTransform(const SmartMap::value_type& pair);
   /**
    * @name Support of type: int32_t (internal)
@@ -934,7 +1014,13 @@ class SmartObject FINAL {
    * @param Key Key of element to retrieve
    * @return SmartObject&
    **/
-  inline SmartObject& handle_map_access(const std::string& Key);
+  inline SmartObject& handle_map_access(const SmartKey& Key);
+  inline SmartObject& handle_map_access(const char* Key, const size_t Size);
+
+  /**
+   * @brief Returns element of map by key string
+   **/
+  const SmartObject& getElement(const char* Key, const size_t Size) const;
 
   /**
    * @brief Converts string to double
@@ -988,11 +1074,33 @@ class SmartObject FINAL {
    **/
   void set_new_type(SmartType NewType);
 
+  /**
+   * @brief Gets container of the object shared with nobody else, copying
+   * it if necessary
+   *
+   * @param HandOutReferences Whether caller gives away non-const
+   * references into the container
+   **/
+  SmartMap& writable_map(const bool HandOutReferences) const;
+  SmartArray& writable_array(const bool HandOutReferences) const;
+
+  /**
+   * @brief Gets pointer to string value, inline string is converted into
+   * Storage
+   **/
+  const custom_str::CustomString* string_value(
+      custom_str::CustomString& Storage) const;
+
   /**
    * @brief Current type of the object
    **/
   SmartType m_type;
 
+  /**
+   * @brief Whether string value is held in InlineString
+   **/
+  bool m_inline_string;
+
   /**
    * @brief Union for holding actual internal object data
    **/
@@ -1002,8 +1110,9 @@ class SmartObject FINAL {
     char char_value;
     int64_t int_value;
     custom_str::CustomString* str_value;
-    SmartArray* array_value;
-    SmartMap* map_value;
+    InlineString inline_str_value;
+    SharedArray* array_value;
+    SharedMap* map_value;
     SmartBinary* binary_value;
   } SmartData;
 
@@ -118,6 +118,9 @@ bool SMember::CheckHistoryFieldVersion(
   return true;  // All checks passed. Return true.
 }
 
+CompiledMember::CompiledMember(const std::string& Key, const SMember* Member)
+    : mKey(Key), mMember(Member) {}
+
 std::shared_ptr<CObjectSchemaItem> CObjectSchemaItem::create(
     const Members& members) {
   return std::shared_ptr<CObjectSchemaItem>(new CObjectSchemaItem(members));
@@ -128,64 +131,143 @@ errors::eType CObjectSchemaItem::validate(
     rpc::ValidationReport* report,
     const utils::SemanticVersion& MessageVersion,
     const bool allow_unknown_enums) {
-  if (SmartType_Map != object.getType()) {
-    std::string validation_info =
-        "Incorrect type, expected: " +
-        SmartObject::typeToString(SmartType_Map) +
-        ", got: " + SmartObject::typeToString(object.getType());
-    report->set_validation_info(validation_info);
-    return errors::INVALID_VALUE;
+  if (mCompiledValidator) {
+    return mCompiledValidator(object,
+                              mCompiledMembers,
+                              report,
+                              MessageVersion,
+                              allow_unknown_enums);
   }
 
-  std::set<std::string> object_keys = object.enumerate();
+  if (!ValidateMapType(object, report)) {
+    return errors::INVALID_VALUE;
+  }
 
   for (Members::const_iterator it = mMembers.begin(); it != mMembers.end();
        ++it) {
     const std::string& key = it->first;
-    const SMember& member = it->second;
-    const SMember* correct_member = GetCorrectMember(member, MessageVersion);
-
-    std::set<std::string>::const_iterator key_it = object_keys.find(key);
-    if (object_keys.end() == key_it) {
-      if (correct_member && correct_member->mIsMandatory == true &&
-          correct_member->mIsRemoved == false) {
-        std::string validation_info = "Missing mandatory parameter: " + key;
-        report->set_validation_info(validation_info);
-        return errors::MISSING_MANDATORY_PARAMETER;
-      } else if (key.compare(msg_params) == 0) {
-        // If the message params struct was filtered, that means that the
-        // app's version is too low to use the message.
-        std::string validation_info =
-            "Function is not available for SyncMsgVersion " +
-            MessageVersion.toString();
-        report->set_validation_info(validation_info);
-        return errors::INVALID_VALUE;
-      }
-      continue;
-    }
-    const SmartObject& field = object.getElement(key);
-
-    errors::eType result;
-    // Check if MessageVersion matches schema version
-    if (correct_member) {
-      result =
-          correct_member->mSchemaItem->validate(field,
-                                                &report->ReportSubobject(key),
-                                                MessageVersion,
-                                                allow_unknown_enums);
-    } else {
-      result = errors::ERROR;
-    }
-
+    const SmartObject* field =
+        object.keyExists(key) ? &object.getElement(key) : nullptr;
+    const errors::eType result =
+        ValidateMember(key,
+                       field,
+                       GetCorrectMember(it->second, MessageVersion),
+                       report,
+                       MessageVersion,
+                       allow_unknown_enums);
     if (errors::OK != result) {
       return result;
     }
-    object_keys.erase(key_it);
   }
 
   return errors::OK;
 }
 
+bool CObjectSchemaItem::SetCompiledValidator(CompiledValidator Validator,
+                                             const char* const* Keys,
+                                             const size_t KeysCount) {
+  ResetCompiledValidator();
+  if (mMembers.size() != KeysCount) {
+    return false;
+  }
+
+  CompiledMembers members;
+  members.reserve(KeysCount);
+  size_t index = 0;
+  for (Members::const_iterator it = mMembers.begin(); it != mMembers.end();
+       ++it, ++index) {
+    if (it->first != Keys[index]) {
+      return false;
+    }
+    members.push_back(CompiledMember(it->first, &it->second));
+  }
+
+  mCompiledMembers.swap(members);
+  mCompiledValidator = Validator;
+  return true;
+}
+
+bool CObjectSchemaItem::ValidateMapType(const SmartObject& Object,
+                                        rpc::ValidationReport* report) {
+  if (SmartType_Map != Object.getType()) {
+    std::string validation_info =
+        "Incorrect type, expected: " +
+        SmartObject::typeToString(SmartType_Map) +
+        ", got: " + SmartObject::typeToString(Object.getType());
+    report->set_validation_info(validation_info);
+    return false;
+  }
+  return true;
+}
+
+errors::eType CObjectSchemaItem::ValidatePlainMember(
+    const SmartObject& Object,
+    const CompiledMember& Member,
+    rpc::ValidationReport* report,
+    const utils::SemanticVersion& MessageVersion,
+    const bool allow_unknown_enums) {
+  const SmartObject* field = Object.keyExists(Member.mKey)
+                                 ? &Object.getElement(Member.mKey)
+                                 : nullptr;
+  return ValidateMember(Member.mKey.str(),
+                        field,
+                        Member.mMember,
+                        report,
+                        MessageVersion,
+                        allow_unknown_enums);
+}
+
+errors::eType CObjectSchemaItem::ValidateVersionedMember(
+    const SmartObject& Object,
+    const CompiledMember& Member,
+    rpc::ValidationReport* report,
+    const utils::SemanticVersion& MessageVersion,
+    const bool allow_unknown_enums) {
+  const SmartObject* field = Object.keyExists(Member.mKey)
+                                 ? &Object.getElement(Member.mKey)
+                                 : nullptr;
+  return ValidateMember(Member.mKey.str(),
+                        field,
+                        GetCorrectMember(*Member.mMember, MessageVersion),
+                        report,
+                        MessageVersion,
+                        allow_unknown_enums);
+}
+
+errors::eType CObjectSchemaItem::ValidateMember(
+    const std::string& Key,
+    const SmartObject* Field,
+    const SMember* Member,
+    rpc::ValidationReport* report,
+    const utils::SemanticVersion& MessageVersion,
+    const bool allow_unknown_enums) {
+  if (!Field) {
+    if (Member && Member->mIsMandatory == true && Member->mIsRemoved == false) {
+      std::string validation_info = "Missing mandatory parameter: " + Key;
+      report->set_validation_info(validation_info);
+      return errors::MISSING_MANDATORY_PARAMETER;
+    } else if (Key.compare(msg_params) == 0) {
+      // If the message params struct was filtered, that means that the
+      // app's version is too low to use the message.
+      std::string validation_info =
+          "Function is not available for SyncMsgVersion " +
+          MessageVersion.toString();
+      report->set_validation_info(validation_info);
+      return errors::INVALID_VALUE;
+    }
+    return errors::OK;
+  }
+
+  // Check if MessageVersion matches schema version
+  if (!Member) {
+    return errors::ERROR;
+  }
+  return Member->mSchemaItem->validate(*Field,
+                                       &report->ReportSubobject(Key),
+                                       MessageVersion,
+                                       allow_unknown_enums);
+}
+
 bool CObjectSchemaItem::filterInvalidEnums(
     SmartObject& Object,
     const utils::SemanticVersion& MessageVersion,
@@ -255,14 +337,18 @@ void CObjectSchemaItem::unapplySchema(SmartObject& Object,
   if (SmartType_Map != Object.getType()) {
     return;
   }
-  for (SmartMap::const_iterator it = Object.map_begin();
-       it != Object.map_end();) {
-    const std::string& key = it->first;
-    // move next to avoid wrong iterator on erase
-    ++it;
-    if (mMembers.end() == mMembers.find(key) && remove_unknown_parameters) {
-      // remove fake params
-      Object.erase(key);
+  if (remove_unknown_parameters) {
+    // Erase invalidates map iterators, so fake params are collected first
+    std::vector<std::string> fake_params;
+    for (SmartMap::const_iterator it = Object.map_begin();
+         it != Object.map_end();
+         ++it) {
+      if (mMembers.end() == mMembers.find(it->first)) {
+        fake_params.push_back(it->first);
+      }
+    }
+    for (size_t i = 0; i < fake_params.size(); ++i) {
+      Object.erase(fake_params[i]);
     }
   }
   for (Members::const_iterator it = mMembers.begin(); it != mMembers.end();
@@ -301,6 +387,9 @@ TypeID CObjectSchemaItem::GetType() {
 
 boost::optional<SMember&> CObjectSchemaItem::GetMemberSchemaItem(
     const std::string& member_key) {
+  // Member is handed out for modification, which generated validator
+  // would not notice
+  ResetCompiledValidator();
   auto it = mMembers.find(member_key);
 
   if (it != mMembers.end()) {
@@ -311,11 +400,17 @@ boost::optional<SMember&> CObjectSchemaItem::GetMemberSchemaItem(
 
 void CObjectSchemaItem::AddMemberSchemaItem(const std::string& member_key,
                                             SMember& member) {
+  ResetCompiledValidator();
   mMembers[member_key] = member;
 }
 
 CObjectSchemaItem::CObjectSchemaItem(const Members& members)
-    : mMembers(members) {}
+    : mMembers(members), mCompiledValidator(nullptr) {}
+
+void CObjectSchemaItem::ResetCompiledValidator() {
+  mCompiledValidator = nullptr;
+  mCompiledMembers.clear();
+}
 
 void CObjectSchemaItem::RemoveUnknownParams(
     SmartObject& Object, const utils::SemanticVersion& MessageVersion) {
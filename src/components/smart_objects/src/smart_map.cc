@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "smart_objects/smart_map.h"
+
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+
+#include "smart_objects/smart_object.h"
+#include "utils/rwlock.h"
+
+namespace ns_smart_device_link {
+namespace ns_smart_objects {
+
+struct SmartKey::Atom {
+  Atom(const char* data, const size_t size, const size_t hash)
+      : value(data, size), hash(hash), ref_count(1) {}
+
+  const std::string value;
+  const size_t hash;
+  std::atomic<int32_t> ref_count;
+};
+
+namespace {
+struct KeyView {
+  const char* data;
+  size_t size;
+  size_t hash;
+};
+
+struct KeyViewHash {
+  size_t operator()(const KeyView& key) const {
+    return key.hash;
+  }
+};
+
+struct KeyViewEqual {
+  bool operator()(const KeyView& first, const KeyView& second) const {
+    return first.size == second.size &&
+           0 == memcmp(first.data, second.data, first.size);
+  }
+};
+
+/**
+ * @brief Unused atoms are kept until key table grows to this size
+ **/
+const size_t kMinSweepThreshold = 1024;
+
+class KeyTable {
+ public:
+  KeyTable() : sweep_threshold_(kMinSweepThreshold) {}
+
+  /**
+   * @brief Gets atom of the key adding it to the table if necessary and
+   * takes reference to it
+   **/
+  SmartKey::Atom* Acquire(const char* data, const size_t size) {
+    const KeyView key = {data, size, SmartKey::Hash(data, size)};
+    {
+      sync_primitives::AutoReadLock lock(lock_);
+      SmartKey::Atom* atom = FindLocked(key);
+      if (atom) {
+        return atom;
+      }
+    }
+    sync_primitives::AutoWriteLock lock(lock_);
+    SmartKey::Atom* atom = FindLocked(key);
+    if (atom) {
+      return atom;
+    }
+    if (atoms_.size() >= sweep_threshold_) {
+      SweepLocked();
+    }
+    atom = new SmartKey::Atom(data, size, key.hash);
+    const KeyView atom_key = {atom->value.data(), size, key.hash};
+    atoms_.insert(std::make_pair(atom_key, atom));
+    return atom;
+  }
+
+  size_t size() const {
+    sync_primitives::AutoReadLock lock(lock_);
+    return atoms_.size();
+  }
+
+ private:
+  SmartKey::Atom* FindLocked(const KeyView& key) const {
+    Atoms::const_iterator it = atoms_.find(key);
+    if (atoms_.end() == it) {
+      return NULL;
+    }
+    ++it->second->ref_count;
+    return it->second;
+  }
+
+  /**
+   * @brief Removes atoms nobody refers to. References are taken either by
+   * copying a key, which needs a living reference, or under lock, so no
+   * atom can be resurrected while the write lock is held
+   **/
+  void SweepLocked() {
+    for (Atoms::iterator it = atoms_.begin(); it != atoms_.end();) {
+      if (0 == it->second->ref_count) {
+        delete it->second;
+        it = atoms_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    sweep_threshold_ = std::max(kMinSweepThreshold, 2 * atoms_.size());
+  }
+
+  typedef std::unordered_map<KeyView, SmartKey::Atom*, KeyViewHash,
+                             KeyViewEqual>
+      Atoms;
+
+  mutable sync_primitives::RWLock lock_;
+  Atoms atoms_;
+  size_t sweep_threshold_;
+};
+
+/**
+ * @brief Table is never destroyed, so keys held by static objects stay
+ * valid until process exit
+ **/
+KeyTable& Table() {
+  static KeyTable* table = new KeyTable();
+  return *table;
+}
+
+bool IsKey(const SmartKey::Atom* atom, const char* key, const size_t size) {
+  return atom->value.size() == size &&
+         0 == memcmp(atom->value.data(), key, size);
+}
+}  // namespace
+
+SmartKey::SmartKey(const std::string& Key)
+    : atom_(Table().Acquire(Key.data(), Key.size())) {}
+
+SmartKey::SmartKey(const char* Key)
+    : atom_(Table().Acquire(Key, strlen(Key))) {}
+
+SmartKey::SmartKey(const SmartKey& Other) : atom_(Other.atom_) {
+  ++atom_->ref_count;
+}
+
+SmartKey& SmartKey::operator=(const SmartKey& Other) {
+  if (atom_ != Other.atom_) {
+    SmartKey copy(Other);
+    std::swap(atom_, copy.atom_);
+  }
+  return *this;
+}
+
+SmartKey::~SmartKey() {
+  // Unused atom is removed from the table by the next sweep
+  --atom_->ref_count;
+}
+
+size_t SmartKey::interned_count() {
+  return Table().size();
+}
+
+size_t SmartKey::Hash(const char* Data, const size_t Size) {
+  // FNV-1a
+  size_t hash = 2166136261u;
+  for (size_t i = 0; i < Size; ++i) {
+    hash ^= static_cast<uint8_t>(Data[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+const std::string& SmartKey::str() const {
+  return atom_->value;
+}
+
+bool SmartKey::operator<(const SmartKey& Other) const {
+  return atom_ != Other.atom_ && atom_->value < Other.atom_->value;
+}
+
+std::ostream& operator<<(std::ostream& stream, const SmartKey& key) {
+  return stream << key.str();
+}
+
+SmartMap::SmartMap() {}
+
+SmartMap::SmartMap(const SmartMap& Other) {
+  entries_.reserve(Other.entries_.size());
+  for (Entries::const_iterator it = Other.entries_.begin();
+       it != Other.entries_.end();
+       ++it) {
+    const Entry entry = {it->atom, it->hash, new value_type(*it->node)};
+    entries_.push_back(entry);
+  }
+}
+
+SmartMap& SmartMap::operator=(const SmartMap& Other) {
+  if (this != &Other) {
+    SmartMap copy(Other);
+    entries_.swap(copy.entries_);
+  }
+  return *this;
+}
+
+SmartMap::~SmartMap() {
+  clear();
+}
+
+SmartMap::iterator SmartMap::find(const SmartKey& Key) {
+  return iterator(entries_.begin() + IndexOf(Key));
+}
+
+SmartMap::const_iterator SmartMap::find(const SmartKey& Key) const {
+  return const_iterator(entries_.begin() + IndexOf(Key));
+}
+
+SmartMap::iterator SmartMap::find(const char* Key, const size_t Size) {
+  return iterator(entries_.begin() + IndexOf(Key, Size));
+}
+
+SmartMap::const_iterator SmartMap::find(const char* Key,
+                                        const size_t Size) const {
+  return const_iterator(entries_.begin() + IndexOf(Key, Size));
+}
+
+SmartObject& SmartMap::operator[](const SmartKey& Key) {
+  const size_t index = IndexOf(Key);
+  if (index != entries_.size()) {
+    return entries_[index].node->second;
+  }
+  const std::string& key = Key.str();
+  std::unique_ptr<value_type> node(new value_type(Key, SmartObject()));
+  const Entry entry = {Key.atom_, Key.atom_->hash, node.get()};
+  entries_.insert(entries_.begin() + LowerBound(key.data(), key.size()),
+                  entry);
+  return node.release()->second;
+}
+
+SmartMap::size_type SmartMap::erase(const SmartKey& Key) {
+  const size_t index = IndexOf(Key);
+  if (index == entries_.size()) {
+    return 0;
+  }
+  erase(iterator(entries_.begin() + index));
+  return 1;
+}
+
+void SmartMap::erase(iterator Position) {
+  delete Position.base()->node;
+  entries_.erase(Position.base());
+}
+
+void SmartMap::clear() {
+  for (Entries::iterator it = entries_.begin(); it != entries_.end(); ++it) {
+    delete it->node;
+  }
+  entries_.clear();
+}
+
+size_t SmartMap::IndexOf(const SmartKey& Key) const {
+  if (entries_.size() <= kLinearSearchLimit) {
+    for (size_t i = 0; i < entries_.size(); ++i) {
+      if (entries_[i].atom == Key.atom_) {
+        return i;
+      }
+    }
+    return entries_.size();
+  }
+  const std::string& key = Key.str();
+  const size_t index = LowerBound(key.data(), key.size());
+  if (index < entries_.size() && entries_[index].atom == Key.atom_) {
+    return index;
+  }
+  return entries_.size();
+}
+
+size_t SmartMap::IndexOf(const char* Key, const size_t Size) const {
+  if (entries_.size() <= kLinearSearchLimit) {
+    const size_t hash = SmartKey::Hash(Key, Size);
+    for (size_t i = 0; i < entries_.size(); ++i) {
+      if (entries_[i].hash == hash && IsKey(entries_[i].atom, Key, Size)) {
+        return i;
+      }
+    }
+    return entries_.size();
+  }
+  const size_t index = LowerBound(Key, Size);
+  if (index < entries_.size() && IsKey(entries_[index].atom, Key, Size)) {
+    return index;
+  }
+  return entries_.size();
+}
+
+size_t SmartMap::LowerBound(const char* Key, const size_t Size) const {
+  size_t first = 0;
+  size_t count = entries_.size();
+  while (count > 0) {
+    const size_t step = count / 2;
+    const size_t middle = first + step;
+    if (entries_[middle].atom->value.compare(0, std::string::npos, Key, Size) <
+        0) {
+      first = middle + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return first;
+}
+
+}  // namespace ns_smart_objects
+}  // namespace ns_smart_device_link
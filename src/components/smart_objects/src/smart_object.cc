@@ -36,6 +36,7 @@
 #include <inttypes.h>
 #include <stdlib.h>
 #include <algorithm>
+#include <cstring>
 #include <iomanip>
 #include <iterator>
 #include <limits>
@@ -49,17 +50,56 @@ namespace ns_smart_objects {
  **/
 static const char* invalid_cstr_value = "";
 
-SmartObject::SmartObject() : m_type(SmartType_Null), m_schema() {
+namespace {
+template <typename Container>
+Container* Share(Container* container) {
+  if (container->shareable) {
+    ++container->ref_count;
+    return container;
+  }
+  return new Container(container->value);
+}
+
+template <typename Container>
+void Release(Container* container) {
+  if (container && 0 == --container->ref_count) {
+    delete container;
+  }
+}
+
+template <typename Container>
+void Detach(Container*& container) {
+  if (container->ref_count > 1) {
+    Container* copy = new Container(container->value);
+    Release(container);
+    container = copy;
+  }
+}
+}  // namespace
+
+SmartObject::SmartObject()
+    : m_type(SmartType_Null), m_inline_string(false), m_schema() {
   m_data.str_value = NULL;
 }
 
 SmartObject::SmartObject(const SmartObject& Other)
-    : m_type(SmartType_Null), m_schema() {
+    : m_type(SmartType_Null), m_inline_string(false), m_schema() {
   m_data.str_value = NULL;
   duplicate(Other);
 }
 
-SmartObject::SmartObject(SmartType Type) : m_type(SmartType_Null), m_schema() {
+SmartObject::SmartObject(SmartObject&& Other) noexcept
+    : m_type(Other.m_type)
+    , m_inline_string(Other.m_inline_string)
+    , m_data(Other.m_data)
+    , m_schema(Other.m_schema) {
+  Other.m_type = SmartType_Null;
+  Other.m_inline_string = false;
+  Other.m_data.str_value = NULL;
+}
+
+SmartObject::SmartObject(SmartType Type)
+    : m_type(SmartType_Null), m_inline_string(false), m_schema() {
   switch (Type) {
     case SmartType_Null:
       break;
@@ -82,11 +122,11 @@ SmartObject::SmartObject(SmartType Type) : m_type(SmartType_Null), m_schema() {
       set_value_string(custom_str::CustomString());
       break;
     case SmartType_Map:
-      m_data.map_value = new SmartMap();
+      m_data.map_value = new SharedMap();
       m_type = SmartType_Map;
       break;
     case SmartType_Array:
-      m_data.array_value = new SmartArray();
+      m_data.array_value = new SharedArray();
       m_type = SmartType_Array;
       break;
     case SmartType_Binary:
@@ -111,6 +151,32 @@ SmartObject& SmartObject::operator=(const SmartObject& Other) {
   return *this;
 }
 
+SmartObject& SmartObject::operator=(SmartObject&& Other) {
+  if (this == &Other) {
+    return *this;
+  }
+  if (SmartType_Null == Other.m_type || SmartType_Invalid == Other.m_type) {
+    // Keep the same result as assignment of a copy has
+    duplicate(Other);
+    return *this;
+  }
+  // Other may be owned by this object, so it is released before cleanup
+  const SmartType newType = Other.m_type;
+  const bool newInlineString = Other.m_inline_string;
+  const SmartData newData = Other.m_data;
+  m_schema = Other.m_schema;
+  Other.m_type = SmartType_Null;
+  Other.m_inline_string = false;
+  Other.m_data.str_value = NULL;
+
+  cleanup_data();
+
+  m_type = newType;
+  m_inline_string = newInlineString;
+  m_data = newData;
+  return *this;
+}
+
 bool SmartObject::operator==(const SmartObject& Other) const {
   if (m_type != Other.m_type)
     return false;
@@ -126,30 +192,39 @@ bool SmartObject::operator==(const SmartObject& Other) const {
       return m_data.bool_value == Other.m_data.bool_value;
     case SmartType_Character:
       return m_data.char_value == Other.m_data.char_value;
-    case SmartType_String:
-      return *(m_data.str_value) == *(Other.m_data.str_value);
+    case SmartType_String: {
+      if (m_inline_string && Other.m_inline_string) {
+        const InlineString& value = m_data.inline_str_value;
+        const InlineString& other_value = Other.m_data.inline_str_value;
+        return value.length == other_value.length &&
+               0 == memcmp(value.chars, other_value.chars, value.length);
+      }
+      custom_str::CustomString storage;
+      custom_str::CustomString other_storage;
+      return *string_value(storage) == *Other.string_value(other_storage);
+    }
     case SmartType_Map: {
       if (m_data.map_value == Other.m_data.map_value)
         return true;
-      if (m_data.map_value->size() != Other.m_data.map_value->size())
+      const SmartMap& map = m_data.map_value->value;
+      const SmartMap& other_map = Other.m_data.map_value->value;
+      if (map.size() != other_map.size())
         return false;
-      return std::equal(m_data.map_value->begin(),
-                        m_data.map_value->end(),
-                        Other.m_data.map_value->begin());
+      return std::equal(map.begin(), map.end(), other_map.begin());
     }
     case SmartType_Array: {
       if (m_data.array_value == Other.m_data.array_value)
         return true;
-      if (m_data.array_value->size() != Other.m_data.array_value->size())
+      const SmartArray& array = m_data.array_value->value;
+      const SmartArray& other_array = Other.m_data.array_value->value;
+      if (array.size() != other_array.size())
         return false;
-      return std::equal(m_data.array_value->begin(),
-                        m_data.array_value->end(),
-                        Other.m_data.array_value->begin());
+      return std::equal(array.begin(), array.end(), other_array.begin());
     }
     case SmartType_Binary: {
       if (m_data.binary_value == Other.m_data.binary_value)
         return true;
-      if (m_data.array_value->size() != Other.m_data.array_value->size())
+      if (m_data.binary_value->size() != Other.m_data.binary_value->size())
         return false;
       return std::equal(m_data.binary_value->begin(),
                         m_data.binary_value->end(),
@@ -167,7 +242,7 @@ bool SmartObject::operator==(const SmartObject& Other) const {
 }
 
 SmartObject::SmartObject(int32_t InitialValue)
-    : m_type(SmartType_Null), m_schema() {
+    : m_type(SmartType_Null), m_inline_string(false), m_schema() {
   m_data.str_value = NULL;
   set_value_integer(InitialValue);
 }
@@ -207,8 +282,10 @@ void SmartObject::set_value_integer(int64_t NewValue) {
 
 int64_t SmartObject::convert_int() const {
   switch (m_type) {
-    case SmartType_String:
-      return convert_string_to_integer(m_data.str_value);
+    case SmartType_String: {
+      custom_str::CustomString storage;
+      return convert_string_to_integer(string_value(storage));
+    }
     case SmartType_Boolean:
       return (m_data.bool_value == true) ? 1 : 0;
     case SmartType_Integer:
@@ -224,7 +301,7 @@ int64_t SmartObject::convert_int() const {
 }
 
 SmartObject::SmartObject(uint32_t InitialValue)
-    : m_type(SmartType_Null), m_schema() {
+    : m_type(SmartType_Null), m_inline_string(false), m_schema() {
   m_data.str_value = NULL;
   set_value_integer(InitialValue);
 }
@@ -253,7 +330,7 @@ bool SmartObject::operator==(const uint32_t Value) const {
 }
 
 SmartObject::SmartObject(int64_t InitialValue)
-    : m_type(SmartType_Null), m_schema() {
+    : m_type(SmartType_Null), m_inline_string(false), m_schema() {
   m_data.str_value = NULL;
   set_value_integer(InitialValue);
 }
@@ -281,7 +358,7 @@ SmartObject& SmartObject::operator=(const uint64_t NewValue) {
 }
 
 SmartObject::SmartObject(double InitialValue)
-    : m_type(SmartType_Null), m_schema() {
+    : m_type(SmartType_Null), m_inline_string(false), m_schema() {
   m_data.str_value = NULL;
   set_value_double(InitialValue);
 }
@@ -312,8 +389,10 @@ void SmartObject::set_value_double(const double NewValue) {
 
 double SmartObject::convert_double() const {
   switch (m_type) {
-    case SmartType_String:
-      return convert_string_to_double(m_data.str_value);
+    case SmartType_String: {
+      custom_str::CustomString storage;
+      return convert_string_to_double(string_value(storage));
+    }
     case SmartType_Boolean:
       return (m_data.bool_value) ? 1.0 : 0.0;
     case SmartType_Integer:
@@ -327,7 +406,7 @@ double SmartObject::convert_double() const {
 }
 
 SmartObject::SmartObject(bool InitialValue)
-    : m_type(SmartType_Null), m_schema() {
+    : m_type(SmartType_Null), m_inline_string(false), m_schema() {
   m_data.str_value = NULL;
   set_value_bool(InitialValue);
 }
@@ -372,7 +451,7 @@ bool SmartObject::convert_bool() const {
 }
 
 SmartObject::SmartObject(char InitialValue)
-    : m_type(SmartType_Null), m_schema() {
+    : m_type(SmartType_Null), m_inline_string(false), m_schema() {
   m_data.str_value = NULL;
   set_value_char(InitialValue);
 }
@@ -404,6 +483,11 @@ void SmartObject::set_value_char(char NewValue) {
 char SmartObject::convert_char() const {
   switch (m_type) {
     case SmartType_String:
+      if (m_inline_string) {
+        return m_data.inline_str_value.length == 1
+                   ? m_data.inline_str_value.chars[0]
+                   : invalid_char_value;
+      }
       return (m_data.str_value->length() == 1 &&
               m_data.str_value->is_ascii_string())
                  ? m_data.str_value->at(0)
@@ -421,13 +505,13 @@ char SmartObject::convert_char() const {
 // =============================================================
 
 SmartObject::SmartObject(const custom_str::CustomString& InitialValue)
-    : m_type(SmartType_Null), m_schema() {
+    : m_type(SmartType_Null), m_inline_string(false), m_schema() {
   m_data.str_value = NULL;
   set_value_string(InitialValue);
 }
 
 SmartObject::SmartObject(const std::string& InitialValue)
-    : m_type(SmartType_Null), m_schema() {
+    : m_type(SmartType_Null), m_inline_string(false), m_schema() {
   m_data.str_value = NULL;
   set_value_string(custom_str::CustomString(InitialValue));
 }
@@ -441,6 +525,9 @@ custom_str::CustomString SmartObject::asCustomString() const {
 }
 
 const char* SmartObject::asCharArray() const {
+  if (m_inline_string) {
+    return m_data.inline_str_value.chars;
+  }
   if (m_data.str_value != NULL) {
     return m_data.str_value->c_str();
   }
@@ -471,9 +558,26 @@ bool SmartObject::operator==(const std::string& Value) const {
 
 void SmartObject::set_value_string(const custom_str::CustomString& NewValue) {
   set_new_type(SmartType_String);
+  if (NewValue.is_ascii_string() &&
+      NewValue.length_bytes() <= kInlineStringCapacity) {
+    InlineString& value = m_data.inline_str_value;
+    value.length = NewValue.length_bytes();
+    memcpy(value.chars, NewValue.c_str(), value.length + 1);
+    m_inline_string = true;
+    return;
+  }
   m_data.str_value = new custom_str::CustomString(NewValue);
 }
 
+const custom_str::CustomString* SmartObject::string_value(
+    custom_str::CustomString& Storage) const {
+  if (!m_inline_string) {
+    return m_data.str_value;
+  }
+  Storage = m_data.inline_str_value.chars;
+  return &Storage;
+}
+
 std::string SmartObject::convert_string() const {
   switch (m_type) {
     case SmartType_Integer: {
@@ -486,6 +590,10 @@ std::string SmartObject::convert_string() const {
     case SmartType_Double:
       return convert_double_to_string(m_data.double_value);
     case SmartType_String:
+      if (m_inline_string) {
+        return std::string(m_data.inline_str_value.chars,
+                           m_data.inline_str_value.length);
+      }
       return (m_data.str_value)->AsMBString();
     default:
       break;
@@ -495,8 +603,10 @@ std::string SmartObject::convert_string() const {
 
 custom_str::CustomString SmartObject::convert_custom_string() const {
   switch (m_type) {
-    case SmartType_String:
-      return *(m_data.str_value);
+    case SmartType_String: {
+      custom_str::CustomString storage;
+      return *string_value(storage);
+    }
     default:
       return custom_str::CustomString(convert_string());
   }
@@ -507,7 +617,7 @@ custom_str::CustomString SmartObject::convert_custom_string() const {
 // =============================================================
 
 SmartObject::SmartObject(const char* const InitialValue)
-    : m_type(SmartType_Null), m_schema() {
+    : m_type(SmartType_Null), m_inline_string(false), m_schema() {
   m_data.str_value = NULL;
   set_value_cstr(InitialValue);
   return;
@@ -537,7 +647,7 @@ void SmartObject::set_value_cstr(const char* NewValue) {
 // BINARY TYPE SUPPORT
 // =============================================================
 SmartObject::SmartObject(const SmartBinary& InitialValue)
-    : m_type(SmartType_Null), m_schema() {
+    : m_type(SmartType_Null), m_inline_string(false), m_schema() {
   m_data.str_value = NULL;
   set_value_binary(InitialValue);
 }
@@ -546,11 +656,18 @@ SmartBinary SmartObject::asBinary() const {
   return convert_binary();
 }
 
-SmartArray* SmartObject::asArray() const {
+SmartArray* SmartObject::asArray() {
   if (m_type != SmartType_Array) {
     return NULL;
   }
-  return m_data.array_value;
+  return &writable_array(true);
+}
+
+const SmartArray* SmartObject::asArray() const {
+  if (m_type != SmartType_Array) {
+    return NULL;
+  }
+  return &m_data.array_value->value;
 }
 
 SmartObject& SmartObject::operator=(const SmartBinary& NewValue) {
@@ -605,9 +722,9 @@ inline SmartObject& SmartObject::handle_array_access(const int32_t Index) {
   if (m_type != SmartType_Array) {
     cleanup_data();
     m_type = SmartType_Array;
-    m_data.array_value = new SmartArray();
+    m_data.array_value = new SharedArray();
   }
-  SmartArray& array = *m_data.array_value;
+  SmartArray& array = writable_array(true);
   if (Index == -1 || static_cast<size_t>(Index) == array.size()) {
     array.push_back(SmartObject());
     return array[array.size() - 1];
@@ -625,7 +742,7 @@ inline SmartObject& SmartObject::handle_array_access(const int32_t Index) {
 // =============================================================
 
 SmartObject& SmartObject::operator[](const std::string& Key) {
-  return handle_map_access(Key);
+  return handle_map_access(Key.data(), Key.size());
 }
 
 const SmartObject& SmartObject::operator[](const std::string& Key) const {
@@ -633,41 +750,67 @@ const SmartObject& SmartObject::operator[](const std::string& Key) const {
 }
 
 SmartObject& SmartObject::operator[](char* Key) {
-  return handle_map_access(std::string(Key));
+  return handle_map_access(Key, strlen(Key));
 }
 
 const SmartObject& SmartObject::operator[](char* Key) const {
-  return getElement(std::string(Key));
+  return getElement(Key, strlen(Key));
 }
 
 SmartObject& SmartObject::operator[](const char* Key) {
-  return handle_map_access(std::string(Key));
+  return handle_map_access(Key, strlen(Key));
 }
 
 const SmartObject& SmartObject::operator[](const char* Key) const {
-  return getElement(std::string(Key));
+  return getElement(Key, strlen(Key));
+}
+
+SmartObject& SmartObject::operator[](const SmartKey& Key) {
+  return handle_map_access(Key);
+}
+
+const SmartObject& SmartObject::operator[](const SmartKey& Key) const {
+  return getElement(Key);
 }
 
 const SmartObject& SmartObject::getElement(size_t Index) const {
   if (SmartType_Array == m_type) {
-    if (Index < m_data.array_value->size()) {
-      return m_data.array_value->at(Index);
+    const SmartArray& array = m_data.array_value->value;
+    if (Index < array.size()) {
+      return array.at(Index);
     }
   }
   return invalid_object_value;
 }
 
 const SmartObject& SmartObject::getElement(const std::string& Key) const {
+  return getElement(Key.data(), Key.size());
+}
+
+const SmartObject& SmartObject::getElement(const char* Key,
+                                           const size_t Size) const {
   if (SmartType_Map == m_type) {
-    SmartMap::const_iterator it = m_data.map_value->find(Key);
-    if (it != m_data.map_value->end()) {
+    const SmartMap& map = m_data.map_value->value;
+    SmartMap::const_iterator it = map.find(Key, Size);
+    if (it != map.end()) {
       return it->second;
     }
   }
   return invalid_object_value;
 }
 
-SmartObject& SmartObject::handle_map_access(const std::string& Key) {
+const SmartObject& SmartObject::getElement(const SmartKey& Key) const {
+  if (SmartType_Map == m_type) {
+    const SmartMap& map = m_data.map_value->value;
+    SmartMap::const_iterator it = map.find(Key);
+    if (it != map.end()) {
+      return it->second;
+    }
+  }
+  return invalid_object_value;
+}
+
+SmartObject& SmartObject::handle_map_access(const SmartKey& Key) {
   if (m_type == SmartType_Invalid) {
     return *this;
   }
@@ -675,27 +818,62 @@ SmartObject& SmartObject::handle_map_access(const std::string& Key) {
   if (m_type != SmartType_Map) {
     cleanup_data();
     m_type = SmartType_Map;
-    m_data.map_value = new SmartMap();
+    m_data.map_value = new SharedMap();
   }
-  SmartMap& map = *m_data.map_value;
+  SmartMap& map = writable_map(true);
 
   return map[Key];
 }
 
+SmartObject& SmartObject::handle_map_access(const char* Key,
+                                            const size_t Size) {
+  if (m_type == SmartType_Map) {
+    // Existing key is found without interning
+    SmartMap& map = writable_map(true);
+    SmartMap::iterator it = map.find(Key, Size);
+    if (it != map.end()) {
+      return it->second;
+    }
+  }
+  return handle_map_access(SmartKey(std::string(Key, Size)));
+}
+
+SmartMap& SmartObject::writable_map(const bool HandOutReferences) const {
+  DCHECK(m_type == SmartType_Map);
+  SharedMap*& map_value = const_cast<SmartObject*>(this)->m_data.map_value;
+  Detach(map_value);
+  if (HandOutReferences) {
+    map_value->shareable = false;
+  }
+  return map_value->value;
+}
+
+SmartArray& SmartObject::writable_array(const bool HandOutReferences) const {
+  DCHECK(m_type == SmartType_Array);
+  SharedArray*& array_value =
+      const_cast<SmartObject*>(this)->m_data.array_value;
+  Detach(array_value);
+  if (HandOutReferences) {
+    array_value->shareable = false;
+  }
+  return array_value->value;
+}
+
 // =============================================================
 // OTHER METHODS
 // =============================================================
 void SmartObject::duplicate(const SmartObject& OtherObject) {
   SmartData newData;
   const SmartType newType = OtherObject.m_type;
+  const bool newInlineString = OtherObject.m_inline_string;
   switch (newType) {
     case SmartType_Null:  // on duplicate empty SmartObject
       return;
     case SmartType_Map:
-      newData.map_value = new SmartMap(*OtherObject.m_data.map_value);
+      newData.map_value = Share(OtherObject.m_data.map_value);
       break;
     case SmartType_Array:
-      newData.array_value = new SmartArray(*OtherObject.m_data.array_value);
+      newData.array_value = Share(OtherObject.m_data.array_value);
       break;
     case SmartType_Integer:
       newData.int_value = OtherObject.m_data.int_value;
@@ -713,8 +891,12 @@ void SmartObject::duplicate(const SmartObject& OtherObject) {
       newData.char_value = OtherObject.m_data.char_value;
       break;
     case SmartType_String:
-      newData.str_value =
-          new custom_str::CustomString(*OtherObject.m_data.str_value);
+      if (newInlineString) {
+        newData.inline_str_value = OtherObject.m_data.inline_str_value;
+      } else {
+        newData.str_value =
+            new custom_str::CustomString(*OtherObject.m_data.str_value);
+      }
       break;
     case SmartType_Binary:
       newData.binary_value = new SmartBinary(*OtherObject.m_data.binary_value);
@@ -728,13 +910,18 @@ void SmartObject::duplicate(const SmartObject& OtherObject) {
   cleanup_data();
 
   m_type = newType;
+  m_inline_string = newInlineString;
   m_data = newData;
 }
 
 void SmartObject::cleanup_data() {
   switch (m_type) {
     case SmartType_String:
-      if (m_data.str_value) {
+      if (m_inline_string) {
+        m_inline_string = false;
+        m_data.str_value = nullptr;
+        m_type = SmartType_Null;
+      } else if (m_data.str_value) {
         delete m_data.str_value;
         m_data.str_value = nullptr;
         m_type = SmartType_Null;
@@ -742,14 +929,14 @@ void SmartObject::cleanup_data() {
       break;
     case SmartType_Map:
       if (m_data.map_value) {
-        delete m_data.map_value;
+        Release(m_data.map_value);
         m_data.map_value = nullptr;
         m_type = SmartType_Null;
       }
       break;
     case SmartType_Array:
       if (m_data.array_value) {
-        delete m_data.array_value;
+        Release(m_data.array_value);
         m_data.array_value = nullptr;
         m_type = SmartType_Null;
       }
@@ -769,11 +956,12 @@ void SmartObject::cleanup_data() {
 size_t SmartObject::length() const {
   switch (m_type) {
     case SmartType_String:
-      return m_data.str_value->size();
+      return m_inline_string ? m_data.inline_str_value.length
+                             : m_data.str_value->size();
     case SmartType_Array:
-      return m_data.array_value->size();
+      return m_data.array_value->value.size();
     case SmartType_Map:
-      return m_data.map_value->size();
+      return m_data.map_value->value.size();
     case SmartType_Binary:
       return m_data.binary_value->size();
     default:
@@ -785,11 +973,12 @@ size_t SmartObject::length() const {
 bool SmartObject::empty() const {
   switch (m_type) {
     case SmartType_String:
-      return m_data.str_value->empty();
+      return m_inline_string ? 0 == m_data.inline_str_value.length
+                             : m_data.str_value->empty();
     case SmartType_Array:
-      return m_data.array_value->empty();
+      return m_data.array_value->value.empty();
     case SmartType_Map:
-      return m_data.map_value->empty();
+      return m_data.map_value->value.empty();
     case SmartType_Binary:
       return m_data.binary_value->empty();
     default:
@@ -864,8 +1053,9 @@ std::set<std::string> SmartObject::enumerate() const {
   std::set<std::string> keys;
 
   if (m_type == SmartType_Map) {
-    std::transform(m_data.map_value->begin(),
-                   m_data.map_value->end(),
+    const SmartMap& map = m_data.map_value->value;
+    std::transform(map.begin(),
+                   map.end(),
                    std::inserter(keys, keys.end()),
                    &SmartObject::OperatorToTransform);
   }
@@ -876,14 +1066,47 @@ bool SmartObject::keyExists(const std::string& Key) const {
   if (m_type != SmartType_Map) {
     return false;
   }
-  return m_data.map_value->find(Key) != m_data.map_value->end();
+  const SmartMap& map = m_data.map_value->value;
+  return map.find(Key.data(), Key.size()) != map.end();
+}
+
+bool SmartObject::keyExists(const SmartKey& Key) const {
+  if (m_type != SmartType_Map) {
+    return false;
+  }
+  const SmartMap& map = m_data.map_value->value;
+  return map.find(Key) != map.end();
+}
+
+SmartMap::iterator SmartObject::map_begin() {
+  return writable_map(true).begin();
+}
+
+SmartMap::iterator SmartObject::map_end() {
+  return writable_map(true).end();
+}
+
+SmartMap::const_iterator SmartObject::map_begin() const {
+  DCHECK(m_type == SmartType_Map);
+  return m_data.map_value->value.begin();
+}
+
+SmartMap::const_iterator SmartObject::map_end() const {
+  DCHECK(m_type == SmartType_Map);
+  return m_data.map_value->value.end();
 }
 
 bool SmartObject::erase(const std::string& Key) {
   if (m_type != SmartType_Map) {
     return false;
   }
-  return (m_data.map_value->erase(Key) > 0);
+  SmartMap& map = writable_map(false);
+  SmartMap::iterator it = map.find(Key.data(), Key.size());
+  if (it == map.end()) {
+    return false;
+  }
+  map.erase(it);
+  return true;
 }
 
 bool SmartObject::isValid() const {
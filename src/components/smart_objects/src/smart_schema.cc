@@ -35,7 +35,18 @@
 namespace ns_smart_device_link {
 namespace ns_smart_objects {
 
-CSmartSchema::CSmartSchema() : mSchemaItem(CAlwaysTrueSchemaItem::create()) {}
+namespace {
+/**
+ * @brief Empty schema item has no state, so one instance is shared by all
+ * default schemas instead of allocating it for every SmartObject
+ */
+const ISchemaItemPtr& DefaultSchemaItem() {
+  static const ISchemaItemPtr item = CAlwaysTrueSchemaItem::create();
+  return item;
+}
+}  // namespace
+
+CSmartSchema::CSmartSchema() : mSchemaItem(DefaultSchemaItem()) {}
 
 CSmartSchema::CSmartSchema(const ISchemaItemPtr SchemaItem)
     : mSchemaItem(SchemaItem) {}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include "gmock/gmock.h"
+#include "smart_objects/number_schema_item.h"
+#include "smart_objects/object_schema_item.h"
+#include "smart_objects/smart_object.h"
+#include "smart_objects/string_schema_item.h"
+#include "utils/semantic_version.h"
+
+namespace test {
+namespace components {
+namespace smart_object_test {
+
+using namespace ns_smart_device_link::ns_smart_objects;
+
+namespace {
+const char kCount[] = "count";
+const char kName[] = "name";
+const char kRange[] = "range";
+
+// Keys in the order of schema members, as InterfaceGenerator emits them
+const char* const kKeys[] = {kCount, kName, kRange};
+const size_t kKeysCount = sizeof(kKeys) / sizeof(kKeys[0]);
+
+size_t compiled_calls = 0;
+
+// Validator the way InterfaceGenerator emits it for the schema below
+errors::eType ValidateTestObject(const SmartObject& object,
+                                 const CompiledMembers& members,
+                                 rpc::ValidationReport* report,
+                                 const utils::SemanticVersion& version,
+                                 const bool allow_unknown_enums) {
+  ++compiled_calls;
+  if (!CObjectSchemaItem::ValidateMapType(object, report)) {
+    return errors::INVALID_VALUE;
+  }
+  errors::eType result = errors::OK;
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[0], report, version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[1], report, version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  result = CObjectSchemaItem::ValidateVersionedMember(
+      object, members[2], report, version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  return errors::OK;
+}
+
+Members CreateMembers() {
+  std::vector<SMember> range_history;
+  range_history.push_back(
+      SMember(TNumberSchemaItem<int>::create(TSchemaItemParameter<int>(0),
+                                             TSchemaItemParameter<int>(10)),
+              false,
+              "1.0.0",
+              "5.0.0"));
+
+  Members members;
+  members[kCount] =
+      SMember(TNumberSchemaItem<int>::create(TSchemaItemParameter<int>(0),
+                                             TSchemaItemParameter<int>(10)),
+              true);
+  members[kName] = SMember(
+      CStringSchemaItem::create(TSchemaItemParameter<size_t>(1),
+                                TSchemaItemParameter<size_t>(5)),
+      false);
+  members[kRange] =
+      SMember(TNumberSchemaItem<int>::create(TSchemaItemParameter<int>(0),
+                                             TSchemaItemParameter<int>(100)),
+              true,
+              "5.0.0",
+              "",
+              false,
+              false,
+              range_history);
+  return members;
+}
+}  // namespace
+
+class CompiledValidatorTest : public ::testing::Test {
+ protected:
+  void SetUp() OVERRIDE {
+    compiled_calls = 0;
+    generic_schema_ = CObjectSchemaItem::create(CreateMembers());
+    compiled_schema_ = CObjectSchemaItem::create(CreateMembers());
+    ASSERT_TRUE(compiled_schema_->SetCompiledValidator(
+        &ValidateTestObject, kKeys, kKeysCount));
+  }
+
+  void ExpectSameAsGeneric(const SmartObject& object,
+                           const utils::SemanticVersion& version) {
+    rpc::ValidationReport generic_report("RPC");
+    rpc::ValidationReport compiled_report("RPC");
+    EXPECT_EQ(generic_schema_->validate(object, &generic_report, version),
+              compiled_schema_->validate(object, &compiled_report, version));
+    EXPECT_EQ(rpc::PrettyFormat(generic_report),
+              rpc::PrettyFormat(compiled_report));
+  }
+
+  std::shared_ptr<CObjectSchemaItem> generic_schema_;
+  std::shared_ptr<CObjectSchemaItem> compiled_schema_;
+};
+
+TEST_F(CompiledValidatorTest, Validate_CompiledValidatorUsed) {
+  SmartObject object(SmartType_Map);
+  object[kCount] = 1;
+  object[kRange] = 50;
+
+  rpc::ValidationReport report("RPC");
+  EXPECT_EQ(errors::OK, compiled_schema_->validate(object, &report));
+  EXPECT_EQ(1u, compiled_calls);
+}
+
+TEST_F(CompiledValidatorTest, SetCompiledValidator_KeysMismatch_NotSet) {
+  const char* const unsorted_keys[] = {kName, kCount, kRange};
+  EXPECT_FALSE(generic_schema_->SetCompiledValidator(
+      &ValidateTestObject, unsorted_keys, kKeysCount));
+  EXPECT_FALSE(generic_schema_->SetCompiledValidator(
+      &ValidateTestObject, kKeys, kKeysCount - 1));
+
+  rpc::ValidationReport report("RPC");
+  generic_schema_->validate(SmartObject(SmartType_Map), &report);
+  EXPECT_EQ(0u, compiled_calls);
+}
+
+TEST_F(CompiledValidatorTest, AddMember_GenericValidationUsed) {
+  SMember member(TNumberSchemaItem<int>::create(), true);
+  compiled_schema_->AddMemberSchemaItem("extra", member);
+
+  SmartObject object(SmartType_Map);
+  object[kCount] = 1;
+  object[kRange] = 50;
+
+  rpc::ValidationReport report("RPC");
+  EXPECT_EQ(errors::MISSING_MANDATORY_PARAMETER,
+            compiled_schema_->validate(object, &report));
+  EXPECT_EQ(0u, compiled_calls);
+}
+
+TEST_F(CompiledValidatorTest, Validate_SameResultAndReportAsGeneric) {
+  const utils::SemanticVersion versions[] = {utils::SemanticVersion(),
+                                             utils::SemanticVersion(2, 0, 0),
+                                             utils::SemanticVersion(5, 0, 0),
+                                             utils::SemanticVersion(6, 1, 0)};
+
+  std::vector<SmartObject> objects;
+  objects.push_back(SmartObject(SmartType_Array));
+  objects.push_back(SmartObject(SmartType_Map));
+  SmartObject valid(SmartType_Map);
+  valid[kCount] = 5;
+  valid[kName] = "abc";
+  valid[kRange] = 7;
+  objects.push_back(valid);
+  SmartObject wide_range = valid;
+  wide_range[kRange] = 70;
+  objects.push_back(wide_range);
+  SmartObject no_range = valid;
+  no_range.erase(kRange);
+  objects.push_back(no_range);
+  SmartObject long_name = valid;
+  long_name[kName] = "too long";
+  objects.push_back(long_name);
+  SmartObject bad_count = valid;
+  bad_count[kCount] = "5";
+  objects.push_back(bad_count);
+  SmartObject unknown_key = valid;
+  unknown_key["unknown"] = true;
+  objects.push_back(unknown_key);
+
+  for (size_t i = 0; i < objects.size(); ++i) {
+    for (size_t j = 0; j < sizeof(versions) / sizeof(versions[0]); ++j) {
+      SCOPED_TRACE(i * 10 + j);
+      ExpectSameAsGeneric(objects[i], versions[j]);
+    }
+  }
+}
+
+}  // namespace smart_object_test
+}  // namespace components
+}  // namespace test
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <map>
+#include <sstream>
+#include <string>
+
+#include "gmock/gmock.h"
+
+#include "smart_objects/smart_object.h"
+
+namespace test {
+namespace components {
+namespace smart_object_test {
+
+using namespace ns_smart_device_link::ns_smart_objects;
+
+namespace {
+std::string MakeKey(const size_t index) {
+  std::stringstream key;
+  key << "smart_map_test_key_" << (index * 7919) % 1000;
+  return key.str();
+}
+}  // namespace
+
+TEST(SmartKeyTest, SameString_SameKey) {
+  const std::string value = "smart_key_test_same";
+  const SmartKey first(value);
+  const SmartKey second(value.c_str());
+  const SmartKey other("smart_key_test_other");
+
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(&first.str(), &second.str());
+  EXPECT_NE(first, other);
+  EXPECT_EQ(value, static_cast<const std::string&>(first));
+  EXPECT_TRUE(other < first);
+  EXPECT_FALSE(first < second);
+}
+
+TEST(SmartKeyTest, Print_KeyStringPrinted) {
+  std::stringstream stream;
+  stream << SmartKey("smart_key_test_print");
+  EXPECT_EQ(std::string("smart_key_test_print"), stream.str());
+}
+
+TEST(SmartMapTest, Iteration_SortedByKeyString) {
+  SmartMap map;
+  std::map<std::string, int> expected;
+  for (size_t i = 0; i < 40; ++i) {
+    const std::string key = MakeKey(i);
+    map[SmartKey(key)] = static_cast<int>(i);
+    expected[key] = static_cast<int>(i);
+  }
+
+  ASSERT_EQ(expected.size(), map.size());
+  std::map<std::string, int>::const_iterator expected_it = expected.begin();
+  for (SmartMap::const_iterator it = map.begin(); it != map.end(); ++it) {
+    EXPECT_EQ(expected_it->first, it->first.str());
+    EXPECT_EQ(expected_it->second, it->second.asInt());
+    ++expected_it;
+  }
+}
+
+TEST(SmartMapTest, FindByKeyAndString_SameElement) {
+  // Both small and large maps
+  for (size_t size = 4; size <= 64; size *= 4) {
+    SmartMap map;
+    for (size_t i = 0; i < size; ++i) {
+      map[SmartKey(MakeKey(i))] = static_cast<int>(i);
+    }
+    for (size_t i = 0; i < size; ++i) {
+      const std::string key = MakeKey(i);
+      SmartMap::iterator by_key = map.find(SmartKey(key));
+      SmartMap::iterator by_string = map.find(key.data(), key.size());
+      ASSERT_TRUE(by_key != map.end());
+      EXPECT_TRUE(by_key == by_string);
+      EXPECT_EQ(static_cast<int>(i), by_key->second.asInt());
+    }
+    const std::string missing = "smart_map_test_missing";
+    EXPECT_TRUE(map.end() == map.find(SmartKey(missing)));
+    EXPECT_TRUE(map.end() == map.find(missing.data(), missing.size()));
+  }
+}
+
+TEST(SmartMapTest, Insert_ReferencesStayValid) {
+  SmartMap map;
+  SmartObject& first = map[SmartKey("smart_map_test_first")];
+  first = 1;
+  for (size_t i = 0; i < 100; ++i) {
+    map[SmartKey(MakeKey(i))] = static_cast<int>(i);
+  }
+  first = 2;
+  EXPECT_EQ(2, map[SmartKey("smart_map_test_first")].asInt());
+}
+
+TEST(SmartMapTest, Erase_OnlyErasedKeyRemoved) {
+  SmartMap map;
+  map[SmartKey("smart_map_test_a")] = 1;
+  map[SmartKey("smart_map_test_b")] = 2;
+
+  EXPECT_EQ(1u, map.erase(SmartKey("smart_map_test_a")));
+  EXPECT_EQ(0u, map.erase(SmartKey("smart_map_test_a")));
+  ASSERT_EQ(1u, map.size());
+  EXPECT_EQ(std::string("smart_map_test_b"), map.begin()->first.str());
+}
+
+TEST(SmartMapTest, Copy_Independent) {
+  SmartMap map;
+  map[SmartKey("smart_map_test_a")] = 1;
+  SmartMap copy = map;
+  copy[SmartKey("smart_map_test_a")] = 2;
+  copy[SmartKey("smart_map_test_b")] = 3;
+
+  EXPECT_EQ(1u, map.size());
+  EXPECT_EQ(1, map[SmartKey("smart_map_test_a")].asInt());
+  EXPECT_EQ(2u, copy.size());
+}
+
+TEST(SmartMapTest, LookupOfUnknownKey_NotInterned) {
+  SmartObject object(SmartType_Map);
+  object["smart_map_test_known"] = 1;
+  const SmartObject& const_object = object;
+  const size_t interned_count = SmartKey::interned_count();
+
+  EXPECT_FALSE(object.keyExists("smart_map_test_unknown_1"));
+  EXPECT_EQ(SmartType_Invalid,
+            const_object["smart_map_test_unknown_2"].getType());
+  EXPECT_FALSE(object.erase("smart_map_test_unknown_3"));
+  EXPECT_EQ(1, object["smart_map_test_known"].asInt());
+  EXPECT_EQ(interned_count, SmartKey::interned_count());
+}
+
+TEST(SmartMapTest, AccessByInternedKey_SameAsByString) {
+  const SmartKey key("smart_map_test_interned");
+  SmartObject object;
+  object[key] = 1;
+  EXPECT_EQ(1, object["smart_map_test_interned"].asInt());
+  object["smart_map_test_interned"] = 2;
+  const SmartObject& const_object = object;
+  EXPECT_EQ(2, const_object[key].asInt());
+  EXPECT_TRUE(object.keyExists(key));
+}
+
+}  // namespace smart_object_test
+}  // namespace components
+}  // namespace test
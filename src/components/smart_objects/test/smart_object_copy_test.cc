@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "gmock/gmock.h"
+
+#include "smart_objects/smart_object.h"
+
+// Allocations are counted by replaced global operator new, so this test is
+// built as a separate executable
+namespace {
+std::atomic<bool> count_allocations(false);
+std::atomic<size_t> allocations_count(0);
+}  // namespace
+
+void* operator new(size_t size) {
+  if (count_allocations) {
+    ++allocations_count;
+  }
+  void* memory = malloc(size ? size : 1);
+  if (!memory) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+// Kept out of line, otherwise compiler reports free() of memory returned
+// by operator new
+__attribute__((noinline)) void operator delete(void* memory) noexcept {
+  free(memory);
+}
+
+__attribute__((noinline)) void operator delete(void* memory,
+                                               size_t) noexcept {
+  free(memory);
+}
+
+namespace test {
+namespace components {
+namespace smart_object_test {
+
+using namespace ns_smart_device_link::ns_smart_objects;
+
+namespace {
+/**
+ * @brief Counts heap allocations made during object lifetime
+ */
+class AllocationsCounter {
+ public:
+  AllocationsCounter() {
+    allocations_count = 0;
+    count_allocations = true;
+  }
+  ~AllocationsCounter() {
+    count_allocations = false;
+  }
+  size_t count() const {
+    return allocations_count;
+  }
+};
+
+/**
+ * @brief Builds object looking like a typical Show request
+ */
+SmartObject MakeRequest() {
+  SmartObject request(SmartType_Map);
+  SmartObject& params = request["params"];
+  params["function_id"] = 13;
+  params["message_type"] = 0;
+  params["correlation_id"] = 42;
+  params["connection_key"] = 65537;
+  params["protocol_type"] = 0;
+  params["protocol_version"] = 5;
+
+  SmartObject& msg_params = request["msg_params"];
+  msg_params["mainField1"] = "Now playing: The long title of the song";
+  msg_params["mainField2"] = "Artist";
+  msg_params["alignment"] = "CENTERED";
+  for (int i = 0; i < 4; ++i) {
+    SmartObject button(SmartType_Map);
+    button["type"] = "BOTH";
+    button["text"] = "Button";
+    button["softButtonID"] = i;
+    button["isHighlighted"] = false;
+    button["systemAction"] = "DEFAULT_ACTION";
+    msg_params["softButtons"][i] = button;
+  }
+  return request;
+}
+}  // namespace
+
+TEST(SmartObjectCopyTest, Move_SourceBecomesNull) {
+  SmartObject source = MakeRequest();
+  const SmartObject expected = MakeRequest();
+
+  SmartObject moved(std::move(source));
+  EXPECT_EQ(expected, moved);
+  EXPECT_EQ(SmartType_Null, source.getType());
+
+  SmartObject assigned;
+  assigned = std::move(moved);
+  EXPECT_EQ(expected, assigned);
+  EXPECT_EQ(SmartType_Null, moved.getType());
+}
+
+TEST(SmartObjectCopyTest, MoveOwnChild_ChildTaken) {
+  SmartObject object = MakeRequest();
+  const SmartObject expected = object["msg_params"];
+
+  object = std::move(object["msg_params"]);
+  EXPECT_EQ(expected, object);
+
+  object = object["mainField2"];
+  EXPECT_EQ(SmartObject("Artist"), object);
+}
+
+TEST(SmartObjectCopyTest, Move_NoAllocations) {
+  SmartObject source = MakeRequest();
+
+  AllocationsCounter counter;
+  SmartObject moved(std::move(source));
+  SmartObject assigned;
+  assigned = std::move(moved);
+  EXPECT_EQ(0u, counter.count());
+}
+
+TEST(SmartObjectCopyTest, ShortString_StoredInline) {
+  AllocationsCounter counter;
+  SmartObject short_string("CENTERED");
+  EXPECT_EQ(0u, counter.count());
+
+  EXPECT_EQ(std::string("CENTERED"), short_string.asString());
+  EXPECT_STREQ("CENTERED", short_string.asCharArray());
+  EXPECT_EQ(8u, short_string.length());
+  EXPECT_EQ(SmartObject("CENTERED"), short_string);
+  EXPECT_EQ(SmartObject(std::string("CENTERED")), short_string);
+  EXPECT_NE(SmartObject("CENTERED_"), short_string);
+
+  EXPECT_EQ(12, SmartObject("12").asInt());
+  EXPECT_EQ('x', SmartObject("x").asChar());
+  EXPECT_TRUE(SmartObject("").empty());
+}
+
+TEST(SmartObjectCopyTest, LongString_ComparedWithInline) {
+  const std::string long_value = "Now playing: The long title of the song";
+  SmartObject long_string(long_value);
+  EXPECT_EQ(long_value, long_string.asString());
+  EXPECT_EQ(long_value.size(), long_string.length());
+  EXPECT_NE(SmartObject("Now playing"), long_string);
+}
+
+TEST(SmartObjectCopyTest, CopyThenChange_OriginalNotChanged) {
+  const SmartObject original = MakeRequest();
+  SmartObject copy = original;
+  EXPECT_EQ(original, copy);
+
+  copy["msg_params"]["mainField2"] = "Other artist";
+  copy["msg_params"]["softButtons"][0]["text"] = "Other";
+  copy["params"].erase("connection_key");
+
+  EXPECT_EQ(std::string("Artist"),
+            original["msg_params"]["mainField2"].asString());
+  EXPECT_EQ(std::string("Button"),
+            original["msg_params"]["softButtons"][0]["text"].asString());
+  EXPECT_TRUE(original["params"].keyExists("connection_key"));
+  EXPECT_NE(original, copy);
+}
+
+TEST(SmartObjectCopyTest, ChangeByReference_CopyNotChanged) {
+  SmartObject original = MakeRequest();
+  SmartObject& msg_params = original["msg_params"];
+
+  // Reference handed out above is still writable, so copy is independent
+  SmartObject copy = original;
+  msg_params["mainField2"] = "Other artist";
+
+  EXPECT_EQ(std::string("Artist"),
+            copy["msg_params"]["mainField2"].asString());
+}
+
+TEST(SmartObjectCopyTest, ChangeArrayByPointer_CopyNotChanged) {
+  SmartObject original = MakeRequest();
+  SmartObject copy = original;
+
+  SmartArray* buttons = original["msg_params"]["softButtons"].asArray();
+  ASSERT_TRUE(buttons);
+  buttons->clear();
+
+  EXPECT_EQ(0u, original["msg_params"]["softButtons"].length());
+  EXPECT_EQ(4u, copy["msg_params"]["softButtons"].length());
+}
+
+TEST(SmartObjectCopyTest, ConstIteration_ContainersStayShared) {
+  const SmartObject original = MakeRequest();
+  const SmartObject shared = original;
+  size_t keys_count = 0;
+  for (SmartMap::const_iterator it = shared.map_begin();
+       it != shared.map_end();
+       ++it) {
+    ++keys_count;
+  }
+  EXPECT_EQ(2u, keys_count);
+  const SmartArray* buttons = shared["msg_params"]["softButtons"].asArray();
+  ASSERT_TRUE(buttons);
+  EXPECT_EQ(4u, buttons->size());
+
+  AllocationsCounter counter;
+  const SmartObject copy = shared;
+  EXPECT_EQ(0u, counter.count());
+}
+
+TEST(SmartObjectCopyTest, IterateCopiesConcurrently_CopiesNotChanged) {
+  const SmartObject expected = MakeRequest();
+  const size_t kRounds = 200;
+
+  auto iterate = [](const SmartObject* object,
+                    const std::atomic<bool>* start,
+                    size_t* count) {
+    while (!*start) {
+    }
+    for (SmartMap::const_iterator it = object->map_begin();
+         it != object->map_end();
+         ++it) {
+      *count += it->second.length();
+    }
+    *count += (*object)["msg_params"]["softButtons"].asArray()->size();
+  };
+
+  for (size_t i = 0; i < kRounds; ++i) {
+    // Both copies are the only owners of the same containers
+    const SmartObject first_copy = expected;
+    const SmartObject second_copy = first_copy;
+
+    std::atomic<bool> start(false);
+    size_t first_count = 0;
+    size_t second_count = 0;
+    std::thread first_thread(iterate, &first_copy, &start, &first_count);
+    std::thread second_thread(iterate, &second_copy, &start, &second_count);
+    start = true;
+    first_thread.join();
+    second_thread.join();
+
+    ASSERT_EQ(14u, first_count);
+    ASSERT_EQ(first_count, second_count);
+    ASSERT_EQ(expected, first_copy);
+    ASSERT_EQ(expected, second_copy);
+
+    // Reading did not detach containers from each other
+    AllocationsCounter counter;
+    const SmartObject third_copy = second_copy;
+    ASSERT_EQ(0u, counter.count());
+  }
+}
+
+TEST(SmartObjectCopyTest, CopyOfCopy_NoAllocations) {
+  const SmartObject original = MakeRequest();
+  const SmartObject first_copy = original;
+
+  AllocationsCounter counter;
+  const SmartObject second_copy = first_copy;
+  EXPECT_EQ(0u, counter.count());
+  EXPECT_EQ(original, second_copy);
+}
+
+}  // namespace smart_object_test
+}  // namespace components
+}  // namespace test
@@ -47,6 +47,9 @@ class ApplicationManagerObserver
   explicit ApplicationManagerObserver(TelemetryMonitor* telemetry_monitor);
   virtual void OnMessage(std::shared_ptr<MessageMetric> metric);
 
+  void OnStageFinished(const TelemetryStage stage,
+                       const date_time::TimeDuration& begin) OVERRIDE;
+
  private:
   TelemetryMonitor* telemetry_monitor_;
 };
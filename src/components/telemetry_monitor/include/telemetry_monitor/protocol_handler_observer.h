@@ -49,6 +49,9 @@ class ProtocolHandlerObserver : public protocol_handler::PHTelemetryObserver {
 
   virtual void EndMessageProcess(std::shared_ptr<MessageMetric> m);
 
+  void OnStageFinished(const TelemetryStage stage,
+                       const date_time::TimeDuration& begin) OVERRIDE;
+
  private:
   TelemetryMonitor* telemetry_monitor_;
   std::map<uint32_t, date_time::TimeDuration> time_starts;
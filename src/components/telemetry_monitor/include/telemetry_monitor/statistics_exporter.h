@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_COMPONENTS_TELEMETRY_MONITOR_INCLUDE_TELEMETRY_MONITOR_STATISTICS_EXPORTER_H_
+#define SRC_COMPONENTS_TELEMETRY_MONITOR_INCLUDE_TELEMETRY_MONITOR_STATISTICS_EXPORTER_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <string>
+
+#include "telemetry_monitor/stage_statistics.h"
+#include "utils/conditional_variable.h"
+#include "utils/lock.h"
+#include "utils/macro.h"
+#include "utils/threads/thread_delegate.h"
+
+namespace telemetry_monitor {
+
+/**
+ * @brief Periodically formats stage statistics and writes them to log.
+ * If socket path is set, serves the latest report over unix socket: every
+ * connected reader receives the report and is disconnected, so any number
+ * of local readers can poll statistics independently
+ */
+class StatisticsExporter : public threads::ThreadDelegate {
+ public:
+  /**
+   * @param statistics Statistics to export, must outlive exporter
+   * @param socket_path Path of unix socket or empty string
+   * @param period Export period in milliseconds
+   */
+  StatisticsExporter(const StageStatistics& statistics,
+                     const std::string& socket_path,
+                     const uint32_t period);
+  ~StatisticsExporter();
+
+  void threadMain() OVERRIDE;
+  void exitThreadMain() OVERRIDE;
+
+ private:
+  bool OpenSocket();
+  void CloseSocket();
+
+  /**
+   * @brief Serves readers connected to socket until timeout expires
+   * or exporter is stopped
+   * @param timeout Timeout in milliseconds
+   */
+  void ServeReaders(const uint32_t timeout);
+
+  /**
+   * @brief Sleeps until timeout expires or exporter is stopped
+   * @param timeout Timeout in milliseconds
+   */
+  void Wait(const uint32_t timeout);
+
+  const StageStatistics& statistics_;
+  const std::string socket_path_;
+  const uint32_t period_;
+  std::atomic<int32_t> socket_fd_;
+  std::atomic<bool> stop_flag_;
+  std::string report_;
+  sync_primitives::Lock wait_lock_;
+  sync_primitives::ConditionalVariable wait_condition_;
+
+  DISALLOW_COPY_AND_ASSIGN(StatisticsExporter);
+};
+
+}  // namespace telemetry_monitor
+#endif  // SRC_COMPONENTS_TELEMETRY_MONITOR_INCLUDE_TELEMETRY_MONITOR_STATISTICS_EXPORTER_H_
@@ -40,6 +40,8 @@
 #include "protocol_handler_observer.h"
 #include "telemetry_monitor/application_manager_observer.h"
 #include "telemetry_monitor/metric_wrapper.h"
+#include "telemetry_monitor/stage_statistics.h"
+#include "telemetry_monitor/statistics_exporter.h"
 #include "telemetry_monitor/transport_manager_observer.h"
 #include "transport_manager/transport_manager_impl.h"
 #include "utils/message_queue.h"
@@ -76,7 +78,10 @@ class Streamer : public threads::ThreadDelegate {
 
 class TelemetryMonitor {
  public:
-  TelemetryMonitor(const std::string& server_address, uint16_t port);
+  TelemetryMonitor(const std::string& server_address,
+                   uint16_t port,
+                   const std::string& statistics_socket = std::string(),
+                   const uint32_t statistics_period = 0);
   virtual ~TelemetryMonitor();
   virtual void Init(
       TelemetryObservable<protocol_handler::PHTelemetryObserver>*
@@ -88,6 +93,18 @@ class TelemetryMonitor {
   virtual void Stop();
   virtual void Start();
   virtual void SendMetric(std::shared_ptr<MetricWrapper> metric);
+  /**
+   * @brief Checks if streaming client is connected, observers skip
+   * building of per message metrics otherwise
+   */
+  virtual bool IsStreaming() const;
+  /**
+   * @brief Adds latency of stage finished right now to statistics
+   * @param stage Finished stage
+   * @param begin Time stage was started
+   */
+  virtual void RecordStage(const TelemetryStage stage,
+                           const date_time::TimeDuration& begin);
   void set_streamer(std::shared_ptr<Streamer> streamer);
   const std::string& ip() const;
   int16_t port() const;
@@ -97,6 +114,11 @@ class TelemetryMonitor {
   int16_t port_;
   threads::Thread* thread_;
   std::shared_ptr<Streamer> streamer_;
+  StageStatistics stage_statistics_;
+  const std::string statistics_socket_;
+  const uint32_t statistics_period_;
+  StatisticsExporter* exporter_;
+  threads::Thread* exporter_thread_;
   ApplicationManagerObserver app_observer;
   TransportManagerObserver tm_observer;
   ProtocolHandlerObserver ph_observer;
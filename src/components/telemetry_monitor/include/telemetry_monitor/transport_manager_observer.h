@@ -35,6 +35,7 @@
 
 #include "transport_manager/telemetry_observer.h"
 #include "utils/date_time.h"
+#include "utils/lock.h"
 #include "utils/message_queue.h"
 
 namespace telemetry_monitor {
@@ -47,8 +48,13 @@ class TransportManagerObserver : public transport_manager::TMTelemetryObserver {
   virtual void StartRawMsg(const protocol_handler::RawMessage* ptr);
   virtual void StopRawMsg(const protocol_handler::RawMessage* ptr);
 
+  void OnStageFinished(const TelemetryStage stage,
+                       const date_time::TimeDuration& begin) OVERRIDE;
+
  private:
   TelemetryMonitor* telemetry_monitor_;
+  // Started on transport adapter threads, stopped on transport manager thread
+  sync_primitives::Lock time_starts_lock_;
   std::map<const protocol_handler::RawMessage*, date_time::TimeDuration>
       time_starts;
 };
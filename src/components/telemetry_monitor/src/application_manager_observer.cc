@@ -42,9 +42,17 @@ ApplicationManagerObserver::ApplicationManagerObserver(
 
 void ApplicationManagerObserver::OnMessage(
     std::shared_ptr<MessageMetric> metric) {
+  if (!telemetry_monitor_->IsStreaming()) {
+    return;
+  }
   auto m = std::make_shared<ApplicationManagerMetricWrapper>();
   m->message_metric = metric;
   m->grabResources();
   telemetry_monitor_->SendMetric(m);
 }
+
+void ApplicationManagerObserver::OnStageFinished(
+    const TelemetryStage stage, const date_time::TimeDuration& begin) {
+  telemetry_monitor_->RecordStage(stage, begin);
+}
 }  // namespace telemetry_monitor
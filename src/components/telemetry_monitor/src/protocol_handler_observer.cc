@@ -67,9 +67,17 @@ void ProtocolHandlerObserver::EndMessageProcess(
   }
   m->begin = time_starts[message_id];
   m->end = date_time::getCurrentTime();
+  if (!telemetry_monitor_->IsStreaming()) {
+    return;
+  }
   auto metric = std::make_shared<ProtocolHandlerMecticWrapper>();
   metric->message_metric = m;
   metric->grabResources();
   telemetry_monitor_->SendMetric(metric);
 }
+
+void ProtocolHandlerObserver::OnStageFinished(
+    const TelemetryStage stage, const date_time::TimeDuration& begin) {
+  telemetry_monitor_->RecordStage(stage, begin);
+}
 }  // namespace telemetry_monitor
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "telemetry_monitor/stage_statistics.h"
+
+#include <sstream>
+
+#include "utils/date_time.h"
+
+namespace telemetry_monitor {
+
+namespace {
+const double kReportedPercentiles[] = {50.0, 90.0, 99.0, 99.9};
+}  // namespace
+
+StageStatistics::StageStatistics() {}
+
+void StageStatistics::Record(const TelemetryStage stage,
+                             const uint64_t latency) {
+  DCHECK_OR_RETURN_VOID(stage < kStagesCount);
+  histograms_[stage].Record(latency);
+}
+
+std::string StageStatistics::Format() const {
+  std::ostringstream report;
+  report << "time_ms " << date_time::getmSecs(date_time::getCurrentTime())
+         << "\n"
+         << "stage count sum_us max_us p50_us p90_us p99_us p999_us\n";
+  utils::LatencyHistogram::Snapshot snapshot;
+  for (size_t stage = 0; stage < kStagesCount; ++stage) {
+    histograms_[stage].TakeSnapshot(snapshot);
+    report << StageName(static_cast<TelemetryStage>(stage)) << ' '
+           << snapshot.count << ' ' << snapshot.sum << ' ' << snapshot.max;
+    for (size_t i = 0; i < ARRAYSIZE(kReportedPercentiles); ++i) {
+      report << ' ' << snapshot.ValueAtPercentile(kReportedPercentiles[i]);
+    }
+    report << "\n";
+  }
+  return report.str();
+}
+
+const char* StageStatistics::StageName(const TelemetryStage stage) {
+  switch (stage) {
+    case kTransportReceive:
+      return "transport_receive";
+    case kFrameParse:
+      return "frame_parse";
+    case kMultiFrameAssembly:
+      return "multiframe_assembly";
+    case kRpcParse:
+      return "rpc_parse";
+    case kValidation:
+      return "validation";
+    case kCommandRun:
+      return "command_run";
+    case kHmiSend:
+      return "hmi_send";
+    default:
+      return "unknown";
+  }
+}
+
+}  // namespace telemetry_monitor
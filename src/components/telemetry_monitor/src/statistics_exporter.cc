@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "telemetry_monitor/statistics_exporter.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <chrono>
+
+#include "utils/logger.h"
+
+namespace telemetry_monitor {
+
+SDL_CREATE_LOG_VARIABLE("TelemetryMonitor")
+
+StatisticsExporter::StatisticsExporter(const StageStatistics& statistics,
+                                       const std::string& socket_path,
+                                       const uint32_t period)
+    : statistics_(statistics)
+    , socket_path_(socket_path)
+    , period_(period)
+    , socket_fd_(-1)
+    , stop_flag_(false) {}
+
+StatisticsExporter::~StatisticsExporter() {
+  CloseSocket();
+}
+
+void StatisticsExporter::threadMain() {
+  SDL_LOG_AUTO_TRACE();
+  const bool serve_readers = !socket_path_.empty() && OpenSocket();
+  while (!stop_flag_) {
+    report_ = statistics_.Format();
+    SDL_LOG_DEBUG("Stage statistics:\n" << report_);
+    if (serve_readers) {
+      ServeReaders(period_);
+    } else {
+      Wait(period_);
+    }
+  }
+  CloseSocket();
+}
+
+void StatisticsExporter::exitThreadMain() {
+  SDL_LOG_AUTO_TRACE();
+  stop_flag_ = true;
+  const int32_t socket_fd = socket_fd_;
+  if (0 <= socket_fd) {
+    // Wakes up poll() of listening socket
+    ::shutdown(socket_fd, SHUT_RDWR);
+  }
+  sync_primitives::AutoLock auto_lock(wait_lock_);
+  wait_condition_.NotifyOne();
+}
+
+bool StatisticsExporter::OpenSocket() {
+  sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  if (socket_path_.size() >= sizeof(address.sun_path)) {
+    SDL_LOG_ERROR("Statistics socket path is too long: " << socket_path_);
+    return false;
+  }
+  address.sun_family = AF_UNIX;
+  strncpy(address.sun_path, socket_path_.c_str(), sizeof(address.sun_path));
+
+  const int32_t socket_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (0 > socket_fd) {
+    SDL_LOG_ERROR("Unable to create statistics socket: " << strerror(errno));
+    return false;
+  }
+  // Socket file may be left by previous run
+  ::unlink(socket_path_.c_str());
+  if (-1 == ::bind(socket_fd,
+                   reinterpret_cast<sockaddr*>(&address),
+                   sizeof(address)) ||
+      -1 == ::listen(socket_fd, SOMAXCONN)) {
+    SDL_LOG_ERROR("Unable to listen statistics socket "
+                  << socket_path_ << ": " << strerror(errno));
+    ::close(socket_fd);
+    return false;
+  }
+  socket_fd_ = socket_fd;
+  SDL_LOG_INFO("Stage statistics are served on " << socket_path_);
+  return true;
+}
+
+void StatisticsExporter::CloseSocket() {
+  const int32_t socket_fd = socket_fd_.exchange(-1);
+  if (0 > socket_fd) {
+    return;
+  }
+  ::close(socket_fd);
+  ::unlink(socket_path_.c_str());
+}
+
+void StatisticsExporter::ServeReaders(const uint32_t timeout) {
+  const std::chrono::steady_clock::time_point deadline =
+      std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+  while (!stop_flag_) {
+    const int64_t remaining =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now())
+            .count();
+    if (0 >= remaining) {
+      return;
+    }
+    pollfd listening = {socket_fd_, POLLIN, 0};
+    const int result = ::poll(&listening, 1, static_cast<int>(remaining));
+    if (0 > result) {
+      if (EINTR == errno) {
+        continue;
+      }
+      SDL_LOG_ERROR("Statistics socket poll failed: " << strerror(errno));
+      Wait(static_cast<uint32_t>(remaining));
+      return;
+    }
+    if (0 == result) {
+      return;
+    }
+    if (listening.revents & (POLLHUP | POLLERR | POLLNVAL)) {
+      Wait(static_cast<uint32_t>(remaining));
+      return;
+    }
+    const int32_t reader_fd = ::accept(socket_fd_, NULL, NULL);
+    if (0 > reader_fd) {
+      continue;
+    }
+    // Report fits into socket buffer, slow readers must not block exporter
+    if (-1 == ::send(reader_fd,
+                     report_.c_str(),
+                     report_.size(),
+                     MSG_NOSIGNAL | MSG_DONTWAIT)) {
+      SDL_LOG_WARN("Unable to send statistics: " << strerror(errno));
+    }
+    ::close(reader_fd);
+  }
+}
+
+void StatisticsExporter::Wait(const uint32_t timeout) {
+  sync_primitives::AutoLock auto_lock(wait_lock_);
+  if (!stop_flag_) {
+    wait_condition_.WaitFor(auto_lock, timeout);
+  }
+}
+
+}  // namespace telemetry_monitor
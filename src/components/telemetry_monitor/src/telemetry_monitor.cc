@@ -50,10 +50,16 @@ namespace telemetry_monitor {
 SDL_CREATE_LOG_VARIABLE("TelemetryMonitor")
 
 TelemetryMonitor::TelemetryMonitor(const std::string& server_address,
-                                   uint16_t port)
+                                   uint16_t port,
+                                   const std::string& statistics_socket,
+                                   const uint32_t statistics_period)
     : server_address_(server_address)
     , port_(port)
     , thread_(NULL)
+    , statistics_socket_(statistics_socket)
+    , statistics_period_(statistics_period)
+    , exporter_(NULL)
+    , exporter_thread_(NULL)
     , app_observer(this)
     , tm_observer(this)
     , ph_observer(this) {}
@@ -61,6 +67,11 @@ TelemetryMonitor::TelemetryMonitor(const std::string& server_address,
 void TelemetryMonitor::Start() {
   streamer_ = streamer_ ? streamer_ : std::make_shared<Streamer>(this);
   thread_ = threads::CreateThread("TelemetryMonitor", streamer_.get());
+  if (statistics_period_ > 0 && !exporter_thread_) {
+    exporter_ = new StatisticsExporter(
+        stage_statistics_, statistics_socket_, statistics_period_);
+    exporter_thread_ = threads::CreateThread("TelemetryStats", exporter_);
+  }
 }
 
 void TelemetryMonitor::set_streamer(std::shared_ptr<Streamer> streamer) {
@@ -100,6 +111,9 @@ void TelemetryMonitor::Init(
 
   DCHECK_OR_RETURN_VOID(thread_);
   thread_->Start(threads::ThreadOptions());
+  if (exporter_thread_) {
+    exporter_thread_->Start(threads::ThreadOptions());
+  }
 }
 
 void TelemetryMonitor::Stop() {
@@ -112,14 +126,32 @@ void TelemetryMonitor::Stop() {
     threads::DeleteThread(thread_);
   }
   thread_ = NULL;
+  if (exporter_thread_) {
+    exporter_thread_->Stop(threads::Thread::kThreadSoftStop);
+    delete exporter_;
+    threads::DeleteThread(exporter_thread_);
+  }
+  exporter_thread_ = NULL;
+  exporter_ = NULL;
 }
 
 void TelemetryMonitor::SendMetric(std::shared_ptr<MetricWrapper> metric) {
-  if (streamer_ && streamer_->is_client_connected_) {
+  if (IsStreaming()) {
     streamer_->PushMessage(metric);
   }
 }
 
+bool TelemetryMonitor::IsStreaming() const {
+  return streamer_ && streamer_->is_client_connected_;
+}
+
+void TelemetryMonitor::RecordStage(const TelemetryStage stage,
+                                   const date_time::TimeDuration& begin) {
+  const int64_t latency =
+      date_time::getuSecs(date_time::getCurrentTime() - begin);
+  stage_statistics_.Record(stage, latency > 0 ? latency : 0);
+}
+
 Streamer::Streamer(TelemetryMonitor* const server)
     : is_client_connected_(false)
     , kserver_(server)
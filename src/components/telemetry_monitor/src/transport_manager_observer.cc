@@ -44,24 +44,40 @@ TransportManagerObserver::TransportManagerObserver(
 
 void TransportManagerObserver::StartRawMsg(
     const protocol_handler::RawMessage* ptr) {
-  time_starts[ptr] = date_time::getCurrentTime();
+  const date_time::TimeDuration begin = date_time::getCurrentTime();
+  sync_primitives::AutoLock auto_lock(time_starts_lock_);
+  time_starts[ptr] = begin;
 }
 
 void TransportManagerObserver::StopRawMsg(
     const protocol_handler::RawMessage* ptr) {
-  std::map<const protocol_handler::RawMessage*,
-           date_time::TimeDuration>::const_iterator it;
-  it = time_starts.find(ptr);
-  if (it != time_starts.end()) {
-    auto m = std::make_shared<TransportManagerMecticWrapper>();
-    m->message_metric = std::make_shared<
-        transport_manager::TMTelemetryObserver::MessageMetric>();
-    m->message_metric->begin = it->second;
-    m->message_metric->end = date_time::getCurrentTime();
-    m->message_metric->data_size = ptr->data_size();
-    m->grabResources();
-    telemetry_monitor_->SendMetric(m);
+  date_time::TimeDuration begin;
+  {
+    sync_primitives::AutoLock auto_lock(time_starts_lock_);
+    std::map<const protocol_handler::RawMessage*,
+             date_time::TimeDuration>::iterator it = time_starts.find(ptr);
+    if (it == time_starts.end()) {
+      return;
+    }
+    begin = it->second;
+    time_starts.erase(it);
   }
+  if (!telemetry_monitor_->IsStreaming()) {
+    return;
+  }
+  auto m = std::make_shared<TransportManagerMecticWrapper>();
+  m->message_metric =
+      std::make_shared<transport_manager::TMTelemetryObserver::MessageMetric>();
+  m->message_metric->begin = begin;
+  m->message_metric->end = date_time::getCurrentTime();
+  m->message_metric->data_size = ptr->data_size();
+  m->grabResources();
+  telemetry_monitor_->SendMetric(m);
+}
+
+void TransportManagerObserver::OnStageFinished(
+    const TelemetryStage stage, const date_time::TimeDuration& begin) {
+  telemetry_monitor_->RecordStage(stage, begin);
 }
 
 }  // namespace telemetry_monitor
@@ -44,6 +44,7 @@ namespace telemetry_monitor_test {
 
 using namespace telemetry_monitor;
 using ::testing::_;
+using ::testing::Return;
 
 TEST(ApplicationManagerObserver, CallOnMessage) {
   MockTelemetryMonitor mock_telemetry_monitor;
@@ -51,6 +52,7 @@ TEST(ApplicationManagerObserver, CallOnMessage) {
   typedef application_manager::AMTelemetryObserver::MessageMetric AMMetric;
   std::shared_ptr<AMMetric> ptr =
       application_manager::AMTelemetryObserver::MessageMetricSharedPtr();
+  EXPECT_CALL(mock_telemetry_monitor, IsStreaming()).WillOnce(Return(true));
   EXPECT_CALL(mock_telemetry_monitor, SendMetric(_));
   app_observer.OnMessage(ptr);
 }
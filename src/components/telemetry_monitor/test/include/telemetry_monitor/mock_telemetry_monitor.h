@@ -50,6 +50,10 @@ class MockTelemetryMonitor : public telemetry_monitor::TelemetryMonitor {
   MOCK_METHOD0(Start, void());
   MOCK_METHOD1(SendMetric,
                void(std::shared_ptr<telemetry_monitor::MetricWrapper> metric));
+  MOCK_CONST_METHOD0(IsStreaming, bool());
+  MOCK_METHOD2(RecordStage,
+               void(const telemetry_monitor::TelemetryStage stage,
+                    const date_time::TimeDuration& begin));
 };
 }  // namespace telemetry_monitor_test
 }  // namespace components
@@ -41,6 +41,7 @@ namespace telemetry_monitor_test {
 
 using namespace telemetry_monitor;
 using ::testing::_;
+using ::testing::Return;
 
 TEST(ProtocolHandlerObserverTest, MessageProcess) {
   MockTelemetryMonitor mock_telemetry_monitor;
@@ -54,6 +55,7 @@ TEST(ProtocolHandlerObserverTest, MessageProcess) {
   typedef protocol_handler::PHTelemetryObserver::MessageMetric MetricType;
   std::shared_ptr<MetricType> message_metric = std::make_shared<MetricType>();
   message_metric->message_id = 1;
+  EXPECT_CALL(mock_telemetry_monitor, IsStreaming()).WillOnce(Return(true));
   EXPECT_CALL(mock_telemetry_monitor, SendMetric(_));
   pr_handler.EndMessageProcess(message_metric);
 }
@@ -74,6 +76,33 @@ TEST(ProtocolHandlerObserverTest, MessageProcessWithZeroMessageId) {
   pr_handler.EndMessageProcess(message_metric);
 }
 
+TEST(ProtocolHandlerObserverTest, MessageProcessWithoutStreaming) {
+  MockTelemetryMonitor mock_telemetry_monitor;
+
+  ProtocolHandlerObserver pr_handler(&mock_telemetry_monitor);
+  uint32_t message_id = 1;
+  date_time::TimeDuration start_time = date_time::seconds(1);
+
+  pr_handler.StartMessageProcess(message_id, start_time);
+
+  typedef protocol_handler::PHTelemetryObserver::MessageMetric MetricType;
+  std::shared_ptr<MetricType> message_metric = std::make_shared<MetricType>();
+  message_metric->message_id = 1;
+  EXPECT_CALL(mock_telemetry_monitor, IsStreaming()).WillOnce(Return(false));
+  EXPECT_CALL(mock_telemetry_monitor, SendMetric(_)).Times(0);
+  pr_handler.EndMessageProcess(message_metric);
+}
+
+TEST(ProtocolHandlerObserverTest, StageFinished) {
+  MockTelemetryMonitor mock_telemetry_monitor;
+
+  ProtocolHandlerObserver pr_handler(&mock_telemetry_monitor);
+  date_time::TimeDuration start_time = date_time::seconds(1);
+
+  EXPECT_CALL(mock_telemetry_monitor, RecordStage(kFrameParse, start_time));
+  pr_handler.OnStageFinished(kFrameParse, start_time);
+}
+
 }  // namespace telemetry_monitor_test
 }  // namespace components
 }  // namespace test
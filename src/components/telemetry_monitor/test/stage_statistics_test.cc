@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "telemetry_monitor/stage_statistics.h"
+
+namespace test {
+namespace components {
+namespace telemetry_monitor_test {
+
+using namespace telemetry_monitor;
+
+TEST(StageStatisticsTest, FormatContainsAllStages) {
+  StageStatistics statistics;
+  statistics.Record(kRpcParse, 10);
+  statistics.Record(kRpcParse, 20);
+
+  std::istringstream report(statistics.Format());
+  std::string line;
+  ASSERT_FALSE(std::getline(report, line).fail());
+  EXPECT_EQ(0u, line.find("time_ms "));
+  ASSERT_FALSE(std::getline(report, line).fail());
+  EXPECT_EQ(0u, line.find("stage "));
+
+  size_t stages = 0;
+  while (std::getline(report, line)) {
+    std::istringstream fields(line);
+    std::string name;
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    fields >> name >> count >> sum;
+    if (StageStatistics::StageName(kRpcParse) == name) {
+      EXPECT_EQ(2u, count);
+      EXPECT_EQ(30u, sum);
+    } else {
+      EXPECT_EQ(0u, count);
+    }
+    ++stages;
+  }
+  EXPECT_EQ(static_cast<size_t>(kStagesCount), stages);
+}
+
+}  // namespace telemetry_monitor_test
+}  // namespace components
+}  // namespace test
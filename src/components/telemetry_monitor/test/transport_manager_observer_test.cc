@@ -42,6 +42,7 @@ namespace telemetry_monitor_test {
 
 using namespace telemetry_monitor;
 using ::testing::_;
+using ::testing::Return;
 
 TEST(TransportManagerObserverTest, MessageProcess) {
   MockTelemetryMonitor mock_telemetry_monitor;
@@ -49,11 +50,25 @@ TEST(TransportManagerObserverTest, MessageProcess) {
   protocol_handler::RawMessage* ptr =
       new ::protocol_handler::RawMessage(0, 0, NULL, 0, false);
   tr_observer.StartRawMsg(ptr);
+  EXPECT_CALL(mock_telemetry_monitor, IsStreaming()).WillOnce(Return(true));
   EXPECT_CALL(mock_telemetry_monitor, SendMetric(_));
   tr_observer.StopRawMsg(ptr);
   delete ptr;
 }
 
+TEST(TransportManagerObserverTest, MessageProcessedOnce) {
+  MockTelemetryMonitor mock_telemetry_monitor;
+  TransportManagerObserver tr_observer(&mock_telemetry_monitor);
+  protocol_handler::RawMessage* ptr =
+      new ::protocol_handler::RawMessage(0, 0, NULL, 0, false);
+  tr_observer.StartRawMsg(ptr);
+  EXPECT_CALL(mock_telemetry_monitor, IsStreaming()).WillOnce(Return(false));
+  EXPECT_CALL(mock_telemetry_monitor, SendMetric(_)).Times(0);
+  tr_observer.StopRawMsg(ptr);
+  tr_observer.StopRawMsg(ptr);
+  delete ptr;
+}
+
 }  // namespace telemetry_monitor_test
 }  // namespace components
 }  // namespace test
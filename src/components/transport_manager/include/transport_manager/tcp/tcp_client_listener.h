@@ -37,6 +37,7 @@
 #define SRC_COMPONENTS_TRANSPORT_MANAGER_INCLUDE_TRANSPORT_MANAGER_TCP_TCP_CLIENT_LISTENER_H_
 
 #include "transport_manager/transport_adapter/client_connection_listener.h"
+#include "transport_manager/transport_adapter/socket_reactor.h"
 
 #include <atomic>
 
@@ -67,11 +68,14 @@ class TcpClientListener : public ClientConnectionListener {
    *listen on. If empty, then this process will listen on all network
    *interfaces.
    *connections
+   * @param reactor Reactor serving accepted connections, if empty each
+   *connection runs its own thread.
    */
   TcpClientListener(TransportAdapterController* controller,
                     uint16_t port,
                     bool enable_keepalive,
-                    const std::string designated_interface = "");
+                    const std::string designated_interface = "",
+                    const SocketReactorSPtr& reactor = SocketReactorSPtr());
 
   /**
    * @brief Destructor.
@@ -157,6 +161,7 @@ class TcpClientListener : public ClientConnectionListener {
   int pipe_fds_[2];
   NetworkInterfaceListener* interface_listener_;
   const std::string designated_interface_;
+  SocketReactorSPtr reactor_;
   std::string current_ip_address_;
   sync_primitives::Lock start_stop_lock_;
 
@@ -37,6 +37,7 @@
 #define SRC_COMPONENTS_TRANSPORT_MANAGER_INCLUDE_TRANSPORT_MANAGER_TCP_TCP_CONNECTION_FACTORY_H_
 
 #include "transport_manager/transport_adapter/server_connection_factory.h"
+#include "transport_manager/transport_adapter/socket_reactor.h"
 
 namespace transport_manager {
 namespace transport_adapter {
@@ -52,8 +53,12 @@ class TcpConnectionFactory : public ServerConnectionFactory {
    * @brief Constructor.
    *
    * @param controller Pointer to the device adapter controller.
+   * @param reactor Reactor serving created connections, if empty each
+   * connection runs its own thread.
    */
-  explicit TcpConnectionFactory(TransportAdapterController* controller);
+  explicit TcpConnectionFactory(
+      TransportAdapterController* controller,
+      const SocketReactorSPtr& reactor = SocketReactorSPtr());
 
   /**
    * @brief Start TCP connection factory.
@@ -91,6 +96,7 @@ class TcpConnectionFactory : public ServerConnectionFactory {
 
  private:
   TransportAdapterController* controller_;
+  SocketReactorSPtr reactor_;
 };
 
 }  // namespace transport_adapter
@@ -55,10 +55,14 @@ class TcpServerOriginatedSocketConnection : public ThreadedSocketConnection {
    * @param device_uid Device unique identifier.
    * @param app_handle Handle of application.
    * @param controller Pointer to the device adapter controller.
+   * @param reactor Reactor serving the connection, if empty connection runs
+   * its own thread.
    */
-  TcpServerOriginatedSocketConnection(const DeviceUID& device_uid,
-                                      const ApplicationHandle& app_handle,
-                                      TransportAdapterController* controller);
+  TcpServerOriginatedSocketConnection(
+      const DeviceUID& device_uid,
+      const ApplicationHandle& app_handle,
+      TransportAdapterController* controller,
+      const SocketReactorSPtr& reactor = SocketReactorSPtr());
 
   /**
    * @brief Destructor.
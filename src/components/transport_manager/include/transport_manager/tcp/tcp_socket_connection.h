@@ -54,10 +54,13 @@ class TcpSocketConnection : public ThreadedSocketConnection {
    * @param device_uid Device unique identifier.
    * @param app_handle Handle of application.
    * @param controller Pointer to the TCP device adapter controller.
+   * @param reactor Reactor serving the connection, if empty connection runs
+   * its own thread.
    */
   TcpSocketConnection(const DeviceUID& device_uid,
                       const ApplicationHandle& app_handle,
-                      TransportAdapterController* controller);
+                      TransportAdapterController* controller,
+                      const SocketReactorSPtr& reactor = SocketReactorSPtr());
 
   /**
    * @brief Destructor.
@@ -36,6 +36,7 @@
 #ifndef SRC_COMPONENTS_TRANSPORT_MANAGER_INCLUDE_TRANSPORT_MANAGER_TCP_TCP_TRANSPORT_ADAPTER_H_
 #define SRC_COMPONENTS_TRANSPORT_MANAGER_INCLUDE_TRANSPORT_MANAGER_TCP_TCP_TRANSPORT_ADAPTER_H_
 
+#include "transport_manager/transport_adapter/socket_reactor.h"
 #include "transport_manager/transport_adapter/transport_adapter_impl.h"
 
 namespace transport_manager {
@@ -91,6 +92,22 @@ class TcpTransportAdapter : public TransportAdapterImpl {
   virtual bool Restore();
 
  private:
+  /**
+   * @brief Constructor sharing one reactor between listener and factory.
+   */
+  TcpTransportAdapter(uint16_t port,
+                      resumption::LastStateWrapperPtr last_state_wrapper,
+                      const TransportManagerSettings& settings,
+                      const SocketReactorSPtr& reactor);
+
+  /**
+   * @brief Creates reactor for TCP connections if it is enabled in settings
+   *
+   * @return Reactor or empty pointer if connections must run own threads
+   */
+  static SocketReactorSPtr CreateSocketReactor(
+      const TransportManagerSettings& settings);
+
   /**
    * @brief Keeps transport specific configuration
    *
@@ -34,12 +34,13 @@
 #define SRC_COMPONENTS_TRANSPORT_MANAGER_INCLUDE_TRANSPORT_MANAGER_TELEMETRY_OBSERVER_H_
 
 #include "protocol/raw_message.h"
+#include "telemetry_monitor/telemetry_stage.h"
 #include "transport_manager/common.h"
 #include "utils/date_time.h"
 
 namespace transport_manager {
 
-class TMTelemetryObserver {
+class TMTelemetryObserver : public telemetry_monitor::StageTelemetryObserver {
  public:
   struct MessageMetric {
     date_time::TimeDuration begin;
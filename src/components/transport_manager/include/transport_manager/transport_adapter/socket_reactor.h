@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_COMPONENTS_TRANSPORT_MANAGER_INCLUDE_TRANSPORT_MANAGER_TRANSPORT_ADAPTER_SOCKET_REACTOR_H_
+#define SRC_COMPONENTS_TRANSPORT_MANAGER_INCLUDE_TRANSPORT_MANAGER_TRANSPORT_ADAPTER_SOCKET_REACTOR_H_
+
+#include <stdint.h>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "utils/conditional_variable.h"
+#include "utils/lock.h"
+#include "utils/macro.h"
+#include "utils/threads/thread.h"
+#include "utils/threads/thread_delegate.h"
+
+namespace transport_manager {
+namespace transport_adapter {
+
+/**
+ * @brief Shared epoll based I/O loop for socket connections.
+ * A small fixed pool of loop threads multiplexes all registered sockets
+ * instead of running one thread per connection. Send notifications are
+ * delivered through one eventfd per loop thread.
+ * Blocking connection establishment is executed on connector threads, one
+ * per loop, so it never stalls the loops and a slow peer delays only
+ * connections queued after it on the same connector.
+ * Thread-safe class
+ */
+class SocketReactor {
+ public:
+  /**
+   * @brief Callback interface of registered connection
+   */
+  class Handler {
+   public:
+    virtual ~Handler() {}
+
+    /**
+     * @brief Called on one of the connector threads after Connect()
+     */
+    virtual void OnConnect() = 0;
+
+    /**
+     * @brief Called on a loop thread when socket is ready or Notify() was
+     * called. Notification is reported as EPOLLOUT
+     * @param events Mask of epoll events
+     */
+    virtual void OnEvents(const uint32_t events) = 0;
+  };
+
+  /**
+   * @brief Registration node embedded into the connection object.
+   * Must not be destroyed before Remove() was called for it
+   */
+  class Entry {
+   public:
+    explicit Entry(Handler* handler);
+
+   private:
+    friend class SocketReactor;
+
+    Handler* handler_;
+    int fd_;
+    size_t loop_index_;
+    bool connect_queued_;
+    bool notify_queued_;
+    bool write_interest_;
+
+    DISALLOW_COPY_AND_ASSIGN(Entry);
+  };
+
+  /**
+   * @brief Constructor, starts loop and connector threads
+   * @param loops_count Number of epoll loop threads, as well as of connector
+   * threads
+   */
+  explicit SocketReactor(const size_t loops_count);
+
+  /**
+   * @brief Destructor, stops all threads.
+   * Entries still registered are dropped without calling their handlers
+   */
+  ~SocketReactor();
+
+  /**
+   * @brief Checks that all threads were started
+   */
+  bool IsInitialised() const;
+
+  /**
+   * @brief Queues Handler::OnConnect() call to the first free connector
+   * @param entry Entry to connect
+   */
+  void Connect(Entry* entry);
+
+  /**
+   * @brief Starts watching socket for input and errors
+   * @param entry Entry to watch socket for
+   * @param fd Non-blocking socket
+   * @return True if socket was registered
+   */
+  bool Watch(Entry* entry, const int fd);
+
+  /**
+   * @brief Enables or disables reporting of socket writability
+   * @param entry Watched entry
+   * @param enabled True to report EPOLLOUT
+   */
+  void SetWriteInterest(Entry* entry, const bool enabled);
+
+  /**
+   * @brief Wakes up loop thread of the entry to call Handler::OnEvents().
+   * Does nothing if entry is not watched
+   * @param entry Entry to notify
+   */
+  void Notify(Entry* entry);
+
+  /**
+   * @brief Unregisters entry and waits until no reactor thread can call its
+   * handler anymore, so the entry can be destroyed afterwards.
+   * Does not wait if called from the handler of the entry. Socket must be
+   * closed only after this call
+   * @param entry Entry to remove
+   */
+  void Remove(Entry* entry);
+
+ private:
+  struct Loop {
+    Loop();
+
+    int epoll_fd;
+    int event_fd;
+    std::vector<Entry*> notified;
+    /**
+     * @brief Entries removed by the loop thread itself while dispatching,
+     * skipped till the end of the current batch
+     */
+    std::vector<Entry*> removed;
+    /**
+     * @brief Number of finished epoll_wait() and dispatch rounds
+     */
+    uint64_t batch;
+    /**
+     * @brief Loop thread runs, so it may still hold events of removed
+     * entries until the current batch ends
+     */
+    bool busy;
+    threads::Thread* thread;
+  };
+
+  class LoopDelegate : public threads::ThreadDelegate {
+   public:
+    LoopDelegate(SocketReactor& reactor, const size_t index);
+    void threadMain() OVERRIDE;
+    void exitThreadMain() OVERRIDE;
+
+   private:
+    SocketReactor& reactor_;
+    const size_t index_;
+  };
+
+  class ConnectorDelegate : public threads::ThreadDelegate {
+   public:
+    ConnectorDelegate(SocketReactor& reactor, const size_t index);
+    void threadMain() OVERRIDE;
+    void exitThreadMain() OVERRIDE;
+
+   private:
+    SocketReactor& reactor_;
+    const size_t index_;
+  };
+
+  void LoopMain(const size_t index);
+  void ConnectorMain(const size_t index);
+
+  /**
+   * @brief Calls handler of the entry unless it was removed.
+   * Releases the lock for the time of the call
+   */
+  void Dispatch(Loop& loop,
+                Entry* entry,
+                const uint32_t events,
+                sync_primitives::AutoLock& auto_lock);
+  void WakeUp(const Loop& loop) const;
+  void UpdateInterest(const Entry* entry) const;
+
+  mutable sync_primitives::Lock lock_;
+  sync_primitives::ConditionalVariable connector_condition_;
+  sync_primitives::ConditionalVariable idle_condition_;
+
+  std::vector<Loop> loops_;
+  size_t next_loop_;
+
+  std::deque<Entry*> connect_queue_;
+  /**
+   * @brief Entries whose OnConnect() is running, indexed by connector
+   */
+  std::vector<Entry*> connecting_;
+
+  bool stop_requested_;
+  bool initialised_;
+
+  std::vector<threads::ThreadDelegate*> delegates_;
+  std::vector<threads::Thread*> connector_threads_;
+
+  DISALLOW_COPY_AND_ASSIGN(SocketReactor);
+};
+
+typedef std::shared_ptr<SocketReactor> SocketReactorSPtr;
+
+}  // namespace transport_adapter
+}  // namespace transport_manager
+
+#endif  // SRC_COMPONENTS_TRANSPORT_MANAGER_INCLUDE_TRANSPORT_MANAGER_TRANSPORT_ADAPTER_SOCKET_REACTOR_H_
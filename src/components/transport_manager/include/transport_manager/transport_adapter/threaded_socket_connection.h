@@ -36,12 +36,15 @@
 #define SRC_COMPONENTS_TRANSPORT_MANAGER_INCLUDE_TRANSPORT_MANAGER_TRANSPORT_ADAPTER_THREADED_SOCKET_CONNECTION_H_
 
 #include <poll.h>
-#include <queue>
+#include <stdint.h>
+#include <deque>
 
 #include <atomic>
 #include "protocol/common.h"
 #include "transport_manager/transport_adapter/connection.h"
+#include "transport_manager/transport_adapter/socket_reactor.h"
 #include "utils/lock.h"
+#include "utils/shared_buffer.h"
 #include "utils/threads/thread_delegate.h"
 
 using ::transport_manager::transport_adapter::Connection;
@@ -55,9 +58,22 @@ class TransportAdapterController;
 
 /**
  * @brief Class responsible for communication over sockets.
+ * Runs its own thread by default or is served by shared SocketReactor
+ * if one is passed to the constructor.
  */
-class ThreadedSocketConnection : public Connection {
+class ThreadedSocketConnection : public Connection,
+                                 private SocketReactor::Handler {
  public:
+  /**
+   * @brief Counters of data written to the socket.
+   */
+  struct SendStatistics {
+    SendStatistics() : bytes(0), frames(0), syscalls(0) {}
+    uint64_t bytes;
+    uint64_t frames;
+    uint64_t syscalls;
+  };
+
   /**
    * @brief Send data frame.
    *
@@ -90,6 +106,11 @@ class ThreadedSocketConnection : public Connection {
    */
   bool IsFramesToSendQueueEmpty() const;
 
+  /**
+   * @brief Returns amount of bytes, frames and write calls sent so far.
+   */
+  SendStatistics send_statistics() const;
+
   /**
    * @brief Check if connection has been terminated.
    *
@@ -113,10 +134,14 @@ class ThreadedSocketConnection : public Connection {
    * @param device_uid Device unique identifier.
    * @param app_handle Handle of application.
    * @param controller Pointer to the device adapter controller.
+   * @param reactor Reactor serving the connection, connection runs its own
+   * thread if empty.
    */
-  ThreadedSocketConnection(const DeviceUID& device_uid,
-                           const ApplicationHandle& app_handle,
-                           TransportAdapterController* controller);
+  ThreadedSocketConnection(
+      const DeviceUID& device_uid,
+      const ApplicationHandle& app_handle,
+      TransportAdapterController* controller,
+      const SocketReactorSPtr& reactor = SocketReactorSPtr());
 
   /**
    * @brief Destructor.
@@ -190,25 +215,64 @@ class ThreadedSocketConnection : public Connection {
   void threadMain();
   void Transmit();
   void Finalize();
-  TransportAdapter::Error Notify() const;
+  TransportAdapter::Error Notify();
   bool Receive();
   bool Send();
   void Abort();
 
+  // SocketReactor::Handler
+  void OnConnect() OVERRIDE;
+  void OnEvents(const uint32_t events) OVERRIDE;
+
+  /**
+   * @brief Sends queued frames until socket buffer is full, the rest is sent
+   * once reactor reports socket writable again.
+   */
+  void SendNonBlocking();
+
+  /**
+   * @brief Writes frames queued before the call gathering several of them
+   * per sendmsg() call and reports every completed frame separately.
+   *
+   * @return False if socket can not accept more data, true if all frames
+   * taken by the call were processed.
+   */
+  bool SendFrames();
+
   TransportAdapterController* controller_;
   /**
    * @brief Frames that must be sent to remote device.
    **/
-  typedef std::queue<protocol_handler::RawMessagePtr> FrameQueue;
+  typedef std::deque<protocol_handler::RawMessagePtr> FrameQueue;
   FrameQueue frames_to_send_;
   mutable sync_primitives::Lock frames_to_send_mutex_;
 
   std::atomic_int socket_;
-  bool terminate_flag_;
+  std::atomic_bool terminate_flag_;
   bool unexpected_disconnect_;
   const DeviceUID device_uid_;
   const ApplicationHandle app_handle_;
   threads::Thread* thread_;
+
+  SocketReactorSPtr reactor_;
+  SocketReactor::Entry reactor_entry_;
+  /**
+   * @brief Frames taken from frames_to_send_ by the sending thread, the front
+   * one may be partially sent.
+   **/
+  FrameQueue frames_in_flight_;
+  size_t send_offset_;
+  std::atomic<uint64_t> bytes_sent_;
+  std::atomic<uint64_t> frames_sent_;
+  std::atomic<uint64_t> send_syscalls_;
+  /**
+   * @brief Block received data is read into. Every received portion is
+   * passed on as a slice of it, so the block is replaced rather than reused.
+   **/
+  utils::SharedBuffer receive_buffer_;
+  size_t receive_offset_;
+  bool started_;
+  bool finalized_;
 };
 }  // namespace transport_adapter
 }  // namespace transport_manager
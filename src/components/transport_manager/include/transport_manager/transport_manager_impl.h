@@ -42,6 +42,7 @@
 #include <utility>
 #include <vector>
 
+#include "utils/mpsc_queue.h"
 #include "utils/rwlock.h"
 #include "utils/timer.h"
 
@@ -59,9 +60,12 @@
 
 namespace transport_manager {
 
-typedef threads::MessageLoopThread<std::queue<protocol_handler::RawMessagePtr> >
+// Many adapter threads post to a single loop thread, lock-free queues
+// keep them from contending on the queue lock
+typedef threads::MessageLoopThread<
+    utils::MpscQueue<protocol_handler::RawMessagePtr> >
     RawMessageLoopThread;
-typedef threads::MessageLoopThread<std::queue<TransportAdapterEvent> >
+typedef threads::MessageLoopThread<utils::MpscQueue<TransportAdapterEvent> >
     TransportAdapterEventLoopThread;
 typedef std::shared_ptr<timer::Timer> TimerSPtr;
 typedef std::map<DeviceUID, TransportAdapter*> DeviceToAdapterMap;
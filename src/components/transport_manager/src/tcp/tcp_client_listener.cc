@@ -77,7 +77,8 @@ bool TcpClientListener::testing_ = false;
 TcpClientListener::TcpClientListener(TransportAdapterController* controller,
                                      const uint16_t port,
                                      const bool enable_keepalive,
-                                     const std::string designated_interface)
+                                     const std::string designated_interface,
+                                     const SocketReactorSPtr& reactor)
     : port_(port)
     , enable_keepalive_(enable_keepalive)
     , controller_(controller)
@@ -87,7 +88,8 @@ TcpClientListener::TcpClientListener(TransportAdapterController* controller,
     , socket_(-1)
     , thread_stop_requested_(false)
     , remove_devices_on_terminate_(false)
-    , designated_interface_(designated_interface) {
+    , designated_interface_(designated_interface)
+    , reactor_(reactor) {
   pipe_fds_[0] = pipe_fds_[1] = -1;
   thread_ = threads::CreateThread("TcpClientListener",
                                   new ListeningThreadDelegate(this));
@@ -316,7 +318,7 @@ void TcpClientListener::Loop() {
 
       std::shared_ptr<TcpSocketConnection> connection =
           std::make_shared<TcpSocketConnection>(
-              device->unique_device_id(), app_handle, controller_);
+              device->unique_device_id(), app_handle, controller_, reactor_);
       controller_->ConnectionCreated(
           connection, device->unique_device_id(), app_handle);
       connection->set_socket(connection_fd);
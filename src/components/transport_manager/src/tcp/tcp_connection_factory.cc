@@ -42,8 +42,8 @@ namespace transport_adapter {
 SDL_CREATE_LOG_VARIABLE("TransportManager")
 
 TcpConnectionFactory::TcpConnectionFactory(
-    TransportAdapterController* controller)
-    : controller_(controller) {}
+    TransportAdapterController* controller, const SocketReactorSPtr& reactor)
+    : controller_(controller), reactor_(reactor) {}
 
 TransportAdapter::Error TcpConnectionFactory::Init() {
   return TransportAdapter::OK;
@@ -56,7 +56,7 @@ TransportAdapter::Error TcpConnectionFactory::CreateConnection(
                               << ", ApplicationHandle: " << &app_handle);
   std::shared_ptr<TcpServerOriginatedSocketConnection> connection =
       std::make_shared<TcpServerOriginatedSocketConnection>(
-          device_uid, app_handle, controller_);
+          device_uid, app_handle, controller_, reactor_);
   controller_->ConnectionCreated(connection, device_uid, app_handle);
   const TransportAdapter::Error error = connection->Start();
   if (TransportAdapter::OK != error) {
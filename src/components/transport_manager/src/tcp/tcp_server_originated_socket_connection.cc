@@ -44,8 +44,9 @@ SDL_CREATE_LOG_VARIABLE("TransportManager")
 TcpServerOriginatedSocketConnection::TcpServerOriginatedSocketConnection(
     const DeviceUID& device_uid,
     const ApplicationHandle& app_handle,
-    TransportAdapterController* controller)
-    : ThreadedSocketConnection(device_uid, app_handle, controller) {}
+    TransportAdapterController* controller,
+    const SocketReactorSPtr& reactor)
+    : ThreadedSocketConnection(device_uid, app_handle, controller, reactor) {}
 
 TcpServerOriginatedSocketConnection::~TcpServerOriginatedSocketConnection() {
   StopAndJoinThread();
@@ -43,8 +43,9 @@ SDL_CREATE_LOG_VARIABLE("TransportManager")
 
 TcpSocketConnection::TcpSocketConnection(const DeviceUID& device_uid,
                                          const ApplicationHandle& app_handle,
-                                         TransportAdapterController* controller)
-    : ThreadedSocketConnection(device_uid, app_handle, controller) {}
+                                         TransportAdapterController* controller,
+                                         const SocketReactorSPtr& reactor)
+    : ThreadedSocketConnection(device_uid, app_handle, controller, reactor) {}
 
 TcpSocketConnection::~TcpSocketConnection() {
   StopAndJoinThread();
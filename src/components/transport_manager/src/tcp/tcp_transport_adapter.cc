@@ -55,19 +55,48 @@ TcpTransportAdapter::TcpTransportAdapter(
     const uint16_t port,
     resumption::LastStateWrapperPtr last_state_wrapper,
     const TransportManagerSettings& settings)
+    : TcpTransportAdapter(port,
+                          last_state_wrapper,
+                          settings,
+                          CreateSocketReactor(settings)) {}
+
+TcpTransportAdapter::TcpTransportAdapter(
+    const uint16_t port,
+    resumption::LastStateWrapperPtr last_state_wrapper,
+    const TransportManagerSettings& settings,
+    const SocketReactorSPtr& reactor)
     : TransportAdapterImpl(
           NULL,
-          new TcpConnectionFactory(this),
+          new TcpConnectionFactory(this, reactor),
           new TcpClientListener(
               this,
               port,
               true,
-              settings.transport_manager_tcp_adapter_network_interface()),
+              settings.transport_manager_tcp_adapter_network_interface(),
+              reactor),
           last_state_wrapper,
           settings) {}
 
 TcpTransportAdapter::~TcpTransportAdapter() {}
 
+SocketReactorSPtr TcpTransportAdapter::CreateSocketReactor(
+    const TransportManagerSettings& settings) {
+  const uint16_t threads_count =
+      settings.transport_manager_tcp_reactor_threads();
+  if (0 == threads_count) {
+    return SocketReactorSPtr();
+  }
+  SocketReactorSPtr reactor = std::make_shared<SocketReactor>(threads_count);
+  if (!reactor->IsInitialised()) {
+    SDL_LOG_ERROR("Failed to start socket reactor, "
+                  "TCP connections will run own threads");
+    return SocketReactorSPtr();
+  }
+  SDL_LOG_INFO("TCP connections are served by " << threads_count
+                                                << " reactor threads");
+  return reactor;
+}
+
 void TcpTransportAdapter::TransportConfigUpdated(
     const TransportConfig& new_config) {
   SDL_LOG_AUTO_TRACE();
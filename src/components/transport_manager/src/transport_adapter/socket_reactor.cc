@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "transport_manager/transport_adapter/socket_reactor.h"
+
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <algorithm>
+
+#include "utils/logger.h"
+
+namespace transport_manager {
+namespace transport_adapter {
+
+SDL_CREATE_LOG_VARIABLE("TransportManager")
+
+namespace {
+const int kMaxEventsPerWait = 64;
+const size_t kNoLoop = static_cast<size_t>(-1);
+
+void EraseEntry(std::vector<SocketReactor::Entry*>& entries,
+                const SocketReactor::Entry* entry) {
+  entries.erase(std::remove(entries.begin(), entries.end(), entry),
+                entries.end());
+}
+}  // namespace
+
+SocketReactor::Entry::Entry(Handler* handler)
+    : handler_(handler)
+    , fd_(-1)
+    , loop_index_(kNoLoop)
+    , connect_queued_(false)
+    , notify_queued_(false)
+    , write_interest_(false) {}
+
+SocketReactor::Loop::Loop()
+    : epoll_fd(-1)
+    , event_fd(-1)
+    , batch(0)
+    , busy(false)
+    , thread(NULL) {}
+
+SocketReactor::SocketReactor(const size_t loops_count)
+    : lock_()
+    , loops_(loops_count)
+    , next_loop_(0)
+    , connecting_(loops_count, NULL)
+    , stop_requested_(false)
+    , initialised_(true) {
+  SDL_LOG_AUTO_TRACE();
+  DCHECK(loops_count > 0);
+  for (size_t i = 0; i < loops_.size(); ++i) {
+    Loop& loop = loops_[i];
+    loop.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    loop.event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (-1 == loop.epoll_fd || -1 == loop.event_fd) {
+      SDL_LOG_ERROR_WITH_ERRNO("Failed to create reactor loop " << i);
+      initialised_ = false;
+      continue;
+    }
+    // NULL data marks the notification eventfd
+    epoll_event event = {0};
+    event.events = EPOLLIN;
+    event.data.ptr = NULL;
+    if (-1 == epoll_ctl(loop.epoll_fd, EPOLL_CTL_ADD, loop.event_fd, &event)) {
+      SDL_LOG_ERROR_WITH_ERRNO("Failed to watch eventfd of loop " << i);
+      initialised_ = false;
+      continue;
+    }
+    LoopDelegate* delegate = new LoopDelegate(*this, i);
+    delegates_.push_back(delegate);
+    loop.thread = threads::CreateThread("SocketReactor", delegate);
+    if (!loop.thread->Start()) {
+      SDL_LOG_ERROR("Failed to start reactor loop " << i);
+      initialised_ = false;
+    }
+  }
+
+  // All connectors are created before start, Remove() looks up their threads
+  for (size_t i = 0; i < loops_count; ++i) {
+    ConnectorDelegate* delegate = new ConnectorDelegate(*this, i);
+    delegates_.push_back(delegate);
+    connector_threads_.push_back(
+        threads::CreateThread("SocketConnector", delegate));
+  }
+  for (size_t i = 0; i < connector_threads_.size(); ++i) {
+    if (!connector_threads_[i]->Start()) {
+      SDL_LOG_ERROR("Failed to start socket connector " << i);
+      initialised_ = false;
+    }
+  }
+  SDL_LOG_DEBUG("Socket reactor has been created with " << loops_count
+                                                        << " loops");
+}
+
+SocketReactor::~SocketReactor() {
+  SDL_LOG_AUTO_TRACE();
+  for (size_t i = 0; i < connector_threads_.size(); ++i) {
+    connector_threads_[i]->Stop(threads::Thread::kThreadStopDelegate);
+  }
+  for (size_t i = 0; i < loops_.size(); ++i) {
+    if (loops_[i].thread) {
+      loops_[i].thread->Stop(threads::Thread::kThreadStopDelegate);
+    }
+  }
+
+  // Delegates must be deleted before their threads
+  std::vector<threads::Thread*> threads;
+  for (size_t i = 0; i < loops_.size(); ++i) {
+    if (loops_[i].thread) {
+      threads.push_back(loops_[i].thread);
+    }
+  }
+  threads.insert(
+      threads.end(), connector_threads_.begin(), connector_threads_.end());
+  for (size_t i = 0; i < delegates_.size(); ++i) {
+    delete delegates_[i];
+  }
+  for (size_t i = 0; i < threads.size(); ++i) {
+    threads::DeleteThread(threads[i]);
+  }
+
+  for (size_t i = 0; i < loops_.size(); ++i) {
+    if (-1 != loops_[i].epoll_fd) {
+      close(loops_[i].epoll_fd);
+    }
+    if (-1 != loops_[i].event_fd) {
+      close(loops_[i].event_fd);
+    }
+  }
+}
+
+bool SocketReactor::IsInitialised() const {
+  return initialised_;
+}
+
+void SocketReactor::Connect(Entry* entry) {
+  DCHECK_OR_RETURN_VOID(entry);
+  sync_primitives::AutoLock auto_lock(lock_);
+  if (entry->connect_queued_ || stop_requested_) {
+    return;
+  }
+  entry->connect_queued_ = true;
+  connect_queue_.push_back(entry);
+  connector_condition_.NotifyOne();
+}
+
+bool SocketReactor::Watch(Entry* entry, const int fd) {
+  DCHECK_OR_RETURN(entry, false);
+  sync_primitives::AutoLock auto_lock(lock_);
+  DCHECK_OR_RETURN(kNoLoop == entry->loop_index_, false);
+  if (stop_requested_) {
+    SDL_LOG_WARN("Reactor is stopping, socket " << fd << " is not watched");
+    return false;
+  }
+
+  const size_t index = next_loop_++ % loops_.size();
+  epoll_event event = {0};
+  event.events = EPOLLIN;
+  event.data.ptr = entry;
+  if (-1 == epoll_ctl(loops_[index].epoll_fd, EPOLL_CTL_ADD, fd, &event)) {
+    SDL_LOG_ERROR_WITH_ERRNO("Failed to watch socket " << fd);
+    return false;
+  }
+  entry->fd_ = fd;
+  entry->loop_index_ = index;
+  entry->write_interest_ = false;
+  SDL_LOG_DEBUG("Socket " << fd << " is watched by loop " << index);
+  return true;
+}
+
+void SocketReactor::SetWriteInterest(Entry* entry, const bool enabled) {
+  DCHECK_OR_RETURN_VOID(entry);
+  sync_primitives::AutoLock auto_lock(lock_);
+  if (-1 == entry->fd_ || enabled == entry->write_interest_) {
+    return;
+  }
+  entry->write_interest_ = enabled;
+  UpdateInterest(entry);
+}
+
+void SocketReactor::Notify(Entry* entry) {
+  DCHECK_OR_RETURN_VOID(entry);
+  sync_primitives::AutoLock auto_lock(lock_);
+  if (-1 == entry->fd_ || entry->notify_queued_) {
+    return;
+  }
+  Loop& loop = loops_[entry->loop_index_];
+  entry->notify_queued_ = true;
+  loop.notified.push_back(entry);
+  // Loop consumes the whole list per wakeup, so only the first one counts
+  if (1 == loop.notified.size()) {
+    WakeUp(loop);
+  }
+}
+
+void SocketReactor::Remove(Entry* entry) {
+  DCHECK_OR_RETURN_VOID(entry);
+  sync_primitives::AutoLock auto_lock(lock_);
+  if (entry->connect_queued_) {
+    connect_queue_.erase(
+        std::find(connect_queue_.begin(), connect_queue_.end(), entry));
+    entry->connect_queued_ = false;
+  }
+  const std::vector<Entry*>::iterator connecting =
+      std::find(connecting_.begin(), connecting_.end(), entry);
+  if (connecting_.end() != connecting &&
+      !connector_threads_[connecting - connecting_.begin()]
+           ->IsCurrentThread()) {
+    // OnConnect() may register the socket, so check it only afterwards
+    while (entry == *connecting) {
+      idle_condition_.Wait(auto_lock);
+    }
+  }
+  if (kNoLoop == entry->loop_index_) {
+    return;
+  }
+
+  Loop& loop = loops_[entry->loop_index_];
+  if (-1 != entry->fd_) {
+    if (-1 == epoll_ctl(loop.epoll_fd, EPOLL_CTL_DEL, entry->fd_, NULL)) {
+      SDL_LOG_ERROR_WITH_ERRNO("Failed to unwatch socket " << entry->fd_);
+    }
+    entry->fd_ = -1;
+    if (entry->notify_queued_) {
+      EraseEntry(loop.notified, entry);
+      entry->notify_queued_ = false;
+    }
+  }
+  // Entry may be watched again after reconnection
+  entry->loop_index_ = kNoLoop;
+  if (!loop.busy) {
+    return;
+  }
+  if (loop.thread->IsCurrentThread()) {
+    // Current batch may still refer to the entry, it must not be touched
+    // after the handler returns since it could be destroyed by then
+    loop.removed.push_back(entry);
+    return;
+  }
+  // Events already returned by epoll_wait() or the handler of the entry
+  // may still be pending in the loop, so wake it up and wait for the batch
+  const uint64_t batch = loop.batch;
+  WakeUp(loop);
+  while (loop.busy && batch == loop.batch) {
+    idle_condition_.Wait(auto_lock);
+  }
+}
+
+void SocketReactor::LoopMain(const size_t index) {
+  SDL_LOG_AUTO_TRACE();
+  Loop& loop = loops_[index];
+  epoll_event events[kMaxEventsPerWait];
+  sync_primitives::AutoLock auto_lock(lock_);
+  while (!stop_requested_) {
+    // Loop stays busy while waiting without the lock, since the returned
+    // events may refer to entries removed in the meantime
+    loop.busy = true;
+    int count = 0;
+    int error = 0;
+    {
+      sync_primitives::AutoUnlock auto_unlock(auto_lock);
+      count = epoll_wait(loop.epoll_fd, events, kMaxEventsPerWait, -1);
+      error = errno;
+    }
+    if (-1 == count && EINTR != error) {
+      errno = error;
+      SDL_LOG_ERROR_WITH_ERRNO("epoll_wait failed for loop " << index);
+      break;
+    }
+    if (stop_requested_) {
+      break;
+    }
+    for (int i = 0; i < count; ++i) {
+      Entry* entry = static_cast<Entry*>(events[i].data.ptr);
+      if (entry) {
+        Dispatch(loop, entry, events[i].events, auto_lock);
+        continue;
+      }
+
+      uint64_t counter = 0;
+      if (-1 == read(loop.event_fd, &counter, sizeof(counter)) &&
+          EAGAIN != errno) {
+        SDL_LOG_ERROR_WITH_ERRNO("Failed to read eventfd of loop " << index);
+      }
+      std::vector<Entry*> notified;
+      notified.swap(loop.notified);
+      for (size_t j = 0; j < notified.size(); ++j) {
+        notified[j]->notify_queued_ = false;
+      }
+      for (size_t j = 0; j < notified.size(); ++j) {
+        Dispatch(loop, notified[j], EPOLLOUT, auto_lock);
+      }
+    }
+    loop.removed.clear();
+    ++loop.batch;
+    idle_condition_.Broadcast();
+  }
+  loop.busy = false;
+  ++loop.batch;
+  idle_condition_.Broadcast();
+}
+
+void SocketReactor::ConnectorMain(const size_t index) {
+  SDL_LOG_AUTO_TRACE();
+  sync_primitives::AutoLock auto_lock(lock_);
+  while (!stop_requested_) {
+    if (connect_queue_.empty()) {
+      connector_condition_.Wait(auto_lock);
+      continue;
+    }
+    Entry* entry = connect_queue_.front();
+    connect_queue_.pop_front();
+    entry->connect_queued_ = false;
+    connecting_[index] = entry;
+    Handler* handler = entry->handler_;
+    {
+      sync_primitives::AutoUnlock auto_unlock(auto_lock);
+      handler->OnConnect();
+    }
+    connecting_[index] = NULL;
+    idle_condition_.Broadcast();
+  }
+}
+
+void SocketReactor::Dispatch(Loop& loop,
+                             Entry* entry,
+                             const uint32_t events,
+                             sync_primitives::AutoLock& auto_lock) {
+  if (loop.removed.end() !=
+          std::find(loop.removed.begin(), loop.removed.end(), entry) ||
+      -1 == entry->fd_) {
+    return;
+  }
+  Handler* handler = entry->handler_;
+  sync_primitives::AutoUnlock auto_unlock(auto_lock);
+  handler->OnEvents(events);
+}
+
+void SocketReactor::WakeUp(const Loop& loop) const {
+  const uint64_t counter = 1;
+  if (sizeof(counter) != write(loop.event_fd, &counter, sizeof(counter))) {
+    SDL_LOG_ERROR_WITH_ERRNO("Failed to wake up reactor loop");
+  }
+}
+
+void SocketReactor::UpdateInterest(const Entry* entry) const {
+  epoll_event event = {0};
+  event.events = EPOLLIN | (entry->write_interest_ ? EPOLLOUT : 0);
+  event.data.ptr = const_cast<Entry*>(entry);
+  const Loop& loop = loops_[entry->loop_index_];
+  if (-1 == epoll_ctl(loop.epoll_fd, EPOLL_CTL_MOD, entry->fd_, &event)) {
+    SDL_LOG_ERROR_WITH_ERRNO("Failed to update socket " << entry->fd_);
+  }
+}
+
+SocketReactor::LoopDelegate::LoopDelegate(SocketReactor& reactor,
+                                          const size_t index)
+    : reactor_(reactor), index_(index) {}
+
+void SocketReactor::LoopDelegate::threadMain() {
+  reactor_.LoopMain(index_);
+}
+
+void SocketReactor::LoopDelegate::exitThreadMain() {
+  sync_primitives::AutoLock auto_lock(reactor_.lock_);
+  reactor_.stop_requested_ = true;
+  reactor_.WakeUp(reactor_.loops_[index_]);
+}
+
+SocketReactor::ConnectorDelegate::ConnectorDelegate(SocketReactor& reactor,
+                                                    const size_t index)
+    : reactor_(reactor), index_(index) {}
+
+void SocketReactor::ConnectorDelegate::threadMain() {
+  reactor_.ConnectorMain(index_);
+}
+
+void SocketReactor::ConnectorDelegate::exitThreadMain() {
+  sync_primitives::AutoLock auto_lock(reactor_.lock_);
+  reactor_.stop_requested_ = true;
+  reactor_.connector_condition_.Broadcast();
+}
+
+}  // namespace transport_adapter
+}  // namespace transport_manager
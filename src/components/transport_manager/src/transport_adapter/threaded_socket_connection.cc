@@ -33,8 +33,10 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <memory.h>
+#include <sys/epoll.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #include <algorithm>
 
@@ -48,10 +50,20 @@ namespace transport_manager {
 namespace transport_adapter {
 SDL_CREATE_LOG_VARIABLE("TransportManager")
 
+namespace {
+// Gathering more frames per call gives no gain but costs stack space
+const size_t kMaxFramesPerWrite = 64;
+// Received portions are sliced out of blocks of this size
+const size_t kReceiveBlockSize = 32768;
+// Block is replaced once less space than one recv() needs is left
+const size_t kMinReceiveSpace = 4096;
+}  // namespace
+
 ThreadedSocketConnection::ThreadedSocketConnection(
     const DeviceUID& device_id,
     const ApplicationHandle& app_handle,
-    TransportAdapterController* controller)
+    TransportAdapterController* controller,
+    const SocketReactorSPtr& reactor)
     : read_fd_(-1)
     , write_fd_(-1)
     , controller_(controller)
@@ -62,7 +74,21 @@ ThreadedSocketConnection::ThreadedSocketConnection(
     , unexpected_disconnect_(false)
     , device_uid_(device_id)
     , app_handle_(app_handle)
-    , thread_(nullptr) {
+    , thread_(nullptr)
+    , reactor_(reactor)
+    , reactor_entry_(this)
+    , frames_in_flight_()
+    , send_offset_(0)
+    , bytes_sent_(0)
+    , frames_sent_(0)
+    , send_syscalls_(0)
+    , receive_buffer_()
+    , receive_offset_(0)
+    , started_(false)
+    , finalized_(false) {
+  if (reactor_) {
+    return;
+  }
   const std::string thread_name = std::string("Socket ") + device_handle();
   thread_ = threads::CreateThread(thread_name.c_str(),
                                   new SocketConnectionDelegate(this));
@@ -82,6 +108,13 @@ ThreadedSocketConnection::~ThreadedSocketConnection() {
 
 void ThreadedSocketConnection::StopAndJoinThread() {
   Disconnect();
+  if (reactor_) {
+    reactor_->Remove(&reactor_entry_);
+    // Reactor will not finalize the connection anymore
+    if (started_ && !finalized_) {
+      Finalize();
+    }
+  }
   if (thread_) {
     thread_->Stop(threads::Thread::kThreadSoftStop);
     delete thread_->GetDelegate();
@@ -98,6 +131,12 @@ void ThreadedSocketConnection::Abort() {
 
 TransportAdapter::Error ThreadedSocketConnection::Start() {
   SDL_LOG_AUTO_TRACE();
+  if (reactor_) {
+    started_ = true;
+    reactor_->Connect(&reactor_entry_);
+    return TransportAdapter::OK;
+  }
+
   int fds[2];
   const int pipe_ret = pipe(fds);
   if (0 == pipe_ret) {
@@ -135,10 +174,34 @@ void ThreadedSocketConnection::Finalize() {
   }
 
   ShutdownAndCloseSocket();
+  SDL_LOG_DEBUG("Connection " << this << " sent " << bytes_sent_
+                              << " bytes in " << frames_sent_ << " frames with "
+                              << send_syscalls_ << " write calls");
+
+  while (!frames_in_flight_.empty()) {
+    SDL_LOG_INFO("removing message");
+    ::protocol_handler::RawMessagePtr message = frames_in_flight_.front();
+    frames_in_flight_.pop_front();
+    controller_->DataSendFailed(
+        device_handle(), application_handle(), message, DataSendError());
+  }
+  sync_primitives::AutoLock auto_lock(frames_to_send_mutex_);
+  while (!frames_to_send_.empty()) {
+    SDL_LOG_INFO("removing message");
+    ::protocol_handler::RawMessagePtr message = frames_to_send_.front();
+    frames_to_send_.pop_front();
+    controller_->DataSendFailed(
+        device_handle(), application_handle(), message, DataSendError());
+  }
+  finalized_ = true;
 }
 
-TransportAdapter::Error ThreadedSocketConnection::Notify() const {
+TransportAdapter::Error ThreadedSocketConnection::Notify() {
   SDL_LOG_AUTO_TRACE();
+  if (reactor_) {
+    reactor_->Notify(&reactor_entry_);
+    return TransportAdapter::OK;
+  }
   if (-1 == write_fd_) {
     SDL_LOG_ERROR_WITH_ERRNO(
         "Failed to wake up connection thread for connection " << this);
@@ -158,14 +221,23 @@ TransportAdapter::Error ThreadedSocketConnection::SendData(
     ::protocol_handler::RawMessagePtr message) {
   SDL_LOG_AUTO_TRACE();
   sync_primitives::AutoLock auto_lock(frames_to_send_mutex_);
-  frames_to_send_.push(message);
+  frames_to_send_.push_back(message);
   return Notify();
 }
 
 TransportAdapter::Error ThreadedSocketConnection::Disconnect() {
   SDL_LOG_AUTO_TRACE();
   terminate_flag_ = true;
-  ShutdownAndCloseSocket();
+  if (reactor_) {
+    // Socket may be watched by reactor, so it is only closed by Finalize()
+    // after being removed from there
+    const int socket = socket_;
+    if (-1 != socket) {
+      shutdown(socket, SHUT_RDWR);
+    }
+  } else {
+    ShutdownAndCloseSocket();
+  }
   return Notify();
 }
 
@@ -191,16 +263,79 @@ void ThreadedSocketConnection::threadMain() {
   }
   SDL_LOG_DEBUG("Connection is to finalize");
   Finalize();
-  sync_primitives::AutoLock auto_lock(frames_to_send_mutex_);
-  while (!frames_to_send_.empty()) {
-    SDL_LOG_INFO("removing message");
-    ::protocol_handler::RawMessagePtr message = frames_to_send_.front();
-    frames_to_send_.pop();
-    controller_->DataSendFailed(
-        device_handle(), application_handle(), message, DataSendError());
+}
+
+void ThreadedSocketConnection::OnConnect() {
+  SDL_LOG_AUTO_TRACE();
+  ConnectError* connect_error = nullptr;
+  if (!Establish(&connect_error)) {
+    SDL_LOG_ERROR("Connection Establish failed");
+    delete connect_error;
+    Abort();
+    Finalize();
+    return;
+  }
+  SDL_LOG_DEBUG("Connection established");
+  controller_->ConnectDone(device_handle(), application_handle());
+
+  if (terminate_flag_) {
+    SDL_LOG_DEBUG("Connection is to finalize");
+    Finalize();
+    return;
+  }
+  const int socket = socket_;
+  const int flags = fcntl(socket, F_GETFL);
+  if (-1 == flags || 0 != fcntl(socket, F_SETFL, flags | O_NONBLOCK) ||
+      !reactor_->Watch(&reactor_entry_, socket)) {
+    SDL_LOG_ERROR("Failed to pass connection " << this << " to reactor");
+    Abort();
+    Finalize();
+    return;
+  }
+  // Picks up frames and Disconnect() requests which came before Watch()
+  reactor_->Notify(&reactor_entry_);
+}
+
+void ThreadedSocketConnection::OnEvents(const uint32_t events) {
+  SDL_LOG_TRACE("Connection " << this << " events: " << std::hex << events);
+  if (!terminate_flag_) {
+    bool transmit_ok = 0 == (events & (EPOLLERR | EPOLLHUP));
+    if (transmit_ok && (events & EPOLLOUT)) {
+      SendNonBlocking();
+    }
+    if (transmit_ok && (events & EPOLLIN)) {
+      transmit_ok = Receive();
+    }
+    // Socket errors caused by concurrent Disconnect() are expected
+    if (!transmit_ok && !terminate_flag_) {
+      SDL_LOG_WARN("Connection " << this << " terminated");
+      Abort();
+    }
+  }
+
+  if (terminate_flag_) {
+    SDL_LOG_DEBUG("Connection is to finalize");
+    reactor_->Remove(&reactor_entry_);
+    Finalize();
   }
 }
 
+void ThreadedSocketConnection::SendNonBlocking() {
+  SDL_LOG_AUTO_TRACE();
+  // Level triggered EPOLLOUT resumes sending with the next batch of the loop
+  const bool all_sent = SendFrames() && IsFramesToSendQueueEmpty();
+  reactor_->SetWriteInterest(&reactor_entry_, !all_sent);
+}
+
+ThreadedSocketConnection::SendStatistics
+ThreadedSocketConnection::send_statistics() const {
+  SendStatistics statistics;
+  statistics.bytes = bytes_sent_;
+  statistics.frames = frames_sent_;
+  statistics.syscalls = send_syscalls_;
+  return statistics;
+}
+
 bool ThreadedSocketConnection::IsFramesToSendQueueEmpty() const {
   // Check Frames queue is empty or not
   sync_primitives::AutoLock auto_lock(frames_to_send_mutex_);
@@ -300,17 +435,30 @@ void ThreadedSocketConnection::Transmit() {
 
 bool ThreadedSocketConnection::Receive() {
   SDL_LOG_AUTO_TRACE();
-  uint8_t buffer[4096];
   ssize_t bytes_read = -1;
 
   do {
-    bytes_read = recv(socket_, buffer, sizeof(buffer), MSG_DONTWAIT);
+    if (receive_buffer_.size() - receive_offset_ < kMinReceiveSpace) {
+      receive_buffer_ = utils::SharedBuffer(kReceiveBlockSize);
+      receive_offset_ = 0;
+      if (receive_buffer_.empty()) {
+        SDL_LOG_ERROR("Failed to allocate receive buffer for connection "
+                      << this);
+        return false;
+      }
+    }
+    bytes_read = recv(socket_,
+                      receive_buffer_.data() + receive_offset_,
+                      receive_buffer_.size() - receive_offset_,
+                      MSG_DONTWAIT);
 
     if (bytes_read > 0) {
       SDL_LOG_TRACE("Received " << bytes_read << " bytes for connection "
                                 << this);
-      ::protocol_handler::RawMessagePtr frame(
-          new protocol_handler::RawMessage(0, 0, buffer, bytes_read, false));
+      // Message takes received bytes over without copying them
+      ::protocol_handler::RawMessagePtr frame(new protocol_handler::RawMessage(
+          0, 0, receive_buffer_.Slice(receive_offset_, bytes_read), false));
+      receive_offset_ += bytes_read;
       controller_->DataReceiveDone(
           device_handle(), application_handle(), frame);
     } else if (bytes_read < 0) {
@@ -329,38 +477,71 @@ bool ThreadedSocketConnection::Receive() {
 
 bool ThreadedSocketConnection::Send() {
   SDL_LOG_AUTO_TRACE();
-  FrameQueue frames_to_send_local;
+  // Socket is blocking here, so every frame taken by SendFrames() is
+  // processed, later ones are announced by Notify() for the next poll()
+  SendFrames();
+  return true;
+}
 
-  {
+bool ThreadedSocketConnection::SendFrames() {
+  SDL_LOG_AUTO_TRACE();
+  iovec chunks[kMaxFramesPerWrite];
+  // Only frames queued so far are sent, the ones queued meanwhile wait for
+  // the next call, so receiving and other connections are not starved
+  if (frames_in_flight_.empty()) {
     sync_primitives::AutoLock auto_lock(frames_to_send_mutex_);
-    std::swap(frames_to_send_local, frames_to_send_);
-  }
-
-  size_t offset = 0;
-  while (!frames_to_send_local.empty()) {
-    SDL_LOG_INFO("frames_to_send is not empty");
-    ::protocol_handler::RawMessagePtr frame = frames_to_send_local.front();
-    const ssize_t bytes_sent =
-        ::send(socket_, frame->data() + offset, frame->data_size() - offset, 0);
-
-    if (bytes_sent >= 0) {
-      SDL_LOG_DEBUG("bytes_sent >= 0");
-      offset += bytes_sent;
-      if (offset == frame->data_size()) {
-        frames_to_send_local.pop();
-        offset = 0;
-        controller_->DataSendDone(device_handle(), application_handle(), frame);
+    std::swap(frames_in_flight_, frames_to_send_);
+  }
+  while (!frames_in_flight_.empty()) {
+    size_t chunks_count = 0;
+    size_t offset = send_offset_;
+    for (FrameQueue::const_iterator it = frames_in_flight_.begin();
+         it != frames_in_flight_.end() && chunks_count < kMaxFramesPerWrite;
+         ++it) {
+      chunks[chunks_count].iov_base = (*it)->data() + offset;
+      chunks[chunks_count].iov_len = (*it)->data_size() - offset;
+      ++chunks_count;
+      offset = 0;
+    }
+
+    msghdr message = {0};
+    message.msg_iov = chunks;
+    message.msg_iovlen = chunks_count;
+    ssize_t bytes_sent = ::sendmsg(socket_, &message, 0);
+    ++send_syscalls_;
+
+    if (bytes_sent < 0) {
+      if (EAGAIN == errno || EWOULDBLOCK == errno) {
+        SDL_LOG_DEBUG("Socket buffer is full for connection " << this);
+        return false;
       }
-    } else {
-      SDL_LOG_DEBUG("bytes_sent < 0");
       SDL_LOG_ERROR_WITH_ERRNO("Send failed for connection " << this);
-      frames_to_send_local.pop();
-      offset = 0;
+      ::protocol_handler::RawMessagePtr frame = frames_in_flight_.front();
+      frames_in_flight_.pop_front();
+      send_offset_ = 0;
       controller_->DataSendFailed(
           device_handle(), application_handle(), frame, DataSendError());
+      continue;
     }
-  }
 
+    SDL_LOG_TRACE("Sent " << bytes_sent << " bytes of " << chunks_count
+                          << " frames for connection " << this);
+    bytes_sent_ += bytes_sent;
+    // Write may stop in the middle of any frame
+    while (!frames_in_flight_.empty()) {
+      ::protocol_handler::RawMessagePtr frame = frames_in_flight_.front();
+      const size_t frame_rest = frame->data_size() - send_offset_;
+      if (static_cast<size_t>(bytes_sent) < frame_rest) {
+        send_offset_ += bytes_sent;
+        break;
+      }
+      bytes_sent -= frame_rest;
+      frames_in_flight_.pop_front();
+      send_offset_ = 0;
+      ++frames_sent_;
+      controller_->DataSendDone(device_handle(), application_handle(), frame);
+    }
+  }
   return true;
 }
 
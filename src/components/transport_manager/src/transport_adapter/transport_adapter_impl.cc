@@ -265,10 +265,12 @@ TransportAdapter::Error TransportAdapterImpl::ConnectDevice(
       device->next_retry();
 
       // Start timer for next retry
+      // Retry connects to the cloud app, keep it off the shared workers
       TimerSPtr retry_timer(std::make_shared<timer::Timer>(
           "RetryConnectionTimer",
           new timer::TimerTaskImpl<TransportAdapterImpl>(
-              this, &TransportAdapterImpl::RetryConnection)));
+              this, &TransportAdapterImpl::RetryConnection),
+          timer::TimerWheel::blocking_instance()));
       sync_primitives::AutoLock locker(retry_timer_pool_lock_);
       retry_timer_pool_.push(std::make_pair(retry_timer, device_handle));
       retry_timer->Start(get_settings().cloud_app_retry_timeout(),
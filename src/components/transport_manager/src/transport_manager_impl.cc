@@ -1284,6 +1284,8 @@ void TransportManagerImpl::Handle(TransportAdapterEvent event) {
 #ifdef TELEMETRY_MONITOR
       if (metric_observer_) {
         metric_observer_->StopRawMsg(event.event_data.get());
+        metric_observer_->OnStageFinished(telemetry_monitor::kTransportReceive,
+                                          event.raise_time);
       }
 #endif  // TELEMETRY_MONITOR
       RaiseEvent(&TransportManagerListener::OnTMMessageReceived,
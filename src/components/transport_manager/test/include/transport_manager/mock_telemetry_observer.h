@@ -44,6 +44,9 @@ class MockTMTelemetryObserver : public transport_manager::TMTelemetryObserver {
  public:
   MOCK_METHOD1(StartRawMsg, void(const protocol_handler::RawMessage* ptr));
   MOCK_METHOD1(StopRawMsg, void(const protocol_handler::RawMessage* ptr));
+  MOCK_METHOD2(OnStageFinished,
+               void(const telemetry_monitor::TelemetryStage stage,
+                    const date_time::TimeDuration& begin));
 };
 
 }  // namespace transport_manager_test
@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sys/socket.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstring>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "transport_manager/tcp/tcp_socket_connection.h"
+#include "transport_manager/transport_adapter/mock_transport_adapter_controller.h"
+#include "transport_manager/transport_adapter/socket_reactor.h"
+#include "utils/test_async_waiter.h"
+
+namespace test {
+namespace components {
+namespace transport_manager_test {
+
+using ::testing::_;
+using ::testing::NiceMock;
+using namespace ::transport_manager;
+using namespace ::transport_manager::transport_adapter;
+
+namespace {
+const uint32_t kTimeoutMs = 1000u;
+const std::string kDeviceUid = "device";
+const ApplicationHandle kAppHandle = 1;
+
+/**
+ * @brief Notifies waiter on connect after release waiter, if any, is
+ * notified
+ */
+class ConnectHandler : public SocketReactor::Handler {
+ public:
+  ConnectHandler(const std::shared_ptr<TestAsyncWaiter>& connected,
+                 const std::shared_ptr<TestAsyncWaiter>& release)
+      : connected_(connected), release_(release) {}
+
+  void OnConnect() OVERRIDE {
+    if (release_) {
+      release_->WaitFor(1u, kTimeoutMs);
+    }
+    connected_->Notify();
+  }
+
+  void OnEvents(const uint32_t) OVERRIDE {}
+
+ private:
+  std::shared_ptr<TestAsyncWaiter> connected_;
+  std::shared_ptr<TestAsyncWaiter> release_;
+};
+}  // namespace
+
+class SocketReactorTest : public ::testing::Test {
+ protected:
+  SocketReactorTest()
+      : reactor_(std::make_shared<SocketReactor>(2u)), peer_fd_(-1) {}
+
+  void SetUp() OVERRIDE {
+    int fds[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+    peer_fd_ = fds[1];
+    connection_ = std::make_shared<TcpSocketConnection>(
+        kDeviceUid, kAppHandle, &controller_, reactor_);
+    connection_->set_socket(fds[0]);
+  }
+
+  void TearDown() OVERRIDE {
+    connection_.reset();
+    if (-1 != peer_fd_) {
+      close(peer_fd_);
+    }
+  }
+
+  void StartConnection() {
+    auto waiter = TestAsyncWaiter::createInstance();
+    EXPECT_CALL(controller_, ConnectDone(kDeviceUid, kAppHandle))
+        .WillOnce(NotifyTestAsyncWaiter(waiter));
+    ASSERT_TRUE(reactor_->IsInitialised());
+    ASSERT_EQ(TransportAdapter::OK, connection_->Start());
+    ASSERT_TRUE(waiter->WaitFor(1u, kTimeoutMs));
+  }
+
+  ::protocol_handler::RawMessagePtr CreateFrame(const size_t size) const {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<uint8_t>(i);
+    }
+    return std::make_shared< ::protocol_handler::RawMessage>(
+        0, 0, data.data(), data.size(), false);
+  }
+
+  std::string ReadFromPeer(const size_t size) {
+    std::string result;
+    char buffer[4096];
+    while (result.size() < size) {
+      const ssize_t bytes_read = read(peer_fd_, buffer, sizeof(buffer));
+      if (bytes_read <= 0) {
+        break;
+      }
+      result.append(buffer, bytes_read);
+    }
+    return result;
+  }
+
+  NiceMock<MockTransportAdapterController> controller_;
+  SocketReactorSPtr reactor_;
+  std::shared_ptr<TcpSocketConnection> connection_;
+  int peer_fd_;
+};
+
+TEST_F(SocketReactorTest, Start_ConnectDoneCalled) {
+  StartConnection();
+  EXPECT_CALL(controller_, ConnectionFinished(kDeviceUid, kAppHandle));
+}
+
+TEST_F(SocketReactorTest, PeerWritesData_DataReceiveDoneCalled) {
+  StartConnection();
+
+  auto waiter = TestAsyncWaiter::createInstance();
+  std::string received;
+  EXPECT_CALL(controller_, DataReceiveDone(kDeviceUid, kAppHandle, _))
+      .WillRepeatedly(
+          ::testing::DoAll(::testing::Invoke([&received](
+                               const DeviceUID&,
+                               const ApplicationHandle&,
+                               ::protocol_handler::RawMessagePtr message) {
+                             received.append(
+                                 reinterpret_cast<char*>(message->data()),
+                                 message->data_size());
+                           }),
+                           NotifyTestAsyncWaiter(waiter)));
+
+  const std::string data = "reactor";
+  ASSERT_EQ(static_cast<ssize_t>(data.size()),
+            write(peer_fd_, data.c_str(), data.size()));
+  EXPECT_TRUE(waiter->WaitFor(1u, kTimeoutMs));
+  EXPECT_EQ(data, received);
+  EXPECT_CALL(controller_, ConnectionFinished(kDeviceUid, kAppHandle));
+}
+
+TEST_F(SocketReactorTest, SendData_FramesDeliveredInOrder) {
+  StartConnection();
+
+  auto waiter = TestAsyncWaiter::createInstance();
+  EXPECT_CALL(controller_, DataSendDone(kDeviceUid, kAppHandle, _))
+      .Times(2)
+      .WillRepeatedly(NotifyTestAsyncWaiter(waiter));
+
+  ::protocol_handler::RawMessagePtr first = CreateFrame(10u);
+  ::protocol_handler::RawMessagePtr second = CreateFrame(20u);
+  EXPECT_EQ(TransportAdapter::OK, connection_->SendData(first));
+  EXPECT_EQ(TransportAdapter::OK, connection_->SendData(second));
+  EXPECT_TRUE(waiter->WaitFor(2u, kTimeoutMs));
+
+  const std::string expected =
+      std::string(reinterpret_cast<char*>(first->data()), first->data_size()) +
+      std::string(reinterpret_cast<char*>(second->data()),
+                  second->data_size());
+  EXPECT_EQ(expected, ReadFromPeer(expected.size()));
+  EXPECT_CALL(controller_, ConnectionFinished(kDeviceUid, kAppHandle));
+}
+
+TEST_F(SocketReactorTest, SendData_FrameLargerThanSocketBuffer_SentOnWritable) {
+  StartConnection();
+
+  auto waiter = TestAsyncWaiter::createInstance();
+  EXPECT_CALL(controller_, DataSendDone(kDeviceUid, kAppHandle, _))
+      .WillOnce(NotifyTestAsyncWaiter(waiter));
+
+  const size_t kFrameSize = 4u * 1024u * 1024u;
+  ::protocol_handler::RawMessagePtr frame = CreateFrame(kFrameSize);
+  EXPECT_EQ(TransportAdapter::OK, connection_->SendData(frame));
+
+  // Frame can only be completed once peer drains the socket
+  const std::string received = ReadFromPeer(kFrameSize);
+  EXPECT_TRUE(waiter->WaitFor(1u, kTimeoutMs));
+  ASSERT_EQ(kFrameSize, received.size());
+  EXPECT_EQ(0, memcmp(received.data(), frame->data(), kFrameSize));
+  EXPECT_CALL(controller_, ConnectionFinished(kDeviceUid, kAppHandle));
+}
+
+TEST_F(SocketReactorTest, SendData_QueuedFrames_GatheredIntoOneWrite) {
+  const size_t kFramesCount = 50u;
+  const size_t kFrameSize = 100u;
+  auto waiter = TestAsyncWaiter::createInstance();
+  EXPECT_CALL(controller_, DataSendDone(kDeviceUid, kAppHandle, _))
+      .Times(kFramesCount)
+      .WillRepeatedly(NotifyTestAsyncWaiter(waiter));
+
+  // Frames queued before connection is watched are flushed at once
+  for (size_t i = 0; i < kFramesCount; ++i) {
+    EXPECT_EQ(TransportAdapter::OK,
+              connection_->SendData(CreateFrame(kFrameSize)));
+  }
+  StartConnection();
+  EXPECT_TRUE(waiter->WaitFor(kFramesCount, kTimeoutMs));
+  EXPECT_EQ(kFramesCount * kFrameSize,
+            ReadFromPeer(kFramesCount * kFrameSize).size());
+
+  const ThreadedSocketConnection::SendStatistics statistics =
+      connection_->send_statistics();
+  EXPECT_EQ(kFramesCount * kFrameSize, statistics.bytes);
+  EXPECT_EQ(kFramesCount, statistics.frames);
+  EXPECT_EQ(1u, statistics.syscalls);
+  EXPECT_CALL(controller_, ConnectionFinished(kDeviceUid, kAppHandle));
+}
+
+TEST_F(SocketReactorTest, SendData_QueueRefilled_ReceiveNotStarved) {
+  StartConnection();
+  const size_t kFramesCount = 100u;
+  const size_t kFrameSize = 10u;
+  const char kData = 0;
+  std::atomic<size_t> frames_sent(0);
+  std::atomic<size_t> sent_on_receive(0);
+
+  // Every sent frame queues the next one, and the first one makes peer
+  // write data, so the producer queue never gets empty before receiving
+  auto waiter = TestAsyncWaiter::createInstance();
+  EXPECT_CALL(controller_, DataSendDone(kDeviceUid, kAppHandle, _))
+      .WillRepeatedly(::testing::Invoke(
+          [&](const DeviceUID&,
+              const ApplicationHandle&,
+              ::protocol_handler::RawMessagePtr) {
+            if (1u == ++frames_sent) {
+              ASSERT_EQ(1, write(peer_fd_, &kData, sizeof(kData)));
+            }
+            if (frames_sent < kFramesCount) {
+              connection_->SendData(CreateFrame(kFrameSize));
+            } else {
+              waiter->Notify();
+            }
+          }));
+  EXPECT_CALL(controller_, DataReceiveDone(kDeviceUid, kAppHandle, _))
+      .WillOnce(::testing::Invoke([&](const DeviceUID&,
+                                      const ApplicationHandle&,
+                                      ::protocol_handler::RawMessagePtr) {
+        sent_on_receive = frames_sent.load();
+      }));
+
+  EXPECT_EQ(TransportAdapter::OK,
+            connection_->SendData(CreateFrame(kFrameSize)));
+  EXPECT_TRUE(waiter->WaitFor(1u, kTimeoutMs));
+  EXPECT_LT(sent_on_receive.load(), kFramesCount);
+  EXPECT_LT(0u, sent_on_receive.load());
+  EXPECT_CALL(controller_, ConnectionFinished(kDeviceUid, kAppHandle));
+}
+
+TEST_F(SocketReactorTest, PeerClosed_ConnectionAborted) {
+  StartConnection();
+
+  auto waiter = TestAsyncWaiter::createInstance();
+  EXPECT_CALL(controller_, ConnectionAborted(kDeviceUid, kAppHandle, _))
+      .WillOnce(NotifyTestAsyncWaiter(waiter));
+  EXPECT_CALL(controller_, ConnectionFinished(_, _)).Times(0);
+
+  close(peer_fd_);
+  peer_fd_ = -1;
+  EXPECT_TRUE(waiter->WaitFor(1u, kTimeoutMs));
+  EXPECT_TRUE(connection_->IsConnectionTerminated());
+}
+
+TEST_F(SocketReactorTest, Disconnect_ConnectionFinishedAndQueuedFramesFailed) {
+  StartConnection();
+
+  auto waiter = TestAsyncWaiter::createInstance();
+  EXPECT_CALL(controller_, ConnectionFinished(kDeviceUid, kAppHandle))
+      .WillOnce(NotifyTestAsyncWaiter(waiter));
+
+  EXPECT_EQ(TransportAdapter::OK, connection_->Disconnect());
+  EXPECT_TRUE(waiter->WaitFor(1u, kTimeoutMs));
+  EXPECT_EQ(std::string(), ReadFromPeer(1u));
+}
+
+TEST_F(SocketReactorTest, Connect_SlowConnect_OtherConnectNotDelayed) {
+  auto release = TestAsyncWaiter::createInstance();
+  auto slow_connected = TestAsyncWaiter::createInstance();
+  auto connected = TestAsyncWaiter::createInstance();
+  ConnectHandler slow_handler(slow_connected, release);
+  ConnectHandler handler(connected, nullptr);
+  SocketReactor::Entry slow_entry(&slow_handler);
+  SocketReactor::Entry entry(&handler);
+
+  reactor_->Connect(&slow_entry);
+  reactor_->Connect(&entry);
+  EXPECT_TRUE(connected->WaitFor(1u, kTimeoutMs / 2));
+
+  release->Notify();
+  EXPECT_TRUE(slow_connected->WaitFor(1u, kTimeoutMs));
+  reactor_->Remove(&slow_entry);
+  reactor_->Remove(&entry);
+}
+
+TEST_F(SocketReactorTest, Remove_WatchedEntry_CanBeWatchedAgain) {
+  ConnectHandler handler(TestAsyncWaiter::createInstance(), nullptr);
+  SocketReactor::Entry entry(&handler);
+  int fds[2];
+  ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+
+  EXPECT_TRUE(reactor_->Watch(&entry, fds[0]));
+  reactor_->Remove(&entry);
+  // Reconnected connection watches its new socket with the same entry
+  EXPECT_TRUE(reactor_->Watch(&entry, fds[0]));
+  reactor_->Remove(&entry);
+
+  close(fds[0]);
+  close(fds[1]);
+}
+
+TEST_F(SocketReactorTest, Remove_EventsPending_EntryCanBeDestroyed) {
+  // Single loop gets events of all sockets
+  reactor_ = std::make_shared<SocketReactor>(1u);
+  ConnectHandler handler(TestAsyncWaiter::createInstance(), nullptr);
+  const size_t kIterations = 2000u;
+  const char kData = 0;
+
+  for (size_t i = 0; i < kIterations; ++i) {
+    int fds[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+    SocketReactor::Entry* entry = new SocketReactor::Entry(&handler);
+    ASSERT_TRUE(reactor_->Watch(entry, fds[0]));
+
+    // Loop may get the event and wait for the reactor lock meanwhile
+    ASSERT_EQ(1, write(fds[1], &kData, sizeof(kData)));
+    reactor_->Remove(entry);
+    delete entry;
+
+    close(fds[0]);
+    close(fds[1]);
+  }
+}
+
+}  // namespace transport_manager_test
+}  // namespace components
+}  // namespace test
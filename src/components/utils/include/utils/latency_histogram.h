@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_COMPONENTS_UTILS_INCLUDE_UTILS_LATENCY_HISTOGRAM_H_
+#define SRC_COMPONENTS_UTILS_INCLUDE_UTILS_LATENCY_HISTOGRAM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <vector>
+
+#include "utils/macro.h"
+
+namespace utils {
+
+/**
+ * @brief Lock-free histogram of latencies in microseconds.
+ * Values below kSubBucketsCount are counted exactly, each following power
+ * of two range is split into kSubBucketsCount linear buckets, so relative
+ * error of reported values does not exceed 1/kSubBucketsCount.
+ * Values above 2^kMaxValueBits are counted in the last bucket.
+ * Record() and Merge() may be called concurrently from any thread
+ */
+class LatencyHistogram {
+ public:
+  enum {
+    kSubBucketBits = 4,
+    kSubBucketsCount = 1 << kSubBucketBits,
+    kMaxValueBits = 32,
+    kBucketsCount =
+        kSubBucketsCount * (kMaxValueBits - kSubBucketBits + 1)
+  };
+
+  /**
+   * @brief Consistent enough copy of histogram counters taken for export
+   */
+  struct Snapshot {
+    Snapshot();
+
+    /**
+     * @brief Gets upper bound of bucket containing given percentile
+     * @param percentile Percentile in range (0, 100]
+     * @return Value in microseconds or 0 if snapshot is empty
+     */
+    uint64_t ValueAtPercentile(const double percentile) const;
+
+    /**
+     * @brief Gets mean value
+     * @return Value in microseconds or 0 if snapshot is empty
+     */
+    double Mean() const;
+
+    uint64_t count;
+    uint64_t sum;
+    /**
+     * @brief Smallest recorded value, 0 if snapshot is empty
+     */
+    uint64_t min;
+    uint64_t max;
+    std::vector<uint64_t> buckets;
+  };
+
+  LatencyHistogram();
+
+  /**
+   * @brief Adds value to histogram
+   * @param value Latency in microseconds
+   */
+  void Record(const uint64_t value);
+
+  /**
+   * @brief Adds all values recorded by other histogram
+   * @param other Histogram which is not changed concurrently
+   */
+  void Merge(const LatencyHistogram& other);
+
+  /**
+   * @brief Copies current counters. Values recorded concurrently with
+   * this call may be partially reflected in the snapshot
+   * @param snapshot Output snapshot
+   */
+  void TakeSnapshot(Snapshot& snapshot) const;
+
+  static size_t BucketIndex(const uint64_t value);
+  static uint64_t BucketUpperBound(const size_t index);
+
+ private:
+  void UpdateMin(const uint64_t value);
+  void UpdateMax(const uint64_t value);
+
+  std::atomic<uint64_t> buckets_[kBucketsCount];
+  std::atomic<uint64_t> sum_;
+  std::atomic<uint64_t> min_;
+  std::atomic<uint64_t> max_;
+
+  DISALLOW_COPY_AND_ASSIGN(LatencyHistogram);
+};
+
+}  // namespace utils
+#endif  // SRC_COMPONENTS_UTILS_INCLUDE_UTILS_LATENCY_HISTOGRAM_H_
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_COMPONENTS_UTILS_INCLUDE_UTILS_LOGGER_BINARY_LOG_H_
+#define SRC_COMPONENTS_UTILS_INCLUDE_UTILS_LOGGER_BINARY_LOG_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/binary_log_format.h"
+#include "utils/conditional_variable.h"
+#include "utils/ilogger.h"
+#include "utils/lock.h"
+#include "utils/macro.h"
+#include "utils/threads/thread.h"
+#include "utils/threads/thread_delegate.h"
+
+namespace logger {
+
+class BinaryLogThreadBuffer;
+
+/**
+ * @brief Writes log messages in binary form to a memory mapped file.
+ * Each thread appends encoded messages to its own lock-free ring buffer,
+ * background thread moves them to the file. Messages not fitting into the
+ * buffer or into the file of max size are dropped and counted, logging
+ * thread never blocks.
+ * Use tools/binary_log_decoder to get text log from the file
+ */
+class BinaryLog : public BinaryLogSink {
+ public:
+  /**
+   * @param file_name Log file, overwritten if exists
+   * @param thread_buffer_size Size of buffer of each thread, rounded up to
+   * power of 2
+   * @param flush_period_ms Period of moving messages to the file
+   * @param max_file_size Size file may grow to, further messages are
+   * dropped and counted
+   */
+  BinaryLog(const std::string& file_name,
+            const size_t thread_buffer_size = 64 * 1024,
+            const uint32_t flush_period_ms = 100,
+            const size_t max_file_size = 100 * 1024 * 1024);
+
+  ~BinaryLog();
+
+  /**
+   * @brief Creates the file and starts flushing thread
+   * @return false if file can not be created
+   */
+  bool Init();
+
+  /**
+   * @brief Writes remaining messages and closes the file
+   */
+  void DeInit() OVERRIDE;
+
+  uint32_t instance_id() const OVERRIDE;
+
+  uint32_t RegisterSite(const LogSite& site,
+                        const std::string& component,
+                        LogLevel log_level) OVERRIDE;
+
+  void Write(const uint32_t site_id,
+             const char* arguments,
+             const size_t size,
+             const bool truncated) OVERRIDE;
+
+  void Flush() OVERRIDE;
+
+  /**
+   * @brief Gets amount of messages dropped because of full buffers
+   */
+  uint64_t dropped_count() const;
+
+ private:
+  typedef std::shared_ptr<BinaryLogThreadBuffer> ThreadBufferPtr;
+
+  class FlusherDelegate : public threads::ThreadDelegate {
+   public:
+    explicit FlusherDelegate(BinaryLog& binary_log);
+    void threadMain() OVERRIDE;
+    void exitThreadMain() OVERRIDE;
+
+   private:
+    BinaryLog& binary_log_;
+  };
+
+  BinaryLogThreadBuffer& CurrentThreadBuffer();
+
+  /**
+   * @brief Moves messages of all thread buffers to the file
+   */
+  void Drain();
+
+  /**
+   * @brief Checks if record fits into the file leaving space for the
+   * record of messages dropped because of its size. Once a record does not
+   * fit, file is full and all further records are dropped.
+   * Must be called under file_lock_
+   */
+  bool HasSpaceFor(const size_t size);
+
+  /**
+   * @brief Writes record taken from thread buffer if file has space for it.
+   * Must be called under file_lock_
+   */
+  void WriteRecord(const binary_log::RecordHeader& header,
+                   const char* first_part,
+                   const size_t first_part_size,
+                   const char* second_part,
+                   const size_t second_part_size);
+
+  /**
+   * @brief Writes amount of messages dropped by thread buffer.
+   * Must be called under file_lock_
+   */
+  void WriteDroppedRecord(const uint64_t thread_id, const uint64_t count);
+
+  /**
+   * @brief Appends data to the file, maps next part of file if needed.
+   * Must be called under file_lock_
+   */
+  void WriteToFile(const void* data, const size_t size);
+  bool MapNextChunk();
+  void CloseFile();
+
+  const std::string file_name_;
+  const size_t thread_buffer_size_;
+  const uint32_t flush_period_ms_;
+  const size_t max_file_size_;
+  const uint32_t instance_id_;
+
+  sync_primitives::Lock file_lock_;
+  int file_descriptor_;
+  char* mapped_chunk_;
+  /**
+   * @brief Size of file, mapped chunk is at its end
+   */
+  size_t file_size_;
+  size_t mapped_position_;
+  size_t written_size_;
+  bool file_full_;
+  /**
+   * @brief Messages dropped because file is full, written by CloseFile
+   */
+  uint64_t file_full_dropped_count_;
+
+  sync_primitives::Lock sites_lock_;
+  std::unordered_map<const LogSite*, uint32_t> sites_;
+
+  sync_primitives::Lock buffers_lock_;
+  std::vector<ThreadBufferPtr> buffers_;
+  std::atomic<uint64_t> dropped_count_;
+
+  sync_primitives::Lock flusher_lock_;
+  sync_primitives::ConditionalVariable flusher_condition_;
+  bool stop_requested_;
+  FlusherDelegate* flusher_delegate_;
+  threads::Thread* flusher_thread_;
+
+  DISALLOW_COPY_AND_ASSIGN(BinaryLog);
+};
+
+}  // namespace logger
+
+#endif  // SRC_COMPONENTS_UTILS_INCLUDE_UTILS_LOGGER_BINARY_LOG_H_
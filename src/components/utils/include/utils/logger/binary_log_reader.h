@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_COMPONENTS_UTILS_INCLUDE_UTILS_LOGGER_BINARY_LOG_READER_H_
+#define SRC_COMPONENTS_UTILS_INCLUDE_UTILS_LOGGER_BINARY_LOG_READER_H_
+
+#include <stdint.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "utils/ilogger.h"
+
+namespace logger {
+
+/**
+ * @brief Decodes files written by BinaryLog
+ */
+class BinaryLogReader {
+ public:
+  struct Site {
+    std::string component;
+    LogLevel log_level;
+    std::string file_name;
+    std::string function_name;
+    int line_number;
+  };
+
+  struct Message {
+    uint32_t site_id;
+    uint64_t thread_id;
+    /**
+     * @brief Nanoseconds since epoch
+     */
+    int64_t timestamp;
+    std::string text;
+    /**
+     * @brief Arguments did not fit into the message and were cut
+     */
+    bool truncated;
+  };
+
+  BinaryLogReader();
+
+  /**
+   * @brief Reads whole file, messages are ordered by timestamp
+   * @return false if file can not be read or has unknown format. Messages
+   * read before a malformed record are kept
+   */
+  bool Read(const std::string& file_name);
+
+  const std::vector<Message>& messages() const;
+
+  /**
+   * @brief Gets site of message, nullptr if site is unknown
+   */
+  const Site* site(const uint32_t site_id) const;
+
+  /**
+   * @brief Gets amount of messages dropped by writer
+   */
+  uint64_t dropped_count() const;
+
+  /**
+   * @brief Formats message arguments the same way std::ostream does
+   * @return false if arguments are malformed
+   */
+  static bool FormatArguments(const char* data,
+                              const size_t size,
+                              std::string* text);
+
+ private:
+  bool ReadRecord(const char* data, const size_t size);
+
+  std::map<uint32_t, Site> sites_;
+  std::vector<Message> messages_;
+  uint64_t dropped_count_;
+};
+
+}  // namespace logger
+
+#endif  // SRC_COMPONENTS_UTILS_INCLUDE_UTILS_LOGGER_BINARY_LOG_READER_H_
@@ -36,6 +36,7 @@
 #include "utils/ilogger.h"
 
 #include <functional>
+#include <vector>
 
 #include "utils/threads/message_loop_thread.h"
 
@@ -68,6 +69,13 @@ class LoggerImpl : public Logger, public LoggerInitializer {
  public:
   LoggerImpl(bool use_message_loop_thread = true);
   void Init(std::unique_ptr<ThirdPartyLoggerInterface>&& impl) override;
+
+  /**
+   * @brief Sets sink enabled messages are written to in binary form,
+   * levels are still checked by logger implementation
+   */
+  void InitBinaryLog(std::unique_ptr<BinaryLogSink>&& sink);
+
   void DeInit() override;
   void Flush() override;
 
@@ -76,6 +84,11 @@ class LoggerImpl : public Logger, public LoggerInitializer {
   void PushLog(const LogMessage& log_message) override;
 
   std::unique_ptr<ThirdPartyLoggerInterface> impl_;
+  BinaryLogSink* binary_log_sink_;
+  /**
+   * @brief All sinks set so far, kept till the logger is deleted
+   */
+  std::vector<std::unique_ptr<BinaryLogSink> > binary_log_sinks_;
   LoopThreadPtr<LogMessageLoopThread> loop_thread_;
   bool use_message_loop_thread_;
 };
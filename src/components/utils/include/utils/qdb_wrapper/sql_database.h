@@ -34,6 +34,7 @@
 #define SRC_COMPONENTS_UTILS_INCLUDE_UTILS_QDB_WRAPPER_SQL_DATABASE_H_
 
 #include <qdb/qdb.h>
+#include <stdint.h>
 #include <string>
 #include "qdb_wrapper/sql_error.h"
 #include "utils/lock.h"
@@ -63,23 +64,34 @@ class SQLDatabase {
   void Close();
 
   /**
-   * Begins a transaction on the database
+   * Begins a transaction on the database.
+   * If a transaction is already in progress, a savepoint is created instead,
+   * so nested transaction can be committed or rolled back on its own
    * @return true if successfully
    */
   bool BeginTransaction();
 
   /**
-   * Commits a transaction to the database
+   * Commits a transaction to the database or releases the savepoint of
+   * nested transaction
    * @return true if successfully
    */
   bool CommitTransaction();
 
   /**
-   * Rolls back a transaction on the database
+   * Rolls back a transaction on the database or changes made since the
+   * savepoint of nested transaction
    * @return true if successfully
    */
   bool RollbackTransaction();
 
+  /**
+   * Does nothing, journal of QDB database is configured by the server.
+   * Kept for compatibility with SQLite wrapper
+   * @return always true
+   */
+  bool EnableWriteAheadLog(const uint32_t mmap_size);
+
   /**
    * Gets information about the last error that occurred on the database
    * @return last error
@@ -119,6 +131,11 @@ class SQLDatabase {
    */
   Error error_;
 
+  /**
+   * Number of nested transactions in progress
+   */
+  uint32_t transaction_depth_;
+
   /**
    * Execs query for internal using in this class
    * @param query sql query without return results
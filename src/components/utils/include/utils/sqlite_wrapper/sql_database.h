@@ -33,11 +33,14 @@
 #ifndef SRC_COMPONENTS_UTILS_INCLUDE_UTILS_SQLITE_WRAPPER_SQL_DATABASE_H_
 #define SRC_COMPONENTS_UTILS_INCLUDE_UTILS_SQLITE_WRAPPER_SQL_DATABASE_H_
 
+#include <stdint.h>
+#include <map>
 #include <string>
 #include "utils/lock.h"
 #include "utils/sqlite_wrapper/sql_error.h"
 
 struct sqlite3;
+struct sqlite3_stmt;
 
 namespace utils {
 namespace dbms {
@@ -65,23 +68,36 @@ class SQLDatabase {
   void Close();
 
   /**
-   * Begins a transaction on the database
+   * Begins a transaction on the database.
+   * If a transaction is already in progress, a savepoint is created instead,
+   * so nested transaction can be committed or rolled back on its own
    * @return true if successfully
    */
   bool BeginTransaction();
 
   /**
-   * Commits a transaction to the database
+   * Commits a transaction to the database or releases the savepoint of
+   * nested transaction
    * @return true if successfully
    */
   bool CommitTransaction();
 
   /**
-   * Rolls back a transaction on the database
+   * Rolls back a transaction on the database or changes made since the
+   * savepoint of nested transaction
    * @return true if successfully
    */
   bool RollbackTransaction();
 
+  /**
+   * Switches journal of the opened database to write-ahead log and sets
+   * size of memory mapped I/O. Has no effect for in-memory database
+   * @param mmap_size maximum number of bytes of the database file to be
+   * memory mapped, 0 disables memory mapped I/O
+   * @return true if successfully
+   */
+  bool EnableWriteAheadLog(const uint32_t mmap_size);
+
   /**
    * Gets information about the last error that occurred on the database
    * @return last error
@@ -119,7 +135,34 @@ class SQLDatabase {
    */
   sqlite3* conn() const;
 
+  /**
+   * Gets prepared statement for the query. Statement is taken from the cache
+   * if it was prepared before, otherwise it is compiled.
+   * Caller owns the statement till it is given back with ReleaseStatement
+   * @param query the utf-8 string of SQL query
+   * @param statement receives prepared statement
+   * @return SQLite result code
+   */
+  int AcquireStatement(const std::string& query, sqlite3_stmt** statement);
+
+  /**
+   * Resets statement and puts it back to the cache for the next Prepare
+   * of the same query
+   * @param query the utf-8 string of SQL query statement was prepared for
+   * @param statement statement to give back
+   * @return SQLite result code of the last evaluation of statement
+   */
+  int ReleaseStatement(const std::string& query, sqlite3_stmt* statement);
+
  private:
+  typedef std::multimap<std::string, sqlite3_stmt*> Statements;
+
+  /**
+   * Finalizes all cached statements, must be called before closing
+   * connection
+   */
+  void ClearStatements();
+
   /**
    * The connection to the SQLite database
    */
@@ -145,6 +188,26 @@ class SQLDatabase {
    */
   int error_;
 
+  /**
+   * Prepared statements which are not used by any query at the moment
+   */
+  Statements statements_;
+
+  /**
+   * Lock for guarding cache of statements
+   */
+  sync_primitives::Lock statements_lock_;
+
+  /**
+   * Number of nested transactions in progress
+   */
+  uint32_t transaction_depth_;
+
+  /**
+   * Maximum number of statements kept in the cache
+   */
+  static const size_t kMaxCachedStatements;
+
   /**
    *  The temporary in-memory database
    *  @see SQLite manual
@@ -163,6 +226,11 @@ class SQLDatabase {
    */
   inline bool Exec(const std::string& query);
 
+  /**
+   * Updates depth of nested transactions after the end of a transaction
+   */
+  void UpdateTransactionDepth();
+
   friend class SQLQuery;
 };
 
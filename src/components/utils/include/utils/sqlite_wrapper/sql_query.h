@@ -216,6 +216,12 @@ class SQLQuery {
    */
   sqlite3_stmt* statement_;
 
+  /**
+   * The string of query the statement was prepared for,
+   * unlike query_ it is not changed by Exec of another query
+   */
+  std::string statement_query_;
+
   /**
    * Lock for guarding statement
    */
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef SRC_COMPONENTS_UTILS_INCLUDE_UTILS_THREADS_WORK_STEALING_EXECUTOR_H_
+#define SRC_COMPONENTS_UTILS_INCLUDE_UTILS_THREADS_WORK_STEALING_EXECUTOR_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/conditional_variable.h"
+#include "utils/lock.h"
+#include "utils/macro.h"
+#include "utils/threads/thread.h"
+#include "utils/threads/thread_delegate.h"
+
+namespace threads {
+
+/**
+ * @brief Pool of worker threads running tasks posted with an affinity key.
+ * Tasks of the same key run one at a time in posting order, tasks of
+ * different keys run in parallel. Pending tasks of a key form a strand
+ * which is queued to the deque of its home worker, idle workers steal
+ * strands from deques of other workers. Delayed tasks are kept in a
+ * deadline heap served by the same workers.
+ * Thread-safe class
+ */
+class WorkStealingExecutor {
+ public:
+  typedef std::function<void()> Task;
+  typedef uint32_t Key;
+
+  struct Statistics {
+    Statistics();
+
+    /**
+     * @brief Amount of tasks ready for execution
+     */
+    size_t queue_depth;
+    /**
+     * @brief Amount of delayed tasks which are not due yet
+     */
+    size_t delayed_count;
+    uint64_t executed_count;
+    /**
+     * @brief Amount of strands taken from deque of another worker
+     */
+    uint64_t stolen_count;
+    /**
+     * @brief Time between task becoming ready and its start
+     */
+    uint64_t average_latency_us;
+    uint64_t max_latency_us;
+  };
+
+  /**
+   * @brief Gets amount of workers matching amount of CPU cores
+   */
+  static size_t DefaultWorkersCount();
+
+  /**
+   * @brief Constructor, does not start worker threads
+   * @param name Name of worker threads
+   * @param workers_count Amount of worker threads, DefaultWorkersCount()
+   * is used if zero
+   */
+  WorkStealingExecutor(const std::string& name, const size_t workers_count);
+
+  /**
+   * @brief Destructor, stops workers and drops all pending tasks
+   */
+  ~WorkStealingExecutor();
+
+  /**
+   * @brief Starts worker threads
+   */
+  void Start();
+
+  /**
+   * @brief Stops worker threads after their current tasks.
+   * Pending tasks are kept and run after next Start()
+   */
+  void Stop();
+
+  bool IsRunning() const;
+
+  size_t workers_count() const;
+
+  /**
+   * @brief Queues task after all pending tasks of the key
+   * @param key Affinity key of task
+   * @param task Task to run
+   */
+  void Post(const Key key, const Task& task);
+
+  /**
+   * @brief Queues task after all pending tasks of the key once delay passes
+   * @param key Affinity key of task
+   * @param delay_ms Delay in milliseconds
+   * @param task Task to run
+   */
+  void PostDelayed(const Key key, const uint32_t delay_ms, const Task& task);
+
+  /**
+   * @brief Drops tasks of the key posted by Post() which have not started.
+   * Delayed tasks are kept
+   * @param key Affinity key of tasks
+   * @return Amount of dropped tasks
+   */
+  size_t Remove(const Key key);
+
+  /**
+   * @brief Drops all tasks posted by Post() which have not started.
+   * Delayed tasks are kept
+   * @return Amount of dropped tasks
+   */
+  size_t Clear();
+
+  /**
+   * @brief Gets amount of tasks ready for execution
+   */
+  size_t queue_depth() const;
+
+  Statistics GetStatistics() const;
+
+ private:
+  struct Item {
+    Item();
+    Item(const Task& task, const uint64_t ready_time, const bool removable);
+
+    Task task;
+    uint64_t ready_time;
+    bool removable;
+  };
+
+  struct DelayedItem {
+    DelayedItem(const Key key,
+                const Task& task,
+                const uint64_t deadline,
+                const uint64_t sequence);
+
+    /**
+     * @brief Orders heap by deadline, then by posting order
+     */
+    bool operator<(const DelayedItem& other) const;
+
+    Key key;
+    Task task;
+    uint64_t deadline;
+    uint64_t sequence;
+  };
+
+  /**
+   * @brief Pending tasks of one key. Exists only while it is queued to some
+   * worker deque or is being run, so a key never runs on two workers
+   */
+  struct Strand {
+    Strand(const Key key, const size_t home);
+
+    const Key key;
+    const size_t home;
+    std::deque<Item> items;
+  };
+
+  struct WorkerQueue {
+    sync_primitives::Lock lock;
+    std::deque<Strand*> strands;
+  };
+
+  class WorkerDelegate : public ThreadDelegate {
+   public:
+    WorkerDelegate(WorkStealingExecutor& executor, const size_t index);
+    void threadMain() OVERRIDE;
+    void exitThreadMain() OVERRIDE;
+
+   private:
+    WorkStealingExecutor& executor_;
+    const size_t index_;
+  };
+
+  /**
+   * @brief Microseconds elapsed since executor creation by monotonic clock
+   */
+  uint64_t Now() const;
+
+  void Enqueue(const Key key, const Item& item);
+
+  /**
+   * @brief Drops tasks matching key filter, destroys them unlocked
+   */
+  size_t RemoveItems(const bool all_keys, const Key key);
+
+  /**
+   * @brief Pushes strand to the back of its home worker deque.
+   * Called with strands_lock_ acquired
+   */
+  void Schedule(Strand* strand);
+
+  /**
+   * @brief Pops strand from own deque front or steals one from the back
+   * of other deques
+   */
+  Strand* PopStrand(const size_t index);
+
+  /**
+   * @brief Runs first task of strand and schedules strand again if it
+   * still has tasks
+   */
+  void RunStrand(Strand* strand);
+
+  /**
+   * @brief Moves due delayed tasks to their strands
+   */
+  void PostDueTasks();
+
+  /**
+   * @brief Blocks worker until some strand is scheduled, nearest deadline
+   * comes or executor stops
+   */
+  void WaitForWork();
+
+  void WakeWorker();
+
+  void WorkerMain(const size_t index);
+
+  const std::string name_;
+  const std::chrono::steady_clock::time_point start_time_;
+
+  mutable sync_primitives::Lock strands_lock_;
+  std::unordered_map<Key, Strand*> strands_;
+  size_t queue_depth_;
+
+  std::vector<WorkerQueue*> queues_;
+  std::atomic<size_t> scheduled_count_;
+
+  mutable sync_primitives::Lock delayed_lock_;
+  std::vector<DelayedItem> delayed_;
+  uint64_t delayed_sequence_;
+  /**
+   * @brief Nearest deadline in microseconds, lets workers skip delayed_lock_
+   */
+  std::atomic<uint64_t> next_deadline_;
+
+  sync_primitives::Lock sleep_lock_;
+  sync_primitives::ConditionalVariable sleep_condition_;
+  std::atomic<size_t> sleepers_count_;
+  std::atomic<bool> stop_requested_;
+
+  std::atomic<uint64_t> executed_count_;
+  std::atomic<uint64_t> stolen_count_;
+  std::atomic<uint64_t> total_latency_us_;
+  std::atomic<uint64_t> max_latency_us_;
+
+  mutable sync_primitives::Lock threads_lock_;
+  std::vector<WorkerDelegate*> worker_delegates_;
+  std::vector<Thread*> worker_threads_;
+
+  DISALLOW_COPY_AND_ASSIGN(WorkStealingExecutor);
+};
+
+}  // namespace threads
+
+#endif  // SRC_COMPONENTS_UTILS_INCLUDE_UTILS_THREADS_WORK_STEALING_EXECUTOR_H_
@@ -38,14 +38,11 @@
 
 #include "utils/lock.h"
 #include "utils/macro.h"
-#include "utils/threads/thread.h"
-#include "utils/threads/thread_delegate.h"
+#include "utils/timer_wheel.h"
 #include "utils/timer_task.h"
 
 namespace timer {
 
-typedef uint32_t Milliseconds;
-
 /**
  * @brief Enumeration listing of possible timer types.
  * Single shot timer signals only once and then stops counting.
@@ -66,9 +63,12 @@ enum TimerType {
 /**
  * @brief Timer calls custom callback function after
  * specified timeout has been elapsed.
+ * Timer does not own a thread, it is armed in the process-wide
+ * TimerWheel and its task is called from one of the wheel workers, which
+ * are shared by all timers, so task must not block.
  * Thread-safe class
  */
-class Timer {
+class Timer : private TimerWheel::Handler {
  public:
   /**
    * @brief Constructor
@@ -78,9 +78,20 @@ class Timer {
    */
   Timer(const std::string& name, TimerTask* task);
 
+  /**
+   * @brief Constructor of timer armed in the given wheel.
+   * Tasks which may block must use TimerWheel::blocking_instance()
+   * Does not start timer
+   * @param name Timer name for identification
+   * @param task Task for tracking
+   * @param wheel Wheel running the task, must outlive the timer
+   */
+  Timer(const std::string& name, TimerTask* task, TimerWheel& wheel);
+
   /**
    * @brief Destructor
-   * Stops timer if it's running
+   * Stops timer if it's running and waits for its task
+   * unless called from that task
    */
   ~Timer();
 
@@ -92,7 +103,8 @@ class Timer {
   void Start(const Milliseconds timeout, const TimerType timer_type);
 
   /**
-   * @brief Stops timer if it's running
+   * @brief Stops timer if it's running.
+   * Waits for task being executed unless called from that task
    */
   void Stop();
 
@@ -113,115 +125,34 @@ class Timer {
 
  private:
   /**
-   * @brief Delegate for timer thread
-   */
-  class TimerDelegate : public threads::ThreadDelegate {
-   public:
-    /**
-     * @brief Constructor
-     * @param timer Timer instance pointer for callback calling
-     */
-    TimerDelegate(Timer* timer, sync_primitives::Lock& state_lock_ref);
-
-    /**
-     * @brief Sets timer timeout
-     * @param timeout Timeout in milliseconds to be set
-     */
-    void set_timeout(const Milliseconds timeout);
-
-    /**
-     * @brief Gets timer timeout
-     * @return Timer timeout
-     */
-    Milliseconds timeout() const;
-
-    /**
-     * @brief Sets timer delegate stop flag
-     * @param stop_flag Bool flag to be set
-     */
-    void set_stop_flag(const bool stop_flag);
-
-    /**
-     * @brief Gets timer delegate stop flag
-     * @return Delegate stop flag
-     */
-    bool stop_flag() const;
-
-    /**
-     * @brief Sets timer delegate finalized flag
-     * @param finalized_flag Bool flag to be set
-     */
-    void set_finalized_flag(const bool finalized_flag);
-
-    /**
-     * @brief Gets timer delegate finalized flag
-     * @return Delegate finalized flag
-     */
-    bool finalized_flag() const;
-
-    void threadMain() OVERRIDE;
-    void exitThreadMain() OVERRIDE;
-
-   private:
-    Timer* timer_;
-    Milliseconds timeout_;
-
-    /**
-     * @brief Stop flag shows if timer should be stopped
-     * after next iteration
-     */
-    bool stop_flag_;
-
-    /**
-     * @brief Finalized flag shows if timer is finalized
-     * and cannot be restarted until actual thread stopping
-     */
-    bool finalized_flag_;
-
-    sync_primitives::Lock& state_lock_ref_;
-    sync_primitives::ConditionalVariable state_condition_;
-
-    DISALLOW_COPY_AND_ASSIGN(TimerDelegate);
-  };
-
-  /**
-   * @brief Sets up timer delegate to start state.
-   * Not thread-safe
-   * @param timeout Timer timeout
-   */
-  void StartDelegate(const Milliseconds timeout);
-
-  /**
-   * @brief Sets up timer delegate to stop state.
-   * Not thread-safe
-   */
-  void StopDelegate();
-
-  /**
-   * @brief Starts timer thread.
-   * Not thread-safe
-   */
-  void StartThread();
-
-  /**
-   * @brief Stops timer thread.
+   * @brief Sets up timer to stop state.
    * Not thread-safe
    */
-  void StopThread();
+  void StopState();
 
   /**
-   * @brief Callback called on timeout.
-   * Not thread-safe
+   * @brief Callback called by the wheel on timeout
+   * @param generation Timer generation the expiration belongs to
    */
-  void OnTimeout();
+  void OnExpired(const uint32_t generation) OVERRIDE;
 
   const std::string name_;
   TimerTask* task_;
 
   mutable sync_primitives::Lock state_lock_;
 
-  std::unique_ptr<TimerDelegate> delegate_;
-  threads::Thread* thread_;
+  TimerWheel& wheel_;
+  TimerWheel::Entry entry_;
+
+  Milliseconds timeout_;
+
+  /**
+   * @brief Incremented on each Start/Stop, lets drop expirations
+   * of previous runs which were already picked up by a wheel worker
+   */
+  uint32_t generation_;
+
+  bool running_;
 
   /**
    * @brief Single shot flag shows if timer should be fired once
@@ -230,6 +161,11 @@ class Timer {
 
   bool completed_flag_;
 
+  /**
+   * @brief Set while task is executed, lets task destroy its own timer
+   */
+  bool* destroyed_flag_;
+
   DISALLOW_COPY_AND_ASSIGN(Timer);
 };
 
@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef SRC_COMPONENTS_UTILS_INCLUDE_UTILS_TIMER_WHEEL_H_
+#define SRC_COMPONENTS_UTILS_INCLUDE_UTILS_TIMER_WHEEL_H_
+
+#include <stdint.h>
+#include <chrono>
+#include <vector>
+
+#include "utils/conditional_variable.h"
+#include "utils/lock.h"
+#include "utils/macro.h"
+#include "utils/threads/thread.h"
+#include "utils/threads/thread_delegate.h"
+
+namespace timer {
+
+typedef uint32_t Milliseconds;
+
+/**
+ * @brief Hierarchical timing wheel shared by all timer::Timer instances.
+ * One ticker thread advances the wheel with millisecond resolution and a
+ * small fixed pool of worker threads runs expired callbacks, so arming and
+ * cancelling a timer is O(1) and creates no threads.
+ * Entries are intrusive and owned by the client, the wheel never allocates
+ * on Schedule/Cancel.
+ * Thread-safe class
+ */
+class TimerWheel {
+ public:
+  /**
+   * @brief Callback interface invoked on a worker thread on expiration
+   */
+  class Handler {
+   public:
+    virtual ~Handler() {}
+
+    /**
+     * @brief Called when scheduled entry expires
+     * @param cookie Value passed to Schedule() for this expiration
+     */
+    virtual void OnExpired(const uint32_t cookie) = 0;
+  };
+
+  /**
+   * @brief Wheel node embedded into the client object.
+   * Must not be destroyed before Release() was called for it
+   */
+  class Entry {
+   public:
+    explicit Entry(Handler* handler);
+
+   private:
+    friend class TimerWheel;
+
+    enum State {
+      kIdle = 0,
+      /**
+       * @brief Linked into one of the wheel slots
+       */
+      kPending,
+      /**
+       * @brief Linked into the list of expired entries
+       */
+      kReady,
+      /**
+       * @brief Expired while its previous callback is still running
+       */
+      kDeferred
+    };
+
+    Handler* handler_;
+    Entry* next_;
+    Entry** pprev_;
+    uint64_t expires_;
+    uint32_t cookie_;
+    uint8_t level_;
+    uint16_t index_;
+    State state_;
+    bool firing_;
+    threads::PlatformThreadHandle firing_thread_;
+    bool* released_flag_;
+
+    DISALLOW_COPY_AND_ASSIGN(Entry);
+  };
+
+  /**
+   * @brief Process-wide wheel instance used by timer::Timer.
+   * Created on first use and never destroyed, so timers living in static
+   * objects stay valid until process exit
+   */
+  static TimerWheel& instance();
+
+  /**
+   * @brief Process-wide wheel for tasks which may block, e.g. on network
+   * or on another thread. Its workers are separate from instance() ones,
+   * so such tasks can not starve regular timers.
+   * Created on first use and never destroyed
+   */
+  static TimerWheel& blocking_instance();
+
+  /**
+   * @brief Constructor, starts ticker and worker threads
+   * @param workers_count Number of threads running expired callbacks
+   * @param callback_budget Longest time a callback is expected to run,
+   * longer callbacks are reported as errors. Zero disables the check
+   */
+  explicit TimerWheel(const size_t workers_count,
+                      const Milliseconds callback_budget = 0);
+
+  /**
+   * @brief Destructor, stops all threads.
+   * Entries still scheduled are dropped without calling their handlers
+   */
+  ~TimerWheel();
+
+  /**
+   * @brief Arms entry to expire after timeout, re-arms it if already armed
+   * @param entry Entry to schedule
+   * @param timeout Timeout in milliseconds
+   * @param cookie Value passed back to Handler::OnExpired
+   */
+  void Schedule(Entry* entry,
+                const Milliseconds timeout,
+                const uint32_t cookie);
+
+  /**
+   * @brief Disarms entry. Does not wait for a callback already running
+   * @param entry Entry to cancel
+   */
+  void Cancel(Entry* entry);
+
+  /**
+   * @brief Blocks until the running callback of the entry is finished.
+   * Returns immediately if called from that callback
+   * @param entry Entry to wait for
+   */
+  void Wait(Entry* entry);
+
+  /**
+   * @brief Cancels entry and waits for its running callback so the entry
+   * can be destroyed afterwards
+   * @param entry Entry to release
+   * @return True if called from the entry own callback. In that case the
+   * wheel does not touch the entry after the callback returns
+   */
+  bool Release(Entry* entry);
+
+  /**
+   * @brief Gets amount of armed entries
+   */
+  size_t pending_count() const;
+
+  /**
+   * @brief Gets amount of callbacks which ran longer than the budget
+   */
+  size_t overrun_count() const;
+
+ private:
+  class TickerDelegate : public threads::ThreadDelegate {
+   public:
+    explicit TickerDelegate(TimerWheel& wheel);
+    void threadMain() OVERRIDE;
+    void exitThreadMain() OVERRIDE;
+
+   private:
+    TimerWheel& wheel_;
+  };
+
+  class WorkerDelegate : public threads::ThreadDelegate {
+   public:
+    explicit WorkerDelegate(TimerWheel& wheel);
+    void threadMain() OVERRIDE;
+    void exitThreadMain() OVERRIDE;
+
+   private:
+    TimerWheel& wheel_;
+  };
+
+  enum {
+    kRootBits = 8,
+    kLevelBits = 6,
+    kRootSize = 1 << kRootBits,
+    kLevelSize = 1 << kLevelBits,
+    kRootMask = kRootSize - 1,
+    kLevelMask = kLevelSize - 1,
+    kLevelsCount = 5,
+    kBitmapWords = kRootSize / 64
+  };
+
+  typedef Entry* Slot;
+
+  /**
+   * @brief Milliseconds elapsed since wheel creation by monotonic clock
+   */
+  uint64_t CurrentTick() const;
+
+  Slot* SlotAt(const size_t level, const size_t index);
+
+  /**
+   * @brief Links entry into the slot matching its expiration tick.
+   * Not thread-safe
+   */
+  void Insert(Entry* entry);
+
+  /**
+   * @brief Unlinks entry from wheel slot or expired list.
+   * Not thread-safe
+   */
+  void Unlink(Entry* entry);
+
+  void PushReady(Entry* entry);
+  Entry* PopReady();
+
+  /**
+   * @brief Moves all entries of the upper level slot to lower levels.
+   * Not thread-safe
+   * @return Index of cascaded slot
+   */
+  size_t Cascade(const size_t level);
+
+  /**
+   * @brief Processes single tick, moves expired entries to expired list.
+   * Not thread-safe
+   */
+  void RunTick();
+
+  /**
+   * @brief Gets nearest tick when wheel has something to do.
+   * Not thread-safe
+   * @return Tick number or UINT64_MAX if wheel is empty
+   */
+  uint64_t NextEventTick() const;
+
+  void TickerMain();
+  void WorkerMain();
+  void StopThreads();
+
+  bool IsFiringOnCurrentThread(const Entry* entry) const;
+
+  mutable sync_primitives::Lock lock_;
+  sync_primitives::ConditionalVariable ticker_condition_;
+  sync_primitives::ConditionalVariable workers_condition_;
+  sync_primitives::ConditionalVariable idle_condition_;
+
+  Slot root_[kRootSize];
+  Slot levels_[kLevelsCount - 1][kLevelSize];
+  /**
+   * @brief Non-empty root slots, lets ticker sleep till the nearest one
+   */
+  uint64_t root_bitmap_[kBitmapWords];
+
+  Entry* ready_head_;
+  Entry** ready_tail_;
+
+  const std::chrono::steady_clock::time_point start_time_;
+  uint64_t now_tick_;
+  uint64_t next_wakeup_tick_;
+  size_t pending_count_;
+  const Milliseconds callback_budget_;
+  size_t overrun_count_;
+  bool stop_requested_;
+
+  TickerDelegate* ticker_delegate_;
+  threads::Thread* ticker_thread_;
+  std::vector<WorkerDelegate*> worker_delegates_;
+  std::vector<threads::Thread*> worker_threads_;
+
+  DISALLOW_COPY_AND_ASSIGN(TimerWheel);
+};
+
+}  // namespace timer
+
+#endif  // SRC_COMPONENTS_UTILS_INCLUDE_UTILS_TIMER_WHEEL_H_
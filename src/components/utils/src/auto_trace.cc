@@ -35,31 +35,11 @@
 
 namespace logger {
 
-AutoTrace::AutoTrace(const std::string& component, const LocationInfo& location)
-    : component_(component), location_(location) {
-  if (logger::Logger::instance().IsEnabledFor(component_,
-                                              logger::LogLevel::TRACE_LEVEL)) {
-    logger::LogMessage message{component_,
-                               LogLevel::TRACE_LEVEL,
-                               "Enter",
-                               std::chrono::high_resolution_clock::now(),
-                               location_,
-                               std::this_thread::get_id()};
-    logger::Logger::instance().PushLog(message);
-  }
-}
-
-AutoTrace::~AutoTrace() {
-  if (logger::Logger::instance().IsEnabledFor(component_,
-                                              logger::LogLevel::TRACE_LEVEL)) {
-    logger::LogMessage message{component_,
-                               LogLevel::TRACE_LEVEL,
-                               "Exit",
-                               std::chrono::high_resolution_clock::now(),
-                               location_,
-                               std::this_thread::get_id()};
-    logger::Logger::instance().PushLog(message);
-  }
+void AutoTrace::PushLog(const char* log_event) const {
+  LogStream stream(
+      Logger::instance(), site_, component_, LogLevel::TRACE_LEVEL);
+  stream << log_event;
+  stream.Push();
 }
 
 }  // namespace logger
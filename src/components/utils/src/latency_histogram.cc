@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/latency_histogram.h"
+
+#include <limits>
+
+namespace utils {
+
+namespace {
+size_t HighestBit(uint64_t value) {
+  size_t bit = 0;
+  while (value >>= 1) {
+    ++bit;
+  }
+  return bit;
+}
+}  // namespace
+
+LatencyHistogram::Snapshot::Snapshot() : count(0), sum(0), min(0), max(0) {}
+
+uint64_t LatencyHistogram::Snapshot::ValueAtPercentile(
+    const double percentile) const {
+  if (0 == count) {
+    return 0;
+  }
+  uint64_t rank = static_cast<uint64_t>(percentile / 100.0 * count + 0.5);
+  if (0 == rank) {
+    rank = 1;
+  }
+  uint64_t accumulated = 0;
+  for (size_t index = 0; index < buckets.size(); ++index) {
+    accumulated += buckets[index];
+    if (accumulated >= rank) {
+      const uint64_t bound = BucketUpperBound(index);
+      return bound < max ? bound : max;
+    }
+  }
+  return max;
+}
+
+double LatencyHistogram::Snapshot::Mean() const {
+  return count ? static_cast<double>(sum) / count : 0.0;
+}
+
+LatencyHistogram::LatencyHistogram()
+    : sum_(0), min_(std::numeric_limits<uint64_t>::max()), max_(0) {
+  for (size_t index = 0; index < kBucketsCount; ++index) {
+    buckets_[index].store(0, std::memory_order_relaxed);
+  }
+}
+
+size_t LatencyHistogram::BucketIndex(const uint64_t value) {
+  if (value < kSubBucketsCount) {
+    return static_cast<size_t>(value);
+  }
+  const size_t bit = HighestBit(value);
+  if (bit >= kMaxValueBits) {
+    return kBucketsCount - 1;
+  }
+  const size_t shift = bit - kSubBucketBits;
+  const size_t sub_bucket =
+      static_cast<size_t>(value >> shift) & (kSubBucketsCount - 1);
+  return kSubBucketsCount * (shift + 1) + sub_bucket;
+}
+
+uint64_t LatencyHistogram::BucketUpperBound(const size_t index) {
+  if (index < kSubBucketsCount) {
+    return index;
+  }
+  const size_t shift = index / kSubBucketsCount - 1;
+  const uint64_t sub_bucket = index % kSubBucketsCount;
+  const uint64_t lower_bound = (uint64_t(kSubBucketsCount) + sub_bucket)
+                               << shift;
+  return lower_bound + (uint64_t(1) << shift) - 1;
+}
+
+void LatencyHistogram::Record(const uint64_t value) {
+  buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+  sum_.fetch_add(value, std::memory_order_relaxed);
+  UpdateMin(value);
+  UpdateMax(value);
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram& other) {
+  for (size_t index = 0; index < kBucketsCount; ++index) {
+    const uint64_t count =
+        other.buckets_[index].load(std::memory_order_relaxed);
+    if (count) {
+      buckets_[index].fetch_add(count, std::memory_order_relaxed);
+    }
+  }
+  sum_.fetch_add(other.sum_.load(std::memory_order_relaxed),
+                 std::memory_order_relaxed);
+  UpdateMin(other.min_.load(std::memory_order_relaxed));
+  UpdateMax(other.max_.load(std::memory_order_relaxed));
+}
+
+void LatencyHistogram::TakeSnapshot(Snapshot& snapshot) const {
+  snapshot.sum = sum_.load(std::memory_order_relaxed);
+  snapshot.max = max_.load(std::memory_order_relaxed);
+  const uint64_t min = min_.load(std::memory_order_relaxed);
+  snapshot.buckets.resize(kBucketsCount);
+  snapshot.count = 0;
+  for (size_t index = 0; index < kBucketsCount; ++index) {
+    snapshot.buckets[index] = buckets_[index].load(std::memory_order_relaxed);
+    snapshot.count += snapshot.buckets[index];
+  }
+  snapshot.min = snapshot.count ? min : 0;
+}
+
+void LatencyHistogram::UpdateMin(const uint64_t value) {
+  uint64_t current_min = min_.load(std::memory_order_relaxed);
+  while (value < current_min &&
+         !min_.compare_exchange_weak(
+             current_min, value, std::memory_order_relaxed)) {
+  }
+}
+
+void LatencyHistogram::UpdateMax(const uint64_t value) {
+  uint64_t current_max = max_.load(std::memory_order_relaxed);
+  while (value > current_max &&
+         !max_.compare_exchange_weak(
+             current_max, value, std::memory_order_relaxed)) {
+  }
+}
+
+}  // namespace utils
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/log_stream.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace logger {
+
+void LogStream::Push() {
+  if (!binary_log_sink_) {
+    LogMessage message{
+        component_,
+        log_level_,
+        std::move(text_),
+        std::chrono::high_resolution_clock::now(),
+        LocationInfo{site_.file_name, site_.function_name, site_.line_number},
+        std::this_thread::get_id()};
+    logger_.PushLog(message);
+    return;
+  }
+
+  const uint64_t instance_id = binary_log_sink_->instance_id();
+  uint64_t site_id = site_.binary_site_id.load(std::memory_order_relaxed);
+  if ((site_id >> 32) != instance_id) {
+    // Sink returns the same id for all threads racing here
+    site_id = (instance_id << 32) |
+              binary_log_sink_->RegisterSite(site_, component_, log_level_);
+    site_.binary_site_id.store(site_id, std::memory_order_relaxed);
+  }
+  binary_log_sink_->Write(
+      static_cast<uint32_t>(site_id), buffer_, size_, truncated_);
+}
+
+void LogStream::AppendText(const char* value, const size_t size) {
+  if (!binary_log_sink_) {
+    text_.append(value, size);
+    return;
+  }
+
+  uint16_t text_size = 0;
+  if (kNoTextArgument == text_argument_) {
+    if (size_ + 1 + sizeof(text_size) > sizeof(buffer_)) {
+      truncated_ = truncated_ || size > 0;
+      return;
+    }
+    buffer_[size_++] = static_cast<char>(binary_log::kStringArgument);
+    text_argument_ = size_;
+    size_ += sizeof(text_size);
+  } else {
+    memcpy(&text_size, buffer_ + text_argument_, sizeof(text_size));
+  }
+
+  const size_t appended_size = std::min(size, sizeof(buffer_) - size_);
+  truncated_ = truncated_ || appended_size < size;
+  memcpy(buffer_ + size_, value, appended_size);
+  size_ += appended_size;
+  text_size += static_cast<uint16_t>(appended_size);
+  memcpy(buffer_ + text_argument_, &text_size, sizeof(text_size));
+}
+
+}  // namespace logger
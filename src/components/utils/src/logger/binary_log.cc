@@ -0,0 +1,546 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/logger/binary_log.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+
+#include "utils/binary_log_format.h"
+
+namespace logger {
+
+namespace {
+/**
+ * @brief Size of file part mapped at once, multiple of page size
+ */
+const size_t kChunkSize = 1024 * 1024;
+
+std::atomic<uint32_t> next_instance_id(1);
+
+size_t RoundUpToPowerOfTwo(const size_t value) {
+  size_t result = 1;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+uint64_t CurrentThreadId() {
+  return static_cast<uint64_t>(threads::Thread::CurrentId());
+}
+
+struct DroppedRecordData {
+  binary_log::RecordHeader header;
+  binary_log::DroppedRecord dropped;
+};
+
+/**
+ * @brief Space kept at the end of the file for the record reporting
+ * messages dropped because the file reached its max size
+ */
+const size_t kReservedSize = sizeof(DroppedRecordData);
+}  // namespace
+
+/**
+ * @brief Ring buffer of encoded records with single producer, the owning
+ * thread, and single consumer, the thread draining buffers under file lock
+ */
+class BinaryLogThreadBuffer {
+ public:
+  explicit BinaryLogThreadBuffer(const size_t capacity)
+      : data_(RoundUpToPowerOfTwo(capacity))
+      , thread_id_(CurrentThreadId())
+      , head_(0)
+      , tail_(0)
+      , dropped_count_(0)
+      , reported_dropped_count_(0)
+      , abandoned_(false) {}
+
+  /**
+   * @brief Appends record consisting of two parts.
+   * @return false if buffer has no space for the record
+   */
+  bool Push(const void* header,
+            const size_t header_size,
+            const void* data,
+            const size_t size) {
+    const uint64_t head = head_.load(std::memory_order_relaxed);
+    const uint64_t tail = tail_.load(std::memory_order_acquire);
+    if (data_.size() - (head - tail) < header_size + size) {
+      dropped_count_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    CopyIn(head, header, header_size);
+    CopyIn(head + header_size, data, size);
+    head_.store(head + header_size + size, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Passes all complete records to write_record one by one
+   * @param write_record Called with record header and the record split
+   * into two parts by the end of the ring, second part may be empty
+   * @return Amount of messages dropped since previous call
+   */
+  template <typename RecordWriter>
+  uint64_t Drain(RecordWriter write_record) {
+    const uint64_t head = head_.load(std::memory_order_acquire);
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    const size_t mask = data_.size() - 1;
+    while (tail != head) {
+      binary_log::RecordHeader header;
+      CopyOut(tail, &header, sizeof(header));
+      const size_t begin = static_cast<size_t>(tail) & mask;
+      const size_t first_part =
+          std::min<size_t>(header.size, data_.size() - begin);
+      write_record(header,
+                   &data_[begin],
+                   first_part,
+                   &data_[0],
+                   header.size - first_part);
+      tail += header.size;
+    }
+    tail_.store(tail, std::memory_order_release);
+
+    const uint64_t dropped_count =
+        dropped_count_.load(std::memory_order_relaxed);
+    const uint64_t new_dropped_count = dropped_count - reported_dropped_count_;
+    reported_dropped_count_ = dropped_count;
+    return new_dropped_count;
+  }
+
+  /**
+   * @brief Marks buffer as not used by its thread anymore
+   */
+  void Abandon() {
+    abandoned_.store(true, std::memory_order_release);
+  }
+
+  bool abandoned() const {
+    return abandoned_.load(std::memory_order_acquire);
+  }
+
+  uint64_t thread_id() const {
+    return thread_id_;
+  }
+
+ private:
+  void CopyIn(const uint64_t position, const void* data, const size_t size) {
+    const size_t mask = data_.size() - 1;
+    const size_t begin = static_cast<size_t>(position) & mask;
+    const size_t first_part = std::min(size, data_.size() - begin);
+    memcpy(&data_[begin], data, first_part);
+    memcpy(&data_[0], static_cast<const char*>(data) + first_part,
+           size - first_part);
+  }
+
+  void CopyOut(const uint64_t position, void* data, const size_t size) const {
+    const size_t mask = data_.size() - 1;
+    const size_t begin = static_cast<size_t>(position) & mask;
+    const size_t first_part = std::min(size, data_.size() - begin);
+    memcpy(data, &data_[begin], first_part);
+    memcpy(static_cast<char*>(data) + first_part, &data_[0], size - first_part);
+  }
+
+  std::vector<char> data_;
+  const uint64_t thread_id_;
+  std::atomic<uint64_t> head_;
+  std::atomic<uint64_t> tail_;
+  std::atomic<uint64_t> dropped_count_;
+  uint64_t reported_dropped_count_;
+  std::atomic<bool> abandoned_;
+
+  DISALLOW_COPY_AND_ASSIGN(BinaryLogThreadBuffer);
+};
+
+namespace {
+/**
+ * @brief Buffer of the current thread, released on thread exit
+ */
+struct CurrentThreadBufferHolder {
+  CurrentThreadBufferHolder() : instance_id(0) {}
+
+  ~CurrentThreadBufferHolder() {
+    if (buffer) {
+      buffer->Abandon();
+    }
+  }
+
+  uint32_t instance_id;
+  std::shared_ptr<BinaryLogThreadBuffer> buffer;
+};
+
+thread_local CurrentThreadBufferHolder current_thread_buffer;
+}  // namespace
+
+BinaryLog::BinaryLog(const std::string& file_name,
+                     const size_t thread_buffer_size,
+                     const uint32_t flush_period_ms,
+                     const size_t max_file_size)
+    : file_name_(file_name)
+    , thread_buffer_size_(thread_buffer_size)
+    , flush_period_ms_(flush_period_ms)
+    , max_file_size_(max_file_size)
+    , instance_id_(next_instance_id.fetch_add(1))
+    , file_descriptor_(-1)
+    , mapped_chunk_(nullptr)
+    , file_size_(0)
+    , mapped_position_(0)
+    , written_size_(0)
+    , file_full_(false)
+    , file_full_dropped_count_(0)
+    , dropped_count_(0)
+    , stop_requested_(false)
+    , flusher_delegate_(nullptr)
+    , flusher_thread_(nullptr) {}
+
+BinaryLog::~BinaryLog() {
+  DeInit();
+}
+
+bool BinaryLog::Init() {
+  {
+    sync_primitives::AutoLock auto_lock(file_lock_);
+    if (-1 != file_descriptor_) {
+      return true;
+    }
+    file_descriptor_ =
+        open(file_name_.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (-1 == file_descriptor_) {
+      return false;
+    }
+    binary_log::FileHeader header;
+    memcpy(header.magic, binary_log::kFileMagic, sizeof(header.magic));
+    header.version = binary_log::kFormatVersion;
+    header.header_size = sizeof(header);
+    file_full_ = false;
+    file_full_dropped_count_ = 0;
+    WriteToFile(&header, sizeof(header));
+    if (!mapped_chunk_) {
+      CloseFile();
+      return false;
+    }
+  }
+
+  stop_requested_ = false;
+  flusher_delegate_ = new FlusherDelegate(*this);
+  flusher_thread_ = threads::CreateThread("BinaryLogger", flusher_delegate_);
+  flusher_thread_->Start();
+  return true;
+}
+
+void BinaryLog::DeInit() {
+  if (flusher_thread_) {
+    flusher_thread_->Stop(threads::Thread::kThreadStopDelegate);
+    delete flusher_delegate_;
+    flusher_delegate_ = nullptr;
+    threads::DeleteThread(flusher_thread_);
+    flusher_thread_ = nullptr;
+  }
+  Drain();
+
+  sync_primitives::AutoLock auto_lock(file_lock_);
+  CloseFile();
+}
+
+uint32_t BinaryLog::instance_id() const {
+  return instance_id_;
+}
+
+uint32_t BinaryLog::RegisterSite(const LogSite& site,
+                                 const std::string& component,
+                                 LogLevel log_level) {
+  sync_primitives::AutoLock auto_lock(sites_lock_);
+  const auto it = sites_.find(&site);
+  if (sites_.end() != it) {
+    return it->second;
+  }
+  const uint32_t site_id = static_cast<uint32_t>(sites_.size() + 1);
+  sites_[&site] = site_id;
+
+  binary_log::SiteRecord site_record;
+  site_record.site_id = site_id;
+  site_record.log_level = static_cast<uint32_t>(log_level);
+  site_record.line_number = static_cast<uint32_t>(site.line_number);
+  site_record.component_size =
+      static_cast<uint16_t>(std::min<size_t>(component.size(), UINT16_MAX));
+  site_record.file_name_size = static_cast<uint16_t>(
+      std::min<size_t>(strlen(site.file_name), UINT16_MAX));
+  site_record.function_name_size =
+      static_cast<uint32_t>(strlen(site.function_name));
+
+  binary_log::RecordHeader header;
+  header.size = sizeof(header) + sizeof(site_record) +
+                site_record.component_size + site_record.file_name_size +
+                site_record.function_name_size;
+  header.kind = binary_log::kSiteRecord;
+
+  sync_primitives::AutoLock file_lock(file_lock_);
+  if (!HasSpaceFor(header.size)) {
+    // Messages of the site are not written either
+    return site_id;
+  }
+  WriteToFile(&header, sizeof(header));
+  WriteToFile(&site_record, sizeof(site_record));
+  WriteToFile(component.data(), site_record.component_size);
+  WriteToFile(site.file_name, site_record.file_name_size);
+  WriteToFile(site.function_name, site_record.function_name_size);
+  return site_id;
+}
+
+void BinaryLog::Write(const uint32_t site_id,
+                      const char* arguments,
+                      const size_t size,
+                      const bool truncated) {
+  struct {
+    binary_log::RecordHeader header;
+    binary_log::MessageRecord message;
+  } record;
+  record.header.size = static_cast<uint32_t>(sizeof(record) + size);
+  record.header.kind = binary_log::kMessageRecord;
+  record.message.site_id = site_id;
+  record.message.flags = truncated ? binary_log::kTruncatedMessage : 0u;
+  BinaryLogThreadBuffer& buffer = CurrentThreadBuffer();
+  record.message.thread_id = buffer.thread_id();
+  record.message.timestamp =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::system_clock::now().time_since_epoch())
+          .count();
+
+  if (!buffer.Push(&record, sizeof(record), arguments, size)) {
+    dropped_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void BinaryLog::Flush() {
+  Drain();
+}
+
+uint64_t BinaryLog::dropped_count() const {
+  return dropped_count_.load(std::memory_order_relaxed);
+}
+
+BinaryLogThreadBuffer& BinaryLog::CurrentThreadBuffer() {
+  CurrentThreadBufferHolder& holder = current_thread_buffer;
+  if (holder.instance_id != instance_id_) {
+    ThreadBufferPtr buffer =
+        std::make_shared<BinaryLogThreadBuffer>(thread_buffer_size_);
+    {
+      sync_primitives::AutoLock auto_lock(buffers_lock_);
+      buffers_.push_back(buffer);
+    }
+    if (holder.buffer) {
+      holder.buffer->Abandon();
+    }
+    holder.buffer = buffer;
+    holder.instance_id = instance_id_;
+  }
+  return *holder.buffer;
+}
+
+void BinaryLog::Drain() {
+  std::vector<ThreadBufferPtr> buffers;
+  {
+    sync_primitives::AutoLock auto_lock(buffers_lock_);
+    buffers = buffers_;
+  }
+
+  std::vector<ThreadBufferPtr> abandoned_buffers;
+  {
+    sync_primitives::AutoLock auto_lock(file_lock_);
+    for (const ThreadBufferPtr& buffer : buffers) {
+      // Checked before draining, so abandoned buffer is drained completely
+      const bool abandoned = buffer->abandoned();
+      const uint64_t dropped_count =
+          buffer->Drain([this](const binary_log::RecordHeader& header,
+                               const char* first_part,
+                               const size_t first_part_size,
+                               const char* second_part,
+                               const size_t second_part_size) {
+            WriteRecord(header,
+                        first_part,
+                        first_part_size,
+                        second_part,
+                        second_part_size);
+          });
+      if (0 != dropped_count) {
+        WriteDroppedRecord(buffer->thread_id(), dropped_count);
+      }
+      if (abandoned) {
+        abandoned_buffers.push_back(buffer);
+      }
+    }
+  }
+
+  if (!abandoned_buffers.empty()) {
+    sync_primitives::AutoLock auto_lock(buffers_lock_);
+    for (const ThreadBufferPtr& buffer : abandoned_buffers) {
+      buffers_.erase(std::remove(buffers_.begin(), buffers_.end(), buffer),
+                     buffers_.end());
+    }
+  }
+}
+
+bool BinaryLog::HasSpaceFor(const size_t size) {
+  if (!file_full_ && written_size_ + size + kReservedSize > max_file_size_) {
+    file_full_ = true;
+  }
+  return !file_full_;
+}
+
+void BinaryLog::WriteRecord(const binary_log::RecordHeader& header,
+                            const char* first_part,
+                            const size_t first_part_size,
+                            const char* second_part,
+                            const size_t second_part_size) {
+  if (!HasSpaceFor(header.size)) {
+    if (binary_log::kMessageRecord == header.kind) {
+      ++file_full_dropped_count_;
+      dropped_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return;
+  }
+  WriteToFile(first_part, first_part_size);
+  WriteToFile(second_part, second_part_size);
+}
+
+void BinaryLog::WriteDroppedRecord(const uint64_t thread_id,
+                                   const uint64_t count) {
+  if (!HasSpaceFor(kReservedSize)) {
+    file_full_dropped_count_ += count;
+    return;
+  }
+  DroppedRecordData record;
+  record.header.size = sizeof(record);
+  record.header.kind = binary_log::kDroppedRecord;
+  record.dropped.thread_id = thread_id;
+  record.dropped.count = count;
+  WriteToFile(&record, sizeof(record));
+}
+
+void BinaryLog::WriteToFile(const void* data, const size_t size) {
+  const char* bytes = static_cast<const char*>(data);
+  size_t remaining_size = size;
+  while (remaining_size > 0 && -1 != file_descriptor_) {
+    if (!mapped_chunk_ || kChunkSize == mapped_position_) {
+      if (!MapNextChunk()) {
+        return;
+      }
+    }
+    const size_t part_size =
+        std::min(remaining_size, kChunkSize - mapped_position_);
+    memcpy(mapped_chunk_ + mapped_position_, bytes, part_size);
+    mapped_position_ += part_size;
+    written_size_ += part_size;
+    bytes += part_size;
+    remaining_size -= part_size;
+  }
+}
+
+bool BinaryLog::MapNextChunk() {
+  if (mapped_chunk_) {
+    munmap(mapped_chunk_, kChunkSize);
+    mapped_chunk_ = nullptr;
+  }
+  if (0 != ftruncate(file_descriptor_, file_size_ + kChunkSize)) {
+    return false;
+  }
+  void* chunk = mmap(nullptr,
+                     kChunkSize,
+                     PROT_READ | PROT_WRITE,
+                     MAP_SHARED,
+                     file_descriptor_,
+                     static_cast<off_t>(file_size_));
+  if (MAP_FAILED == chunk) {
+    return false;
+  }
+  // Unused tail of the file is zeroed, which reads as the end of records
+  mapped_chunk_ = static_cast<char*>(chunk);
+  file_size_ += kChunkSize;
+  mapped_position_ = 0;
+  return true;
+}
+
+void BinaryLog::CloseFile() {
+  if (-1 == file_descriptor_) {
+    return;
+  }
+  if (0 != file_full_dropped_count_) {
+    // Space for this record is reserved by HasSpaceFor
+    DroppedRecordData record;
+    record.header.size = sizeof(record);
+    record.header.kind = binary_log::kDroppedRecord;
+    record.dropped.thread_id = 0;
+    record.dropped.count = file_full_dropped_count_;
+    WriteToFile(&record, sizeof(record));
+    file_full_dropped_count_ = 0;
+  }
+  if (mapped_chunk_) {
+    munmap(mapped_chunk_, kChunkSize);
+    mapped_chunk_ = nullptr;
+  }
+  if (0 != ftruncate(file_descriptor_, written_size_)) {
+    // Zeroed tail is left in the file, it reads as the end of records
+  }
+  close(file_descriptor_);
+  file_descriptor_ = -1;
+}
+
+BinaryLog::FlusherDelegate::FlusherDelegate(BinaryLog& binary_log)
+    : binary_log_(binary_log) {}
+
+void BinaryLog::FlusherDelegate::threadMain() {
+  sync_primitives::AutoLock auto_lock(binary_log_.flusher_lock_);
+  while (!binary_log_.stop_requested_) {
+    {
+      sync_primitives::AutoUnlock auto_unlock(auto_lock);
+      binary_log_.Drain();
+    }
+    if (!binary_log_.stop_requested_) {
+      binary_log_.flusher_condition_.WaitFor(auto_lock,
+                                             binary_log_.flush_period_ms_);
+    }
+  }
+}
+
+void BinaryLog::FlusherDelegate::exitThreadMain() {
+  sync_primitives::AutoLock auto_lock(binary_log_.flusher_lock_);
+  binary_log_.stop_requested_ = true;
+  binary_log_.flusher_condition_.Broadcast();
+}
+
+}  // namespace logger
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/logger/binary_log_reader.h"
+
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#include "utils/binary_log_format.h"
+
+namespace logger {
+
+namespace {
+template <typename T>
+bool ReadValue(const char* data, const size_t size, size_t* offset, T* value) {
+  if (size - *offset < sizeof(T)) {
+    return false;
+  }
+  memcpy(value, data + *offset, sizeof(T));
+  *offset += sizeof(T);
+  return true;
+}
+
+bool ReadString(const char* data,
+                const size_t size,
+                const size_t string_size,
+                size_t* offset,
+                std::string* value) {
+  if (size - *offset < string_size) {
+    return false;
+  }
+  value->assign(data + *offset, string_size);
+  *offset += string_size;
+  return true;
+}
+
+bool MessageLess(const BinaryLogReader::Message& first,
+                 const BinaryLogReader::Message& second) {
+  return first.timestamp < second.timestamp;
+}
+}  // namespace
+
+BinaryLogReader::BinaryLogReader() : dropped_count_(0) {}
+
+bool BinaryLogReader::Read(const std::string& file_name) {
+  std::ifstream file(file_name.c_str(), std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  const std::vector<char> content((std::istreambuf_iterator<char>(file)),
+                                  std::istreambuf_iterator<char>());
+
+  binary_log::FileHeader header;
+  size_t offset = 0;
+  if (!ReadValue(content.data(), content.size(), &offset, &header) ||
+      0 != memcmp(header.magic, binary_log::kFileMagic, sizeof(header.magic)) ||
+      binary_log::kFormatVersion != header.version ||
+      header.header_size < sizeof(header) ||
+      header.header_size > content.size()) {
+    return false;
+  }
+
+  bool result = true;
+  offset = header.header_size;
+  while (content.size() - offset >= sizeof(binary_log::RecordHeader)) {
+    binary_log::RecordHeader record_header;
+    memcpy(&record_header, content.data() + offset, sizeof(record_header));
+    if (0 == record_header.size) {
+      // Zeroed tail of a file which was not closed
+      break;
+    }
+    if (record_header.size < sizeof(record_header) ||
+        record_header.size > content.size() - offset ||
+        !ReadRecord(content.data() + offset, record_header.size)) {
+      result = false;
+      break;
+    }
+    offset += record_header.size;
+  }
+
+  // Records are written per thread, so only order within thread is kept
+  std::stable_sort(messages_.begin(), messages_.end(), &MessageLess);
+  return result;
+}
+
+const std::vector<BinaryLogReader::Message>& BinaryLogReader::messages()
+    const {
+  return messages_;
+}
+
+const BinaryLogReader::Site* BinaryLogReader::site(
+    const uint32_t site_id) const {
+  const auto it = sites_.find(site_id);
+  return sites_.end() != it ? &it->second : nullptr;
+}
+
+uint64_t BinaryLogReader::dropped_count() const {
+  return dropped_count_;
+}
+
+bool BinaryLogReader::FormatArguments(const char* data,
+                                      const size_t size,
+                                      std::string* text) {
+  size_t offset = 0;
+  while (offset < size) {
+    const uint8_t type = static_cast<uint8_t>(data[offset++]);
+    switch (type) {
+      case binary_log::kSignedArgument: {
+        int64_t value;
+        if (!ReadValue(data, size, &offset, &value)) {
+          return false;
+        }
+        text->append(std::to_string(value));
+        break;
+      }
+      case binary_log::kUnsignedArgument: {
+        uint64_t value;
+        if (!ReadValue(data, size, &offset, &value)) {
+          return false;
+        }
+        text->append(std::to_string(value));
+        break;
+      }
+      case binary_log::kCharArgument: {
+        char value;
+        if (!ReadValue(data, size, &offset, &value)) {
+          return false;
+        }
+        text->push_back(value);
+        break;
+      }
+      case binary_log::kDoubleArgument: {
+        double value;
+        if (!ReadValue(data, size, &offset, &value)) {
+          return false;
+        }
+        std::ostringstream stream;
+        stream << value;
+        text->append(stream.str());
+        break;
+      }
+      case binary_log::kStringArgument: {
+        uint16_t string_size;
+        std::string value;
+        if (!ReadValue(data, size, &offset, &string_size) ||
+            !ReadString(data, size, string_size, &offset, &value)) {
+          return false;
+        }
+        text->append(value);
+        break;
+      }
+      case binary_log::kPointerArgument: {
+        uint64_t value;
+        if (!ReadValue(data, size, &offset, &value)) {
+          return false;
+        }
+        std::ostringstream stream;
+        stream << reinterpret_cast<const void*>(static_cast<uintptr_t>(value));
+        text->append(stream.str());
+        break;
+      }
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+bool BinaryLogReader::ReadRecord(const char* data, const size_t size) {
+  binary_log::RecordHeader header;
+  size_t offset = 0;
+  ReadValue(data, size, &offset, &header);
+
+  switch (header.kind) {
+    case binary_log::kSiteRecord: {
+      binary_log::SiteRecord record;
+      Site site;
+      if (!ReadValue(data, size, &offset, &record) ||
+          !ReadString(
+              data, size, record.component_size, &offset, &site.component) ||
+          !ReadString(
+              data, size, record.file_name_size, &offset, &site.file_name) ||
+          !ReadString(data,
+                      size,
+                      record.function_name_size,
+                      &offset,
+                      &site.function_name)) {
+        return false;
+      }
+      site.log_level = static_cast<LogLevel>(record.log_level);
+      site.line_number = static_cast<int>(record.line_number);
+      sites_[record.site_id] = site;
+      return true;
+    }
+    case binary_log::kMessageRecord: {
+      binary_log::MessageRecord record;
+      if (!ReadValue(data, size, &offset, &record)) {
+        return false;
+      }
+      Message message;
+      message.site_id = record.site_id;
+      message.thread_id = record.thread_id;
+      message.timestamp = record.timestamp;
+      message.truncated = 0 != (record.flags & binary_log::kTruncatedMessage);
+      if (!FormatArguments(data + offset, size - offset, &message.text)) {
+        return false;
+      }
+      messages_.push_back(message);
+      return true;
+    }
+    case binary_log::kDroppedRecord: {
+      binary_log::DroppedRecord record;
+      if (!ReadValue(data, size, &offset, &record)) {
+        return false;
+      }
+      dropped_count_ += record.count;
+      return true;
+    }
+    default:
+      // Records of newer writer versions are skipped
+      return true;
+  }
+}
+
+}  // namespace logger
@@ -37,13 +37,16 @@
 namespace logger {
 
 LoggerImpl::LoggerImpl(bool use_message_loop_thread)
-    : impl_(nullptr), use_message_loop_thread_(use_message_loop_thread) {}
+    : impl_(nullptr)
+    , binary_log_sink_(nullptr)
+    , use_message_loop_thread_(use_message_loop_thread) {}
 
 void LoggerImpl::Init(std::unique_ptr<ThirdPartyLoggerInterface>&& impl) {
   assert(impl_ == nullptr);
   impl_ = std::move(impl);
 
   impl_->Init();
+  ResetCachedLevels();
 
   if (use_message_loop_thread_) {
     auto deinit_logger = [](LogMessageLoopThread* logMsgThread) {
@@ -59,7 +62,22 @@ void LoggerImpl::Init(std::unique_ptr<ThirdPartyLoggerInterface>&& impl) {
   }
 }
 
+void LoggerImpl::InitBinaryLog(std::unique_ptr<BinaryLogSink>&& sink) {
+  assert(binary_log_sink_ == nullptr);
+  binary_log_sink_ = sink.get();
+  binary_log_sinks_.push_back(std::move(sink));
+  set_binary_log_sink(binary_log_sink_);
+}
+
 void LoggerImpl::DeInit() {
+  if (binary_log_sink_) {
+    set_binary_log_sink(nullptr);
+    // Log statements of other threads may still hold the sink, so it is
+    // only closed here and deleted with the logger
+    binary_log_sink_->DeInit();
+    binary_log_sink_ = nullptr;
+  }
+
   if (use_message_loop_thread_) {
     Flush();
     loop_thread_.reset();
@@ -68,9 +86,15 @@ void LoggerImpl::DeInit() {
   if (impl_) {
     impl_->DeInit();
   }
+  ResetCachedLevels();
 }
 
 void LoggerImpl::Flush() {
+  BinaryLogSink* sink = binary_log_sink();
+  if (sink) {
+    sink->Flush();
+  }
+
   if (use_message_loop_thread_) {
     if (loop_thread_) {
       loop_thread_->WaitDumpQueue();
@@ -39,8 +39,17 @@ namespace dbms {
 
 SDL_CREATE_LOG_VARIABLE("Utils")
 
+namespace {
+std::string SavepointName(const uint32_t depth) {
+  return "nested_transaction_" + std::to_string(depth);
+}
+}  // namespace
+
 SQLDatabase::SQLDatabase(const std::string& db_name)
-    : conn_(NULL), db_name_(db_name), error_(Error::OK) {}
+    : conn_(NULL)
+    , db_name_(db_name)
+    , error_(Error::OK)
+    , transaction_depth_(0) {}
 
 SQLDatabase::~SQLDatabase() {
   Close();
@@ -63,6 +72,7 @@ void SQLDatabase::Close() {
   if (conn_) {
     if (qdb_disconnect(conn_) != -1) {
       conn_ = NULL;
+      transaction_depth_ = 0;
     } else {
       error_ = Error::ERROR;
     }
@@ -70,15 +80,49 @@ void SQLDatabase::Close() {
 }
 
 bool SQLDatabase::BeginTransaction() {
-  return Exec("BEGIN TRANSACTION");
+  const std::string query =
+      0 == transaction_depth_
+          ? "BEGIN TRANSACTION"
+          : "SAVEPOINT " + SavepointName(transaction_depth_);
+  const bool result = Exec(query);
+  if (result) {
+    ++transaction_depth_;
+  }
+  return result;
 }
 
 bool SQLDatabase::CommitTransaction() {
-  return Exec("COMMIT TRANSACTION");
+  if (transaction_depth_ <= 1) {
+    transaction_depth_ = 0;
+    return Exec("COMMIT TRANSACTION");
+  }
+  const bool result =
+      Exec("RELEASE SAVEPOINT " + SavepointName(transaction_depth_ - 1));
+  if (result) {
+    --transaction_depth_;
+  }
+  return result;
 }
 
 bool SQLDatabase::RollbackTransaction() {
-  return Exec("ROLLBACK TRANSACTION");
+  if (transaction_depth_ <= 1) {
+    transaction_depth_ = 0;
+    return Exec("ROLLBACK TRANSACTION");
+  }
+  const std::string savepoint = SavepointName(transaction_depth_ - 1);
+  // Savepoint stays on the stack after rollback to it, so it is released too
+  const bool result =
+      Exec("ROLLBACK TRANSACTION TO SAVEPOINT " + savepoint) &&
+      Exec("RELEASE SAVEPOINT " + savepoint);
+  if (result) {
+    --transaction_depth_;
+  }
+  return result;
+}
+
+bool SQLDatabase::EnableWriteAheadLog(const uint32_t mmap_size) {
+  // Journal mode of QDB database is defined by the configuration of server
+  return true;
 }
 
 bool SQLDatabase::Exec(const std::string& query) {
@@ -38,12 +38,25 @@ namespace dbms {
 
 const std::string SQLDatabase::kInMemory = ":memory:";
 const std::string SQLDatabase::kExtension = ".sqlite";
+const size_t SQLDatabase::kMaxCachedStatements = 256;
+
+namespace {
+std::string SavepointName(const uint32_t depth) {
+  return "nested_transaction_" + std::to_string(depth);
+}
+}  // namespace
 
 SQLDatabase::SQLDatabase()
-    : conn_(NULL), databasename_(kInMemory), error_(SQLITE_OK) {}
+    : conn_(NULL)
+    , databasename_(kInMemory)
+    , error_(SQLITE_OK)
+    , transaction_depth_(0) {}
 
 SQLDatabase::SQLDatabase(const std::string& db_name)
-    : conn_(NULL), databasename_(db_name + kExtension), error_(SQLITE_OK) {}
+    : conn_(NULL)
+    , databasename_(db_name + kExtension)
+    , error_(SQLITE_OK)
+    , transaction_depth_(0) {}
 
 SQLDatabase::~SQLDatabase() {
   Close();
@@ -70,23 +83,132 @@ void SQLDatabase::Close() {
     return;
   }
 
+  ClearStatements();
   sync_primitives::AutoLock auto_lock(conn_lock_);
   error_ = sqlite3_close(conn_);
   if (error_ == SQLITE_OK) {
     conn_ = NULL;
+    transaction_depth_ = 0;
   }
 }
 
 bool SQLDatabase::BeginTransaction() {
-  return Exec("BEGIN TRANSACTION");
+  const std::string query =
+      0 == transaction_depth_
+          ? "BEGIN TRANSACTION"
+          : "SAVEPOINT " + SavepointName(transaction_depth_);
+  const bool result = Exec(query);
+  if (result) {
+    ++transaction_depth_;
+  }
+  return result;
 }
 
 bool SQLDatabase::CommitTransaction() {
-  return Exec("COMMIT TRANSACTION");
+  if (transaction_depth_ <= 1) {
+    const bool result = Exec("COMMIT TRANSACTION");
+    UpdateTransactionDepth();
+    return result;
+  }
+  const bool result =
+      Exec("RELEASE SAVEPOINT " + SavepointName(transaction_depth_ - 1));
+  if (result) {
+    --transaction_depth_;
+  }
+  UpdateTransactionDepth();
+  return result;
 }
 
 bool SQLDatabase::RollbackTransaction() {
-  return Exec("ROLLBACK TRANSACTION");
+  if (transaction_depth_ <= 1) {
+    const bool result = Exec("ROLLBACK TRANSACTION");
+    UpdateTransactionDepth();
+    return result;
+  }
+  const std::string savepoint = SavepointName(transaction_depth_ - 1);
+  // Savepoint stays on the stack after rollback to it, so it is released too
+  const bool result = Exec("ROLLBACK TRANSACTION TO SAVEPOINT " + savepoint +
+                           "; RELEASE SAVEPOINT " + savepoint);
+  if (result) {
+    --transaction_depth_;
+  }
+  UpdateTransactionDepth();
+  return result;
+}
+
+void SQLDatabase::UpdateTransactionDepth() {
+  // SQLite rolls back the whole transaction by itself on some errors
+  if (!conn_ || 0 != sqlite3_get_autocommit(conn_)) {
+    transaction_depth_ = 0;
+  }
+}
+
+bool SQLDatabase::EnableWriteAheadLog(const uint32_t mmap_size) {
+  if (kInMemory == databasename_) {
+    return true;
+  }
+  sqlite3_stmt* statement = NULL;
+  const std::string query = "PRAGMA journal_mode = WAL";
+  sync_primitives::AutoLock auto_lock(conn_lock_);
+  error_ = sqlite3_prepare_v2(
+      conn_, query.c_str(), query.length(), &statement, NULL);
+  if (SQLITE_OK != error_) {
+    return false;
+  }
+  // Pragma returns the journal mode in effect, which stays unchanged if
+  // WAL is not supported for the database
+  error_ = sqlite3_step(statement);
+  const unsigned char* mode =
+      SQLITE_ROW == error_ ? sqlite3_column_text(statement, 0) : NULL;
+  const bool is_wal =
+      mode && 0 == sqlite3_stricmp(reinterpret_cast<const char*>(mode), "wal");
+  sqlite3_finalize(statement);
+  if (!is_wal) {
+    return false;
+  }
+  const std::string mmap_query =
+      "PRAGMA mmap_size = " + std::to_string(mmap_size);
+  error_ = sqlite3_exec(conn_, mmap_query.c_str(), NULL, NULL, NULL);
+  return error_ == SQLITE_OK;
+}
+
+int SQLDatabase::AcquireStatement(const std::string& query,
+                                  sqlite3_stmt** statement) {
+  {
+    sync_primitives::AutoLock auto_lock(statements_lock_);
+    Statements::iterator it = statements_.find(query);
+    if (statements_.end() != it) {
+      *statement = it->second;
+      statements_.erase(it);
+      return SQLITE_OK;
+    }
+  }
+  // Unlike the legacy interface, statements prepared by v2 are recompiled
+  // automatically on schema changes, so they can be kept in the cache
+  return sqlite3_prepare_v2(
+      conn_, query.c_str(), query.length(), statement, NULL);
+}
+
+int SQLDatabase::ReleaseStatement(const std::string& query,
+                                  sqlite3_stmt* statement) {
+  const int result = sqlite3_reset(statement);
+  sqlite3_clear_bindings(statement);
+  sync_primitives::AutoLock auto_lock(statements_lock_);
+  if (statements_.size() < kMaxCachedStatements) {
+    statements_.insert(std::make_pair(query, statement));
+  } else {
+    sqlite3_finalize(statement);
+  }
+  return result;
+}
+
+void SQLDatabase::ClearStatements() {
+  sync_primitives::AutoLock auto_lock(statements_lock_);
+  for (Statements::iterator it = statements_.begin(); it != statements_.end();
+       ++it) {
+    sqlite3_finalize(it->second);
+  }
+  statements_.clear();
 }
 
 bool SQLDatabase::Exec(const std::string& query) {
@@ -50,9 +50,9 @@ bool SQLQuery::Prepare(const std::string& query) {
   sync_primitives::AutoLock auto_lock(statement_lock_);
   if (statement_)
     return false;
-  error_ = sqlite3_prepare(
-      db_.conn(), query.c_str(), query.length(), &statement_, NULL);
+  error_ = db_.AcquireStatement(query, &statement_);
   query_ = query;
+  statement_query_ = query;
   return error_ == SQLITE_OK;
 }
 
@@ -73,10 +73,13 @@ bool SQLQuery::Reset() {
 
 void SQLQuery::Finalize() {
   sync_primitives::AutoLock auto_lock(statement_lock_);
-  error_ = sqlite3_finalize(statement_);
-  if (error_ == SQLITE_OK) {
-    statement_ = NULL;
+  if (!statement_) {
+    error_ = SQLITE_OK;
+    return;
   }
+  // Statement is kept prepared by database for the next query of same text
+  error_ = db_.ReleaseStatement(statement_query_, statement_);
+  statement_ = NULL;
 }
 
 bool SQLQuery::Exec(const std::string& query) {
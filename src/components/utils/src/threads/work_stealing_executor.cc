@@ -0,0 +1,420 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/threads/work_stealing_executor.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <thread>
+
+#include "utils/logger.h"
+
+SDL_CREATE_LOG_VARIABLE("Utils")
+
+namespace {
+const uint64_t kNoDeadline = std::numeric_limits<uint64_t>::max();
+const uint64_t kMicrosecondsInMillisecond = 1000u;
+}  // namespace
+
+namespace threads {
+
+WorkStealingExecutor::Statistics::Statistics()
+    : queue_depth(0)
+    , delayed_count(0)
+    , executed_count(0)
+    , stolen_count(0)
+    , average_latency_us(0)
+    , max_latency_us(0) {}
+
+WorkStealingExecutor::Item::Item() : ready_time(0), removable(false) {}
+
+WorkStealingExecutor::Item::Item(const Task& task,
+                                 const uint64_t ready_time,
+                                 const bool removable)
+    : task(task), ready_time(ready_time), removable(removable) {}
+
+WorkStealingExecutor::DelayedItem::DelayedItem(const Key key,
+                                               const Task& task,
+                                               const uint64_t deadline,
+                                               const uint64_t sequence)
+    : key(key), task(task), deadline(deadline), sequence(sequence) {}
+
+bool WorkStealingExecutor::DelayedItem::operator<(
+    const DelayedItem& other) const {
+  // std heap functions keep the greatest item on top
+  if (deadline != other.deadline) {
+    return deadline > other.deadline;
+  }
+  return sequence > other.sequence;
+}
+
+WorkStealingExecutor::Strand::Strand(const Key key, const size_t home)
+    : key(key), home(home) {}
+
+size_t WorkStealingExecutor::DefaultWorkersCount() {
+  const size_t cores_count = std::thread::hardware_concurrency();
+  return cores_count > 0 ? cores_count : 1u;
+}
+
+WorkStealingExecutor::WorkStealingExecutor(const std::string& name,
+                                           const size_t workers_count)
+    : name_(name)
+    , start_time_(std::chrono::steady_clock::now())
+    , queue_depth_(0)
+    , scheduled_count_(0)
+    , delayed_sequence_(0)
+    , next_deadline_(kNoDeadline)
+    , sleepers_count_(0)
+    , stop_requested_(false)
+    , executed_count_(0)
+    , stolen_count_(0)
+    , total_latency_us_(0)
+    , max_latency_us_(0) {
+  const size_t queues_count =
+      workers_count > 0 ? workers_count : DefaultWorkersCount();
+  for (size_t i = 0; i < queues_count; ++i) {
+    queues_.push_back(new WorkerQueue());
+  }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+  SDL_LOG_AUTO_TRACE();
+  Stop();
+  // Tasks are destroyed outside of the locks
+  Clear();
+  std::vector<DelayedItem> delayed;
+  {
+    sync_primitives::AutoLock auto_lock(delayed_lock_);
+    delayed.swap(delayed_);
+  }
+  delayed.clear();
+  {
+    sync_primitives::AutoLock auto_lock(strands_lock_);
+    for (auto it = strands_.begin(); strands_.end() != it; ++it) {
+      delete it->second;
+    }
+    strands_.clear();
+  }
+  for (size_t i = 0; i < queues_.size(); ++i) {
+    delete queues_[i];
+  }
+}
+
+void WorkStealingExecutor::Start() {
+  SDL_LOG_AUTO_TRACE();
+  sync_primitives::AutoLock auto_lock(threads_lock_);
+  if (!worker_threads_.empty()) {
+    return;
+  }
+  stop_requested_ = false;
+  for (size_t i = 0; i < queues_.size(); ++i) {
+    WorkerDelegate* delegate = new WorkerDelegate(*this, i);
+    Thread* thread = CreateThread(name_.c_str(), delegate);
+    worker_delegates_.push_back(delegate);
+    worker_threads_.push_back(thread);
+    thread->Start();
+  }
+  SDL_LOG_DEBUG(name_ << " has been started with " << queues_.size()
+                      << " workers");
+}
+
+void WorkStealingExecutor::Stop() {
+  SDL_LOG_AUTO_TRACE();
+  sync_primitives::AutoLock auto_lock(threads_lock_);
+  if (worker_threads_.empty()) {
+    return;
+  }
+  for (size_t i = 0; i < worker_threads_.size(); ++i) {
+    worker_threads_[i]->Stop(Thread::kThreadStopDelegate);
+  }
+  for (size_t i = 0; i < worker_threads_.size(); ++i) {
+    delete worker_delegates_[i];
+    DeleteThread(worker_threads_[i]);
+  }
+  worker_threads_.clear();
+  worker_delegates_.clear();
+  SDL_LOG_DEBUG(name_ << " has been stopped");
+}
+
+bool WorkStealingExecutor::IsRunning() const {
+  sync_primitives::AutoLock auto_lock(threads_lock_);
+  return !worker_threads_.empty();
+}
+
+size_t WorkStealingExecutor::workers_count() const {
+  return queues_.size();
+}
+
+void WorkStealingExecutor::Post(const Key key, const Task& task) {
+  Enqueue(key, Item(task, Now(), true));
+}
+
+void WorkStealingExecutor::PostDelayed(const Key key,
+                                       const uint32_t delay_ms,
+                                       const Task& task) {
+  const uint64_t deadline = Now() + delay_ms * kMicrosecondsInMillisecond;
+  {
+    sync_primitives::AutoLock auto_lock(delayed_lock_);
+    delayed_.push_back(DelayedItem(key, task, deadline, ++delayed_sequence_));
+    std::push_heap(delayed_.begin(), delayed_.end());
+    if (deadline >= next_deadline_) {
+      return;
+    }
+    next_deadline_ = deadline;
+  }
+  // Sleeping workers have to recalculate their wait time
+  WakeWorker();
+}
+
+size_t WorkStealingExecutor::Remove(const Key key) {
+  return RemoveItems(false, key);
+}
+
+size_t WorkStealingExecutor::Clear() {
+  return RemoveItems(true, 0);
+}
+
+size_t WorkStealingExecutor::queue_depth() const {
+  sync_primitives::AutoLock auto_lock(strands_lock_);
+  return queue_depth_;
+}
+
+WorkStealingExecutor::Statistics WorkStealingExecutor::GetStatistics() const {
+  Statistics statistics;
+  statistics.queue_depth = queue_depth();
+  {
+    sync_primitives::AutoLock auto_lock(delayed_lock_);
+    statistics.delayed_count = delayed_.size();
+  }
+  statistics.executed_count = executed_count_;
+  statistics.stolen_count = stolen_count_;
+  statistics.average_latency_us =
+      statistics.executed_count > 0
+          ? total_latency_us_ / statistics.executed_count
+          : 0;
+  statistics.max_latency_us = max_latency_us_;
+  return statistics;
+}
+
+uint64_t WorkStealingExecutor::Now() const {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - start_time_)
+      .count();
+}
+
+void WorkStealingExecutor::Enqueue(const Key key, const Item& item) {
+  {
+    sync_primitives::AutoLock auto_lock(strands_lock_);
+    ++queue_depth_;
+    auto it = strands_.find(key);
+    if (strands_.end() != it) {
+      // Strand is already queued or running, it will pick the item up
+      it->second->items.push_back(item);
+      return;
+    }
+    Strand* strand = new Strand(key, key % queues_.size());
+    strand->items.push_back(item);
+    strands_.insert(std::make_pair(key, strand));
+    Schedule(strand);
+  }
+  WakeWorker();
+}
+
+size_t WorkStealingExecutor::RemoveItems(const bool all_keys, const Key key) {
+  std::deque<Item> removed;
+  {
+    sync_primitives::AutoLock auto_lock(strands_lock_);
+    for (auto it = strands_.begin(); strands_.end() != it; ++it) {
+      if (!all_keys && key != it->first) {
+        continue;
+      }
+      // Empty strand is dropped by the worker which picks it up
+      std::deque<Item>& items = it->second->items;
+      auto kept_end = std::stable_partition(
+          items.begin(), items.end(), [](const Item& item) {
+            return !item.removable;
+          });
+      std::move(kept_end, items.end(), std::back_inserter(removed));
+      items.erase(kept_end, items.end());
+    }
+    queue_depth_ -= removed.size();
+  }
+  SDL_LOG_DEBUG(name_ << ": " << removed.size() << " tasks removed");
+  return removed.size();
+}
+
+void WorkStealingExecutor::Schedule(Strand* strand) {
+  WorkerQueue& queue = *queues_[strand->home];
+  sync_primitives::AutoLock auto_lock(queue.lock);
+  queue.strands.push_back(strand);
+  ++scheduled_count_;
+}
+
+WorkStealingExecutor::Strand* WorkStealingExecutor::PopStrand(
+    const size_t index) {
+  const size_t queues_count = queues_.size();
+  for (size_t i = 0; i < queues_count; ++i) {
+    WorkerQueue& queue = *queues_[(index + i) % queues_count];
+    sync_primitives::AutoLock auto_lock(queue.lock);
+    if (queue.strands.empty()) {
+      continue;
+    }
+    Strand* strand = NULL;
+    if (0 == i) {
+      strand = queue.strands.front();
+      queue.strands.pop_front();
+    } else {
+      // Stealing from the back leaves the oldest work to the owner
+      strand = queue.strands.back();
+      queue.strands.pop_back();
+      ++stolen_count_;
+    }
+    --scheduled_count_;
+    return strand;
+  }
+  return NULL;
+}
+
+void WorkStealingExecutor::RunStrand(Strand* strand) {
+  Item item;
+  {
+    sync_primitives::AutoLock auto_lock(strands_lock_);
+    if (strand->items.empty()) {
+      strands_.erase(strand->key);
+      delete strand;
+      return;
+    }
+    item = std::move(strand->items.front());
+    strand->items.pop_front();
+    --queue_depth_;
+  }
+
+  const uint64_t latency = Now() - item.ready_time;
+  total_latency_us_ += latency;
+  uint64_t max_latency = max_latency_us_;
+  while (latency > max_latency &&
+         !max_latency_us_.compare_exchange_weak(max_latency, latency)) {
+  }
+
+  item.task();
+  // Captured objects are released before the strand may be run elsewhere
+  item.task = Task();
+  ++executed_count_;
+
+  {
+    sync_primitives::AutoLock auto_lock(strands_lock_);
+    if (strand->items.empty()) {
+      strands_.erase(strand->key);
+      delete strand;
+      return;
+    }
+    Schedule(strand);
+  }
+  WakeWorker();
+}
+
+void WorkStealingExecutor::PostDueTasks() {
+  const uint64_t now = Now();
+  if (next_deadline_ > now) {
+    return;
+  }
+  std::vector<DelayedItem> due;
+  {
+    sync_primitives::AutoLock auto_lock(delayed_lock_);
+    while (!delayed_.empty() && delayed_.front().deadline <= now) {
+      std::pop_heap(delayed_.begin(), delayed_.end());
+      due.push_back(std::move(delayed_.back()));
+      delayed_.pop_back();
+    }
+    next_deadline_ = delayed_.empty() ? kNoDeadline : delayed_.front().deadline;
+  }
+  for (auto it = due.begin(); due.end() != it; ++it) {
+    Enqueue(it->key, Item(it->task, now, false));
+  }
+}
+
+void WorkStealingExecutor::WaitForWork() {
+  sync_primitives::AutoLock auto_lock(sleep_lock_);
+  ++sleepers_count_;
+  if (!stop_requested_ && 0 == scheduled_count_) {
+    const uint64_t deadline = next_deadline_;
+    const uint64_t now = Now();
+    if (kNoDeadline == deadline) {
+      sleep_condition_.Wait(auto_lock);
+    } else if (deadline > now) {
+      const uint64_t timeout_ms =
+          (deadline - now + kMicrosecondsInMillisecond - 1) /
+          kMicrosecondsInMillisecond;
+      sleep_condition_.WaitFor(auto_lock, static_cast<uint32_t>(timeout_ms));
+    }
+  }
+  --sleepers_count_;
+}
+
+void WorkStealingExecutor::WakeWorker() {
+  // Sleeper registers itself before checking for work under sleep_lock_,
+  // so either it sees the new work or it is already waiting here
+  if (0 == sleepers_count_) {
+    return;
+  }
+  sync_primitives::AutoLock auto_lock(sleep_lock_);
+  sleep_condition_.NotifyOne();
+}
+
+void WorkStealingExecutor::WorkerMain(const size_t index) {
+  while (!stop_requested_) {
+    PostDueTasks();
+    Strand* strand = PopStrand(index);
+    if (strand) {
+      RunStrand(strand);
+      continue;
+    }
+    WaitForWork();
+  }
+}
+
+WorkStealingExecutor::WorkerDelegate::WorkerDelegate(
+    WorkStealingExecutor& executor, const size_t index)
+    : executor_(executor), index_(index) {}
+
+void WorkStealingExecutor::WorkerDelegate::threadMain() {
+  executor_.WorkerMain(index_);
+}
+
+void WorkStealingExecutor::WorkerDelegate::exitThreadMain() {
+  sync_primitives::AutoLock auto_lock(executor_.sleep_lock_);
+  executor_.stop_requested_ = true;
+  executor_.sleep_condition_.Broadcast();
+}
+
+}  // namespace threads
@@ -33,40 +33,48 @@
 
 #include <string>
 
-#include "utils/conditional_variable.h"
 #include "utils/lock.h"
 #include "utils/logger.h"
 #include "utils/macro.h"
-#include "utils/threads/thread.h"
-#include "utils/threads/thread_delegate.h"
 #include "utils/timer_task.h"
+#include "utils/timer_wheel.h"
 
 SDL_CREATE_LOG_VARIABLE("Utils")
 
 timer::Timer::Timer(const std::string& name, TimerTask* task)
+    : Timer(name, task, TimerWheel::instance()) {}
+
+timer::Timer::Timer(const std::string& name,
+                    TimerTask* task,
+                    TimerWheel& wheel)
     : name_(name)
     , task_(task)
     , state_lock_()
-    , delegate_(new TimerDelegate(this, state_lock_))
-    , thread_(threads::CreateThread(name_.c_str(), delegate_.get()))
+    , wheel_(wheel)
+    , entry_(this)
+    , timeout_(0)
+    , generation_(0)
+    , running_(false)
     , single_shot_(true)
-    , completed_flag_(false) {
+    , completed_flag_(false)
+    , destroyed_flag_(NULL) {
   SDL_LOG_AUTO_TRACE();
   DCHECK(!name_.empty());
   DCHECK(task_);
-  DCHECK(thread_);
   SDL_LOG_DEBUG("Timer " << name_ << " has been created");
 }
 
 timer::Timer::~Timer() {
   SDL_LOG_AUTO_TRACE();
-  sync_primitives::AutoLock auto_lock(state_lock_);
-  StopThread();
-  StopDelegate();
-  single_shot_ = true;
+  {
+    sync_primitives::AutoLock auto_lock(state_lock_);
+    StopState();
+  }
+  // Must not hold state lock here, running task may need it to finish
+  if (wheel_.Release(&entry_) && destroyed_flag_) {
+    *destroyed_flag_ = true;
+  }
 
-  delegate_.reset();
-  DeleteThread(thread_);
   DCHECK(task_);
   delete task_;
   SDL_LOG_DEBUG("Timer " << name_ << " has been destroyed");
@@ -76,7 +84,6 @@ void timer::Timer::Start(const Milliseconds timeout,
                          const TimerType timer_type) {
   SDL_LOG_AUTO_TRACE();
   sync_primitives::AutoLock auto_lock(state_lock_);
-  StopThread();
   completed_flag_ = false;
   switch (timer_type) {
     case kSingleShot: {
@@ -91,23 +98,28 @@ void timer::Timer::Start(const Milliseconds timeout,
       ASSERT("timer_type should be kSingleShot or kPeriodic");
     }
   };
-  StartDelegate(timeout);
-  StartThread();
+  ++generation_;
+  running_ = true;
+  timeout_ = timeout;
+  wheel_.Schedule(&entry_, timeout_, generation_);
   SDL_LOG_DEBUG("Timer " << name_ << " has been started");
 }
 
 void timer::Timer::Stop() {
   SDL_LOG_AUTO_TRACE();
-  sync_primitives::AutoLock auto_lock(state_lock_);
-  StopThread();
-  StopDelegate();
-  single_shot_ = true;
+  {
+    sync_primitives::AutoLock auto_lock(state_lock_);
+    StopState();
+    wheel_.Cancel(&entry_);
+  }
+  // Must not hold state lock here, running task may need it to finish
+  wheel_.Wait(&entry_);
   SDL_LOG_DEBUG("Timer " << name_ << " has been stopped");
 }
 
 bool timer::Timer::is_running() const {
   sync_primitives::AutoLock auto_lock(state_lock_);
-  return !delegate_->stop_flag();
+  return running_;
 }
 
 bool timer::Timer::is_completed() const {
@@ -116,112 +128,42 @@ bool timer::Timer::is_completed() const {
 
 timer::Milliseconds timer::Timer::timeout() const {
   sync_primitives::AutoLock auto_lock(state_lock_);
-  return delegate_->timeout();
-}
-
-void timer::Timer::StartDelegate(const Milliseconds timeout) {
-  delegate_->set_stop_flag(false);
-  delegate_->set_timeout(timeout);
-}
-
-void timer::Timer::StopDelegate() {
-  delegate_->set_stop_flag(true);
-  delegate_->set_timeout(0);
-}
-
-void timer::Timer::StartThread() {
-  if (delegate_->finalized_flag()) {
-    return;
-  }
-
-  DCHECK_OR_RETURN_VOID(thread_);
-  if (!thread_->IsCurrentThread()) {
-    thread_->Start();
-  }
+  return timeout_;
 }
 
-void timer::Timer::StopThread() {
-  if (delegate_->finalized_flag()) {
-    return;
-  }
-
-  DCHECK_OR_RETURN_VOID(thread_);
-  if (!thread_->IsCurrentThread()) {
-    delegate_->set_finalized_flag(true);
-    {
-      sync_primitives::AutoUnlock auto_unlock(state_lock_);
-      thread_->Stop(threads::Thread::kThreadStopDelegate);
-    }
-    delegate_->set_finalized_flag(false);
-  }
+void timer::Timer::StopState() {
+  ++generation_;
+  running_ = false;
+  timeout_ = 0;
+  single_shot_ = true;
 }
 
-void timer::Timer::OnTimeout() {
+void timer::Timer::OnExpired(const uint32_t generation) {
   {
     sync_primitives::AutoLock auto_lock(state_lock_);
+    if (!running_ || generation != generation_) {
+      SDL_LOG_DEBUG("Timer " << name_ << " expiration has been dropped");
+      return;
+    }
+    SDL_LOG_DEBUG("Timer has finished counting. Timeout (ms): " << timeout_);
     if (single_shot_) {
-      StopDelegate();
+      StopState();
     }
   }
 
   DCHECK_OR_RETURN_VOID(task_);
+  bool destroyed = false;
+  destroyed_flag_ = &destroyed;
   task_->run();
-  completed_flag_ = true;
-}
-
-timer::Timer::TimerDelegate::TimerDelegate(
-    Timer* timer, sync_primitives::Lock& state_lock_ref)
-    : timer_(timer)
-    , timeout_(0)
-    , stop_flag_(true)
-    , finalized_flag_(false)
-    , state_lock_ref_(state_lock_ref)
-    , state_condition_() {
-  DCHECK(timer_);
-}
-
-void timer::Timer::TimerDelegate::set_timeout(const Milliseconds timeout) {
-  timeout_ = timeout;
-}
-
-timer::Milliseconds timer::Timer::TimerDelegate::timeout() const {
-  return timeout_;
-}
-
-void timer::Timer::TimerDelegate::set_stop_flag(const bool stop_flag) {
-  stop_flag_ = stop_flag;
-}
-
-bool timer::Timer::TimerDelegate::stop_flag() const {
-  return stop_flag_;
-}
-
-void timer::Timer::TimerDelegate::set_finalized_flag(
-    const bool finalized_flag) {
-  finalized_flag_ = finalized_flag;
-}
-
-bool timer::Timer::TimerDelegate::finalized_flag() const {
-  return finalized_flag_;
-}
-
-void timer::Timer::TimerDelegate::threadMain() {
-  sync_primitives::AutoLock auto_lock(state_lock_ref_);
-  while (!stop_flag_ && !finalized_flag_) {
-    SDL_LOG_DEBUG("Milliseconds left to wait: " << timeout_);
-    if (sync_primitives::ConditionalVariable::kTimeout ==
-        state_condition_.WaitFor(auto_lock, timeout_)) {
-      SDL_LOG_DEBUG("Timer has finished counting. Timeout (ms): " << timeout_);
-      if (timer_) {
-        sync_primitives::AutoUnlock auto_unlock(auto_lock);
-        timer_->OnTimeout();
-      }
-    } else {
-      SDL_LOG_DEBUG("Timer has been force reset");
-    }
+  if (destroyed) {
+    return;
   }
-}
+  destroyed_flag_ = NULL;
 
-void timer::Timer::TimerDelegate::exitThreadMain() {
-  state_condition_.NotifyOne();
+  sync_primitives::AutoLock auto_lock(state_lock_);
+  completed_flag_ = true;
+  // Task may have restarted or stopped timer, then generation differs
+  if (running_ && generation == generation_) {
+    wheel_.Schedule(&entry_, timeout_, generation_);
+  }
 }
@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "utils/timer_wheel.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "utils/logger.h"
+
+SDL_CREATE_LOG_VARIABLE("Utils")
+
+namespace {
+/**
+ * @brief Amount of threads running expired callbacks of the shared wheel.
+ * Callbacks are expected to be short, the value only protects from a single
+ * slow callback delaying all other timers
+ */
+const size_t kDefaultWorkersCount = 4u;
+/**
+ * @brief Callbacks of the shared wheel running longer are reported, each
+ * of them holds a worker all other timers of the process are waiting for
+ */
+const timer::Milliseconds kDefaultCallbackBudgetMs = 100u;
+/**
+ * @brief Amount of threads running callbacks which may block
+ */
+const size_t kBlockingWorkersCount = 4u;
+const uint64_t kNoEvent = std::numeric_limits<uint64_t>::max();
+}  // namespace
+
+timer::TimerWheel::Entry::Entry(Handler* handler)
+    : handler_(handler)
+    , next_(NULL)
+    , pprev_(NULL)
+    , expires_(0)
+    , cookie_(0)
+    , level_(0)
+    , index_(0)
+    , state_(kIdle)
+    , firing_(false)
+    , firing_thread_()
+    , released_flag_(NULL) {
+  DCHECK(handler_);
+}
+
+timer::TimerWheel& timer::TimerWheel::instance() {
+  // Intentionally leaked: timers owned by static objects may be
+  // destroyed after any static wheel would have been
+  static TimerWheel* wheel =
+      new TimerWheel(kDefaultWorkersCount, kDefaultCallbackBudgetMs);
+  return *wheel;
+}
+
+timer::TimerWheel& timer::TimerWheel::blocking_instance() {
+  // Intentionally leaked, see instance()
+  static TimerWheel* wheel = new TimerWheel(kBlockingWorkersCount);
+  return *wheel;
+}
+
+timer::TimerWheel::TimerWheel(const size_t workers_count,
+                              const Milliseconds callback_budget)
+    : lock_()
+    , ready_head_(NULL)
+    , ready_tail_(&ready_head_)
+    , start_time_(std::chrono::steady_clock::now())
+    , now_tick_(0)
+    , next_wakeup_tick_(kNoEvent)
+    , pending_count_(0)
+    , callback_budget_(callback_budget)
+    , overrun_count_(0)
+    , stop_requested_(false)
+    , ticker_delegate_(new TickerDelegate(*this))
+    , ticker_thread_(threads::CreateThread("TimerWheel", ticker_delegate_)) {
+  SDL_LOG_AUTO_TRACE();
+  DCHECK(workers_count > 0);
+  for (size_t i = 0; i < kRootSize; ++i) {
+    root_[i] = NULL;
+  }
+  for (size_t level = 0; level < kLevelsCount - 1; ++level) {
+    for (size_t i = 0; i < kLevelSize; ++i) {
+      levels_[level][i] = NULL;
+    }
+  }
+  for (size_t i = 0; i < kBitmapWords; ++i) {
+    root_bitmap_[i] = 0;
+  }
+
+  ticker_thread_->Start();
+  for (size_t i = 0; i < workers_count; ++i) {
+    WorkerDelegate* delegate = new WorkerDelegate(*this);
+    threads::Thread* thread = threads::CreateThread("TimerWorker", delegate);
+    worker_delegates_.push_back(delegate);
+    worker_threads_.push_back(thread);
+    thread->Start();
+  }
+  SDL_LOG_DEBUG("Timer wheel has been created with " << workers_count
+                                                     << " workers");
+}
+
+timer::TimerWheel::~TimerWheel() {
+  SDL_LOG_AUTO_TRACE();
+  StopThreads();
+
+  delete ticker_delegate_;
+  threads::DeleteThread(ticker_thread_);
+  for (size_t i = 0; i < worker_threads_.size(); ++i) {
+    delete worker_delegates_[i];
+    threads::DeleteThread(worker_threads_[i]);
+  }
+}
+
+void timer::TimerWheel::Schedule(Entry* entry,
+                                 const Milliseconds timeout,
+                                 const uint32_t cookie) {
+  DCHECK_OR_RETURN_VOID(entry);
+  sync_primitives::AutoLock auto_lock(lock_);
+  Unlink(entry);
+  if (0 == pending_count_) {
+    // Ticker does not advance empty wheel while it sleeps, skip idle ticks
+    // here, otherwise it would run all of them under the lock on wakeup
+    now_tick_ = std::max(now_tick_, CurrentTick());
+  }
+  entry->cookie_ = cookie;
+  // One extra tick guarantees that at least timeout has passed
+  // since current tick may already be partially elapsed
+  entry->expires_ = CurrentTick() + timeout + 1;
+  Insert(entry);
+
+  if (entry->expires_ < next_wakeup_tick_) {
+    next_wakeup_tick_ = entry->expires_;
+    ticker_condition_.NotifyOne();
+  }
+}
+
+void timer::TimerWheel::Cancel(Entry* entry) {
+  DCHECK_OR_RETURN_VOID(entry);
+  sync_primitives::AutoLock auto_lock(lock_);
+  Unlink(entry);
+}
+
+void timer::TimerWheel::Wait(Entry* entry) {
+  DCHECK_OR_RETURN_VOID(entry);
+  sync_primitives::AutoLock auto_lock(lock_);
+  while (entry->firing_ && !IsFiringOnCurrentThread(entry)) {
+    idle_condition_.Wait(auto_lock);
+  }
+}
+
+bool timer::TimerWheel::Release(Entry* entry) {
+  DCHECK_OR_RETURN(entry, false);
+  sync_primitives::AutoLock auto_lock(lock_);
+  Unlink(entry);
+  if (entry->firing_ && IsFiringOnCurrentThread(entry)) {
+    *entry->released_flag_ = true;
+    return true;
+  }
+  while (entry->firing_) {
+    idle_condition_.Wait(auto_lock);
+  }
+  return false;
+}
+
+size_t timer::TimerWheel::pending_count() const {
+  sync_primitives::AutoLock auto_lock(lock_);
+  return pending_count_;
+}
+
+size_t timer::TimerWheel::overrun_count() const {
+  sync_primitives::AutoLock auto_lock(lock_);
+  return overrun_count_;
+}
+
+uint64_t timer::TimerWheel::CurrentTick() const {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now() - start_time_)
+      .count();
+}
+
+timer::TimerWheel::Slot* timer::TimerWheel::SlotAt(const size_t level,
+                                                   const size_t index) {
+  return 0 == level ? &root_[index] : &levels_[level - 1][index];
+}
+
+void timer::TimerWheel::Insert(Entry* entry) {
+  const uint64_t max_delta = (1ULL << (kRootBits + (kLevelsCount - 1) *
+                                                       kLevelBits)) -
+                             1;
+  const int64_t delta = static_cast<int64_t>(entry->expires_ - now_tick_);
+
+  size_t level = 0;
+  size_t index = 0;
+  if (delta < 0) {
+    // Already expired, fire on the very next tick
+    index = now_tick_ & kRootMask;
+  } else if (delta < kRootSize) {
+    index = entry->expires_ & kRootMask;
+  } else {
+    // Entries beyond the wheel range are parked in the farthest slot and
+    // cascaded down again once it is reached
+    const uint64_t expires = static_cast<uint64_t>(delta) > max_delta
+                                 ? now_tick_ + max_delta
+                                 : entry->expires_;
+    size_t shift = kRootBits;
+    level = 1;
+    while (level < kLevelsCount - 1 &&
+           static_cast<uint64_t>(delta) >= (1ULL << (shift + kLevelBits))) {
+      ++level;
+      shift += kLevelBits;
+    }
+    index = (expires >> shift) & kLevelMask;
+  }
+
+  Slot* slot = SlotAt(level, index);
+  entry->next_ = *slot;
+  if (entry->next_) {
+    entry->next_->pprev_ = &entry->next_;
+  }
+  *slot = entry;
+  entry->pprev_ = slot;
+  entry->level_ = static_cast<uint8_t>(level);
+  entry->index_ = static_cast<uint16_t>(index);
+  entry->state_ = Entry::kPending;
+  if (0 == level) {
+    root_bitmap_[index / 64] |= 1ULL << (index % 64);
+  }
+  ++pending_count_;
+}
+
+void timer::TimerWheel::Unlink(Entry* entry) {
+  switch (entry->state_) {
+    case Entry::kPending:
+    case Entry::kReady: {
+      *entry->pprev_ = entry->next_;
+      if (entry->next_) {
+        entry->next_->pprev_ = entry->pprev_;
+      } else if (Entry::kReady == entry->state_) {
+        ready_tail_ = entry->pprev_;
+      }
+      if (Entry::kPending == entry->state_) {
+        if (0 == entry->level_ && NULL == root_[entry->index_]) {
+          root_bitmap_[entry->index_ / 64] &= ~(1ULL << (entry->index_ % 64));
+        }
+        --pending_count_;
+      }
+      break;
+    }
+    case Entry::kIdle:
+    case Entry::kDeferred:
+    default:
+      break;
+  }
+  entry->next_ = NULL;
+  entry->pprev_ = NULL;
+  entry->state_ = Entry::kIdle;
+}
+
+void timer::TimerWheel::PushReady(Entry* entry) {
+  entry->next_ = NULL;
+  entry->pprev_ = ready_tail_;
+  *ready_tail_ = entry;
+  ready_tail_ = &entry->next_;
+  entry->state_ = Entry::kReady;
+}
+
+timer::TimerWheel::Entry* timer::TimerWheel::PopReady() {
+  Entry* entry = ready_head_;
+  if (entry) {
+    Unlink(entry);
+  }
+  return entry;
+}
+
+size_t timer::TimerWheel::Cascade(const size_t level) {
+  const size_t shift = kRootBits + (level - 1) * kLevelBits;
+  const size_t index = (now_tick_ >> shift) & kLevelMask;
+
+  Slot* slot = SlotAt(level, index);
+  Entry* entry = *slot;
+  *slot = NULL;
+  while (entry) {
+    Entry* next = entry->next_;
+    --pending_count_;
+    Insert(entry);
+    entry = next;
+  }
+  return index;
+}
+
+void timer::TimerWheel::RunTick() {
+  const size_t index = now_tick_ & kRootMask;
+  if (0 == index) {
+    for (size_t level = 1; level < kLevelsCount; ++level) {
+      if (0 != Cascade(level)) {
+        break;
+      }
+    }
+  }
+
+  Entry* entry = root_[index];
+  root_[index] = NULL;
+  root_bitmap_[index / 64] &= ~(1ULL << (index % 64));
+  while (entry) {
+    Entry* next = entry->next_;
+    --pending_count_;
+    if (entry->firing_) {
+      // Never run two callbacks of the same entry in parallel,
+      // worker will queue it as soon as current callback returns
+      entry->next_ = NULL;
+      entry->pprev_ = NULL;
+      entry->state_ = Entry::kDeferred;
+    } else {
+      PushReady(entry);
+    }
+    entry = next;
+  }
+  ++now_tick_;
+}
+
+uint64_t timer::TimerWheel::NextEventTick() const {
+  if (0 == pending_count_) {
+    return kNoEvent;
+  }
+
+  const size_t index = now_tick_ & kRootMask;
+  for (size_t word = index / 64; word < kBitmapWords; ++word) {
+    uint64_t bits = root_bitmap_[word];
+    if (index / 64 == word) {
+      bits &= ~0ULL << (index % 64);
+    }
+    if (bits) {
+      return now_tick_ - index + word * 64 + __builtin_ctzll(bits);
+    }
+  }
+  // Nothing in the root level till its end, wake up for next cascade
+  return (now_tick_ | kRootMask) + 1;
+}
+
+void timer::TimerWheel::TickerMain() {
+  sync_primitives::AutoLock auto_lock(lock_);
+  while (!stop_requested_) {
+    const uint64_t current_tick = CurrentTick();
+    while (now_tick_ <= current_tick) {
+      if (0 == pending_count_) {
+        now_tick_ = current_tick + 1;
+        break;
+      }
+      RunTick();
+    }
+
+    if (ready_head_) {
+      workers_condition_.Broadcast();
+    }
+
+    next_wakeup_tick_ = NextEventTick();
+    if (kNoEvent == next_wakeup_tick_) {
+      ticker_condition_.Wait(auto_lock);
+      continue;
+    }
+
+    const uint64_t now = CurrentTick();
+    if (next_wakeup_tick_ > now) {
+      ticker_condition_.WaitFor(
+          auto_lock, static_cast<uint32_t>(next_wakeup_tick_ - now));
+    }
+  }
+}
+
+void timer::TimerWheel::WorkerMain() {
+  sync_primitives::AutoLock auto_lock(lock_);
+  while (!stop_requested_) {
+    Entry* entry = PopReady();
+    if (!entry) {
+      workers_condition_.Wait(auto_lock);
+      continue;
+    }
+
+    bool released = false;
+    entry->firing_ = true;
+    entry->firing_thread_ = threads::Thread::CurrentId();
+    entry->released_flag_ = &released;
+    Handler* handler = entry->handler_;
+    const uint32_t cookie = entry->cookie_;
+    uint64_t duration = 0;
+    {
+      sync_primitives::AutoUnlock auto_unlock(auto_lock);
+      const uint64_t start_tick = CurrentTick();
+      handler->OnExpired(cookie);
+      duration = CurrentTick() - start_tick;
+    }
+
+    if (callback_budget_ > 0 && duration > callback_budget_) {
+      ++overrun_count_;
+      SDL_LOG_ERROR("Timer callback has been running for "
+                    << duration << " ms, longer than " << callback_budget_
+                    << " ms budget. Tasks which may block must use "
+                       "TimerWheel::blocking_instance()");
+    }
+
+    if (released) {
+      // Entry has been destroyed by its own callback
+      continue;
+    }
+    entry->firing_ = false;
+    entry->released_flag_ = NULL;
+    if (Entry::kDeferred == entry->state_) {
+      PushReady(entry);
+    }
+    idle_condition_.Broadcast();
+  }
+}
+
+void timer::TimerWheel::StopThreads() {
+  ticker_thread_->Stop(threads::Thread::kThreadStopDelegate);
+  for (size_t i = 0; i < worker_threads_.size(); ++i) {
+    worker_threads_[i]->Stop(threads::Thread::kThreadStopDelegate);
+  }
+}
+
+bool timer::TimerWheel::IsFiringOnCurrentThread(const Entry* entry) const {
+  return entry->firing_ &&
+         pthread_equal(entry->firing_thread_, threads::Thread::CurrentId());
+}
+
+timer::TimerWheel::TickerDelegate::TickerDelegate(TimerWheel& wheel)
+    : wheel_(wheel) {}
+
+void timer::TimerWheel::TickerDelegate::threadMain() {
+  wheel_.TickerMain();
+}
+
+void timer::TimerWheel::TickerDelegate::exitThreadMain() {
+  sync_primitives::AutoLock auto_lock(wheel_.lock_);
+  wheel_.stop_requested_ = true;
+  wheel_.ticker_condition_.NotifyOne();
+}
+
+timer::TimerWheel::WorkerDelegate::WorkerDelegate(TimerWheel& wheel)
+    : wheel_(wheel) {}
+
+void timer::TimerWheel::WorkerDelegate::threadMain() {
+  wheel_.WorkerMain();
+}
+
+void timer::TimerWheel::WorkerDelegate::exitThreadMain() {
+  sync_primitives::AutoLock auto_lock(wheel_.lock_);
+  wheel_.stop_requested_ = true;
+  wheel_.workers_condition_.Broadcast();
+}
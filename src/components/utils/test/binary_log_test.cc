@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/log_stream.h"
+#include "utils/logger/binary_log.h"
+#include "utils/logger/binary_log_reader.h"
+#include "utils/logger/logger_impl.h"
+
+namespace test {
+namespace components {
+namespace binary_log_test {
+
+namespace {
+const std::string kFileName = "binary_log_test.bin";
+const std::string kComponent = "BinaryLogTest";
+const uint32_t kLongFlushPeriodMs = 60000u;
+
+/**
+ * @brief Logger writing all messages to binary log sink
+ */
+class BinaryLogger : public logger::Logger {
+ public:
+  explicit BinaryLogger(logger::BinaryLogSink* sink) {
+    set_binary_log_sink(sink);
+  }
+
+  bool IsEnabledFor(const std::string&, logger::LogLevel) const OVERRIDE {
+    return true;
+  }
+  void DeInit() OVERRIDE {}
+  void Flush() OVERRIDE {}
+  void PushLog(const logger::LogMessage&) OVERRIDE {
+    FAIL() << "Text message in binary mode";
+  }
+};
+}  // namespace
+
+class BinaryLogTest : public ::testing::Test {
+ protected:
+  void TearDown() OVERRIDE {
+    remove(kFileName.c_str());
+  }
+};
+
+TEST_F(BinaryLogTest, Write_Arguments_DecodedAsStreamOutput) {
+  static logger::LogSite site(__FILE__, __PRETTY_FUNCTION__, __LINE__);
+  const std::string expected_text = [] {
+    std::ostringstream stream;
+    stream << "int " << -5 << " unsigned " << 7u << " char " << 'c'
+           << " double " << 2.5 << " bool " << true << " str "
+           << std::string("value") << " hex " << std::hex << 255;
+    return stream.str();
+  }();
+  {
+    logger::BinaryLog binary_log(kFileName);
+    ASSERT_TRUE(binary_log.Init());
+    BinaryLogger logger(&binary_log);
+    for (int i = 0; i < 2; ++i) {
+      logger::LogStream stream(
+          logger, site, kComponent, logger::LogLevel::DEBUG_LEVEL);
+      stream << "int " << -5 << " unsigned " << 7u << " char " << 'c'
+             << " double " << 2.5 << " bool " << true << " str "
+             << std::string("value") << " hex " << std::hex << 255;
+      stream.Push();
+    }
+    binary_log.DeInit();
+  }
+
+  logger::BinaryLogReader reader;
+  ASSERT_TRUE(reader.Read(kFileName));
+  ASSERT_EQ(2u, reader.messages().size());
+  for (const auto& message : reader.messages()) {
+    EXPECT_EQ(expected_text, message.text);
+    EXPECT_FALSE(message.truncated);
+    const logger::BinaryLogReader::Site* message_site =
+        reader.site(message.site_id);
+    ASSERT_TRUE(message_site);
+    EXPECT_EQ(kComponent, message_site->component);
+    EXPECT_EQ(logger::LogLevel::DEBUG_LEVEL, message_site->log_level);
+    EXPECT_EQ(site.line_number, message_site->line_number);
+    EXPECT_EQ(site.function_name, message_site->function_name);
+  }
+  EXPECT_EQ(0u, reader.dropped_count());
+}
+
+TEST_F(BinaryLogTest, Write_SeveralThreads_AllMessagesDecoded) {
+  static logger::LogSite site(__FILE__, __PRETTY_FUNCTION__, __LINE__);
+  const int kThreadsCount = 4;
+  const int kMessagesCount = 500;
+  logger::BinaryLog binary_log(kFileName, 64 * 1024, 1);
+  ASSERT_TRUE(binary_log.Init());
+  BinaryLogger logger(&binary_log);
+
+  std::vector<std::thread> threads;
+  for (int thread = 0; thread < kThreadsCount; ++thread) {
+    threads.push_back(std::thread([&logger, thread, kMessagesCount] {
+      for (int i = 0; i < kMessagesCount; ++i) {
+        logger::LogStream stream(
+            logger, site, kComponent, logger::LogLevel::INFO_LEVEL);
+        stream << "thread " << thread << " message " << i;
+        stream.Push();
+        if (0 == i % 100) {
+          std::this_thread::yield();
+        }
+      }
+    }));
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  binary_log.DeInit();
+
+  logger::BinaryLogReader reader;
+  ASSERT_TRUE(reader.Read(kFileName));
+  EXPECT_EQ(kThreadsCount * kMessagesCount - binary_log.dropped_count(),
+            reader.messages().size());
+  EXPECT_EQ(binary_log.dropped_count(), reader.dropped_count());
+
+  std::vector<int> next_message(kThreadsCount, 0);
+  for (const auto& message : reader.messages()) {
+    int thread = -1;
+    int index = -1;
+    ASSERT_EQ(2,
+              sscanf(message.text.c_str(),
+                     "thread %d message %d",
+                     &thread,
+                     &index));
+    ASSERT_LE(0, thread);
+    ASSERT_GT(kThreadsCount, thread);
+    // Messages of a thread keep their order
+    EXPECT_LE(next_message[thread], index);
+    next_message[thread] = index + 1;
+  }
+}
+
+TEST_F(BinaryLogTest, Write_BufferFull_MessagesDroppedAndCounted) {
+  static logger::LogSite site(__FILE__, __PRETTY_FUNCTION__, __LINE__);
+  const int kMessagesCount = 100;
+  logger::BinaryLog binary_log(kFileName, 256, kLongFlushPeriodMs);
+  BinaryLogger logger(&binary_log);
+
+  // Nothing drains buffer before Init
+  for (int i = 0; i < kMessagesCount; ++i) {
+    logger::LogStream stream(
+        logger, site, kComponent, logger::LogLevel::WARNING_LEVEL);
+    stream << "message " << i;
+    stream.Push();
+  }
+  EXPECT_LT(0u, binary_log.dropped_count());
+
+  ASSERT_TRUE(binary_log.Init());
+  binary_log.DeInit();
+
+  logger::BinaryLogReader reader;
+  ASSERT_TRUE(reader.Read(kFileName));
+  EXPECT_EQ(binary_log.dropped_count(), reader.dropped_count());
+  EXPECT_EQ(kMessagesCount - binary_log.dropped_count(),
+            reader.messages().size());
+  ASSERT_FALSE(reader.messages().empty());
+  EXPECT_EQ("message 0", reader.messages().front().text);
+}
+
+TEST_F(BinaryLogTest, Write_ArgumentsTooLong_MessageMarkedTruncated) {
+  static logger::LogSite site(__FILE__, __PRETTY_FUNCTION__, __LINE__);
+  const std::string long_value(2 * logger::binary_log::kMaxArgumentsSize, 'x');
+  {
+    logger::BinaryLog binary_log(kFileName, 64 * 1024, kLongFlushPeriodMs);
+    ASSERT_TRUE(binary_log.Init());
+    BinaryLogger logger(&binary_log);
+    logger::LogStream stream(
+        logger, site, kComponent, logger::LogLevel::DEBUG_LEVEL);
+    stream << "value " << long_value << " end " << 1;
+    stream.Push();
+    binary_log.DeInit();
+  }
+
+  logger::BinaryLogReader reader;
+  ASSERT_TRUE(reader.Read(kFileName));
+  ASSERT_EQ(1u, reader.messages().size());
+  const logger::BinaryLogReader::Message& message = reader.messages().front();
+  EXPECT_TRUE(message.truncated);
+  EXPECT_EQ(0u, message.text.find("value xxx"));
+  EXPECT_GT(long_value.size(), message.text.size());
+}
+
+TEST_F(BinaryLogTest, Write_FileReachesMaxSize_MessagesDroppedAndCounted) {
+  static logger::LogSite site(__FILE__, __PRETTY_FUNCTION__, __LINE__);
+  const size_t kMaxFileSize = 4096u;
+  const int kMessagesCount = 200;
+  logger::BinaryLog binary_log(
+      kFileName, 64 * 1024, kLongFlushPeriodMs, kMaxFileSize);
+  ASSERT_TRUE(binary_log.Init());
+  BinaryLogger logger(&binary_log);
+  for (int i = 0; i < kMessagesCount; ++i) {
+    logger::LogStream stream(
+        logger, site, kComponent, logger::LogLevel::INFO_LEVEL);
+    stream << "message " << i;
+    stream.Push();
+  }
+  binary_log.DeInit();
+
+  FILE* file = fopen(kFileName.c_str(), "rb");
+  ASSERT_TRUE(file);
+  fseek(file, 0, SEEK_END);
+  EXPECT_GE(static_cast<long>(kMaxFileSize), ftell(file));
+  fclose(file);
+
+  logger::BinaryLogReader reader;
+  ASSERT_TRUE(reader.Read(kFileName));
+  EXPECT_LT(0u, binary_log.dropped_count());
+  EXPECT_EQ(binary_log.dropped_count(), reader.dropped_count());
+  EXPECT_EQ(kMessagesCount - binary_log.dropped_count(),
+            reader.messages().size());
+  ASSERT_FALSE(reader.messages().empty());
+  EXPECT_EQ("message 0", reader.messages().front().text);
+}
+
+TEST_F(BinaryLogTest, DeInit_StreamHoldsSink_MessageIgnored) {
+  static logger::LogSite site(__FILE__, __PRETTY_FUNCTION__, __LINE__);
+  logger::LoggerImpl logger(false);
+  std::unique_ptr<logger::BinaryLog> binary_log(
+      new logger::BinaryLog(kFileName, 64 * 1024, kLongFlushPeriodMs));
+  ASSERT_TRUE(binary_log->Init());
+  logger.InitBinaryLog(std::move(binary_log));
+
+  logger::LogStream stream(
+      logger, site, kComponent, logger::LogLevel::INFO_LEVEL);
+  logger.DeInit();
+  EXPECT_FALSE(logger.binary_log_sink());
+
+  // Stream got the sink before DeInit, it is still valid but closed
+  stream << "message after DeInit";
+  stream.Push();
+
+  logger::BinaryLogReader reader;
+  ASSERT_TRUE(reader.Read(kFileName));
+  EXPECT_TRUE(reader.messages().empty());
+}
+
+}  // namespace binary_log_test
+}  // namespace components
+}  // namespace test
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "utils/bucket_prioritized_queue.h"
+#include "utils/message_queue.h"
+
+namespace test {
+namespace components {
+namespace utils_test {
+
+using ::utils::BucketPrioritizedQueue;
+
+namespace {
+
+struct TestMessage {
+  TestMessage() : priority(0) {}
+  TestMessage(const std::string& message, size_t msg_priority)
+      : msg(message), priority(msg_priority) {}
+
+  size_t PriorityOrder() const {
+    return priority;
+  }
+
+  std::string msg;
+  size_t priority;
+};
+
+struct SharedMessage : public std::shared_ptr<int> {
+  SharedMessage() {}
+  explicit SharedMessage(const std::shared_ptr<int>& value)
+      : std::shared_ptr<int>(value) {}
+
+  size_t PriorityOrder() const {
+    return 0;
+  }
+};
+
+}  // namespace
+
+class BucketPrioritizedQueueTest : public testing::Test {
+ protected:
+  BucketPrioritizedQueue<TestMessage> test_queue;
+};
+
+TEST_F(BucketPrioritizedQueueTest, DefaultCtor_ExpectEmptyQueue) {
+  EXPECT_TRUE(test_queue.empty());
+  EXPECT_EQ(0u, test_queue.size());
+}
+
+TEST_F(BucketPrioritizedQueueTest, Pop_ExpectHighestPriorityFirst) {
+  test_queue.push(TestMessage("from", 4));
+  test_queue.push(TestMessage("Luxoft", 14));
+  test_queue.push(TestMessage("Ford", 255));
+  test_queue.push(TestMessage("Hello", 64));
+  test_queue.push(TestMessage("World", 63));
+  EXPECT_EQ(5u, test_queue.size());
+
+  const char* expected[] = {"Ford", "Hello", "World", "Luxoft", "from"};
+  for (size_t i = 0; i < 5; ++i) {
+    ASSERT_FALSE(test_queue.empty());
+    EXPECT_EQ(expected[i], test_queue.front().msg);
+    test_queue.pop();
+  }
+  EXPECT_TRUE(test_queue.empty());
+}
+
+TEST_F(BucketPrioritizedQueueTest, Pop_EqualPriority_ExpectFifoOrder) {
+  // More messages than initial bucket capacity with wrapped ring buffer
+  for (size_t i = 0; i < 3; ++i) {
+    test_queue.push(TestMessage(std::to_string(i), 111));
+  }
+  test_queue.pop();
+  for (size_t i = 3; i < 20; ++i) {
+    test_queue.push(TestMessage(std::to_string(i), 111));
+  }
+
+  for (size_t i = 1; i < 20; ++i) {
+    EXPECT_EQ(std::to_string(i), test_queue.front().msg);
+    test_queue.pop();
+  }
+  EXPECT_TRUE(test_queue.empty());
+}
+
+TEST_F(BucketPrioritizedQueueTest, Swap_ExpectContentExchanged) {
+  test_queue.push(TestMessage("Hello", 1));
+  BucketPrioritizedQueue<TestMessage> other_queue;
+  other_queue.push(TestMessage("World", 2));
+  other_queue.push(TestMessage("!", 3));
+
+  test_queue.swap(other_queue);
+  EXPECT_EQ(2u, test_queue.size());
+  EXPECT_EQ("!", test_queue.front().msg);
+  EXPECT_EQ(1u, other_queue.size());
+  EXPECT_EQ("Hello", other_queue.front().msg);
+}
+
+TEST(BucketPrioritizedQueueReleaseTest, Pop_ExpectMessageReleased) {
+  BucketPrioritizedQueue<SharedMessage> queue;
+  std::shared_ptr<int> value = std::make_shared<int>(42);
+  queue.push(SharedMessage(value));
+  EXPECT_EQ(2, value.use_count());
+
+  queue.pop();
+  EXPECT_EQ(1, value.use_count());
+}
+
+TEST(BucketPrioritizedQueueReleaseTest, MessageQueue_ShutdownClearsQueue) {
+  utils::MessageQueue<TestMessage, BucketPrioritizedQueue<TestMessage> > queue;
+  queue.push(TestMessage("Hello", 1));
+  queue.push(TestMessage("World", 2));
+
+  TestMessage message;
+  ASSERT_TRUE(queue.pop(message));
+  EXPECT_EQ("World", message.msg);
+
+  queue.Shutdown();
+  EXPECT_TRUE(queue.empty());
+}
+
+}  // namespace utils_test
+}  // namespace components
+}  // namespace test
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "utils/ilogger.h"
+
+namespace test {
+namespace components {
+namespace call_site_level_test {
+
+using ::testing::_;
+using ::testing::Return;
+
+namespace {
+const std::string kComponent = "Test";
+}  // namespace
+
+class MockLogger : public logger::Logger {
+ public:
+  MOCK_CONST_METHOD2(IsEnabledFor,
+                     bool(const std::string& component,
+                          logger::LogLevel log_level));
+  MOCK_METHOD0(DeInit, void());
+  MOCK_METHOD0(Flush, void());
+  MOCK_METHOD1(PushLog, void(const logger::LogMessage& log_message));
+};
+
+TEST(CallSiteLevelTest, IsEnabled_RepeatedCheck_LoggerAskedOnce) {
+  MockLogger logger;
+  logger::CallSiteLevel call_site_level;
+
+  EXPECT_CALL(logger, IsEnabledFor(kComponent, logger::LogLevel::DEBUG_LEVEL))
+      .WillOnce(Return(false));
+
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_FALSE(call_site_level.IsEnabled(
+        logger, kComponent, logger::LogLevel::DEBUG_LEVEL));
+  }
+}
+
+TEST(CallSiteLevelTest, IsEnabled_LevelsReset_LoggerAskedAgain) {
+  MockLogger logger;
+  logger::CallSiteLevel call_site_level;
+
+  EXPECT_CALL(logger, IsEnabledFor(kComponent, _))
+      .WillOnce(Return(false))
+      .WillOnce(Return(true));
+
+  EXPECT_FALSE(call_site_level.IsEnabled(
+      logger, kComponent, logger::LogLevel::TRACE_LEVEL));
+
+  logger.ResetCachedLevels();
+  EXPECT_TRUE(call_site_level.IsEnabled(
+      logger, kComponent, logger::LogLevel::TRACE_LEVEL));
+  EXPECT_TRUE(call_site_level.IsEnabled(
+      logger, kComponent, logger::LogLevel::TRACE_LEVEL));
+}
+
+}  // namespace call_site_level_test
+}  // namespace components
+}  // namespace test
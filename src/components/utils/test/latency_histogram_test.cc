@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "gtest/gtest.h"
+#include "utils/latency_histogram.h"
+#include "utils/macro.h"
+
+namespace test {
+namespace components {
+namespace utils_test {
+
+using utils::LatencyHistogram;
+
+TEST(LatencyHistogramTest, BucketBoundsCoverValues) {
+  const uint64_t values[] = {0, 1, 15, 16, 17, 31, 32, 1000, 123456, 1u << 31};
+  for (size_t i = 0; i < ARRAYSIZE(values); ++i) {
+    const size_t index = LatencyHistogram::BucketIndex(values[i]);
+    ASSERT_LT(index, static_cast<size_t>(LatencyHistogram::kBucketsCount));
+    EXPECT_GE(LatencyHistogram::BucketUpperBound(index), values[i]);
+    if (index > 0) {
+      EXPECT_LT(LatencyHistogram::BucketUpperBound(index - 1), values[i]);
+    }
+  }
+}
+
+TEST(LatencyHistogramTest, BigValuesGoToLastBucket) {
+  EXPECT_EQ(static_cast<size_t>(LatencyHistogram::kBucketsCount - 1),
+            LatencyHistogram::BucketIndex(uint64_t(1) << 40));
+}
+
+TEST(LatencyHistogramTest, EmptySnapshot) {
+  LatencyHistogram histogram;
+  LatencyHistogram::Snapshot snapshot;
+  histogram.TakeSnapshot(snapshot);
+  EXPECT_EQ(0u, snapshot.count);
+  EXPECT_EQ(0u, snapshot.ValueAtPercentile(99.0));
+}
+
+TEST(LatencyHistogramTest, Percentiles) {
+  LatencyHistogram histogram;
+  for (uint64_t value = 1; value <= 1000; ++value) {
+    histogram.Record(value);
+  }
+  LatencyHistogram::Snapshot snapshot;
+  histogram.TakeSnapshot(snapshot);
+  EXPECT_EQ(1000u, snapshot.count);
+  EXPECT_EQ(500500u, snapshot.sum);
+  EXPECT_EQ(1000u, snapshot.max);
+
+  const uint64_t median = snapshot.ValueAtPercentile(50.0);
+  EXPECT_GE(median, 500u);
+  EXPECT_LE(median, 500u + 500u / LatencyHistogram::kSubBucketsCount);
+  EXPECT_EQ(1000u, snapshot.ValueAtPercentile(100.0));
+}
+
+TEST(LatencyHistogramTest, MinAndMean) {
+  LatencyHistogram histogram;
+  histogram.Record(30);
+  histogram.Record(10);
+  histogram.Record(20);
+  LatencyHistogram::Snapshot snapshot;
+  histogram.TakeSnapshot(snapshot);
+  EXPECT_EQ(10u, snapshot.min);
+  EXPECT_EQ(30u, snapshot.max);
+  EXPECT_DOUBLE_EQ(20.0, snapshot.Mean());
+}
+
+TEST(LatencyHistogramTest, Merge) {
+  LatencyHistogram first;
+  first.Record(5);
+  first.Record(100);
+  LatencyHistogram second;
+  second.Record(1);
+  second.Record(1000);
+  LatencyHistogram empty;
+
+  first.Merge(second);
+  first.Merge(empty);
+  LatencyHistogram::Snapshot snapshot;
+  first.TakeSnapshot(snapshot);
+  EXPECT_EQ(4u, snapshot.count);
+  EXPECT_EQ(1106u, snapshot.sum);
+  EXPECT_EQ(1u, snapshot.min);
+  EXPECT_EQ(1000u, snapshot.max);
+  EXPECT_EQ(1u, snapshot.ValueAtPercentile(25.0));
+  EXPECT_EQ(1000u, snapshot.ValueAtPercentile(100.0));
+}
+
+}  // namespace utils_test
+}  // namespace components
+}  // namespace test
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <pthread.h>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/message_queue.h"
+#include "utils/mpsc_queue.h"
+#include "utils/threads/message_loop_thread.h"
+
+namespace test {
+namespace components {
+namespace utils_test {
+
+using ::utils::MessageQueue;
+using ::utils::MpscQueue;
+
+namespace {
+
+typedef MessageQueue<int, MpscQueue<int> > IntMessageQueue;
+
+const int kProducersCount = 4;
+const int kMessagesPerProducer = 10000;
+
+struct ProducerContext {
+  IntMessageQueue* queue;
+  int producer_id;
+};
+
+void* Produce(void* context) {
+  ProducerContext* producer = static_cast<ProducerContext*>(context);
+  for (int i = 0; i < kMessagesPerProducer; ++i) {
+    producer->queue->push(producer->producer_id * kMessagesPerProducer + i);
+  }
+  return NULL;
+}
+
+typedef MpscQueue<int> IntQueue;
+
+class CountingHandler : public threads::MessageLoopThread<IntQueue>::Handler {
+ public:
+  CountingHandler() : handled_count_(0) {}
+
+  void Handle(const int message) OVERRIDE {
+    ++handled_count_;
+  }
+
+  int handled_count() const {
+    return handled_count_;
+  }
+
+ private:
+  int handled_count_;
+};
+
+}  // namespace
+
+TEST(MpscQueueTest, Push_PopInFifoOrder) {
+  MpscQueue<std::string> queue;
+  EXPECT_TRUE(queue.empty());
+
+  EXPECT_TRUE(queue.push("first"));
+  EXPECT_FALSE(queue.push("second"));
+  EXPECT_EQ(2u, queue.size());
+
+  std::string value;
+  ASSERT_TRUE(queue.pop(value));
+  EXPECT_EQ("first", value);
+
+  EXPECT_TRUE(queue.push("third"));
+  ASSERT_TRUE(queue.pop(value));
+  EXPECT_EQ("second", value);
+  ASSERT_TRUE(queue.pop(value));
+  EXPECT_EQ("third", value);
+
+  EXPECT_FALSE(queue.pop(value));
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpscQueueTest, Clear_ExpectEmptyQueue) {
+  MpscQueue<int> queue;
+  queue.push(1);
+  queue.push(2);
+  int value = 0;
+  ASSERT_TRUE(queue.pop(value));
+  queue.push(3);
+
+  queue.clear();
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(0u, queue.size());
+  EXPECT_FALSE(queue.pop(value));
+}
+
+TEST(MpscMessageQueueTest, ManyProducers_AllMessagesInPerProducerOrder) {
+  IntMessageQueue queue;
+  pthread_t producers[kProducersCount];
+  ProducerContext contexts[kProducersCount];
+  for (int i = 0; i < kProducersCount; ++i) {
+    contexts[i].queue = &queue;
+    contexts[i].producer_id = i;
+    pthread_create(&producers[i], NULL, &Produce, &contexts[i]);
+  }
+
+  std::vector<int> last_received(kProducersCount, -1);
+  int received_count = 0;
+  while (received_count < kProducersCount * kMessagesPerProducer) {
+    queue.wait();
+    int message = 0;
+    while (queue.pop(message)) {
+      const int producer_id = message / kMessagesPerProducer;
+      EXPECT_LT(last_received[producer_id], message);
+      last_received[producer_id] = message;
+      ++received_count;
+    }
+  }
+
+  for (int i = 0; i < kProducersCount; ++i) {
+    pthread_join(producers[i], NULL);
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpscMessageQueueTest, Shutdown_DropsPendingAndWakesConsumer) {
+  IntMessageQueue queue;
+  queue.push(1);
+  queue.push(2);
+
+  queue.Shutdown();
+  EXPECT_TRUE(queue.IsShuttingDown());
+  EXPECT_TRUE(queue.empty());
+  queue.wait();
+
+  queue.push(3);
+  EXPECT_TRUE(queue.empty());
+
+  queue.Reset();
+  queue.push(4);
+  EXPECT_EQ(1u, queue.size());
+}
+
+TEST(MpscMessageQueueTest, MessageLoopThread_HandlesAllPostedMessages) {
+  CountingHandler handler;
+  {
+    threads::MessageLoopThread<IntQueue> loop_thread("MpscTest", &handler);
+    for (int i = 0; i < kMessagesPerProducer; ++i) {
+      loop_thread.PostMessage(i);
+    }
+    loop_thread.WaitDumpQueue();
+  }
+  EXPECT_EQ(kMessagesPerProducer, handler.handled_count());
+}
+
+}  // namespace utils_test
+}  // namespace components
+}  // namespace test
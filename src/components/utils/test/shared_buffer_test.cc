@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/shared_buffer.h"
+#include "gtest/gtest.h"
+
+namespace test {
+namespace components {
+namespace utils_test {
+
+using ::utils::SharedBuffer;
+
+TEST(SharedBufferTest, DefaultConstructed_Empty) {
+  const SharedBuffer buffer;
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(0u, buffer.size());
+  EXPECT_EQ(NULL, buffer.data());
+}
+
+TEST(SharedBufferTest, Copy_BytesDuplicated) {
+  const uint8_t data[] = {1, 2, 3, 4};
+  const SharedBuffer buffer = SharedBuffer::Copy(data, sizeof(data));
+  ASSERT_EQ(sizeof(data), buffer.size());
+  EXPECT_NE(data, buffer.data());
+  EXPECT_EQ(0, memcmp(data, buffer.data(), sizeof(data)));
+  EXPECT_TRUE(SharedBuffer::Copy(NULL, 10).empty());
+}
+
+TEST(SharedBufferTest, Slice_SharesBlock) {
+  SharedBuffer buffer(8);
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    buffer.data()[i] = i;
+  }
+  const SharedBuffer slice = buffer.Slice(2, 4);
+  EXPECT_EQ(buffer.data() + 2, slice.data());
+  EXPECT_EQ(4u, slice.size());
+  EXPECT_EQ(2, buffer.use_count());
+
+  const SharedBuffer nested = slice.Slice(1, 2);
+  EXPECT_EQ(3u, nested.data()[0]);
+  EXPECT_EQ(2u, nested.size());
+}
+
+TEST(SharedBufferTest, Slice_OutOfRange_Clamped) {
+  const SharedBuffer buffer(8);
+  EXPECT_EQ(3u, buffer.Slice(5, 100).size());
+  EXPECT_TRUE(buffer.Slice(8, 1).empty());
+  EXPECT_EQ(1, buffer.use_count());
+}
+
+TEST(SharedBufferTest, SliceOutlivesBuffer_DataStaysValid) {
+  SharedBuffer slice;
+  {
+    const SharedBuffer buffer = SharedBuffer::Copy(
+        reinterpret_cast<const uint8_t*>("abcdef"), 6);
+    slice = buffer.Slice(3, 3);
+  }
+  EXPECT_EQ(1, slice.use_count());
+  EXPECT_EQ(0, memcmp("def", slice.data(), slice.size()));
+}
+
+}  // namespace utils_test
+}  // namespace components
+}  // namespace test
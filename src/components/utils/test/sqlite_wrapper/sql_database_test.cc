@@ -32,9 +32,11 @@
 #include "utils/sqlite_wrapper/sql_database.h"
 #include "gtest/gtest.h"
 #include "utils/sqlite_wrapper/sql_error.h"
+#include "utils/sqlite_wrapper/sql_query.h"
 
 using ::utils::dbms::SQLDatabase;
 using ::utils::dbms::SQLError;
+using ::utils::dbms::SQLQuery;
 
 namespace test {
 namespace components {
@@ -217,6 +219,49 @@ TEST(SQLDatabaseTest, IsReadWrite_FirstOpenDBIsRWSecondIsNot) {
   remove("test-database.sqlite");
 }
 
+TEST(SQLDatabaseTest,
+     NestedTransaction_RollbackNestedTransaction_OuterChangesAreKept) {
+  // arrange
+  SQLDatabase db;
+  ASSERT_TRUE(db.Open());
+  SQLQuery query(&db);
+  ASSERT_TRUE(query.Exec("CREATE TABLE test (value INTEGER)"));
+
+  // act
+  EXPECT_TRUE(db.BeginTransaction());
+  EXPECT_TRUE(query.Exec("INSERT INTO test VALUES (1)"));
+  EXPECT_TRUE(db.BeginTransaction());
+  EXPECT_TRUE(query.Exec("INSERT INTO test VALUES (2)"));
+  EXPECT_TRUE(db.RollbackTransaction());
+  EXPECT_TRUE(db.BeginTransaction());
+  EXPECT_TRUE(query.Exec("INSERT INTO test VALUES (3)"));
+  EXPECT_TRUE(db.CommitTransaction());
+  EXPECT_TRUE(db.CommitTransaction());
+
+  // assert
+  ASSERT_TRUE(query.Prepare("SELECT SUM(value) FROM test"));
+  ASSERT_TRUE(query.Next());
+  EXPECT_EQ(4, query.GetInteger(0));
+  EXPECT_FALSE(db.CommitTransaction());
+}
+
+TEST(SQLDatabaseTest, EnableWriteAheadLog_FileDatabase_ExpectActsWithoutError) {
+  // arrange
+  SQLDatabase db("test-database-wal");
+  ASSERT_TRUE(db.Open());
+
+  // act
+  EXPECT_TRUE(db.EnableWriteAheadLog(1024 * 1024));
+
+  // assert
+  EXPECT_FALSE(IsError(db.LastError()));
+
+  db.Close();
+  remove("test-database-wal.sqlite");
+  remove("test-database-wal.sqlite-wal");
+  remove("test-database-wal.sqlite-shm");
+}
+
 }  // namespace dbms_test
 }  // namespace utils_test
 }  // namespace components
@@ -376,6 +376,77 @@ TEST_F(SQLQueryTest, DoublePrepare_TwicePrepareQuery_ActWithoutErrors) {
   EXPECT_FALSE(IsError(query.LastError()));
 }
 
+TEST_F(SQLQueryTest, Prepare_CachedStatement_BindsAreCleared) {
+  // arrange
+  const std::string kInsert(
+      "INSERT INTO testTable (`integerValue`)"
+      " VALUES (?)");
+  const std::string kSelect("SELECT COUNT(*) FROM testTable"
+                            " WHERE integerValue IS NULL");
+  SQLDatabase db(kDatabaseName);
+  ASSERT_TRUE(db.Open());
+
+  // act
+  SQLQuery query(&db);
+  ASSERT_TRUE(query.Prepare(kInsert));
+  query.Bind(0, 1);
+  EXPECT_TRUE(query.Exec());
+  query.Finalize();
+  ASSERT_TRUE(query.Prepare(kInsert));
+  EXPECT_TRUE(query.Exec());
+
+  // assert
+  SQLQuery select(&db);
+  ASSERT_TRUE(select.Prepare(kSelect));
+  ASSERT_TRUE(select.Next());
+  EXPECT_EQ(1, select.GetInteger(0));
+}
+
+TEST_F(SQLQueryTest, Prepare_SameQueryTwice_BothStatementsAreUsable) {
+  // arrange
+  const std::string kInsert(
+      "INSERT INTO testTable (`integerValue`)"
+      " VALUES (?)");
+  const std::string kSelect("SELECT integerValue FROM testTable");
+  SQLDatabase db(kDatabaseName);
+  ASSERT_TRUE(db.Open());
+  SQLQuery insert(&db);
+  ASSERT_TRUE(insert.Prepare(kInsert));
+  insert.Bind(0, 1);
+  EXPECT_TRUE(insert.Exec());
+
+  // act
+  SQLQuery outer(&db);
+  SQLQuery inner(&db);
+  ASSERT_TRUE(outer.Prepare(kSelect));
+  ASSERT_TRUE(inner.Prepare(kSelect));
+
+  // assert
+  ASSERT_TRUE(outer.Next());
+  ASSERT_TRUE(inner.Next());
+  EXPECT_EQ(1, outer.GetInteger(0));
+  EXPECT_EQ(1, inner.GetInteger(0));
+}
+
+TEST_F(SQLQueryTest, Finalize_AfterExecOfAnotherQuery_StatementIsReused) {
+  // arrange
+  const std::string kSelect("SELECT integerValue FROM testTable");
+  SQLDatabase db(kDatabaseName);
+  ASSERT_TRUE(db.Open());
+
+  // act
+  SQLQuery query(&db);
+  ASSERT_TRUE(query.Prepare(kSelect));
+  EXPECT_TRUE(query.Exec("INSERT INTO testTable (`integerValue`) VALUES (5)"));
+  query.Finalize();
+
+  // assert
+  ASSERT_TRUE(query.Prepare(kSelect));
+  ASSERT_TRUE(query.Next());
+  EXPECT_EQ(5, query.GetInteger(0));
+  EXPECT_FALSE(query.Next());
+}
+
 }  // namespace dbms_test
 }  // namespace utils_test
 }  // namespace components
@@ -161,6 +161,24 @@ TEST(TimerTest, Start_Stop_NoLoop_OneCall) {
   EXPECT_EQ(1u, task->calls_count());
 }
 
+TEST(TimerTest, Start_Stop_OwnWheel_OneCall) {
+  timer::TimerWheel wheel(1u);
+  sync_primitives::AutoLock auto_lock(shot_lock);
+  TestTask* task = new TestTask();
+
+  timer::Timer timer(kTimerName, task, wheel);
+  timer.Start(kDefaultTimeoutMs, timer::kSingleShot);
+  EXPECT_TRUE(timer.is_running());
+  EXPECT_EQ(1u, wheel.pending_count());
+
+  // Wait for 1 call
+  shot_condition.Wait(shot_lock);
+  EXPECT_FALSE(timer.is_running());
+
+  timer.Stop();
+  EXPECT_EQ(1u, task->calls_count());
+}
+
 TEST(TimerTest, Start_Stop_Loop_3Calls) {
   const size_t loops_count = 3u;
 
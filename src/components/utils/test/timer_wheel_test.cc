@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <unistd.h>
+#include <vector>
+
+#include "utils/timer_wheel.h"
+#include "gtest/gtest.h"
+#include "utils/conditional_variable.h"
+#include "utils/lock.h"
+#include "utils/macro.h"
+
+namespace test {
+namespace components {
+namespace timer_wheel_test {
+namespace {
+
+const size_t kWorkersCount = 2u;
+const uint32_t kWaitTimeoutMs = 1000u;
+const timer::Milliseconds kCallbackBudgetMs = 10u;
+
+class CountingHandler : public timer::TimerWheel::Handler {
+ public:
+  CountingHandler() : calls_count_(0u), last_cookie_(0u) {}
+
+  void OnExpired(const uint32_t cookie) OVERRIDE {
+    sync_primitives::AutoLock auto_lock(lock_);
+    ++calls_count_;
+    last_cookie_ = cookie;
+    condition_.Broadcast();
+  }
+
+  bool WaitForCalls(const size_t calls_count) {
+    sync_primitives::AutoLock auto_lock(lock_);
+    while (calls_count_ < calls_count) {
+      if (sync_primitives::ConditionalVariable::kTimeout ==
+          condition_.WaitFor(auto_lock, kWaitTimeoutMs)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  size_t calls_count() const {
+    sync_primitives::AutoLock auto_lock(lock_);
+    return calls_count_;
+  }
+
+  uint32_t last_cookie() const {
+    sync_primitives::AutoLock auto_lock(lock_);
+    return last_cookie_;
+  }
+
+ private:
+  mutable sync_primitives::Lock lock_;
+  sync_primitives::ConditionalVariable condition_;
+  size_t calls_count_;
+  uint32_t last_cookie_;
+};
+
+class SleepingHandler : public CountingHandler {
+ public:
+  explicit SleepingHandler(const uint32_t sleep_ms) : sleep_ms_(sleep_ms) {}
+
+  void OnExpired(const uint32_t cookie) OVERRIDE {
+    usleep(sleep_ms_ * 1000);
+    CountingHandler::OnExpired(cookie);
+  }
+
+ private:
+  const uint32_t sleep_ms_;
+};
+
+}  // namespace
+
+TEST(TimerWheelTest, Schedule_EntryExpires_HandlerCalledWithCookie) {
+  timer::TimerWheel wheel(kWorkersCount);
+  CountingHandler handler;
+  timer::TimerWheel::Entry entry(&handler);
+
+  wheel.Schedule(&entry, 10u, 42u);
+  EXPECT_EQ(1u, wheel.pending_count());
+
+  EXPECT_TRUE(handler.WaitForCalls(1u));
+  EXPECT_EQ(42u, handler.last_cookie());
+  EXPECT_EQ(0u, wheel.pending_count());
+  EXPECT_FALSE(wheel.Release(&entry));
+}
+
+TEST(TimerWheelTest, Cancel_PendingEntry_HandlerNotCalled) {
+  timer::TimerWheel wheel(kWorkersCount);
+  CountingHandler handler;
+  timer::TimerWheel::Entry entry(&handler);
+
+  wheel.Schedule(&entry, 20u, 0u);
+  wheel.Cancel(&entry);
+  EXPECT_EQ(0u, wheel.pending_count());
+
+  EXPECT_FALSE(handler.WaitForCalls(1u));
+  EXPECT_EQ(0u, handler.calls_count());
+  EXPECT_FALSE(wheel.Release(&entry));
+}
+
+TEST(TimerWheelTest, Schedule_Rearm_OnlyLastArmingExpires) {
+  timer::TimerWheel wheel(kWorkersCount);
+  CountingHandler handler;
+  timer::TimerWheel::Entry entry(&handler);
+
+  wheel.Schedule(&entry, 500u, 1u);
+  wheel.Schedule(&entry, 10u, 2u);
+  EXPECT_EQ(1u, wheel.pending_count());
+
+  EXPECT_TRUE(handler.WaitForCalls(1u));
+  EXPECT_EQ(2u, handler.last_cookie());
+  EXPECT_EQ(0u, wheel.pending_count());
+  EXPECT_FALSE(wheel.Release(&entry));
+}
+
+TEST(TimerWheelTest, Schedule_BeyondRootLevel_EntryCascadedAndExpires) {
+  timer::TimerWheel wheel(kWorkersCount);
+  CountingHandler handler;
+  timer::TimerWheel::Entry entry(&handler);
+
+  // Longer than the root level so entry has to be cascaded
+  wheel.Schedule(&entry, 300u, 0u);
+
+  EXPECT_TRUE(handler.WaitForCalls(1u));
+  EXPECT_FALSE(wheel.Release(&entry));
+}
+
+TEST(TimerWheelTest, Schedule_ManyEntries_AllExpire) {
+  const size_t entries_count = 1000u;
+  timer::TimerWheel wheel(kWorkersCount);
+  CountingHandler handler;
+  std::vector<timer::TimerWheel::Entry*> entries;
+  for (size_t i = 0; i < entries_count; ++i) {
+    entries.push_back(new timer::TimerWheel::Entry(&handler));
+    wheel.Schedule(entries.back(), i % 50u, 0u);
+  }
+
+  EXPECT_TRUE(handler.WaitForCalls(entries_count));
+  EXPECT_EQ(0u, wheel.pending_count());
+
+  for (size_t i = 0; i < entries_count; ++i) {
+    EXPECT_FALSE(wheel.Release(entries[i]));
+    delete entries[i];
+  }
+}
+
+TEST(TimerWheelTest, Schedule_CallbackWithinBudget_NoOverrun) {
+  timer::TimerWheel wheel(kWorkersCount, kCallbackBudgetMs);
+  CountingHandler handler;
+  timer::TimerWheel::Entry entry(&handler);
+
+  wheel.Schedule(&entry, 10u, 0u);
+
+  EXPECT_TRUE(handler.WaitForCalls(1u));
+  EXPECT_FALSE(wheel.Release(&entry));
+  EXPECT_EQ(0u, wheel.overrun_count());
+}
+
+TEST(TimerWheelTest, Schedule_CallbackOverBudget_OverrunCounted) {
+  timer::TimerWheel wheel(kWorkersCount, kCallbackBudgetMs);
+  SleepingHandler handler(5 * kCallbackBudgetMs);
+  timer::TimerWheel::Entry entry(&handler);
+
+  wheel.Schedule(&entry, 10u, 0u);
+
+  EXPECT_TRUE(handler.WaitForCalls(1u));
+  // Waits for the callback to return so its duration is accounted
+  EXPECT_FALSE(wheel.Release(&entry));
+  EXPECT_EQ(1u, wheel.overrun_count());
+}
+
+TEST(TimerWheelTest, BlockingInstance_SeparateFromSharedWheel) {
+  timer::TimerWheel& blocking_wheel = timer::TimerWheel::blocking_instance();
+  EXPECT_NE(&timer::TimerWheel::instance(), &blocking_wheel);
+
+  // Blocking callback must not delay timers of the shared wheel
+  SleepingHandler blocking_handler(kWaitTimeoutMs / 2);
+  timer::TimerWheel::Entry blocking_entry(&blocking_handler);
+  blocking_wheel.Schedule(&blocking_entry, 0u, 0u);
+
+  CountingHandler handler;
+  timer::TimerWheel::Entry entry(&handler);
+  timer::TimerWheel::instance().Schedule(&entry, 10u, 0u);
+  EXPECT_TRUE(handler.WaitForCalls(1u));
+  EXPECT_EQ(0u, blocking_handler.calls_count());
+
+  EXPECT_FALSE(timer::TimerWheel::instance().Release(&entry));
+  EXPECT_FALSE(blocking_wheel.Release(&blocking_entry));
+  EXPECT_EQ(1u, blocking_handler.calls_count());
+}
+
+}  // namespace timer_wheel_test
+}  // namespace components
+}  // namespace test
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/conditional_variable.h"
+#include "utils/lock.h"
+#include "utils/threads/work_stealing_executor.h"
+
+namespace test {
+namespace components {
+namespace work_stealing_executor_test {
+namespace {
+
+const size_t kWorkersCount = 4u;
+const uint32_t kWaitTimeoutMs = 1000u;
+
+/**
+ * @brief Records order of executed tasks and lets tests wait for them
+ */
+class Journal {
+ public:
+  Journal() : running_count_(0), max_running_count_(0), open_(true) {}
+
+  void Record(const int value) {
+    sync_primitives::AutoLock auto_lock(lock_);
+    ++running_count_;
+    max_running_count_ = std::max(max_running_count_, running_count_);
+    condition_.Broadcast();
+    while (!open_) {
+      condition_.Wait(auto_lock);
+    }
+    values_.push_back(value);
+    --running_count_;
+    condition_.Broadcast();
+  }
+
+  void Close() {
+    sync_primitives::AutoLock auto_lock(lock_);
+    open_ = false;
+  }
+
+  void Open() {
+    sync_primitives::AutoLock auto_lock(lock_);
+    open_ = true;
+    condition_.Broadcast();
+  }
+
+  bool WaitForRunning(const size_t running_count) {
+    sync_primitives::AutoLock auto_lock(lock_);
+    while (running_count_ < running_count) {
+      if (sync_primitives::ConditionalVariable::kTimeout ==
+          condition_.WaitFor(auto_lock, kWaitTimeoutMs)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool WaitForValues(const size_t values_count) {
+    sync_primitives::AutoLock auto_lock(lock_);
+    while (values_.size() < values_count) {
+      if (sync_primitives::ConditionalVariable::kTimeout ==
+          condition_.WaitFor(auto_lock, kWaitTimeoutMs)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::vector<int> values() const {
+    sync_primitives::AutoLock auto_lock(lock_);
+    return values_;
+  }
+
+  size_t max_running_count() const {
+    sync_primitives::AutoLock auto_lock(lock_);
+    return max_running_count_;
+  }
+
+ private:
+  mutable sync_primitives::Lock lock_;
+  sync_primitives::ConditionalVariable condition_;
+  std::vector<int> values_;
+  size_t running_count_;
+  size_t max_running_count_;
+  bool open_;
+};
+
+}  // namespace
+
+TEST(WorkStealingExecutorTest, Post_SameKey_TasksRunOneByOneInOrder) {
+  threads::WorkStealingExecutor executor("Test", kWorkersCount);
+  Journal journal;
+  const int tasks_count = 100;
+  executor.Start();
+
+  for (int i = 0; i < tasks_count; ++i) {
+    executor.Post(1u, [&journal, i]() { journal.Record(i); });
+  }
+
+  ASSERT_TRUE(journal.WaitForValues(tasks_count));
+  const std::vector<int> values = journal.values();
+  for (int i = 0; i < tasks_count; ++i) {
+    EXPECT_EQ(i, values[i]);
+  }
+  EXPECT_EQ(1u, journal.max_running_count());
+  executor.Stop();
+}
+
+TEST(WorkStealingExecutorTest, Post_DifferentKeys_TasksRunInParallel) {
+  threads::WorkStealingExecutor executor("Test", kWorkersCount);
+  Journal journal;
+  journal.Close();
+  executor.Start();
+
+  executor.Post(1u, [&journal]() { journal.Record(1); });
+  executor.Post(2u, [&journal]() { journal.Record(2); });
+
+  EXPECT_TRUE(journal.WaitForRunning(2u));
+  journal.Open();
+  EXPECT_TRUE(journal.WaitForValues(2u));
+  executor.Stop();
+}
+
+TEST(WorkStealingExecutorTest, Post_KeysOfBusyWorker_StolenByIdleWorkers) {
+  threads::WorkStealingExecutor executor("Test", kWorkersCount);
+  Journal journal;
+  journal.Close();
+  executor.Start();
+
+  // All keys share the same home worker
+  executor.Post(0u, [&journal]() { journal.Record(0); });
+  executor.Post(kWorkersCount, [&journal]() { journal.Record(1); });
+  executor.Post(2 * kWorkersCount, [&journal]() { journal.Record(2); });
+
+  EXPECT_TRUE(journal.WaitForRunning(3u));
+  journal.Open();
+  EXPECT_TRUE(journal.WaitForValues(3u));
+  EXPECT_LT(0u, executor.GetStatistics().stolen_count);
+  executor.Stop();
+}
+
+TEST(WorkStealingExecutorTest, PostDelayed_TasksRunInDeadlineOrder) {
+  threads::WorkStealingExecutor executor("Test", kWorkersCount);
+  Journal journal;
+  executor.Start();
+
+  executor.PostDelayed(1u, 60u, [&journal]() { journal.Record(2); });
+  executor.PostDelayed(1u, 30u, [&journal]() { journal.Record(1); });
+  executor.Post(1u, [&journal]() { journal.Record(0); });
+
+  ASSERT_TRUE(journal.WaitForValues(3u));
+  const std::vector<int> values = journal.values();
+  EXPECT_EQ(0, values[0]);
+  EXPECT_EQ(1, values[1]);
+  EXPECT_EQ(2, values[2]);
+  EXPECT_EQ(0u, executor.GetStatistics().delayed_count);
+  executor.Stop();
+}
+
+TEST(WorkStealingExecutorTest, Remove_NotStartedTasks_OnlyKeyTasksDropped) {
+  threads::WorkStealingExecutor executor("Test", kWorkersCount);
+  Journal journal;
+
+  executor.Post(1u, [&journal]() { journal.Record(1); });
+  executor.Post(2u, [&journal]() { journal.Record(2); });
+  executor.Post(1u, [&journal]() { journal.Record(1); });
+  EXPECT_EQ(3u, executor.queue_depth());
+
+  EXPECT_EQ(2u, executor.Remove(1u));
+  EXPECT_EQ(1u, executor.queue_depth());
+
+  executor.Start();
+  ASSERT_TRUE(journal.WaitForValues(1u));
+  EXPECT_EQ(2, journal.values()[0]);
+  executor.Stop();
+}
+
+TEST(WorkStealingExecutorTest, Stop_PendingTasks_RunAfterRestart) {
+  threads::WorkStealingExecutor executor("Test", kWorkersCount);
+  Journal journal;
+  executor.Start();
+  executor.Stop();
+  EXPECT_FALSE(executor.IsRunning());
+
+  executor.Post(1u, [&journal]() { journal.Record(1); });
+  EXPECT_FALSE(journal.WaitForValues(1u));
+  EXPECT_EQ(1u, executor.queue_depth());
+
+  executor.Start();
+  EXPECT_TRUE(journal.WaitForValues(1u));
+  executor.Stop();
+
+  const threads::WorkStealingExecutor::Statistics statistics =
+      executor.GetStatistics();
+  EXPECT_EQ(1u, statistics.executed_count);
+  EXPECT_EQ(0u, statistics.queue_depth);
+  EXPECT_LE(statistics.average_latency_us, statistics.max_latency_us);
+}
+
+}  // namespace work_stealing_executor_test
+}  // namespace components
+}  // namespace test
@@ -160,6 +160,9 @@ class CodeGenerator(object):
                 class_name=class_name,
                 function_id_items=self._indent_code(function_id_items, 1),
                 message_type_items=self._indent_code(message_type_items, 1),
+                compiled_validators=self._gen_compiled_validators(
+                    interface.functions.values(),
+                    interface.structs.values()),
                 struct_schema_items=self._structs_add_code,
                 pre_function_schemas=self._gen_pre_function_schemas(
                     interface.functions.values()),
@@ -493,7 +496,8 @@ class CodeGenerator(object):
         message_type_case_list = [self._message_type_case_template.substitute(
                 message_type = message_type,
                 case_body = function_id_switch(self, message_type, functions)
-            ) for message_type in set([x.message_type.primary_name for x in functions])]
+            ) for message_type in collections.OrderedDict.fromkeys(
+                [x.message_type.primary_name for x in functions])]
         message_type_case_list.append("default:\n  break;\n")
         message_type_cases = self._indent_code(u"".join(message_type_case_list), 1)[:-1]
 
@@ -570,7 +574,11 @@ class CodeGenerator(object):
                     schema_items_decl=self._gen_schema_items_decls(
                         struct.members.values()),
                     schema_item_fill=self._gen_schema_items_fill(
-                        struct.members.values(), struct.since, struct.until, struct.deprecated, struct.removed)),
+                        struct.members.values(), struct.since, struct.until, struct.deprecated, struct.removed),
+                    compiled_validator_set=self._gen_compiled_validator_set(
+                        u"struct_schema",
+                        self._gen_struct_validator_name(struct),
+                        struct.members.values())),
                 1))
 
     
@@ -1025,7 +1033,7 @@ class CodeGenerator(object):
         if (member.since is not None):
             if member.history is not None:
                 return self._impl_function_member_fill_template_with_version_and_history_vector.substitute(
-                    schema=self._impl_function_schema,
+                    schema=self._impl_function_msg_params_schema,
                     since=member.since if member.since is not None else "", 
                     until=member.until if member.until is not None else "", 
                     deprecated=member.deprecated if member.deprecated is not None else u"false", 
@@ -1033,14 +1041,14 @@ class CodeGenerator(object):
                     vector_name=member.name)
             else:
                 return self._impl_function_member_fill_template_with_version.substitute(
-                    schema=self._impl_function_schema,
+                    schema=self._impl_function_msg_params_schema,
                     since=member.since if member.since is not None else "", 
                     until=member.until if member.until is not None else "", 
                     deprecated=member.deprecated if member.deprecated is not None else u"false", 
                     removed=member.removed if member.removed is not None else u"false")
         else:
             return self._impl_function_member_fill_template.substitute(
-                schema=self._impl_function_schema)
+                schema=self._impl_function_msg_params_schema)
 
     def _check_member_history(self, member):
         """
@@ -1271,10 +1279,160 @@ class CodeGenerator(object):
                         function.message_type.name),
                     function_history_fill=self._gen_function_history_decl(
                         function),
+                    compiled_validator_set=self._gen_compiled_validator_set(
+                        self._impl_function_msg_params_schema,
+                        self._gen_function_validator_name(function),
+                        function.params.values()),
                     function_member=self._gen_function_member(
                         function)),
                 1))
 
+    def _gen_compiled_validators(self, functions, structs):
+        """Generate compiled validators for source file.
+
+        Generates straight-line validator for every struct and for
+        msg_params of every function. Validator checks members in the
+        same order as generic CObjectSchemaItem validation does and skips
+        version history lookup for members which have no version info.
+
+        Keyword arguments:
+        functions -- list of functions to generate validators for.
+        structs -- list of structs to generate validators for.
+
+        Returns:
+        String with validators source code.
+
+        """
+
+        if functions is None:
+            raise GenerateError("Functions is None")
+
+        if structs is None:
+            raise GenerateError("Structs is None")
+
+        return u"\n".join(
+            [self._gen_compiled_validator(
+                self._gen_struct_validator_name(x),
+                x.members.values(),
+                x.since) for x in structs] +
+            [self._gen_compiled_validator(
+                self._gen_function_validator_name(x),
+                x.params.values(),
+                x.since) for x in functions])
+
+    def _gen_compiled_validator(self, validator_name, members, since):
+        """Generate compiled validator of single object schema.
+
+        Keyword arguments:
+        validator_name -- name of validator function.
+        members -- list of struct members/function parameters.
+        since -- version of parent struct/function.
+
+        Returns:
+        String with keys table and validator source code.
+
+        """
+
+        members = self._sort_compiled_members(members)
+        keys = u""
+        if members:
+            keys = self._compiled_keys_template.substitute(
+                keys_name=self._gen_compiled_keys_name(validator_name),
+                keys=u"".join([u'  "{0}",\n'.format(x.name)
+                               for x in members]))
+
+        return u"".join([keys, self._compiled_validator_template.substitute(
+            validator_name=validator_name,
+            members_validation=u"".join(
+                [self._compiled_member_validation_template.substitute(
+                    name=x.name,
+                    method=u"ValidatePlainMember" if since is None and
+                    x.since is None else u"ValidateVersionedMember",
+                    index=i) for i, x in enumerate(members)]))])
+
+    def _gen_compiled_validator_set(self, var_name, validator_name, members):
+        """Generate code that sets compiled validator to object schema.
+
+        Keyword arguments:
+        var_name -- name of object schema variable.
+        validator_name -- name of validator function.
+        members -- list of struct members/function parameters.
+
+        Returns:
+        String with validator setting source code.
+
+        """
+
+        members_count = len(members)
+        return self._compiled_validator_set_template.substitute(
+            var_name=var_name,
+            validator_name=validator_name,
+            keys_name=self._gen_compiled_keys_name(validator_name)
+            if members_count else u"nullptr",
+            keys_count=members_count)
+
+    @staticmethod
+    def _sort_compiled_members(members):
+        """Sort members in the order of generic validation.
+
+        CObjectSchemaItem keeps members in std::map, so they are
+        validated in the byte order of their names.
+
+        Keyword arguments:
+        members -- list of struct members/function parameters.
+
+        Returns:
+        Sorted list of members.
+
+        """
+
+        return sorted(members, key=lambda x: x.name.encode("utf-8"))
+
+    @staticmethod
+    def _gen_struct_validator_name(struct):
+        """Generate name of compiled validator for struct.
+
+        Keyword arguments:
+        struct -- struct to generate validator name for.
+
+        Returns:
+        String with validator name.
+
+        """
+
+        return u"".join([u"ValidateStruct_", struct.name])
+
+    @staticmethod
+    def _gen_function_validator_name(function):
+        """Generate name of compiled validator for function msg_params.
+
+        Keyword arguments:
+        function -- function to generate validator name for.
+
+        Returns:
+        String with validator name.
+
+        """
+
+        return u"".join([u"ValidateFunction_",
+                         function.function_id.primary_name,
+                         u"_",
+                         function.message_type.primary_name])
+
+    @staticmethod
+    def _gen_compiled_keys_name(validator_name):
+        """Generate name of keys table used by compiled validator.
+
+        Keyword arguments:
+        validator_name -- name of validator function.
+
+        Returns:
+        String with keys table name.
+
+        """
+
+        return u"".join([validator_name, u"_keys"])
+
     def _gen_enums(self, enums, structs):
         """Generate enums for header file.
 
@@ -1741,6 +1899,14 @@ class CodeGenerator(object):
         u'''\n'''
         u'''using namespace ns_smart_device_link::ns_smart_objects;\n'''
         u'''\n'''
+        u'''//----------------- Compiled schema validators ---------------\n'''
+        u'''\n'''
+        u'''namespace {\n'''
+        u'''\n'''
+        u'''$compiled_validators'''
+        u'''\n'''
+        u'''}  // namespace\n'''
+        u'''\n'''
         u'''$namespace::$class_name::TStructsSchemaItems $namespace::$class_name::struct_schema_items = {};\n\n'''
         u'''$namespace::$class_name::$class_name()\n'''
         u''' : ns_smart_device_link::ns_json_handler::CSmartFactory<FunctionID::eType, '''
@@ -1914,13 +2080,14 @@ class CodeGenerator(object):
     _struct_impl_code_tempate = string.Template(
         u'''Members '''
         u'''schema_members;\n'''
-        u'''std::shared_ptr<ISchemaItem> struct_schema = CObjectSchemaItem::create(schema_members);\n'''
+        u'''std::shared_ptr<CObjectSchemaItem> struct_schema = CObjectSchemaItem::create(schema_members);\n'''
         u'''struct_schema_items.insert(std::make_pair(StructIdentifiers::${struct_name}, CObjectSchemaItem::create(schema_members)));\n'''
         u'''struct_schema_items[StructIdentifiers::${struct_name}] = struct_schema;\n\n'''
         u'''${schema_loc_decl}'''
         u'''${schema_items_decl}'''
         u'''${schema_item_fill}'''
         u'''for(auto& member : schema_members) {struct_schema->AddMemberSchemaItem(member.first, member.second);}\n'''
+        u'''${compiled_validator_set}'''
         u'''return struct_schema;''')
 
     _impl_code_loc_decl_enum_template = string.Template(
@@ -1988,6 +2155,8 @@ class CodeGenerator(object):
     
     _impl_function_schema = u'''CObjectSchemaItem::create(schema_members)'''
 
+    _impl_function_msg_params_schema = u'''msg_params_schema'''
+
     _impl_function_member_fill_template = string.Template(
         u'''SMember(${schema}, true)''')
 
@@ -2016,6 +2185,10 @@ class CodeGenerator(object):
         u'''${schema_params_fill}'''
         u'''\n'''
         u'''${function_history_fill}'''
+        u'''std::shared_ptr<CObjectSchemaItem> msg_params_schema = '''
+        u'''CObjectSchemaItem::create(schema_members);\n'''
+        u'''${compiled_validator_set}'''
+        u'''\n'''
         u'''Members '''
         u'''root_members_map;\n'''
         u'''root_members_map[ns_smart_device_link::ns_json_handler::'''
@@ -2028,6 +2201,40 @@ class CodeGenerator(object):
         u'''return CSmartSchema(CObjectSchemaItem::'''
         u'''create(root_members_map));''')
 
+    _compiled_keys_template = string.Template(
+        u'''const char* const ${keys_name}[] = {\n'''
+        u'''${keys}'''
+        u'''};\n'''
+        u'''\n''')
+
+    _compiled_validator_template = string.Template(
+        u'''errors::eType ${validator_name}(\n'''
+        u'''    const SmartObject& object,\n'''
+        u'''    const CompiledMembers& members,\n'''
+        u'''    rpc::ValidationReport* report,\n'''
+        u'''    const utils::SemanticVersion& message_version,\n'''
+        u'''    const bool allow_unknown_enums) {\n'''
+        u'''  if (!CObjectSchemaItem::ValidateMapType(object, report)) {\n'''
+        u'''    return errors::INVALID_VALUE;\n'''
+        u'''  }\n'''
+        u'''  errors::eType result = errors::OK;\n'''
+        u'''${members_validation}'''
+        u'''  return result;\n'''
+        u'''}\n''')
+
+    _compiled_member_validation_template = string.Template(
+        u'''  // ${name}\n'''
+        u'''  result = CObjectSchemaItem::${method}(\n'''
+        u'''      object, members[${index}], report, message_version, '''
+        u'''allow_unknown_enums);\n'''
+        u'''  if (errors::OK != result) {\n'''
+        u'''    return result;\n'''
+        u'''  }\n''')
+
+    _compiled_validator_set_template = string.Template(
+        u'''${var_name}->SetCompiledValidator(&${validator_name}, '''
+        u'''${keys_name}, ${keys_count});\n''')
+
     _class_h_template = string.Template(
         u'''$comment\n'''
         u'''class $class_name : public ns_smart_device_link::ns_json_handler::'''
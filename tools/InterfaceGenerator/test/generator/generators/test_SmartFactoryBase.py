@@ -15,7 +15,9 @@ try:
     from generator.generators import SmartFactoryBase
     from model.enum import Enum
     from model.enum_element import EnumElement
+    from model.integer import Integer
     from model.issue import Issue
+    from model.param import Param
     from generator.generators import SmartFactoryBase
 except ModuleNotFoundError as error:
     print('{}.\nProbably you did not initialize submodule'.format(error))
@@ -140,6 +142,37 @@ enum eType {
 } // E2
 """
 
+EXPECTED_RESULT_COMPILED_VALIDATOR = u"""const char* const ValidateStruct_Item_keys[] = {
+  "count",
+  "value",
+};
+
+errors::eType ValidateStruct_Item(
+    const SmartObject& object,
+    const CompiledMembers& members,
+    rpc::ValidationReport* report,
+    const utils::SemanticVersion& message_version,
+    const bool allow_unknown_enums) {
+  if (!CObjectSchemaItem::ValidateMapType(object, report)) {
+    return errors::INVALID_VALUE;
+  }
+  errors::eType result = errors::OK;
+  // count
+  result = CObjectSchemaItem::ValidateVersionedMember(
+      object, members[0], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  // value
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[1], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  return result;
+}
+"""
+
 DESCRIPTION = [u"Description Line1", u"Description Line2"]
 
 DESIGN_DESCRIPTION = [u"Design Line1"]
@@ -268,6 +301,29 @@ class Test(unittest.TestCase):
                                             EXPECTED_RESULT_ENUM2),
                          "Generated enums are invalid")
 
+    def test_gen_compiled_validator(self):
+        """Test generation of the compiled schema validator.
+
+        Verifies that members are validated in schema map order and that
+        only members without version use plain validation.
+
+        """
+        generator = SmartFactoryBase.CodeGenerator()
+
+        members = [Param(name=u"value", param_type=Integer()),
+                   Param(name=u"count", param_type=Integer(),
+                         since=u"2.0.0")]
+        self.assertEqual(generator._gen_compiled_validator(
+            u"ValidateStruct_Item", members, None),
+            EXPECTED_RESULT_COMPILED_VALIDATOR,
+            "Compiled validator is invalid")
+
+        self.assertEqual(generator._gen_compiled_validator_set(
+            u"struct_schema", u"ValidateStruct_Item", members),
+            u"struct_schema->SetCompiledValidator(&ValidateStruct_Item, "
+            u"ValidateStruct_Item_keys, 2);\n",
+            "Compiled validator setting is invalid")
+
     def test_normalize_multiline_comments(self):
         """Test normalization of the multiline comments.
 
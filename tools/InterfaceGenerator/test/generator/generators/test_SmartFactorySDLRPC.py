@@ -120,12 +120,13 @@ class Test(unittest.TestCase):
 
         Creates output files which is captured by the mock and compare them
         with sample files with correct code. This test requires valid
-        test_expected_sdlrpc.h and test_expected_sdlrpc.cc in the same as
-        this module.
+        test_expected_sdlrpc.h, test_expected_sdlrpc_schema.h and
+        test_expected_sdlrpc.cc in the same directory as this module.
 
         """
         self.maxDiff = None
         expected_h_file_content = Path(__file__).parents[0].joinpath('test_expected_sdlrpc.h').read_text()
+        expected_schema_h_file_content = Path(__file__).parents[0].joinpath('test_expected_sdlrpc_schema.h').read_text()
         expected_cc_file_content = Path(__file__).parents[0].joinpath('test_expected_sdlrpc.cc').read_text()
 
         generator = SmartFactorySDLRPC.CodeGenerator()
@@ -331,17 +332,25 @@ class Test(unittest.TestCase):
                          call('/some/test/dir/Test_schema.h',
                               mode='w',
                               encoding='utf-8'),
+                         "Invalid schema header file creation")
+
+        self.assertEqual(mock_calls[8],
+                         call('/some/test/dir/Test_schema.cc',
+                              mode='w',
+                              encoding='utf-8'),
                          "Invalid source file creation")
-        try:
-            self.assertSequenceEqual(str(mock_calls[2])[27:-2].replace("\\n", "\n"),
-                                     expected_h_file_content,
-                                     "Invalid header file content")
-
-            self.assertSequenceEqual(str(mock_calls[6])[27:-2].replace("\\n", "\n"),
-                                     expected_cc_file_content,
-                                     "Invalid source file content")
-        except AssertionError as message:
-            print(message)
+
+        self.assertSequenceEqual(mock_calls[2].args[0],
+                                 expected_h_file_content,
+                                 "Invalid header file content")
+
+        self.assertSequenceEqual(mock_calls[6].args[0],
+                                 expected_schema_h_file_content,
+                                 "Invalid schema header file content")
+
+        self.assertSequenceEqual(mock_calls[10].args[0],
+                                 expected_cc_file_content,
+                                 "Invalid source file content")
 
 
 if __name__ == '__main__':
@@ -6,7 +6,7 @@
  * factory functionallity which allows client to use SmartSchemas
  * in accordance with definitions from Test.xml file
  */
-// Copyright (c) 2013, Ford Motor Company
+// Copyright (c) 2019, SmartDeviceLink Consortium, Inc.
 // All rights reserved.
 //
 // Redistribution and use in source and binary forms, with or without
@@ -20,13 +20,13 @@
 // disclaimer in the documentation and/or other materials provided with the
 // distribution.
 //
-// Neither the name of the Ford Motor Company nor the names of its contributors
-// may be used to endorse or promote products derived from this software
-// without specific prior written permission.
+// Neither the name of the SmartDeviceLink Consortium, Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
 //
 // THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
 // AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR 'A PARTICULAR PURPOSE
 // ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
 // LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
 // CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
@@ -39,23 +39,206 @@
 #include <map>
 #include <set>
 
-#include "Test.h"
-#include "SmartObjects/CAlwaysTrueSchemaItem.hpp"
-#include "SmartObjects/CAlwaysFalseSchemaItem.hpp"
-#include "SmartObjects/CArraySchemaItem.hpp"
-#include "SmartObjects/CBoolSchemaItem.hpp"
-#include "SmartObjects/CObjectSchemaItem.hpp"
-#include "SmartObjects/CStringSchemaItem.hpp"
-#include "SmartObjects/TEnumSchemaItem.hpp"
-#include "SmartObjects/TNumberSchemaItem.hpp"
-#include "SmartObjects/TSchemaItemParameter.hpp"
+#include "Test_schema.h"
+#include "smart_objects/always_true_schema_item.h"
+#include "smart_objects/always_false_schema_item.h"
+#include "smart_objects/array_schema_item.h"
+#include "smart_objects/bool_schema_item.h"
+#include "smart_objects/object_schema_item.h"
+#include "smart_objects/string_schema_item.h"
+#include "smart_objects/enum_schema_item.h"
+#include "smart_objects/number_schema_item.h"
+#include "smart_objects/schema_item_parameter.h"
 
 using namespace ns_smart_device_link::ns_smart_objects;
 
+//----------------- Compiled schema validators ---------------
+
+namespace {
+
+const char* const ValidateStruct_Struct1_keys[] = {
+  "arrayOfEnum1",
+  "arrayOfEnum3",
+  "arrayOfEnum4",
+  "arrayOfEnum5",
+  "arrayOfEnum6",
+  "arrayOfInt",
+  "boolParam",
+  "doubleParam",
+  "enumParam",
+  "enumParam1",
+  "enumSubset1",
+  "intParam",
+  "structParam",
+};
+
+errors::eType ValidateStruct_Struct1(
+    const SmartObject& object,
+    const CompiledMembers& members,
+    rpc::ValidationReport* report,
+    const utils::SemanticVersion& message_version,
+    const bool allow_unknown_enums) {
+  if (!CObjectSchemaItem::ValidateMapType(object, report)) {
+    return errors::INVALID_VALUE;
+  }
+  errors::eType result = errors::OK;
+  // arrayOfEnum1
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[0], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  // arrayOfEnum3
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[1], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  // arrayOfEnum4
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[2], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  // arrayOfEnum5
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[3], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  // arrayOfEnum6
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[4], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  // arrayOfInt
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[5], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  // boolParam
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[6], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  // doubleParam
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[7], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  // enumParam
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[8], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  // enumParam1
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[9], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  // enumSubset1
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[10], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  // intParam
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[11], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  // structParam
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[12], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  return result;
+}
+
+errors::eType ValidateStruct_Struct2(
+    const SmartObject& object,
+    const CompiledMembers& members,
+    rpc::ValidationReport* report,
+    const utils::SemanticVersion& message_version,
+    const bool allow_unknown_enums) {
+  if (!CObjectSchemaItem::ValidateMapType(object, report)) {
+    return errors::INVALID_VALUE;
+  }
+  errors::eType result = errors::OK;
+  return result;
+}
+
+const char* const ValidateFunction_name1_request_keys[] = {
+  "param1",
+  "param2",
+};
+
+errors::eType ValidateFunction_name1_request(
+    const SmartObject& object,
+    const CompiledMembers& members,
+    rpc::ValidationReport* report,
+    const utils::SemanticVersion& message_version,
+    const bool allow_unknown_enums) {
+  if (!CObjectSchemaItem::ValidateMapType(object, report)) {
+    return errors::INVALID_VALUE;
+  }
+  errors::eType result = errors::OK;
+  // param1
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[0], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  // param2
+  result = CObjectSchemaItem::ValidatePlainMember(
+      object, members[1], report, message_version, allow_unknown_enums);
+  if (errors::OK != result) {
+    return result;
+  }
+  return result;
+}
+
+errors::eType ValidateFunction_val_1_response(
+    const SmartObject& object,
+    const CompiledMembers& members,
+    rpc::ValidationReport* report,
+    const utils::SemanticVersion& message_version,
+    const bool allow_unknown_enums) {
+  if (!CObjectSchemaItem::ValidateMapType(object, report)) {
+    return errors::INVALID_VALUE;
+  }
+  errors::eType result = errors::OK;
+  return result;
+}
+
+errors::eType ValidateFunction_val_2_notification(
+    const SmartObject& object,
+    const CompiledMembers& members,
+    rpc::ValidationReport* report,
+    const utils::SemanticVersion& message_version,
+    const bool allow_unknown_enums) {
+  if (!CObjectSchemaItem::ValidateMapType(object, report)) {
+    return errors::INVALID_VALUE;
+  }
+  errors::eType result = errors::OK;
+  return result;
+}
+
+}  // namespace
+
+XXX::YYY::ZZZ::Test::TStructsSchemaItems XXX::YYY::ZZZ::Test::struct_schema_items = {};
+
 XXX::YYY::ZZZ::Test::Test()
- : CSmartFactory<FunctionID::eType, messageType::eType, StructIdentifiers::eType>() {
-  TStructsSchemaItems struct_schema_items;
-  InitStructSchemes(struct_schema_items);
+ : ns_smart_device_link::ns_json_handler::CSmartFactory<FunctionID::eType, messageType::eType, StructIdentifiers::eType>() {
+  InitStructSchemes();
 
   std::set<FunctionID::eType> function_id_items;
 
@@ -66,10 +249,10 @@ XXX::YYY::ZZZ::Test::Test()
   message_type_items.insert(messageType::notification);
   message_type_items.insert(messageType::error_response);
 
-  InitFunctionSchemes(struct_schema_items, function_id_items, message_type_items);
+  InitFunctionSchemes(function_id_items, message_type_items);
 }
 
-TSharedPtr<ISchemaItem> XXX::YYY::ZZZ::Test::ProvideObjectSchemaItemForStruct(
+std::shared_ptr<ISchemaItem> XXX::YYY::ZZZ::Test::ProvideObjectSchemaItemForStruct(
     const TStructsSchemaItems &struct_schema_items,
     const StructIdentifiers::eType struct_id) {
   const TStructsSchemaItems::const_iterator it = struct_schema_items.find(struct_id);
@@ -80,22 +263,46 @@ TSharedPtr<ISchemaItem> XXX::YYY::ZZZ::Test::ProvideObjectSchemaItemForStruct(
   return ns_smart_device_link::ns_smart_objects::CAlwaysFalseSchemaItem::create();
 }
 
-void XXX::YYY::ZZZ::Test::InitStructSchemes(
-    TStructsSchemaItems &struct_schema_items) {
-  TSharedPtr<ISchemaItem> struct_schema_item_Struct2 = InitStructSchemaItem_Struct2(struct_schema_items);
-  struct_schema_items.insert(std::make_pair(StructIdentifiers::Struct2, struct_schema_item_Struct2));
+bool XXX::YYY::ZZZ::Test::AddCustomMember(FunctionID::eType function_id,
+                                              messageType::eType message_type,
+                                              std::string member_key, ns_smart_device_link::ns_smart_objects::SMember member) {
+  using namespace ns_smart_device_link::ns_json_handler;
+  using namespace ns_smart_device_link::ns_smart_objects;
+  SmartSchemaKey<FunctionID::eType, messageType::eType> shema_key(function_id, message_type);
+  auto function_schema = functions_schemes_.find(shema_key);
+  if (functions_schemes_.end() == function_schema){
+    return false;
+  }
+
+  auto schema = function_schema->second.getSchemaItem();
+  auto msg_params_schema_item = schema->GetMemberSchemaItem(ns_smart_device_link::ns_json_handler::strings::S_MSG_PARAMS);
+  if (!msg_params_schema_item.is_initialized()){
+    return false;
+  }
+
+  msg_params_schema_item->mSchemaItem->AddMemberSchemaItem(member_key, member);
+  return true;
+}
+
+void XXX::YYY::ZZZ::Test::ResetFunctionSchema(FunctionID::eType function_id,
+                         messageType::eType message_type) {
+  InitFunctionSchema(function_id, message_type);
+}
+
+void XXX::YYY::ZZZ::Test::InitStructSchemes() {
+  std::shared_ptr<ISchemaItem> struct_schema_item_Struct2 = InitStructSchemaItem_Struct2();
   structs_schemes_.insert(std::make_pair(StructIdentifiers::Struct2, CSmartSchema(struct_schema_item_Struct2)));
 
-  TSharedPtr<ISchemaItem> struct_schema_item_Struct1 = InitStructSchemaItem_Struct1(struct_schema_items);
-  struct_schema_items.insert(std::make_pair(StructIdentifiers::Struct1, struct_schema_item_Struct1));
+
+  std::shared_ptr<ISchemaItem> struct_schema_item_Struct1 = InitStructSchemaItem_Struct1();
   structs_schemes_.insert(std::make_pair(StructIdentifiers::Struct1, CSmartSchema(struct_schema_item_Struct1)));
+
 }
 
 void XXX::YYY::ZZZ::Test::InitFunctionSchemes(
-    const TStructsSchemaItems &struct_schema_items,
     const std::set<FunctionID::eType> &function_id_items,
     const std::set<messageType::eType> &message_type_items) {
-  std::map<std::string, SMember> params_members;
+  Members params_members;
   params_members[ns_smart_device_link::ns_json_handler::strings::S_FUNCTION_ID] = SMember(TEnumSchemaItem<FunctionID::eType>::create(function_id_items), true);
   params_members[ns_smart_device_link::ns_json_handler::strings::S_MESSAGE_TYPE] = SMember(TEnumSchemaItem<messageType::eType>::create(message_type_items), true);
   params_members[ns_smart_device_link::ns_json_handler::strings::S_PROTOCOL_VERSION] = SMember(TNumberSchemaItem<int>::create(), true);
@@ -104,22 +311,71 @@ void XXX::YYY::ZZZ::Test::InitFunctionSchemes(
   params_members[ns_smart_device_link::ns_json_handler::strings::kCode] = SMember(TNumberSchemaItem<int>::create(), true);
   params_members[ns_smart_device_link::ns_json_handler::strings::kMessage] = SMember(CStringSchemaItem::create(), true);
 
-  std::map<std::string, SMember> root_members_map;
+  Members root_members_map;
   root_members_map[ns_smart_device_link::ns_json_handler::strings::S_PARAMS] = SMember(CObjectSchemaItem::create(params_members), true);
 
   CSmartSchema error_response_schema(CObjectSchemaItem::create(root_members_map));
 
   functions_schemes_.insert(std::make_pair(ns_smart_device_link::ns_json_handler::SmartSchemaKey<FunctionID::eType, messageType::eType>(FunctionID::val_1, messageType::error_response), error_response_schema));
 
-  functions_schemes_.insert(std::make_pair(ns_smart_device_link::ns_json_handler::SmartSchemaKey<FunctionID::eType, messageType::eType>(FunctionID::name1, messageType::request), InitFunction_name1_request(struct_schema_items, function_id_items, message_type_items)));
-  functions_schemes_.insert(std::make_pair(ns_smart_device_link::ns_json_handler::SmartSchemaKey<FunctionID::eType, messageType::eType>(FunctionID::val_1, messageType::response), InitFunction_val_1_response(struct_schema_items, function_id_items, message_type_items)));
-  functions_schemes_.insert(std::make_pair(ns_smart_device_link::ns_json_handler::SmartSchemaKey<FunctionID::eType, messageType::eType>(FunctionID::val_2, messageType::notification), InitFunction_val_2_notification(struct_schema_items, function_id_items, message_type_items)));
+  functions_schemes_.insert(std::make_pair(ns_smart_device_link::ns_json_handler::SmartSchemaKey<FunctionID::eType, messageType::eType>(FunctionID::name1, messageType::request), InitFunction_name1_request(function_id_items, message_type_items)));
+  functions_schemes_.insert(std::make_pair(ns_smart_device_link::ns_json_handler::SmartSchemaKey<FunctionID::eType, messageType::eType>(FunctionID::val_1, messageType::response), InitFunction_val_1_response(function_id_items, message_type_items)));
+  functions_schemes_.insert(std::make_pair(ns_smart_device_link::ns_json_handler::SmartSchemaKey<FunctionID::eType, messageType::eType>(FunctionID::val_2, messageType::notification), InitFunction_val_2_notification(function_id_items, message_type_items)));
+}
+
+void XXX::YYY::ZZZ::Test::InitFunctionSchema(
+    const FunctionID::eType &function_id,
+    const messageType::eType &message_type) {
+
+
+  std::set<FunctionID::eType> function_id_items { function_id };
+  std::set<messageType::eType> message_type_items { message_type };
+
+  switch(message_type) {
+    case messageType::request: {
+      switch(function_id) {
+        case FunctionID::name1: {
+          ns_smart_device_link::ns_json_handler::SmartSchemaKey<FunctionID::eType, messageType::eType> shema_key(function_id, message_type);
+          functions_schemes_[shema_key] = InitFunction_name1_request(function_id_items, message_type_items);
+          break;
+        }
+        default:
+          break;
+      }
+      break;
+    }
+    case messageType::response: {
+      switch(function_id) {
+        case FunctionID::val_1: {
+          ns_smart_device_link::ns_json_handler::SmartSchemaKey<FunctionID::eType, messageType::eType> shema_key(function_id, message_type);
+          functions_schemes_[shema_key] = InitFunction_val_1_response(function_id_items, message_type_items);
+          break;
+        }
+        default:
+          break;
+      }
+      break;
+    }
+    case messageType::notification: {
+      switch(function_id) {
+        case FunctionID::val_2: {
+          ns_smart_device_link::ns_json_handler::SmartSchemaKey<FunctionID::eType, messageType::eType> shema_key(function_id, message_type);
+          functions_schemes_[shema_key] = InitFunction_val_2_notification(function_id_items, message_type_items);
+          break;
+        }
+        default:
+          break;
+      }
+      break;
+    }
+    default:
+      break;
+  }
 }
 
 //------------- Functions schemes initialization -------------
 
 CSmartSchema XXX::YYY::ZZZ::Test::InitFunction_name1_request(
-    const TStructsSchemaItems &struct_schema_items,
     const std::set<FunctionID::eType> &function_id_items,
     const std::set<messageType::eType> &message_type_items) {
   std::set<Enum_new4::eType> Enum_new4_all_enum_values;
@@ -129,7 +385,7 @@ CSmartSchema XXX::YYY::ZZZ::Test::InitFunction_name1_request(
   std::set<Enum1::eType> param2_allowed_enum_subset_values;
   param2_allowed_enum_subset_values.insert(Enum1::name1);
 
-  // Function parameter param1.
+  // Struct member param1.
   //
   // Description Line1
   // Description Line2
@@ -142,37 +398,37 @@ CSmartSchema XXX::YYY::ZZZ::Test::InitFunction_name1_request(
   //
   // ToDo: Do1
   // ToDo: Do2
-  TSharedPtr<ISchemaItem> param1_SchemaItem = TEnumSchemaItem<Enum_new4::eType>::create(Enum_new4_all_enum_values, TSchemaItemParameter<Enum_new4::eType>(Enum_new4::_11));
-
-  // Function parameter param2.
-  TSharedPtr<ISchemaItem> param2_SchemaItem = TEnumSchemaItem<Enum1::eType>::create(param2_allowed_enum_subset_values, TSchemaItemParameter<Enum1::eType>(name1));
+  std::shared_ptr<ISchemaItem> param1_SchemaItem = TEnumSchemaItem<Enum_new4::eType>::create(Enum_new4_all_enum_values, TSchemaItemParameter<Enum_new4::eType>(Enum_new4::_11));
 
-  std::map<std::string, SMember> schema_members;
+  // Struct member param2.
+  std::shared_ptr<ISchemaItem> param2_SchemaItem = TEnumSchemaItem<Enum1::eType>::create(param2_allowed_enum_subset_values, TSchemaItemParameter<Enum1::eType>(name1));Members schema_members;
 
   schema_members["param1"] = SMember(param1_SchemaItem, true);
   schema_members["param2"] = SMember(param2_SchemaItem, true);
 
-  std::map<std::string, SMember> params_members;
+  Members params_members;
   params_members[ns_smart_device_link::ns_json_handler::strings::S_FUNCTION_ID] = SMember(TEnumSchemaItem<FunctionID::eType>::create(function_id_items), true);
   params_members[ns_smart_device_link::ns_json_handler::strings::S_MESSAGE_TYPE] = SMember(TEnumSchemaItem<messageType::eType>::create(message_type_items), true);
   params_members[ns_smart_device_link::ns_json_handler::strings::S_PROTOCOL_VERSION] = SMember(TNumberSchemaItem<int>::create(), true);
   params_members[ns_smart_device_link::ns_json_handler::strings::S_PROTOCOL_TYPE] = SMember(TNumberSchemaItem<int>::create(), true);
   params_members[ns_smart_device_link::ns_json_handler::strings::S_CORRELATION_ID] = SMember(TNumberSchemaItem<int>::create(), true);
 
-  std::map<std::string, SMember> root_members_map;
-  root_members_map[ns_smart_device_link::ns_json_handler::strings::S_MSG_PARAMS] = SMember(CObjectSchemaItem::create(schema_members), true);
+  std::shared_ptr<CObjectSchemaItem> msg_params_schema = CObjectSchemaItem::create(schema_members);
+  msg_params_schema->SetCompiledValidator(&ValidateFunction_name1_request, ValidateFunction_name1_request_keys, 2);
+
+  Members root_members_map;
+  root_members_map[ns_smart_device_link::ns_json_handler::strings::S_MSG_PARAMS] = SMember(msg_params_schema, true);
   root_members_map[ns_smart_device_link::ns_json_handler::strings::S_PARAMS] = SMember(CObjectSchemaItem::create(params_members), true);
 
   return CSmartSchema(CObjectSchemaItem::create(root_members_map));
 }
 
 CSmartSchema XXX::YYY::ZZZ::Test::InitFunction_val_1_response(
-    const TStructsSchemaItems &struct_schema_items,
     const std::set<FunctionID::eType> &function_id_items,
     const std::set<messageType::eType> &message_type_items) {
-  std::map<std::string, SMember> schema_members;
+  Members schema_members;
 
-  std::map<std::string, SMember> params_members;
+  Members params_members;
   params_members[ns_smart_device_link::ns_json_handler::strings::S_FUNCTION_ID] = SMember(TEnumSchemaItem<FunctionID::eType>::create(function_id_items), true);
   params_members[ns_smart_device_link::ns_json_handler::strings::S_MESSAGE_TYPE] = SMember(TEnumSchemaItem<messageType::eType>::create(message_type_items), true);
   params_members[ns_smart_device_link::ns_json_handler::strings::S_PROTOCOL_VERSION] = SMember(TNumberSchemaItem<int>::create(), true);
@@ -180,27 +436,32 @@ CSmartSchema XXX::YYY::ZZZ::Test::InitFunction_val_1_response(
   params_members[ns_smart_device_link::ns_json_handler::strings::S_CORRELATION_ID] = SMember(TNumberSchemaItem<int>::create(), true);
   params_members[ns_smart_device_link::ns_json_handler::strings::kCode] = SMember(TNumberSchemaItem<int>::create(), true);
 
-  std::map<std::string, SMember> root_members_map;
-  root_members_map[ns_smart_device_link::ns_json_handler::strings::S_MSG_PARAMS] = SMember(CObjectSchemaItem::create(schema_members), true);
+  std::shared_ptr<CObjectSchemaItem> msg_params_schema = CObjectSchemaItem::create(schema_members);
+  msg_params_schema->SetCompiledValidator(&ValidateFunction_val_1_response, nullptr, 0);
+
+  Members root_members_map;
+  root_members_map[ns_smart_device_link::ns_json_handler::strings::S_MSG_PARAMS] = SMember(msg_params_schema, true);
   root_members_map[ns_smart_device_link::ns_json_handler::strings::S_PARAMS] = SMember(CObjectSchemaItem::create(params_members), true);
 
   return CSmartSchema(CObjectSchemaItem::create(root_members_map));
 }
 
 CSmartSchema XXX::YYY::ZZZ::Test::InitFunction_val_2_notification(
-    const TStructsSchemaItems &struct_schema_items,
     const std::set<FunctionID::eType> &function_id_items,
     const std::set<messageType::eType> &message_type_items) {
-  std::map<std::string, SMember> schema_members;
+  Members schema_members;
 
-  std::map<std::string, SMember> params_members;
+  Members params_members;
   params_members[ns_smart_device_link::ns_json_handler::strings::S_FUNCTION_ID] = SMember(TEnumSchemaItem<FunctionID::eType>::create(function_id_items), true);
   params_members[ns_smart_device_link::ns_json_handler::strings::S_MESSAGE_TYPE] = SMember(TEnumSchemaItem<messageType::eType>::create(message_type_items), true);
   params_members[ns_smart_device_link::ns_json_handler::strings::S_PROTOCOL_VERSION] = SMember(TNumberSchemaItem<int>::create(), true);
   params_members[ns_smart_device_link::ns_json_handler::strings::S_PROTOCOL_TYPE] = SMember(TNumberSchemaItem<int>::create(), true);
 
-  std::map<std::string, SMember> root_members_map;
-  root_members_map[ns_smart_device_link::ns_json_handler::strings::S_MSG_PARAMS] = SMember(CObjectSchemaItem::create(schema_members), true);
+  std::shared_ptr<CObjectSchemaItem> msg_params_schema = CObjectSchemaItem::create(schema_members);
+  msg_params_schema->SetCompiledValidator(&ValidateFunction_val_2_notification, nullptr, 0);
+
+  Members root_members_map;
+  root_members_map[ns_smart_device_link::ns_json_handler::strings::S_MSG_PARAMS] = SMember(msg_params_schema, true);
   root_members_map[ns_smart_device_link::ns_json_handler::strings::S_PARAMS] = SMember(CObjectSchemaItem::create(params_members), true);
 
   return CSmartSchema(CObjectSchemaItem::create(root_members_map));
@@ -208,8 +469,12 @@ CSmartSchema XXX::YYY::ZZZ::Test::InitFunction_val_2_notification(
 
 //----------- Structs schema items initialization ------------
 
-TSharedPtr<ISchemaItem> XXX::YYY::ZZZ::Test::InitStructSchemaItem_Struct1(
-    const TStructsSchemaItems &struct_schema_items) {
+std::shared_ptr<ISchemaItem> XXX::YYY::ZZZ::Test::InitStructSchemaItem_Struct1() {
+  Members schema_members;
+  std::shared_ptr<CObjectSchemaItem> struct_schema = CObjectSchemaItem::create(schema_members);
+  struct_schema_items.insert(std::make_pair(StructIdentifiers::Struct1, CObjectSchemaItem::create(schema_members)));
+  struct_schema_items[StructIdentifiers::Struct1] = struct_schema;
+
   std::set<Enum1::eType> Enum1_all_enum_values;
   Enum1_all_enum_values.insert(Enum1::name1);
   Enum1_all_enum_values.insert(Enum1::internal_name2);
@@ -232,47 +497,43 @@ TSharedPtr<ISchemaItem> XXX::YYY::ZZZ::Test::InitStructSchemaItem_Struct1(
   sub3_allowed_enum_subset_values.insert(Enum_new4::_22);
 
   // Struct member intParam.
-  TSharedPtr<ISchemaItem> intParam_SchemaItem = TNumberSchemaItem<int>::create(TSchemaItemParameter<int>(), TSchemaItemParameter<int>(2), TSchemaItemParameter<int>());
+  std::shared_ptr<ISchemaItem> intParam_SchemaItem = TNumberSchemaItem<int64_t>::create(TSchemaItemParameter<int64_t>(), TSchemaItemParameter<int64_t>(2), TSchemaItemParameter<int64_t>());
 
   // Struct member doubleParam.
-  TSharedPtr<ISchemaItem> doubleParam_SchemaItem = TNumberSchemaItem<double>::create(TSchemaItemParameter<double>(0.333), TSchemaItemParameter<double>(), TSchemaItemParameter<double>());
+  std::shared_ptr<ISchemaItem> doubleParam_SchemaItem = TNumberSchemaItem<double>::create(TSchemaItemParameter<double>(0.333), TSchemaItemParameter<double>(), TSchemaItemParameter<double>());
 
   // Struct member boolParam.
-  TSharedPtr<ISchemaItem> boolParam_SchemaItem = CBoolSchemaItem::create(TSchemaItemParameter<bool>());
+  std::shared_ptr<ISchemaItem> boolParam_SchemaItem = CBoolSchemaItem::create(TSchemaItemParameter<bool>());
 
   // Struct member structParam.
-  TSharedPtr<ISchemaItem> structParam_SchemaItem = ProvideObjectSchemaItemForStruct(struct_schema_items, StructIdentifiers::Struct2);
+  ISchemaItem* structParam_SchemaItem = ProvideObjectSchemaItemForStruct(struct_schema_items, StructIdentifiers::Struct2).get();
 
   // Struct member enumParam.
-  TSharedPtr<ISchemaItem> enumParam_SchemaItem = TEnumSchemaItem<Enum1::eType>::create(Enum1_all_enum_values, TSchemaItemParameter<Enum1::eType>());
+  std::shared_ptr<ISchemaItem> enumParam_SchemaItem = TEnumSchemaItem<Enum1::eType>::create(Enum1_all_enum_values, TSchemaItemParameter<Enum1::eType>());
 
   // Struct member enumParam1.
-  TSharedPtr<ISchemaItem> enumParam1_SchemaItem = TEnumSchemaItem<Enum1::eType>::create(Enum1_all_enum_values, TSchemaItemParameter<Enum1::eType>());
+  std::shared_ptr<ISchemaItem> enumParam1_SchemaItem = TEnumSchemaItem<Enum1::eType>::create(Enum1_all_enum_values, TSchemaItemParameter<Enum1::eType>());
 
   // Struct member enumSubset1.
-  TSharedPtr<ISchemaItem> enumSubset1_SchemaItem = TEnumSchemaItem<Enum1::eType>::create(enumSubset1_allowed_enum_subset_values, TSchemaItemParameter<Enum1::eType>());
+  std::shared_ptr<ISchemaItem> enumSubset1_SchemaItem = TEnumSchemaItem<Enum1::eType>::create(enumSubset1_allowed_enum_subset_values, TSchemaItemParameter<Enum1::eType>());
 
   // Struct member arrayOfInt.
-  TSharedPtr<ISchemaItem> arrayOfInt_SchemaItem = CArraySchemaItem::create(CBoolSchemaItem::create(TSchemaItemParameter<bool>()), TSchemaItemParameter<size_t>(0), TSchemaItemParameter<size_t>(20));
+  std::shared_ptr<ISchemaItem> arrayOfInt_SchemaItem = CArraySchemaItem::create(CBoolSchemaItem::create(TSchemaItemParameter<bool>()), TSchemaItemParameter<size_t>(0), TSchemaItemParameter<size_t>(20));
 
   // Struct member arrayOfEnum1.
-  TSharedPtr<ISchemaItem> arrayOfEnum1_SchemaItem = CArraySchemaItem::create(TEnumSchemaItem<Enum1::eType>::create(Enum1_all_enum_values, TSchemaItemParameter<Enum1::eType>()), TSchemaItemParameter<size_t>(0), TSchemaItemParameter<size_t>(20));
+  std::shared_ptr<ISchemaItem> arrayOfEnum1_SchemaItem = CArraySchemaItem::create(TEnumSchemaItem<Enum1::eType>::create(Enum1_all_enum_values, TSchemaItemParameter<Enum1::eType>()), TSchemaItemParameter<size_t>(0), TSchemaItemParameter<size_t>(20));
 
   // Struct member arrayOfEnum3.
-  TSharedPtr<ISchemaItem> arrayOfEnum3_SchemaItem = CArraySchemaItem::create(TEnumSchemaItem<Enum_new2::eType>::create(Enum_new2_all_enum_values, TSchemaItemParameter<Enum_new2::eType>()), TSchemaItemParameter<size_t>(10), TSchemaItemParameter<size_t>(40));
+  std::shared_ptr<ISchemaItem> arrayOfEnum3_SchemaItem = CArraySchemaItem::create(TEnumSchemaItem<Enum_new2::eType>::create(Enum_new2_all_enum_values, TSchemaItemParameter<Enum_new2::eType>()), TSchemaItemParameter<size_t>(10), TSchemaItemParameter<size_t>(40));
 
   // Struct member arrayOfEnum4.
-  TSharedPtr<ISchemaItem> arrayOfEnum4_SchemaItem = CArraySchemaItem::create(TEnumSchemaItem<Enum1::eType>::create(sub1_allowed_enum_subset_values, TSchemaItemParameter<Enum1::eType>()), TSchemaItemParameter<size_t>(10), TSchemaItemParameter<size_t>(41));
+  std::shared_ptr<ISchemaItem> arrayOfEnum4_SchemaItem = CArraySchemaItem::create(TEnumSchemaItem<Enum1::eType>::create(sub1_allowed_enum_subset_values, TSchemaItemParameter<Enum1::eType>()), TSchemaItemParameter<size_t>(10), TSchemaItemParameter<size_t>(41));
 
   // Struct member arrayOfEnum5.
-  TSharedPtr<ISchemaItem> arrayOfEnum5_SchemaItem = CArraySchemaItem::create(TEnumSchemaItem<Enum1::eType>::create(sub2_allowed_enum_subset_values, TSchemaItemParameter<Enum1::eType>()), TSchemaItemParameter<size_t>(10), TSchemaItemParameter<size_t>(42));
+  std::shared_ptr<ISchemaItem> arrayOfEnum5_SchemaItem = CArraySchemaItem::create(TEnumSchemaItem<Enum1::eType>::create(sub2_allowed_enum_subset_values, TSchemaItemParameter<Enum1::eType>()), TSchemaItemParameter<size_t>(10), TSchemaItemParameter<size_t>(42));
 
   // Struct member arrayOfEnum6.
-  TSharedPtr<ISchemaItem> arrayOfEnum6_SchemaItem = CArraySchemaItem::create(TEnumSchemaItem<Enum_new4::eType>::create(sub3_allowed_enum_subset_values, TSchemaItemParameter<Enum_new4::eType>()), TSchemaItemParameter<size_t>(10), TSchemaItemParameter<size_t>(43));
-
-  std::map<std::string, SMember> schema_members;
-
-  schema_members["intParam"] = SMember(intParam_SchemaItem, true);
+  std::shared_ptr<ISchemaItem> arrayOfEnum6_SchemaItem = CArraySchemaItem::create(TEnumSchemaItem<Enum_new4::eType>::create(sub3_allowed_enum_subset_values, TSchemaItemParameter<Enum_new4::eType>()), TSchemaItemParameter<size_t>(10), TSchemaItemParameter<size_t>(43));schema_members["intParam"] = SMember(intParam_SchemaItem, true);
   schema_members["doubleParam"] = SMember(doubleParam_SchemaItem, false);
   schema_members["boolParam"] = SMember(boolParam_SchemaItem, true);
   schema_members["structParam"] = SMember(structParam_SchemaItem, true);
@@ -286,14 +547,20 @@ TSharedPtr<ISchemaItem> XXX::YYY::ZZZ::Test::InitStructSchemaItem_Struct1(
   schema_members["arrayOfEnum5"] = SMember(arrayOfEnum5_SchemaItem, true);
   schema_members["arrayOfEnum6"] = SMember(arrayOfEnum6_SchemaItem, true);
 
-  return CObjectSchemaItem::create(schema_members);
+  for(auto& member : schema_members) {struct_schema->AddMemberSchemaItem(member.first, member.second);}
+  struct_schema->SetCompiledValidator(&ValidateStruct_Struct1, ValidateStruct_Struct1_keys, 13);
+  return struct_schema;
 }
 
-TSharedPtr<ISchemaItem> XXX::YYY::ZZZ::Test::InitStructSchemaItem_Struct2(
-    const TStructsSchemaItems &struct_schema_items) {
-  std::map<std::string, SMember> schema_members;
+std::shared_ptr<ISchemaItem> XXX::YYY::ZZZ::Test::InitStructSchemaItem_Struct2() {
+  Members schema_members;
+  std::shared_ptr<CObjectSchemaItem> struct_schema = CObjectSchemaItem::create(schema_members);
+  struct_schema_items.insert(std::make_pair(StructIdentifiers::Struct2, CObjectSchemaItem::create(schema_members)));
+  struct_schema_items[StructIdentifiers::Struct2] = struct_schema;
 
-  return CObjectSchemaItem::create(schema_members);
+  for(auto& member : schema_members) {struct_schema->AddMemberSchemaItem(member.first, member.second);}
+  struct_schema->SetCompiledValidator(&ValidateStruct_Struct2, nullptr, 0);
+  return struct_schema;
 }
 
 //-------------- String to value enum mapping ----------------
@@ -301,84 +568,138 @@ TSharedPtr<ISchemaItem> XXX::YYY::ZZZ::Test::InitStructSchemaItem_Struct2(
 namespace ns_smart_device_link {
 namespace ns_smart_objects {
 
-template <>
-const std::map<XXX::YYY::ZZZ::Enum1::eType, std::string> &TEnumSchemaItem<XXX::YYY::ZZZ::Enum1::eType>::getEnumElementsStringRepresentation() {
-  static bool is_initialized = false;
-  static std::map<XXX::YYY::ZZZ::Enum1::eType, std::string> enum_string_representation;
-
-  if (false == is_initialized) {
-    enum_string_representation.insert(std::make_pair(XXX::YYY::ZZZ::Enum1::name1, "name1"));
-    enum_string_representation.insert(std::make_pair(XXX::YYY::ZZZ::Enum1::internal_name2, "name2"));
-
-    is_initialized = true;
-  }
-
-  return enum_string_representation;
-}
-
-template <>
-const std::map<XXX::YYY::ZZZ::E2::eType, std::string> &TEnumSchemaItem<XXX::YYY::ZZZ::E2::eType>::getEnumElementsStringRepresentation() {
-  static bool is_initialized = false;
-  static std::map<XXX::YYY::ZZZ::E2::eType, std::string> enum_string_representation;
-
-  if (false == is_initialized) {
-    enum_string_representation.insert(std::make_pair(XXX::YYY::ZZZ::E2::val_1, "xxx"));
-    enum_string_representation.insert(std::make_pair(XXX::YYY::ZZZ::E2::val_2, "yyy"));
-    enum_string_representation.insert(std::make_pair(XXX::YYY::ZZZ::E2::val_3, "val_3"));
+template<>
+const EnumConversionHelper<XXX::YYY::ZZZ::Enum1::eType>::EnumToCStringMap
+EnumConversionHelper<XXX::YYY::ZZZ::Enum1::eType>::enum_to_cstring_map_ =
+  EnumConversionHelper<XXX::YYY::ZZZ::Enum1::eType>::InitEnumToCStringMap();
+
+template<>
+const EnumConversionHelper<XXX::YYY::ZZZ::Enum1::eType>::CStringToEnumMap
+EnumConversionHelper<XXX::YYY::ZZZ::Enum1::eType>::cstring_to_enum_map_ =
+  EnumConversionHelper<XXX::YYY::ZZZ::Enum1::eType>::InitCStringToEnumMap();
+
+template<>
+const char* const
+EnumConversionHelper<XXX::YYY::ZZZ::Enum1::eType>::cstring_values_[] = {
+    "name1",
+    "name2"
+};
+
+template<>
+const XXX::YYY::ZZZ::Enum1::eType
+EnumConversionHelper<XXX::YYY::ZZZ::Enum1::eType>::enum_values_[] = {
+    XXX::YYY::ZZZ::Enum1::name1,
+    XXX::YYY::ZZZ::Enum1::internal_name2
+};
+
+
+template<>
+const EnumConversionHelper<XXX::YYY::ZZZ::E2::eType>::EnumToCStringMap
+EnumConversionHelper<XXX::YYY::ZZZ::E2::eType>::enum_to_cstring_map_ =
+  EnumConversionHelper<XXX::YYY::ZZZ::E2::eType>::InitEnumToCStringMap();
+
+template<>
+const EnumConversionHelper<XXX::YYY::ZZZ::E2::eType>::CStringToEnumMap
+EnumConversionHelper<XXX::YYY::ZZZ::E2::eType>::cstring_to_enum_map_ =
+  EnumConversionHelper<XXX::YYY::ZZZ::E2::eType>::InitCStringToEnumMap();
+
+template<>
+const char* const
+EnumConversionHelper<XXX::YYY::ZZZ::E2::eType>::cstring_values_[] = {
+    "xxx",
+    "yyy",
+    "val_3"
+};
+
+template<>
+const XXX::YYY::ZZZ::E2::eType
+EnumConversionHelper<XXX::YYY::ZZZ::E2::eType>::enum_values_[] = {
+    XXX::YYY::ZZZ::E2::val_1,
+    XXX::YYY::ZZZ::E2::val_2,
+    XXX::YYY::ZZZ::E2::val_3
+};
+
+
+template<>
+const EnumConversionHelper<XXX::YYY::ZZZ::Enum_new2::eType>::EnumToCStringMap
+EnumConversionHelper<XXX::YYY::ZZZ::Enum_new2::eType>::enum_to_cstring_map_ =
+  EnumConversionHelper<XXX::YYY::ZZZ::Enum_new2::eType>::InitEnumToCStringMap();
+
+template<>
+const EnumConversionHelper<XXX::YYY::ZZZ::Enum_new2::eType>::CStringToEnumMap
+EnumConversionHelper<XXX::YYY::ZZZ::Enum_new2::eType>::cstring_to_enum_map_ =
+  EnumConversionHelper<XXX::YYY::ZZZ::Enum_new2::eType>::InitCStringToEnumMap();
+
+template<>
+const char* const
+EnumConversionHelper<XXX::YYY::ZZZ::Enum_new2::eType>::cstring_values_[] = {
+    "xxx",
+    "xxx",
+    "xxx"
+};
+
+template<>
+const XXX::YYY::ZZZ::Enum_new2::eType
+EnumConversionHelper<XXX::YYY::ZZZ::Enum_new2::eType>::enum_values_[] = {
+    XXX::YYY::ZZZ::Enum_new2::_1,
+    XXX::YYY::ZZZ::Enum_new2::_2,
+    XXX::YYY::ZZZ::Enum_new2::_3
+};
+
+
+template<>
+const EnumConversionHelper<XXX::YYY::ZZZ::Enum_new4::eType>::EnumToCStringMap
+EnumConversionHelper<XXX::YYY::ZZZ::Enum_new4::eType>::enum_to_cstring_map_ =
+  EnumConversionHelper<XXX::YYY::ZZZ::Enum_new4::eType>::InitEnumToCStringMap();
+
+template<>
+const EnumConversionHelper<XXX::YYY::ZZZ::Enum_new4::eType>::CStringToEnumMap
+EnumConversionHelper<XXX::YYY::ZZZ::Enum_new4::eType>::cstring_to_enum_map_ =
+  EnumConversionHelper<XXX::YYY::ZZZ::Enum_new4::eType>::InitCStringToEnumMap();
+
+template<>
+const char* const
+EnumConversionHelper<XXX::YYY::ZZZ::Enum_new4::eType>::cstring_values_[] = {
+    "xxx",
+    "xxx"
+};
+
+template<>
+const XXX::YYY::ZZZ::Enum_new4::eType
+EnumConversionHelper<XXX::YYY::ZZZ::Enum_new4::eType>::enum_values_[] = {
+    XXX::YYY::ZZZ::Enum_new4::_11,
+    XXX::YYY::ZZZ::Enum_new4::_22
+};
+
+
+template<>
+const EnumConversionHelper<XXX::YYY::ZZZ::messageType::eType>::EnumToCStringMap
+EnumConversionHelper<XXX::YYY::ZZZ::messageType::eType>::enum_to_cstring_map_ =
+  EnumConversionHelper<XXX::YYY::ZZZ::messageType::eType>::InitEnumToCStringMap();
+
+template<>
+const EnumConversionHelper<XXX::YYY::ZZZ::messageType::eType>::CStringToEnumMap
+EnumConversionHelper<XXX::YYY::ZZZ::messageType::eType>::cstring_to_enum_map_ =
+  EnumConversionHelper<XXX::YYY::ZZZ::messageType::eType>::InitCStringToEnumMap();
+
+template<>
+const char* const
+EnumConversionHelper<XXX::YYY::ZZZ::messageType::eType>::cstring_values_[] = {
+    "request",
+    "response",
+    "notification",
+    "error_response"
+};
+
+template<>
+const XXX::YYY::ZZZ::messageType::eType
+EnumConversionHelper<XXX::YYY::ZZZ::messageType::eType>::enum_values_[] = {
+    XXX::YYY::ZZZ::messageType::request,
+    XXX::YYY::ZZZ::messageType::response,
+    XXX::YYY::ZZZ::messageType::notification,
+    XXX::YYY::ZZZ::messageType::error_response
+};
 
-    is_initialized = true;
-  }
-
-  return enum_string_representation;
-}
-
-template <>
-const std::map<XXX::YYY::ZZZ::Enum_new2::eType, std::string> &TEnumSchemaItem<XXX::YYY::ZZZ::Enum_new2::eType>::getEnumElementsStringRepresentation() {
-  static bool is_initialized = false;
-  static std::map<XXX::YYY::ZZZ::Enum_new2::eType, std::string> enum_string_representation;
-
-  if (false == is_initialized) {
-    enum_string_representation.insert(std::make_pair(XXX::YYY::ZZZ::Enum_new2::_1, "xxx"));
-    enum_string_representation.insert(std::make_pair(XXX::YYY::ZZZ::Enum_new2::_2, "xxx"));
-    enum_string_representation.insert(std::make_pair(XXX::YYY::ZZZ::Enum_new2::_3, "xxx"));
-
-    is_initialized = true;
-  }
-
-  return enum_string_representation;
-}
-
-template <>
-const std::map<XXX::YYY::ZZZ::Enum_new4::eType, std::string> &TEnumSchemaItem<XXX::YYY::ZZZ::Enum_new4::eType>::getEnumElementsStringRepresentation() {
-  static bool is_initialized = false;
-  static std::map<XXX::YYY::ZZZ::Enum_new4::eType, std::string> enum_string_representation;
-
-  if (false == is_initialized) {
-    enum_string_representation.insert(std::make_pair(XXX::YYY::ZZZ::Enum_new4::_11, "xxx"));
-    enum_string_representation.insert(std::make_pair(XXX::YYY::ZZZ::Enum_new4::_22, "xxx"));
-
-    is_initialized = true;
-  }
-
-  return enum_string_representation;
-}
-
-template <>
-const std::map<XXX::YYY::ZZZ::messageType::eType, std::string> &TEnumSchemaItem<XXX::YYY::ZZZ::messageType::eType>::getEnumElementsStringRepresentation() {
-  static bool is_initialized = false;
-  static std::map<XXX::YYY::ZZZ::messageType::eType, std::string> enum_string_representation;
-
-  if (false == is_initialized) {
-    enum_string_representation.insert(std::make_pair(XXX::YYY::ZZZ::messageType::request, "request"));
-    enum_string_representation.insert(std::make_pair(XXX::YYY::ZZZ::messageType::response, "response"));
-    enum_string_representation.insert(std::make_pair(XXX::YYY::ZZZ::messageType::notification, "notification"));
-    enum_string_representation.insert(std::make_pair(XXX::YYY::ZZZ::messageType::error_response, "error_response"));
-
-    is_initialized = true;
-  }
-
-  return enum_string_representation;
-}
 
 } // ns_smart_objects
 } // ns_smart_device_link
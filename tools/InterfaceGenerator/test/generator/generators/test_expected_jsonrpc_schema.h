@@ -0,0 +1,180 @@
+/**
+ * @file Test.h
+ * @brief Generated class Test header file.
+ *
+ * This class is a part of SmartObjects solution. It provides
+ * factory functionallity which allows client to use SmartSchemas
+ * in accordance with definitions from Test.xml file
+ */
+// Copyright (c) 2013, Ford Motor Company
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer.
+//
+// Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following
+// disclaimer in the documentation and/or other materials provided with the
+// distribution.
+//
+// Neither the name of the Ford Motor Company nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef __CSMARTFACTORY_TEST_12345678123456781234567812345678_HPP__
+#define __CSMARTFACTORY_TEST_12345678123456781234567812345678_HPP__
+
+#include "formatters/CSmartFactory.h"
+#include "smart_objects/smart_schema.h"
+#include "smart_objects/schema_item.h"
+#include "smart_objects/object_schema_item.h"
+#include "Test.h"
+
+namespace XXX {
+namespace YYY {
+namespace ZZZ {
+
+
+/**
+ * @brief Class Test.
+ *
+ * Params:
+ *     param1 - value1
+ *     param2 - value2
+ */
+class Test : public ns_smart_device_link::ns_json_handler::CSmartFactory<FunctionID::eType, messageType::eType, StructIdentifiers::eType> {
+ public:
+  /**
+   * @brief Constructor.
+   */
+  Test();
+
+  /**
+   * @brief Adds custom members to existing list of params.
+   */
+  bool AddCustomMember(FunctionID::eType function_id,
+                       messageType::eType message_type,
+                       std::string member_key, ns_smart_device_link::ns_smart_objects::SMember member);
+
+  /**
+   * @brief Reset function schema to state defined in API.
+   */
+  void ResetFunctionSchema(FunctionID::eType function_id,
+                           messageType::eType message_type);
+
+  /**
+   * @brief Type that maps of struct IDs to schema items.
+   */
+  typedef std::map<const StructIdentifiers::eType, std::shared_ptr<ns_smart_device_link::ns_smart_objects::ISchemaItem> > TStructsSchemaItems;
+
+ protected:
+  /**
+   * @brief Helper that allows to make reference to struct
+   *
+   * @param struct_schema_items Struct schema items.
+   * @param struct_id ID of structure to provide.
+   *
+   * @return std::shared_ptr of strucute
+   */
+  static std::shared_ptr<ns_smart_device_link::ns_smart_objects::ISchemaItem> ProvideObjectSchemaItemForStruct(
+        const TStructsSchemaItems &struct_schema_items,
+        const StructIdentifiers::eType struct_id);
+
+  /**
+   * @brief Initializes all struct schemes.
+   */
+  void InitStructSchemes();
+
+  /**
+   * @brief Initializes all function schemes.
+   *
+   * @param function_id_items Set of all elements of FunctionID enum.
+   * @param message_type_items Set of all elements of messageType enum.
+   */
+  void InitFunctionSchemes(
+      const std::set<FunctionID::eType> &function_id_items,
+      const std::set<messageType::eType> &message_type_items);
+
+  /**
+   * @brief Initializes single function schema.
+   *
+   * @param function_id Function ID of schema to be initialized.
+   * @param message_type Message type of schema to be initialized.
+   */
+  void InitFunctionSchema(
+      const FunctionID::eType &function_id,
+      const messageType::eType &message_type);
+
+  /**
+   * @brief Method that generates schema for function Function1.
+   *
+   * @return ns_smart_device_link::ns_smart_objects::CSmartSchema
+   */
+  static ns_smart_device_link::ns_smart_objects::CSmartSchema InitFunction_name1_request(
+      const std::set<FunctionID::eType> &function_id_items,
+      const std::set<messageType::eType> &message_type_items);
+
+  /**
+   * @brief Method that generates schema for function Function2.
+   *
+   * @return ns_smart_device_link::ns_smart_objects::CSmartSchema
+   */
+  static ns_smart_device_link::ns_smart_objects::CSmartSchema InitFunction_val_1_response(
+      const std::set<FunctionID::eType> &function_id_items,
+      const std::set<messageType::eType> &message_type_items);
+
+  /**
+   * @brief Method that generates schema for function Function2.
+   *
+   * @return ns_smart_device_link::ns_smart_objects::CSmartSchema
+   */
+  static ns_smart_device_link::ns_smart_objects::CSmartSchema InitFunction_val_2_notification(
+      const std::set<FunctionID::eType> &function_id_items,
+      const std::set<messageType::eType> &message_type_items);
+
+ public:
+  static TStructsSchemaItems struct_schema_items;
+  /**
+   * @brief Method that generates schema item for structure Struct1.
+   *
+   * Design Line1
+   *
+   * @note Issue1
+   * @note Issue2
+   * @note Issue3
+   */
+  static std::shared_ptr<ns_smart_device_link::ns_smart_objects::ISchemaItem> InitStructSchemaItem_Struct1();
+
+
+  /**
+   * @brief Method that generates schema item for structure Struct2.
+   *
+   * @note Issue1
+   * @note Issue2
+   * @note Issue3
+   */
+  static std::shared_ptr<ns_smart_device_link::ns_smart_objects::ISchemaItem> InitStructSchemaItem_Struct2();
+
+};
+
+} // XXX
+} // YYY
+} // ZZZ
+
+#endif //__CSMARTFACTORY_TEST_12345678123456781234567812345678_HPP__
+
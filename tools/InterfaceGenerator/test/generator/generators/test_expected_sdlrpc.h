@@ -39,15 +39,9 @@
 #ifndef __CSMARTFACTORY_TEST_12345678123456781234567812345678_H__
 #define __CSMARTFACTORY_TEST_12345678123456781234567812345678_H__
 
-#include "JSONHandler/CSmartFactory.hpp"
-#include "SmartObjects/CSmartSchema.hpp"
-#include "SmartObjects/ISchemaItem.hpp"
-#include "SmartObjects/TSharedPtr.hpp"
-
 namespace XXX {
 namespace YYY {
 namespace ZZZ {
-
 namespace StructIdentifiers {
 /**
  * @brief Enumeration StructIdentifiers.
@@ -209,113 +203,9 @@ enum eType {
   notification
 };
 } // messageType
-
-
-/**
- * @brief Class Test.
- *
- * Params:
- *     param2 - value2
- *     param1 - value1
- */
-class Test : public ns_smart_device_link::ns_json_handler::CSmartFactory<FunctionID::eType, messageType::eType, StructIdentifiers::eType> {
- public:
-  /**
-   * @brief Constructor.
-   */
-  Test();
-
- protected:
-  /**
-   * @brief Type that maps of struct IDs to schema items.
-   */
-  typedef std::map<const StructIdentifiers::eType, ns_smart_device_link::ns_smart_objects::TSharedPtr<ns_smart_device_link::ns_smart_objects::ISchemaItem> > TStructsSchemaItems;
-
-  /**
-   * @brief Helper that allows to make reference to struct
-   *
-   * @param struct_schema_items Struct schema items.
-   * @param struct_id ID of structure to provide.
-   *
-   * @return TSharedPtr of strucute
-   */
-  static ns_smart_device_link::ns_smart_objects::TSharedPtr<ns_smart_device_link::ns_smart_objects::ISchemaItem> ProvideObjectSchemaItemForStruct(
-        const TStructsSchemaItems &struct_schema_items,
-        const StructIdentifiers::eType struct_id);
-
-  /**
-   * @brief Initializes all struct schemes.
-   */
-  void InitStructSchemes(TStructsSchemaItems &struct_schema_items);
-
-  /**
-   * @brief Initializes all function schemes.
-   *
-   * @param struct_schema_items Struct schema items.
-   * @param function_id_items Set of all elements of FunctionID enum.
-   * @param message_type_items Set of all elements of messageType enum.
-   */
-  void InitFunctionSchemes(
-      const TStructsSchemaItems &struct_schema_items,
-      const std::set<FunctionID::eType> &function_id_items,
-      const std::set<messageType::eType> &message_type_items);
-
-  /**
-   * @brief Method that generates schema for function Function1.
-   *
-   * @return ns_smart_device_link::ns_smart_objects::CSmartSchema
-   */
-  static ns_smart_device_link::ns_smart_objects::CSmartSchema InitFunction_name1_request(
-      const TStructsSchemaItems &struct_schema_items,
-      const std::set<FunctionID::eType> &function_id_items,
-      const std::set<messageType::eType> &message_type_items);
-
-  /**
-   * @brief Method that generates schema for function Function2.
-   *
-   * @return ns_smart_device_link::ns_smart_objects::CSmartSchema
-   */
-  static ns_smart_device_link::ns_smart_objects::CSmartSchema InitFunction_val_1_response(
-      const TStructsSchemaItems &struct_schema_items,
-      const std::set<FunctionID::eType> &function_id_items,
-      const std::set<messageType::eType> &message_type_items);
-
-  /**
-   * @brief Method that generates schema for function Function2.
-   *
-   * @return ns_smart_device_link::ns_smart_objects::CSmartSchema
-   */
-  static ns_smart_device_link::ns_smart_objects::CSmartSchema InitFunction_val_2_notification(
-      const TStructsSchemaItems &struct_schema_items,
-      const std::set<FunctionID::eType> &function_id_items,
-      const std::set<messageType::eType> &message_type_items);
-
-  /**
-   * @brief Method that generates schema item for structure Struct1.
-   *
-   * Design Line1
-   *
-   * @note Issue1
-   * @note Issue2
-   * @note Issue3
-   */
-  static ns_smart_device_link::ns_smart_objects::TSharedPtr<ns_smart_device_link::ns_smart_objects::ISchemaItem> InitStructSchemaItem_Struct1(
-      const TStructsSchemaItems &struct_schema_items);
-
-  /**
-   * @brief Method that generates schema item for structure Struct2.
-   *
-   * @note Issue1
-   * @note Issue2
-   * @note Issue3
-   */
-  static ns_smart_device_link::ns_smart_objects::TSharedPtr<ns_smart_device_link::ns_smart_objects::ISchemaItem> InitStructSchemaItem_Struct2(
-      const TStructsSchemaItems &struct_schema_items);
-};
-
 } // XXX
 } // YYY
 } // ZZZ
-
 #endif //__CSMARTFACTORY_TEST_12345678123456781234567812345678_H__
 
+
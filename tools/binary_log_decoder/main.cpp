@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+#include <time.h>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "utils/logger/binary_log_reader.h"
+
+namespace {
+
+enum ResultCode { SUCCESS = 0, MISSED_FILE_NAME, READ_ERROR };
+
+const char* LevelToString(const logger::LogLevel log_level) {
+  switch (log_level) {
+    case logger::LogLevel::TRACE_LEVEL:
+      return "TRACE";
+    case logger::LogLevel::DEBUG_LEVEL:
+      return "DEBUG";
+    case logger::LogLevel::INFO_LEVEL:
+      return "INFO";
+    case logger::LogLevel::WARNING_LEVEL:
+      return "WARN";
+    case logger::LogLevel::ERROR_LEVEL:
+      return "ERROR";
+    case logger::LogLevel::FATAL_LEVEL:
+      return "FATAL";
+    default:
+      return "?";
+  }
+}
+
+/**
+ * @brief Prints time as "dd Mon yyyy HH:MM:SS,mmm" used by text log files
+ */
+void PrintTimestamp(std::ostream& output, const int64_t timestamp) {
+  const time_t seconds = static_cast<time_t>(timestamp / 1000000000);
+  const int milliseconds = static_cast<int>(timestamp / 1000000 % 1000);
+  struct tm local_time;
+  localtime_r(&seconds, &local_time);
+  char buffer[32];
+  strftime(buffer, sizeof(buffer), "%d %b %Y %H:%M:%S", &local_time);
+  output << buffer << ',' << std::setw(3) << std::setfill('0')
+         << milliseconds;
+}
+
+void help() {
+  std::cout << "Usage:" << std::endl
+            << "./binaryLogDecoder {binary log file}" << std::endl
+            << "Prints messages in the format of SmartDeviceLinkCore.log"
+            << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    help();
+    exit(MISSED_FILE_NAME);
+  }
+
+  logger::BinaryLogReader reader;
+  const bool read_result = reader.Read(argv[1]);
+  if (!read_result && reader.messages().empty()) {
+    std::cerr << "Failed to read binary log " << argv[1] << std::endl;
+    exit(READ_ERROR);
+  }
+
+  const logger::BinaryLogReader::Site unknown_site{
+      "Unknown", logger::LogLevel::TRACE_LEVEL, "?", "?", 0};
+  for (const auto& message : reader.messages()) {
+    const logger::BinaryLogReader::Site* site = reader.site(message.site_id);
+    if (!site) {
+      site = &unknown_site;
+    }
+    std::cout << std::left << std::setw(5) << LevelToString(site->log_level)
+              << std::right << " [";
+    PrintTimestamp(std::cout, message.timestamp);
+    std::cout << "][0x" << std::hex << message.thread_id << std::dec << "]["
+              << site->component << "] " << site->file_name << ':'
+              << site->line_number << ' ' << site->function_name << ": "
+              << message.text << (message.truncated ? " [truncated]" : "")
+              << '\n';
+  }
+
+  if (0 != reader.dropped_count()) {
+    std::cerr << reader.dropped_count()
+              << " messages were dropped by the writer" << std::endl;
+  }
+  if (!read_result) {
+    std::cerr << "Binary log is truncated or corrupted" << std::endl;
+    exit(READ_ERROR);
+  }
+  return SUCCESS;
+}
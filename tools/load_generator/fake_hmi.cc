@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fake_hmi.h"
+
+#include <sys/socket.h>
+#include <iostream>
+#include <vector>
+
+#include <boost/asio/connect.hpp>
+#include <boost/beast/core/buffers_to_string.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+
+#include "utils/jsoncpp_reader_wrapper.h"
+
+namespace load_generator {
+
+namespace {
+const char* const kComponents[] = {"BasicCommunication",
+                                   "UI",
+                                   "VR",
+                                   "TTS",
+                                   "Navigation",
+                                   "VehicleInfo",
+                                   "Buttons",
+                                   "RC",
+                                   "AppService"};
+
+const char kOnAppRegistered[] = "BasicCommunication.OnAppRegistered";
+
+// hmi_apis::Common_Result::SUCCESS
+const int kSuccessCode = 0;
+
+bool EndsWith(const std::string& text, const std::string& suffix) {
+  return text.size() >= suffix.size() &&
+         0 == text.compare(text.size() - suffix.size(), suffix.size(), suffix);
+}
+}  // namespace
+
+FakeHmi::FakeHmi(const LoadConfig& config, StageTracker& tracker)
+    : config_(config)
+    , tracker_(tracker)
+    , websocket_(io_context_)
+    , stopping_(false)
+    , requests_count_(0)
+    , next_request_id_(1) {}
+
+FakeHmi::~FakeHmi() {
+  Stop();
+}
+
+bool FakeHmi::Start() {
+  try {
+    boost::asio::ip::tcp::resolver resolver(io_context_);
+    boost::asio::connect(
+        websocket_.next_layer(),
+        resolver.resolve(config_.host, std::to_string(config_.hmi_port)));
+    websocket_.handshake(config_.host, "/");
+    websocket_.text(true);
+  } catch (const std::exception& error) {
+    std::cerr << "HMI failed to connect: " << error.what() << std::endl;
+    return false;
+  }
+
+  for (const char* component : kComponents) {
+    Json::Value params(Json::objectValue);
+    params["componentName"] = component;
+    SendRequest("MB.registerComponent", params);
+  }
+  Json::Value subscription(Json::objectValue);
+  subscription["propertyName"] = kOnAppRegistered;
+  SendRequest("MB.subscribeTo", subscription);
+
+  SendNotification("BasicCommunication.OnReady",
+                   Json::Value(Json::objectValue));
+  // From now on websocket is used by the reader thread only
+  reader_ = std::thread(&FakeHmi::ReaderMain, this);
+  return true;
+}
+
+void FakeHmi::Stop() {
+  if (!reader_.joinable()) {
+    return;
+  }
+  stopping_ = true;
+  // Unblocks read of the reader thread
+  ::shutdown(websocket_.next_layer().native_handle(), SHUT_RDWR);
+  reader_.join();
+}
+
+void FakeHmi::ReaderMain() {
+  boost::beast::flat_buffer buffer;
+  while (!stopping_) {
+    try {
+      websocket_.read(buffer);
+    } catch (const std::exception& error) {
+      if (!stopping_) {
+        std::cerr << "HMI connection is lost: " << error.what() << std::endl;
+      }
+      return;
+    }
+    HandleMessage(boost::beast::buffers_to_string(buffer.data()));
+    buffer.consume(buffer.size());
+  }
+}
+
+void FakeHmi::HandleMessage(const std::string& text) {
+  const Clock::time_point received = Clock::now();
+  std::vector<StageTracker::Key> keys;
+  StageTracker::FindTokens(text, keys);
+  for (const auto& key : keys) {
+    tracker_.OnHmiReceived(key, received);
+  }
+
+  Json::Value message;
+  utils::JsonReader reader;
+  if (!reader.parse(text, &message) || !message.isObject()) {
+    std::cerr << "HMI received malformed message: " << text << std::endl;
+    return;
+  }
+
+  if (!message.isMember("method")) {
+    // Response to HMI own request, nothing to do
+    return;
+  }
+  if (message.isMember("id")) {
+    HandleRequest(message);
+    const Clock::time_point responded = Clock::now();
+    for (const auto& key : keys) {
+      tracker_.OnHmiResponded(key, responded);
+    }
+  } else {
+    HandleNotification(message);
+  }
+}
+
+void FakeHmi::HandleRequest(const Json::Value& message) {
+  const std::string method = message["method"].asString();
+  Json::Value response(Json::objectValue);
+  response["jsonrpc"] = "2.0";
+  response["id"] = message["id"];
+  Json::Value& result = response["result"];
+  result["code"] = kSuccessCode;
+  result["method"] = method;
+  if (EndsWith(method, ".IsReady")) {
+    result["available"] = true;
+  }
+  Send(response);
+  ++requests_count_;
+}
+
+void FakeHmi::HandleNotification(const Json::Value& message) {
+  if (kOnAppRegistered != message["method"].asString()) {
+    return;
+  }
+  const Json::Value& application = message["params"]["application"];
+  const Json::Value& device = application["deviceInfo"];
+  const std::string device_id = device["id"].asString();
+  if (allowed_devices_.insert(device_id).second) {
+    Json::Value params(Json::objectValue);
+    params["allowed"] = true;
+    params["source"] = "GUI";
+    params["device"]["id"] = device_id;
+    params["device"]["name"] = device["name"];
+    SendNotification("SDL.OnAllowSDLFunctionality", params);
+  }
+
+  Json::Value params(Json::objectValue);
+  params["appID"] = application["appID"];
+  SendRequest("SDL.ActivateApp", params);
+}
+
+void FakeHmi::SendRequest(const std::string& method,
+                          const Json::Value& params) {
+  Json::Value request(Json::objectValue);
+  request["jsonrpc"] = "2.0";
+  request["id"] = next_request_id_++;
+  request["method"] = method;
+  request["params"] = params;
+  Send(request);
+}
+
+void FakeHmi::SendNotification(const std::string& method,
+                               const Json::Value& params) {
+  Json::Value notification(Json::objectValue);
+  notification["jsonrpc"] = "2.0";
+  notification["method"] = method;
+  notification["params"] = params;
+  Send(notification);
+}
+
+void FakeHmi::Send(const Json::Value& message) {
+  Json::StreamWriterBuilder writer_builder;
+  writer_builder["indentation"] = "";
+  const std::string text = Json::writeString(writer_builder, message);
+  try {
+    websocket_.write(boost::asio::buffer(text));
+  } catch (const std::exception& error) {
+    if (!stopping_) {
+      std::cerr << "HMI failed to send message: " << error.what()
+                << std::endl;
+    }
+  }
+}
+
+}  // namespace load_generator
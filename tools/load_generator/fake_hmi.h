@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TOOLS_LOAD_GENERATOR_FAKE_HMI_H_
+#define TOOLS_LOAD_GENERATOR_FAKE_HMI_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/beast/websocket.hpp>
+
+#include "json/json.h"
+#include "load_config.h"
+#include "stage_tracker.h"
+
+namespace load_generator {
+
+/**
+ * @brief Scripted HMI connected to core through the HMI WebSocket of
+ * CMessageBrokerController. Registers all components, answers every
+ * request with SUCCESS right away and activates every registered app,
+ * so measured latencies show core own costs
+ */
+class FakeHmi {
+ public:
+  FakeHmi(const LoadConfig& config, StageTracker& tracker);
+  ~FakeHmi();
+
+  /**
+   * @brief Connects to core and sends BasicCommunication.OnReady
+   * @return false if connection failed
+   */
+  bool Start();
+
+  void Stop();
+
+  /**
+   * @brief Gets amount of requests HMI has answered
+   */
+  uint64_t requests_count() const {
+    return requests_count_;
+  }
+
+ private:
+  void ReaderMain();
+  void HandleMessage(const std::string& text);
+  void HandleRequest(const Json::Value& message);
+  void HandleNotification(const Json::Value& message);
+  void SendRequest(const std::string& method, const Json::Value& params);
+  void SendNotification(const std::string& method, const Json::Value& params);
+  void Send(const Json::Value& message);
+
+  const LoadConfig& config_;
+  StageTracker& tracker_;
+  boost::asio::io_context io_context_;
+  boost::beast::websocket::stream<boost::asio::ip::tcp::socket> websocket_;
+  std::thread reader_;
+  std::atomic<bool> stopping_;
+  std::atomic<uint64_t> requests_count_;
+  uint32_t next_request_id_;
+  std::set<std::string> allowed_devices_;
+};
+
+}  // namespace load_generator
+
+#endif  // TOOLS_LOAD_GENERATOR_FAKE_HMI_H_
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TOOLS_LOAD_GENERATOR_LOAD_CONFIG_H_
+#define TOOLS_LOAD_GENERATOR_LOAD_CONFIG_H_
+
+#include <stdint.h>
+#include <string>
+
+namespace load_generator {
+
+/**
+ * @brief Parameters of load generator run, see help of loadGenerator
+ */
+struct LoadConfig {
+  LoadConfig()
+      : host("127.0.0.1")
+      , tcp_port(12345)
+      , hmi_port(8087)
+      , apps_count(1)
+      , duration_sec(10)
+      , in_flight(1)
+      , rate(0)
+      , mix("Show=60,AddCommand=30,PutFile=10")
+      , put_file_size(1024)
+      , frame_size(1488)
+      , response_timeout_ms(10000)
+      , hmi_startup_ms(2000) {}
+
+  std::string host;
+  uint16_t tcp_port;
+  uint16_t hmi_port;
+  uint32_t apps_count;
+  uint32_t duration_sec;
+  /**
+   * @brief Maximum number of requests each app waits responses for
+   */
+  uint32_t in_flight;
+  /**
+   * @brief Requests per second sent by each app, 0 means as fast as
+   * responses come
+   */
+  uint32_t rate;
+  std::string mix;
+  size_t put_file_size;
+  /**
+   * @brief Maximum payload of frame sent by apps, bigger messages are
+   * sent as multiframes
+   */
+  size_t frame_size;
+  uint32_t response_timeout_ms;
+  /**
+   * @brief Time given to core to finish HMI initialization before apps
+   * connect
+   */
+  uint32_t hmi_startup_ms;
+  /**
+   * @brief File for JSON report, not written if empty
+   */
+  std::string report_file;
+};
+
+}  // namespace load_generator
+
+#endif  // TOOLS_LOAD_GENERATOR_LOAD_CONFIG_H_
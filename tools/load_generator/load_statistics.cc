@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "load_statistics.h"
+
+#include <iomanip>
+
+#include "json/json.h"
+
+namespace load_generator {
+
+using utils::LatencyHistogram;
+
+namespace {
+const double kPercentiles[] = {50.0, 90.0, 99.0, 99.9};
+
+double ToMilliseconds(const uint64_t micros) {
+  return micros / 1000.0;
+}
+
+void PrintHistogramRow(std::ostream& output,
+                       const std::string& name,
+                       const LatencyHistogram::Snapshot& histogram) {
+  output << "  " << std::left << std::setw(14) << name << std::right
+         << std::setw(10) << histogram.count << std::setw(10)
+         << ToMilliseconds(static_cast<uint64_t>(histogram.Mean()));
+  for (const double percentile : kPercentiles) {
+    output << std::setw(10)
+           << ToMilliseconds(histogram.ValueAtPercentile(percentile));
+  }
+  output << std::setw(10) << ToMilliseconds(histogram.max) << '\n';
+}
+
+Json::Value HistogramToJson(const LatencyHistogram::Snapshot& histogram) {
+  Json::Value result(Json::objectValue);
+  result["count"] = Json::UInt64(histogram.count);
+  result["min_us"] = Json::UInt64(histogram.min);
+  result["max_us"] = Json::UInt64(histogram.max);
+  result["mean_us"] = histogram.Mean();
+  result["p50_us"] = Json::UInt64(histogram.ValueAtPercentile(50.0));
+  result["p90_us"] = Json::UInt64(histogram.ValueAtPercentile(90.0));
+  result["p99_us"] = Json::UInt64(histogram.ValueAtPercentile(99.0));
+  result["p999_us"] = Json::UInt64(histogram.ValueAtPercentile(99.9));
+  Json::Value& buckets = result["buckets"] = Json::Value(Json::arrayValue);
+  for (size_t i = 0; i < histogram.buckets.size(); ++i) {
+    if (!histogram.buckets[i]) {
+      continue;
+    }
+    Json::Value item(Json::arrayValue);
+    item.append(Json::UInt64(LatencyHistogram::BucketUpperBound(i)));
+    item.append(Json::UInt64(histogram.buckets[i]));
+    buckets.append(item);
+  }
+  return result;
+}
+}  // namespace
+
+const char* StageName(const Stage stage) {
+  switch (stage) {
+    case kStageTotal:
+      return "total";
+    case kStageMobileToHmi:
+      return "mobile_to_hmi";
+    case kStageHmiToMobile:
+      return "hmi_to_mobile";
+    default:
+      return "unknown";
+  }
+}
+
+void RpcStatistics::Merge(const RpcStatistics& other) {
+  sent += other.sent;
+  succeeded += other.succeeded;
+  for (const auto& failure : other.failures) {
+    failures[failure.first] += failure.second;
+  }
+  for (size_t i = 0; i < kStagesCount; ++i) {
+    stages[i].Merge(other.stages[i]);
+  }
+}
+
+void LoadStatistics::Merge(const LoadStatistics& other) {
+  for (const auto& rpc : other.rpcs_) {
+    rpcs_[rpc.first].Merge(rpc.second);
+  }
+}
+
+void LoadStatistics::PrintTable(std::ostream& output,
+                                const double duration_sec) const {
+  output << std::fixed << std::setprecision(2);
+  for (const auto& item : rpcs_) {
+    const RpcStatistics& rpc = item.second;
+    output << item.first << ": sent " << rpc.sent << ", succeeded "
+           << rpc.succeeded << ", "
+           << (duration_sec > 0 ? rpc.succeeded / duration_sec : 0.0)
+           << " rpc/s\n";
+    for (const auto& failure : rpc.failures) {
+      output << "  " << failure.first << ": " << failure.second << '\n';
+    }
+    output << "  " << std::left << std::setw(14) << "stage, ms" << std::right
+           << std::setw(10) << "count" << std::setw(10) << "mean"
+           << std::setw(10) << "p50" << std::setw(10) << "p90"
+           << std::setw(10) << "p99" << std::setw(10) << "p99.9"
+           << std::setw(10) << "max" << '\n';
+    LatencyHistogram::Snapshot snapshot;
+    for (size_t i = 0; i < kStagesCount; ++i) {
+      rpc.stages[i].TakeSnapshot(snapshot);
+      if (snapshot.count) {
+        PrintHistogramRow(output, StageName(static_cast<Stage>(i)), snapshot);
+      }
+    }
+  }
+}
+
+void LoadStatistics::WriteJson(std::ostream& output,
+                               const double duration_sec) const {
+  Json::Value root(Json::objectValue);
+  root["duration_sec"] = duration_sec;
+  Json::Value& rpcs = root["rpcs"] = Json::Value(Json::objectValue);
+  for (const auto& item : rpcs_) {
+    const RpcStatistics& rpc = item.second;
+    Json::Value& value = rpcs[item.first];
+    value["sent"] = Json::UInt64(rpc.sent);
+    value["succeeded"] = Json::UInt64(rpc.succeeded);
+    value["throughput"] =
+        duration_sec > 0 ? rpc.succeeded / duration_sec : 0.0;
+    Json::Value& failures = value["failures"] =
+        Json::Value(Json::objectValue);
+    for (const auto& failure : rpc.failures) {
+      failures[failure.first] = Json::UInt64(failure.second);
+    }
+    Json::Value& stages = value["stages"] = Json::Value(Json::objectValue);
+    LatencyHistogram::Snapshot snapshot;
+    for (size_t i = 0; i < kStagesCount; ++i) {
+      rpc.stages[i].TakeSnapshot(snapshot);
+      if (snapshot.count) {
+        stages[StageName(static_cast<Stage>(i))] = HistogramToJson(snapshot);
+      }
+    }
+  }
+  Json::StreamWriterBuilder writer_builder;
+  output << Json::writeString(writer_builder, root) << std::endl;
+}
+
+}  // namespace load_generator
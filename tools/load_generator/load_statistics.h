@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TOOLS_LOAD_GENERATOR_LOAD_STATISTICS_H_
+#define TOOLS_LOAD_GENERATOR_LOAD_STATISTICS_H_
+
+#include <stdint.h>
+#include <map>
+#include <ostream>
+#include <string>
+
+#include "utils/latency_histogram.h"
+
+namespace load_generator {
+
+/**
+ * @brief Stages of RPC processing measured by load generator
+ */
+enum Stage {
+  /**
+   * @brief From writing request into mobile socket till reading response
+   */
+  kStageTotal = 0,
+  /**
+   * @brief From writing request into mobile socket till HMI receives
+   * request (or notification) caused by it
+   */
+  kStageMobileToHmi,
+  /**
+   * @brief From HMI response till reading response from mobile socket
+   */
+  kStageHmiToMobile,
+  kStagesCount
+};
+
+const char* StageName(const Stage stage);
+
+/**
+ * @brief Results of single RPC type
+ */
+struct RpcStatistics {
+  RpcStatistics() : sent(0), succeeded(0) {}
+
+  void Merge(const RpcStatistics& other);
+
+  uint64_t sent;
+  uint64_t succeeded;
+  /**
+   * @brief Failed responses by result code, "TIMED_OUT" is used for
+   * requests without response
+   */
+  std::map<std::string, uint64_t> failures;
+  utils::LatencyHistogram stages[kStagesCount];
+};
+
+/**
+ * @brief Results of whole run or its part, not thread-safe
+ */
+class LoadStatistics {
+ public:
+  RpcStatistics& rpc(const std::string& name) {
+    return rpcs_[name];
+  }
+
+  void Merge(const LoadStatistics& other);
+
+  /**
+   * @brief Prints throughput and latency percentiles table
+   * @param duration_sec Duration of measurement
+   */
+  void PrintTable(std::ostream& output, const double duration_sec) const;
+
+  /**
+   * @brief Writes results including histogram buckets in JSON format
+   * @param duration_sec Duration of measurement
+   */
+  void WriteJson(std::ostream& output, const double duration_sec) const;
+
+ private:
+  std::map<std::string, RpcStatistics> rpcs_;
+};
+
+}  // namespace load_generator
+
+#endif  // TOOLS_LOAD_GENERATOR_LOAD_STATISTICS_H_
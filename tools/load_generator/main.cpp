@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <getopt.h>
+#include <stdlib.h>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fake_hmi.h"
+#include "load_config.h"
+#include "load_statistics.h"
+#include "mobile_app.h"
+#include "rpc_mix.h"
+#include "stage_tracker.h"
+
+namespace {
+
+enum ResultCode { SUCCESS = 0, WRONG_ARGUMENTS, HMI_FAILED, APPS_FAILED };
+
+void help(const load_generator::LoadConfig& defaults) {
+  std::cout
+      << "Usage:" << std::endl
+      << "./loadGenerator [options]" << std::endl
+      << "Connects to locally running core as fake HMI and a number of"
+      << std::endl
+      << "mobile apps, sends RPC mix and reports throughput and latency"
+      << std::endl
+      << "of every RPC per pipeline stage." << std::endl
+      << "Core must be started without other HMI connected." << std::endl
+      << "Options:" << std::endl
+      << "  --host <address>      core address [" << defaults.host << "]"
+      << std::endl
+      << "  --tcp-port <port>     TCP transport adapter port ["
+      << defaults.tcp_port << "]" << std::endl
+      << "  --hmi-port <port>     HMI WebSocket port [" << defaults.hmi_port
+      << "]" << std::endl
+      << "  --apps <count>        number of mobile apps ["
+      << defaults.apps_count << "]" << std::endl
+      << "  --duration <sec>      load duration [" << defaults.duration_sec
+      << "]" << std::endl
+      << "  --mix <Name=weight,>  RPC mix [" << defaults.mix << "]"
+      << std::endl
+      << "                        supported RPCs: "
+      << load_generator::RpcMix::SupportedRpcs() << std::endl
+      << "  --in-flight <count>   requests each app keeps in flight ["
+      << defaults.in_flight << "]" << std::endl
+      << "  --rate <rps>          requests per second of each app, 0 is"
+      << std::endl
+      << "                        unlimited [" << defaults.rate << "]"
+      << std::endl
+      << "  --put-file-size <b>   PutFile data size ["
+      << defaults.put_file_size << "]" << std::endl
+      << "  --frame-size <b>      max frame payload of apps ["
+      << defaults.frame_size << "]" << std::endl
+      << "  --timeout <ms>        response timeout ["
+      << defaults.response_timeout_ms << "]" << std::endl
+      << "  --hmi-startup <ms>    delay between HMI and apps start ["
+      << defaults.hmi_startup_ms << "]" << std::endl
+      << "  --report <file>       write JSON report with histograms"
+      << std::endl;
+}
+
+bool ParseArguments(int argc,
+                    char** argv,
+                    load_generator::LoadConfig& config) {
+  enum {
+    kHost = 1,
+    kTcpPort,
+    kHmiPort,
+    kApps,
+    kDuration,
+    kMix,
+    kInFlight,
+    kRate,
+    kPutFileSize,
+    kFrameSize,
+    kTimeout,
+    kHmiStartup,
+    kReport,
+    kHelp
+  };
+  const struct option options[] = {
+      {"host", required_argument, 0, kHost},
+      {"tcp-port", required_argument, 0, kTcpPort},
+      {"hmi-port", required_argument, 0, kHmiPort},
+      {"apps", required_argument, 0, kApps},
+      {"duration", required_argument, 0, kDuration},
+      {"mix", required_argument, 0, kMix},
+      {"in-flight", required_argument, 0, kInFlight},
+      {"rate", required_argument, 0, kRate},
+      {"put-file-size", required_argument, 0, kPutFileSize},
+      {"frame-size", required_argument, 0, kFrameSize},
+      {"timeout", required_argument, 0, kTimeout},
+      {"hmi-startup", required_argument, 0, kHmiStartup},
+      {"report", required_argument, 0, kReport},
+      {"help", no_argument, 0, kHelp},
+      {0, 0, 0, 0}};
+  int option = 0;
+  while (-1 != (option = getopt_long(argc, argv, "", options, NULL))) {
+    switch (option) {
+      case kHost:
+        config.host = optarg;
+        break;
+      case kTcpPort:
+        config.tcp_port = static_cast<uint16_t>(atoi(optarg));
+        break;
+      case kHmiPort:
+        config.hmi_port = static_cast<uint16_t>(atoi(optarg));
+        break;
+      case kApps:
+        config.apps_count = static_cast<uint32_t>(atoi(optarg));
+        break;
+      case kDuration:
+        config.duration_sec = static_cast<uint32_t>(atoi(optarg));
+        break;
+      case kMix:
+        config.mix = optarg;
+        break;
+      case kInFlight:
+        config.in_flight = static_cast<uint32_t>(atoi(optarg));
+        break;
+      case kRate:
+        config.rate = static_cast<uint32_t>(atoi(optarg));
+        break;
+      case kPutFileSize:
+        config.put_file_size = static_cast<size_t>(atoi(optarg));
+        break;
+      case kFrameSize:
+        config.frame_size = static_cast<size_t>(atoi(optarg));
+        break;
+      case kTimeout:
+        config.response_timeout_ms = static_cast<uint32_t>(atoi(optarg));
+        break;
+      case kHmiStartup:
+        config.hmi_startup_ms = static_cast<uint32_t>(atoi(optarg));
+        break;
+      case kReport:
+        config.report_file = optarg;
+        break;
+      default:
+        return false;
+    }
+  }
+  return optind == argc && config.apps_count > 0 && config.in_flight > 0 &&
+         config.frame_size > 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  using namespace load_generator;
+
+  LoadConfig config;
+  if (!ParseArguments(argc, argv, config)) {
+    help(LoadConfig());
+    exit(WRONG_ARGUMENTS);
+  }
+  RpcMix mix;
+  if (!mix.Parse(config.mix)) {
+    std::cerr << "Wrong RPC mix " << config.mix << std::endl;
+    help(LoadConfig());
+    exit(WRONG_ARGUMENTS);
+  }
+
+  StageTracker tracker;
+  FakeHmi hmi(config, tracker);
+  if (!hmi.Start()) {
+    exit(HMI_FAILED);
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(config.hmi_startup_ms));
+
+  std::vector<std::unique_ptr<MobileApp> > apps;
+  for (uint32_t i = 0; i < config.apps_count; ++i) {
+    std::unique_ptr<MobileApp> app(new MobileApp(i, config, mix, tracker));
+    if (app->Connect() && app->Register()) {
+      apps.push_back(std::move(app));
+    }
+  }
+  if (apps.empty()) {
+    std::cerr << "No app is registered" << std::endl;
+    exit(APPS_FAILED);
+  }
+  std::cout << apps.size() << " of " << config.apps_count
+            << " apps are registered, running load for "
+            << config.duration_sec << " s" << std::endl;
+
+  const Clock::time_point start = Clock::now();
+  const Clock::time_point deadline =
+      start + std::chrono::seconds(config.duration_sec);
+  std::vector<std::thread> threads;
+  for (auto& app : apps) {
+    threads.push_back(
+        std::thread(&MobileApp::RunLoad, app.get(), deadline));
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  const double duration_sec =
+      std::chrono::duration<double>(Clock::now() - start).count();
+
+  LoadStatistics statistics;
+  for (auto& app : apps) {
+    app->Disconnect();
+    statistics.Merge(app->statistics());
+  }
+  hmi.Stop();
+
+  statistics.PrintTable(std::cout, duration_sec);
+  std::cout << "HMI answered " << hmi.requests_count() << " requests"
+            << std::endl;
+  if (!config.report_file.empty()) {
+    std::ofstream report(config.report_file.c_str());
+    statistics.WriteJson(report, duration_sec);
+  }
+  return SUCCESS;
+}
@@ -0,0 +1,544 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mobile_app.h"
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <iostream>
+
+#include "json/json.h"
+#include "protocol/common.h"
+#include "utils/jsoncpp_reader_wrapper.h"
+
+namespace load_generator {
+
+using namespace protocol_handler;
+
+namespace {
+const uint8_t kProtocolVersion = PROTOCOL_VERSION_3;
+const size_t kRpcHeaderSize = 12;
+const size_t kFirstFrameDataSize = 8;
+// Frames bigger than that are treated as broken stream
+const uint32_t kMaxFrameSize = 16 * 1024 * 1024;
+
+enum RpcType { kRpcRequest = 0, kRpcResponse = 1, kRpcNotification = 2 };
+
+const char kRegisterAppInterface[] = "RegisterAppInterface";
+const char kTimedOut[] = "TIMED_OUT";
+const std::chrono::milliseconds kExpirationCheckPeriod(100);
+
+void WriteUInt32(uint8_t* out, const uint32_t value) {
+  out[0] = static_cast<uint8_t>(value >> 24);
+  out[1] = static_cast<uint8_t>(value >> 16);
+  out[2] = static_cast<uint8_t>(value >> 8);
+  out[3] = static_cast<uint8_t>(value);
+}
+
+uint32_t ReadUInt32(const uint8_t* data) {
+  return (static_cast<uint32_t>(data[0]) << 24) |
+         (static_cast<uint32_t>(data[1]) << 16) |
+         (static_cast<uint32_t>(data[2]) << 8) | data[3];
+}
+
+uint64_t Micros(const Clock::duration duration) {
+  const int64_t micros =
+      std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+  return micros > 0 ? static_cast<uint64_t>(micros) : 0;
+}
+}  // namespace
+
+MobileApp::MobileApp(const uint32_t index,
+                     const LoadConfig& config,
+                     const RpcMix& mix,
+                     StageTracker& tracker)
+    : index_(index)
+    , config_(config)
+    , mix_(mix)
+    , tracker_(tracker)
+    , generator_(index)
+    , socket_(-1)
+    , next_message_id_(1)
+    , service_started_(false)
+    , connection_closed_(false)
+    , registered_(false)
+    , session_id_(0)
+    , protocol_version_(kProtocolVersion)
+    , next_correlation_id_(1) {}
+
+MobileApp::~MobileApp() {
+  Disconnect();
+}
+
+bool MobileApp::Connect() {
+  struct addrinfo hints = {};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo* address = NULL;
+  const std::string port = std::to_string(config_.tcp_port);
+  if (0 != getaddrinfo(config_.host.c_str(), port.c_str(), &hints, &address)) {
+    std::cerr << "Failed to resolve " << config_.host << std::endl;
+    return false;
+  }
+  socket_ = socket(address->ai_family, address->ai_socktype, 0);
+  const bool connected = socket_ >= 0 &&
+                         0 == connect(socket_,
+                                      address->ai_addr,
+                                      address->ai_addrlen);
+  freeaddrinfo(address);
+  if (!connected) {
+    std::cerr << "App " << index_ << " failed to connect to " << config_.host
+              << ':' << config_.tcp_port << std::endl;
+    return false;
+  }
+
+  reader_ = std::thread(&MobileApp::ReaderMain, this);
+
+  const FrameHeader start_service = {kProtocolVersion,
+                                     FRAME_TYPE_CONTROL,
+                                     SERVICE_TYPE_RPC,
+                                     FRAME_DATA_START_SERVICE,
+                                     0,
+                                     0,
+                                     0};
+  if (!SendFrame(start_service, NULL)) {
+    return false;
+  }
+  std::unique_lock<std::mutex> lock(lock_);
+  if (!WaitFor(lock, [this]() { return service_started_; })) {
+    std::cerr << "App " << index_ << " failed to start RPC service"
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool MobileApp::Register() {
+  OutgoingRpc rpc;
+  uint32_t correlation_id = 0;
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    correlation_id = next_correlation_id_++;
+  }
+  const RequestContext context = {index_,
+                                  correlation_id,
+                                  StageTracker::Token(index_, correlation_id),
+                                  0};
+  RpcMix::BuildRegisterAppInterface(context, rpc);
+  if (!SendRpc(correlation_id, rpc, kRegisterAppInterface, true)) {
+    return false;
+  }
+
+  std::unique_lock<std::mutex> lock(lock_);
+  WaitFor(lock, [this, correlation_id]() {
+    return 0 == pending_.count(correlation_id);
+  });
+  if (!registered_) {
+    std::cerr << "App " << index_ << " failed to register" << std::endl;
+    return false;
+  }
+  // Most RPCs are disallowed in NONE, fake HMI activates every app
+  if (!WaitFor(lock, [this]() {
+        return !hmi_level_.empty() && "NONE" != hmi_level_;
+      })) {
+    std::cerr << "App " << index_ << " was not activated, HMI level is "
+              << hmi_level_ << std::endl;
+  }
+  return true;
+}
+
+void MobileApp::RunLoad(const Clock::time_point deadline) {
+  const Clock::duration interval =
+      config_.rate ? std::chrono::duration_cast<Clock::duration>(
+                         std::chrono::seconds(1)) /
+                         config_.rate
+                   : Clock::duration::zero();
+  Clock::time_point next_send = Clock::now();
+
+  while (Clock::now() < deadline) {
+    if (config_.rate) {
+      std::this_thread::sleep_until(std::min(next_send, deadline));
+      next_send += interval;
+      if (Clock::now() >= deadline) {
+        break;
+      }
+    }
+
+    uint32_t correlation_id = 0;
+    {
+      std::unique_lock<std::mutex> lock(lock_);
+      while (!connection_closed_ && pending_.size() >= config_.in_flight &&
+             Clock::now() < deadline) {
+        // Wakes up periodically to drop requests core never answered
+        condition_.wait_until(
+            lock,
+            std::min(deadline, Clock::now() + kExpirationCheckPeriod));
+        ExpireRequests(Clock::now());
+      }
+      if (connection_closed_ || Clock::now() >= deadline) {
+        break;
+      }
+      correlation_id = next_correlation_id_++;
+    }
+
+    const std::string& name = mix_.Pick(generator_);
+    const RequestContext context = {index_,
+                                    correlation_id,
+                                    StageTracker::Token(index_, correlation_id),
+                                    config_.put_file_size};
+    OutgoingRpc rpc;
+    RpcMix::BuildRequest(name, context, rpc);
+    if (!SendRpc(correlation_id, rpc, name, true)) {
+      break;
+    }
+  }
+
+  std::unique_lock<std::mutex> lock(lock_);
+  WaitFor(lock, [this]() { return pending_.empty(); });
+  ExpireRequests(Clock::time_point::max());
+}
+
+void MobileApp::Disconnect() {
+  if (socket_ < 0) {
+    return;
+  }
+  bool registered = false;
+  uint32_t correlation_id = 0;
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    registered = registered_ && !connection_closed_;
+    correlation_id = next_correlation_id_++;
+  }
+  if (registered) {
+    OutgoingRpc rpc;
+    RpcMix::BuildUnregisterAppInterface(rpc);
+    if (SendRpc(correlation_id, rpc, "UnregisterAppInterface", false)) {
+      std::unique_lock<std::mutex> lock(lock_);
+      WaitFor(lock, [this, correlation_id]() {
+        return 0 == pending_.count(correlation_id);
+      });
+    }
+  }
+
+  shutdown(socket_, SHUT_RDWR);
+  if (reader_.joinable()) {
+    reader_.join();
+  }
+  close(socket_);
+  socket_ = -1;
+}
+
+template <typename Predicate>
+bool MobileApp::WaitFor(std::unique_lock<std::mutex>& lock,
+                        const Predicate& predicate) {
+  const Clock::time_point deadline =
+      Clock::now() + std::chrono::milliseconds(config_.response_timeout_ms);
+  return condition_.wait_until(lock, deadline, [this, &predicate]() {
+    return connection_closed_ || predicate();
+  }) && !connection_closed_;
+}
+
+void MobileApp::ExpireRequests(const Clock::time_point now) {
+  const Clock::duration timeout =
+      std::chrono::milliseconds(config_.response_timeout_ms);
+  for (auto it = pending_.begin(); it != pending_.end();) {
+    if (now == Clock::time_point::max() || now - it->second.sent > timeout) {
+      if (it->second.measured) {
+        ++statistics_.rpc(it->second.name).failures[kTimedOut];
+      }
+      it = pending_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+bool MobileApp::SendFrame(const FrameHeader& header, const uint8_t* data) {
+  uint8_t buffer[PROTOCOL_HEADER_V2_SIZE];
+  buffer[0] = static_cast<uint8_t>((header.version << 4) | header.frame_type);
+  buffer[1] = header.service_type;
+  buffer[2] = header.frame_data;
+  buffer[3] = header.session_id;
+  WriteUInt32(buffer + 4, header.data_size);
+  WriteUInt32(buffer + 8, header.message_id);
+
+  std::lock_guard<std::mutex> guard(send_lock_);
+  const struct {
+    const uint8_t* data;
+    size_t size;
+  } parts[] = {{buffer, sizeof(buffer)}, {data, header.data_size}};
+  for (const auto& part : parts) {
+    size_t sent = 0;
+    while (sent < part.size) {
+      const ssize_t result =
+          send(socket_, part.data + sent, part.size - sent, MSG_NOSIGNAL);
+      if (result <= 0) {
+        return false;
+      }
+      sent += static_cast<size_t>(result);
+    }
+  }
+  return true;
+}
+
+bool MobileApp::SendRpc(const uint32_t correlation_id,
+                        const OutgoingRpc& rpc,
+                        const std::string& name,
+                        const bool measured) {
+  std::vector<uint8_t> payload(kRpcHeaderSize);
+  WriteUInt32(&payload[0], rpc.function_id);
+  payload[0] |= static_cast<uint8_t>(kRpcRequest << 4);
+  WriteUInt32(&payload[4], correlation_id);
+  WriteUInt32(&payload[8], static_cast<uint32_t>(rpc.json.size()));
+  payload.insert(payload.end(), rpc.json.begin(), rpc.json.end());
+  payload.insert(
+      payload.end(), rpc.binary_data.begin(), rpc.binary_data.end());
+
+  uint8_t session_id = 0;
+  uint8_t version = 0;
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    session_id = session_id_;
+    version = protocol_version_;
+    const PendingRequest request = {name, Clock::now(), measured};
+    pending_[correlation_id] = request;
+    if (measured) {
+      ++statistics_.rpc(name).sent;
+    }
+  }
+
+  FrameHeader header = {version,
+                        FRAME_TYPE_SINGLE,
+                        SERVICE_TYPE_RPC,
+                        FRAME_DATA_SINGLE,
+                        session_id,
+                        static_cast<uint32_t>(payload.size()),
+                        0};
+  {
+    std::lock_guard<std::mutex> guard(send_lock_);
+    header.message_id = next_message_id_++;
+  }
+  if (payload.size() <= config_.frame_size) {
+    return SendFrame(header, &payload[0]);
+  }
+
+  const size_t frames_count =
+      (payload.size() + config_.frame_size - 1) / config_.frame_size;
+  uint8_t first_frame_data[kFirstFrameDataSize];
+  WriteUInt32(first_frame_data, static_cast<uint32_t>(payload.size()));
+  WriteUInt32(first_frame_data + 4, static_cast<uint32_t>(frames_count));
+  header.frame_type = FRAME_TYPE_FIRST;
+  header.frame_data = FRAME_DATA_FIRST;
+  header.data_size = kFirstFrameDataSize;
+  if (!SendFrame(header, first_frame_data)) {
+    return false;
+  }
+
+  header.frame_type = FRAME_TYPE_CONSECUTIVE;
+  for (size_t i = 0; i < frames_count; ++i) {
+    const size_t offset = i * config_.frame_size;
+    const bool is_last_frame = frames_count - 1 == i;
+    header.frame_data =
+        is_last_frame ? FRAME_DATA_LAST_CONSECUTIVE
+                      : static_cast<uint8_t>(i % FRAME_DATA_MAX_CONSECUTIVE +
+                                             1);
+    header.data_size = static_cast<uint32_t>(
+        std::min(config_.frame_size, payload.size() - offset));
+    if (!SendFrame(header, &payload[offset])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool MobileApp::ReadAll(uint8_t* buffer, const size_t size) {
+  size_t received = 0;
+  while (received < size) {
+    const ssize_t result = recv(socket_, buffer + received, size - received, 0);
+    if (result <= 0) {
+      return false;
+    }
+    received += static_cast<size_t>(result);
+  }
+  return true;
+}
+
+void MobileApp::ReaderMain() {
+  uint8_t buffer[PROTOCOL_HEADER_V2_SIZE];
+  std::vector<uint8_t> data;
+  while (ReadAll(buffer, sizeof(buffer))) {
+    const FrameHeader header = {static_cast<uint8_t>(buffer[0] >> 4),
+                                static_cast<uint8_t>(buffer[0] & 0x07),
+                                buffer[1],
+                                buffer[2],
+                                buffer[3],
+                                ReadUInt32(buffer + 4),
+                                ReadUInt32(buffer + 8)};
+    if (header.data_size > kMaxFrameSize) {
+      std::cerr << "App " << index_ << " received broken frame" << std::endl;
+      break;
+    }
+    data.resize(header.data_size);
+    if (!data.empty() && !ReadAll(&data[0], data.size())) {
+      break;
+    }
+
+    switch (header.frame_type) {
+      case FRAME_TYPE_CONTROL:
+        HandleControlFrame(header);
+        break;
+      case FRAME_TYPE_SINGLE:
+        HandleRpcPayload(data);
+        break;
+      case FRAME_TYPE_FIRST:
+        multiframes_[header.message_id].clear();
+        break;
+      case FRAME_TYPE_CONSECUTIVE: {
+        std::vector<uint8_t>& message = multiframes_[header.message_id];
+        message.insert(message.end(), data.begin(), data.end());
+        if (FRAME_DATA_LAST_CONSECUTIVE == header.frame_data) {
+          HandleRpcPayload(message);
+          multiframes_.erase(header.message_id);
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  }
+
+  std::lock_guard<std::mutex> guard(lock_);
+  connection_closed_ = true;
+  condition_.notify_all();
+}
+
+void MobileApp::HandleControlFrame(const FrameHeader& header) {
+  switch (header.frame_data) {
+    case FRAME_DATA_START_SERVICE_ACK: {
+      std::lock_guard<std::mutex> guard(lock_);
+      session_id_ = header.session_id;
+      protocol_version_ = header.version;
+      service_started_ = true;
+      condition_.notify_all();
+      break;
+    }
+    case FRAME_DATA_HEART_BEAT: {
+      const FrameHeader ack = {header.version,
+                               FRAME_TYPE_CONTROL,
+                               header.service_type,
+                               FRAME_DATA_HEART_BEAT_ACK,
+                               header.session_id,
+                               0,
+                               header.message_id};
+      SendFrame(ack, NULL);
+      break;
+    }
+    case FRAME_DATA_START_SERVICE_NACK:
+    case FRAME_DATA_END_SERVICE: {
+      std::lock_guard<std::mutex> guard(lock_);
+      connection_closed_ = true;
+      condition_.notify_all();
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void MobileApp::HandleRpcPayload(const std::vector<uint8_t>& payload) {
+  const Clock::time_point received = Clock::now();
+  if (payload.size() < kRpcHeaderSize) {
+    return;
+  }
+  const uint8_t rpc_type = payload[0] >> 4;
+  const uint32_t function_id = ReadUInt32(&payload[0]) & 0x0FFFFFFF;
+  const uint32_t correlation_id = ReadUInt32(&payload[4]);
+  const uint32_t json_size = ReadUInt32(&payload[8]);
+  if (kRpcHeaderSize + json_size > payload.size()) {
+    return;
+  }
+
+  Json::Value message;
+  utils::JsonReader reader;
+  if (!reader.parse(std::string(payload.begin() + kRpcHeaderSize,
+                                payload.begin() + kRpcHeaderSize + json_size),
+                    &message)) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> guard(lock_);
+  if (kRpcNotification == rpc_type &&
+      function_id::kOnHMIStatus == function_id) {
+    hmi_level_ = message["hmiLevel"].asString();
+    condition_.notify_all();
+    return;
+  }
+  if (kRpcResponse != rpc_type) {
+    return;
+  }
+
+  auto it = pending_.find(correlation_id);
+  if (pending_.end() == it) {
+    return;
+  }
+  const PendingRequest request = it->second;
+  pending_.erase(it);
+  condition_.notify_all();
+
+  const bool success = message["success"].asBool();
+  if (function_id::kRegisterAppInterface == function_id) {
+    registered_ = success;
+  }
+  if (!request.measured) {
+    return;
+  }
+
+  RpcStatistics& statistics = statistics_.rpc(request.name);
+  if (success) {
+    ++statistics.succeeded;
+  } else {
+    ++statistics.failures[message["resultCode"].asString()];
+  }
+  statistics.stages[kStageTotal].Record(Micros(received - request.sent));
+  StageTracker::HmiTimes hmi_times;
+  if (tracker_.Take(StageTracker::Key(index_, correlation_id), hmi_times)) {
+    statistics.stages[kStageMobileToHmi].Record(
+        Micros(hmi_times.received - request.sent));
+    statistics.stages[kStageHmiToMobile].Record(
+        Micros(received - hmi_times.responded));
+  }
+}
+
+}  // namespace load_generator
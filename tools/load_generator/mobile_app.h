@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TOOLS_LOAD_GENERATOR_MOBILE_APP_H_
+#define TOOLS_LOAD_GENERATOR_MOBILE_APP_H_
+
+#include <stdint.h>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "load_config.h"
+#include "load_statistics.h"
+#include "rpc_mix.h"
+#include "stage_tracker.h"
+
+namespace load_generator {
+
+/**
+ * @brief Simulated mobile application connected to core through the TCP
+ * transport adapter. Speaks SDL protocol version 3 over single RPC service
+ */
+class MobileApp {
+ public:
+  MobileApp(const uint32_t index,
+            const LoadConfig& config,
+            const RpcMix& mix,
+            StageTracker& tracker);
+  ~MobileApp();
+
+  /**
+   * @brief Opens connection and starts RPC service
+   * @return false if connection failed or service was not started
+   */
+  bool Connect();
+
+  /**
+   * @brief Registers app and waits till HMI activates it
+   * @return false if registration failed
+   */
+  bool Register();
+
+  /**
+   * @brief Sends requests of the mix till deadline, then waits for
+   * responses to requests already sent
+   */
+  void RunLoad(const Clock::time_point deadline);
+
+  /**
+   * @brief Unregisters app and closes connection
+   */
+  void Disconnect();
+
+  /**
+   * @brief Gets results, must be called after Disconnect()
+   */
+  const LoadStatistics& statistics() const {
+    return statistics_;
+  }
+
+ private:
+  struct FrameHeader {
+    uint8_t version;
+    uint8_t frame_type;
+    uint8_t service_type;
+    uint8_t frame_data;
+    uint8_t session_id;
+    uint32_t data_size;
+    uint32_t message_id;
+  };
+
+  struct PendingRequest {
+    std::string name;
+    Clock::time_point sent;
+    bool measured;
+  };
+
+  bool SendFrame(const FrameHeader& header, const uint8_t* data);
+  bool SendRpc(const uint32_t correlation_id,
+               const OutgoingRpc& rpc,
+               const std::string& name,
+               const bool measured);
+  bool ReadAll(uint8_t* buffer, const size_t size);
+
+  void ReaderMain();
+  void HandleControlFrame(const FrameHeader& header);
+  void HandleRpcPayload(const std::vector<uint8_t>& payload);
+
+  /**
+   * @brief Accounts requests waiting for response longer than timeout as
+   * failed, Clock::time_point::max() accounts all of them.
+   * Must be called with lock_ acquired
+   */
+  void ExpireRequests(const Clock::time_point now);
+
+  /**
+   * @brief Waits till predicate is true or timeout expires
+   */
+  template <typename Predicate>
+  bool WaitFor(std::unique_lock<std::mutex>& lock,
+               const Predicate& predicate);
+
+  const uint32_t index_;
+  const LoadConfig& config_;
+  const RpcMix& mix_;
+  StageTracker& tracker_;
+  std::mt19937 generator_;
+
+  int socket_;
+  std::thread reader_;
+  std::mutex send_lock_;
+  uint32_t next_message_id_;
+
+  std::mutex lock_;
+  std::condition_variable condition_;
+  bool service_started_;
+  bool connection_closed_;
+  bool registered_;
+  uint8_t session_id_;
+  uint8_t protocol_version_;
+  std::string hmi_level_;
+  uint32_t next_correlation_id_;
+  std::map<uint32_t, PendingRequest> pending_;
+  LoadStatistics statistics_;
+
+  /**
+   * @brief Multiframe messages being received, used by reader thread only
+   */
+  std::map<uint32_t, std::vector<uint8_t> > multiframes_;
+};
+
+}  // namespace load_generator
+
+#endif  // TOOLS_LOAD_GENERATOR_MOBILE_APP_H_
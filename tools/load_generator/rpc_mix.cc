@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rpc_mix.h"
+
+#include <stdlib.h>
+#include <sstream>
+
+#include "json/json.h"
+
+namespace load_generator {
+
+namespace {
+const char kShow[] = "Show";
+const char kAddCommand[] = "AddCommand";
+const char kPutFile[] = "PutFile";
+
+// Amount of distinct file names every app rotates, so PutFile overwrites
+// files instead of filling app storage
+const uint32_t kFileNamesCount = 8;
+
+std::string ToString(const Json::Value& value) {
+  Json::StreamWriterBuilder writer_builder;
+  writer_builder["indentation"] = "";
+  return Json::writeString(writer_builder, value);
+}
+
+void BuildShow(const RequestContext& context, OutgoingRpc& rpc) {
+  Json::Value params(Json::objectValue);
+  params["mainField1"] = context.token;
+  params["mainField2"] = "Load generator";
+  params["alignment"] = "CENTERED";
+  params["statusBar"] = "Playing";
+  params["mediaTrack"] = "7/12";
+  Json::Value& soft_buttons = params["softButtons"];
+  for (int i = 1; i <= 3; ++i) {
+    Json::Value button(Json::objectValue);
+    button["type"] = "TEXT";
+    button["text"] = "Button " + std::to_string(i);
+    button["softButtonID"] = i;
+    button["systemAction"] = "DEFAULT_ACTION";
+    button["isHighlighted"] = false;
+    soft_buttons.append(button);
+  }
+  rpc.function_id = function_id::kShow;
+  rpc.json = ToString(params);
+}
+
+void BuildAddCommand(const RequestContext& context, OutgoingRpc& rpc) {
+  Json::Value params(Json::objectValue);
+  params["cmdID"] = context.correlation_id;
+  params["menuParams"]["menuName"] = context.token;
+  rpc.function_id = function_id::kAddCommand;
+  rpc.json = ToString(params);
+}
+
+void BuildPutFile(const RequestContext& context, OutgoingRpc& rpc) {
+  Json::Value params(Json::objectValue);
+  params["syncFileName"] = "load_generator_" +
+                           std::to_string(context.correlation_id %
+                                          kFileNamesCount) +
+                           ".bin";
+  params["fileType"] = "BINARY";
+  params["persistentFile"] = false;
+  params["systemFile"] = false;
+  rpc.function_id = function_id::kPutFile;
+  rpc.json = ToString(params);
+  rpc.binary_data.resize(context.put_file_size);
+  for (size_t i = 0; i < rpc.binary_data.size(); ++i) {
+    rpc.binary_data[i] = static_cast<uint8_t>(i);
+  }
+}
+}  // namespace
+
+bool RpcMix::Parse(const std::string& description) {
+  names_.clear();
+  weights_.clear();
+  std::stringstream stream(description);
+  std::string item;
+  while (std::getline(stream, item, ',')) {
+    const size_t separator = item.find('=');
+    const std::string name = item.substr(0, separator);
+    const uint32_t weight =
+        std::string::npos == separator
+            ? 1
+            : static_cast<uint32_t>(atoi(item.c_str() + separator + 1));
+    if (name != kShow && name != kAddCommand && name != kPutFile) {
+      return false;
+    }
+    if (0 == weight) {
+      continue;
+    }
+    names_.push_back(name);
+    weights_.push_back(weight);
+  }
+  return !names_.empty();
+}
+
+const std::string& RpcMix::Pick(std::mt19937& generator) const {
+  std::discrete_distribution<size_t> distribution(weights_.begin(),
+                                                  weights_.end());
+  return names_[distribution(generator)];
+}
+
+bool RpcMix::BuildRequest(const std::string& name,
+                          const RequestContext& context,
+                          OutgoingRpc& rpc) {
+  rpc.binary_data.clear();
+  if (name == kShow) {
+    BuildShow(context, rpc);
+  } else if (name == kAddCommand) {
+    BuildAddCommand(context, rpc);
+  } else if (name == kPutFile) {
+    BuildPutFile(context, rpc);
+  } else {
+    return false;
+  }
+  return true;
+}
+
+void RpcMix::BuildRegisterAppInterface(const RequestContext& context,
+                                       OutgoingRpc& rpc) {
+  const std::string index = std::to_string(context.app_index);
+  Json::Value params(Json::objectValue);
+  params["syncMsgVersion"]["majorVersion"] = 7;
+  params["syncMsgVersion"]["minorVersion"] = 0;
+  params["syncMsgVersion"]["patchVersion"] = 0;
+  // Token goes to BasicCommunication.OnAppRegistered
+  params["appName"] = "LoadGen " + context.token;
+  params["ngnMediaScreenAppName"] = "LG" + index;
+  params["isMediaApplication"] = false;
+  params["languageDesired"] = "EN-US";
+  params["hmiDisplayLanguageDesired"] = "EN-US";
+  params["appHMIType"].append("DEFAULT");
+  params["appID"] = "LoadGen" + index;
+  params["fullAppID"] = "loadgen-" + index;
+  rpc.function_id = function_id::kRegisterAppInterface;
+  rpc.json = ToString(params);
+  rpc.binary_data.clear();
+}
+
+void RpcMix::BuildUnregisterAppInterface(OutgoingRpc& rpc) {
+  rpc.function_id = function_id::kUnregisterAppInterface;
+  rpc.json = "{}";
+  rpc.binary_data.clear();
+}
+
+std::string RpcMix::SupportedRpcs() {
+  return std::string(kShow) + ", " + kAddCommand + ", " + kPutFile;
+}
+
+}  // namespace load_generator
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TOOLS_LOAD_GENERATOR_RPC_MIX_H_
+#define TOOLS_LOAD_GENERATOR_RPC_MIX_H_
+
+#include <stdint.h>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace load_generator {
+
+/**
+ * @brief Function ids of MOBILE_API used by load generator
+ */
+namespace function_id {
+const uint32_t kRegisterAppInterface = 1;
+const uint32_t kUnregisterAppInterface = 2;
+const uint32_t kAddCommand = 5;
+const uint32_t kShow = 13;
+const uint32_t kPutFile = 32;
+const uint32_t kOnHMIStatus = 32768;
+}  // namespace function_id
+
+/**
+ * @brief Mobile request ready to be sent
+ */
+struct OutgoingRpc {
+  uint32_t function_id;
+  std::string json;
+  std::vector<uint8_t> binary_data;
+};
+
+/**
+ * @brief Parameters of requests of particular app
+ */
+struct RequestContext {
+  uint32_t app_index;
+  uint32_t correlation_id;
+  /**
+   * @brief Token to be put into request, see StageTracker
+   */
+  std::string token;
+  size_t put_file_size;
+};
+
+/**
+ * @brief Weighted set of RPCs apps send during the run
+ */
+class RpcMix {
+ public:
+  /**
+   * @brief Parses mix description "Name=weight,Name=weight"
+   * @return false if description is malformed or has unsupported RPC
+   */
+  bool Parse(const std::string& description);
+
+  /**
+   * @brief Randomly picks RPC respecting weights
+   */
+  const std::string& Pick(std::mt19937& generator) const;
+
+  /**
+   * @brief Builds request of RPC returned by Pick()
+   * @return false if RPC is not supported
+   */
+  static bool BuildRequest(const std::string& name,
+                           const RequestContext& context,
+                           OutgoingRpc& rpc);
+
+  /**
+   * @brief Builds RegisterAppInterface request of the app
+   */
+  static void BuildRegisterAppInterface(const RequestContext& context,
+                                        OutgoingRpc& rpc);
+
+  static void BuildUnregisterAppInterface(OutgoingRpc& rpc);
+
+  /**
+   * @brief Gets comma separated list of supported RPCs for help
+   */
+  static std::string SupportedRpcs();
+
+ private:
+  std::vector<std::string> names_;
+  std::vector<uint32_t> weights_;
+};
+
+}  // namespace load_generator
+
+#endif  // TOOLS_LOAD_GENERATOR_RPC_MIX_H_
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "stage_tracker.h"
+
+#include <stdlib.h>
+#include <sstream>
+
+namespace load_generator {
+
+namespace {
+const char kTokenPrefix[] = "lg#";
+const size_t kTokenPrefixSize = sizeof(kTokenPrefix) - 1;
+
+bool ParseNumber(const std::string& text, size_t& position, uint32_t& out) {
+  const char* begin = text.c_str() + position;
+  char* end = NULL;
+  const unsigned long value = strtoul(begin, &end, 10);
+  if (end == begin || '#' != *end) {
+    return false;
+  }
+  out = static_cast<uint32_t>(value);
+  position += (end - begin) + 1;
+  return true;
+}
+}  // namespace
+
+std::string StageTracker::Token(const uint32_t app_index,
+                                const uint32_t correlation_id) {
+  std::stringstream stream;
+  stream << kTokenPrefix << app_index << '#' << correlation_id << '#';
+  return stream.str();
+}
+
+void StageTracker::FindTokens(const std::string& message,
+                              std::vector<Key>& keys) {
+  size_t position = message.find(kTokenPrefix);
+  while (std::string::npos != position) {
+    position += kTokenPrefixSize;
+    Key key;
+    if (ParseNumber(message, position, key.first) &&
+        ParseNumber(message, position, key.second)) {
+      keys.push_back(key);
+    }
+    position = message.find(kTokenPrefix, position);
+  }
+}
+
+void StageTracker::OnHmiReceived(const Key& key,
+                                 const Clock::time_point time) {
+  std::lock_guard<std::mutex> guard(lock_);
+  auto result = times_.insert(std::make_pair(key, HmiTimes{time, time}));
+  if (!result.second && time > result.first->second.responded) {
+    // Another message of the same request, e.g. VR part of AddCommand
+    result.first->second.responded = time;
+  }
+}
+
+void StageTracker::OnHmiResponded(const Key& key,
+                                  const Clock::time_point time) {
+  std::lock_guard<std::mutex> guard(lock_);
+  auto it = times_.find(key);
+  if (times_.end() != it) {
+    it->second.responded = time;
+  }
+}
+
+bool StageTracker::Take(const Key& key, HmiTimes& times) {
+  std::lock_guard<std::mutex> guard(lock_);
+  auto it = times_.find(key);
+  if (times_.end() == it) {
+    return false;
+  }
+  times = it->second;
+  times_.erase(it);
+  return true;
+}
+
+}  // namespace load_generator
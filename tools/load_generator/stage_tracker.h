@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2021, Ford Motor Company
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the
+ * distribution.
+ *
+ * Neither the name of the Ford Motor Company nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TOOLS_LOAD_GENERATOR_STAGE_TRACKER_H_
+#define TOOLS_LOAD_GENERATOR_STAGE_TRACKER_H_
+
+#include <stdint.h>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace load_generator {
+
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * @brief Matches messages seen by fake HMI with mobile requests.
+ * Mobile requests carry text token "lg#<app>#<correlation id>#" in one of
+ * string parameters, core passes it to HMI unchanged, so HMI side finds
+ * which request caused a message without any knowledge of RPC semantics.
+ * Thread-safe class
+ */
+class StageTracker {
+ public:
+  /**
+   * @brief Moments HMI saw messages caused by single mobile request
+   */
+  struct HmiTimes {
+    Clock::time_point received;
+    /**
+     * @brief Moment of the last HMI response, equals to received if HMI
+     * got only notifications
+     */
+    Clock::time_point responded;
+  };
+
+  typedef std::pair<uint32_t, uint32_t> Key;
+
+  /**
+   * @brief Creates token to be put into request of the app
+   */
+  static std::string Token(const uint32_t app_index,
+                           const uint32_t correlation_id);
+
+  /**
+   * @brief Finds tokens in raw message received by HMI
+   * @param message Raw message text
+   * @param keys Output, keys of requests mentioned in the message
+   */
+  static void FindTokens(const std::string& message, std::vector<Key>& keys);
+
+  void OnHmiReceived(const Key& key, const Clock::time_point time);
+  void OnHmiResponded(const Key& key, const Clock::time_point time);
+
+  /**
+   * @brief Removes times recorded for request
+   * @return false if HMI did not see the request
+   */
+  bool Take(const Key& key, HmiTimes& times);
+
+ private:
+  std::mutex lock_;
+  std::map<Key, HmiTimes> times_;
+};
+
+}  // namespace load_generator
+
+#endif  // TOOLS_LOAD_GENERATOR_STAGE_TRACKER_H_